@@ -0,0 +1,99 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include <cmath>
+
+#include <MeshKernel/AveragingInterpolation.hpp>
+#include <MeshKernel/Mesh2D.hpp>
+
+#include <TestUtils/MakeMeshes.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace meshkernel;
+
+static void BM_AveragingInterpolationProperties(benchmark::State& state)
+{
+    const auto numberOfNodes = static_cast<UInt>(state.range(0));
+    const auto numberOfProperties = static_cast<UInt>(state.range(1));
+    const bool computeTogether = state.range(2) != 0;
+
+    auto mesh = MakeRectangularMeshForTesting(numberOfNodes, numberOfNodes, 1.0, Projection::cartesian);
+
+    // four samples for each face
+    std::vector<Sample> samples;
+    std::vector<std::vector<double>> sampleValues(numberOfProperties);
+    const UInt numberOfSamples = 2 * (numberOfNodes - 1);
+    for (UInt i = 0; i < numberOfSamples; ++i)
+    {
+        for (UInt j = 0; j < numberOfSamples; ++j)
+        {
+            const double x = 0.5 * i + 0.25;
+            const double y = 0.5 * j + 0.25;
+            samples.emplace_back(x, y, 0.0);
+
+            for (UInt p = 0; p < numberOfProperties; ++p)
+            {
+                sampleValues[p].emplace_back(std::sin(x + p) * std::cos(y));
+            }
+        }
+    }
+
+    for (auto _ : state)
+    {
+        if (computeTogether)
+        {
+            AveragingInterpolation averaging(*mesh, samples, AveragingInterpolation::Method::InverseWeightedDistance, Location::Faces, 1.0, false, false, 1);
+            benchmark::DoNotOptimize(averaging.ComputeProperties(sampleValues));
+        }
+        else
+        {
+            for (UInt p = 0; p < numberOfProperties; ++p)
+            {
+                for (UInt s = 0; s < samples.size(); ++s)
+                {
+                    samples[s].value = sampleValues[p][s];
+                }
+
+                AveragingInterpolation averaging(*mesh, samples, AveragingInterpolation::Method::InverseWeightedDistance, Location::Faces, 1.0, false, false, 1);
+                averaging.Compute();
+                benchmark::DoNotOptimize(averaging.GetFaceResults());
+            }
+        }
+    }
+
+    state.counters["faces"] = static_cast<double>(mesh->GetNumFaces());
+    state.counters["samples"] = static_cast<double>(samples.size());
+}
+
+BENCHMARK(BM_AveragingInterpolationProperties)
+    ->ArgNames({"nodes", "properties", "together"})
+    ->Args({200, 1, 0})
+    ->Args({200, 1, 1})
+    ->Args({200, 4, 0})
+    ->Args({200, 4, 1});
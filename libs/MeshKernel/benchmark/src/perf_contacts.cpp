@@ -0,0 +1,113 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include <MeshKernel/Contacts.hpp>
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Mesh1D.hpp>
+#include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/Polygons.hpp>
+#include <TestUtils/MakeMeshes.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <vector>
+
+using namespace meshkernel;
+
+/// @brief Creates a meandering 1d mesh crossing a square 2d mesh, partly running outside of it
+static std::unique_ptr<Mesh1D> MakeMeanderingMesh1D(double meshSize, double edgeLength)
+{
+    const auto numNodes = static_cast<UInt>(meshSize / edgeLength) + 1;
+
+    std::vector<Point> nodes(numNodes);
+    std::vector<Edge> edges(numNodes - 1);
+    for (UInt n = 0; n < numNodes; ++n)
+    {
+        const double x = static_cast<double>(n) * edgeLength;
+        nodes[n] = {x, meshSize * (0.5 + 0.6 * std::sin(4.0 * std::numbers::pi * x / meshSize))};
+        if (n > 0)
+        {
+            edges[n - 1] = {n - 1, n};
+        }
+    }
+
+    return std::make_unique<Mesh1D>(edges, nodes, Projection::cartesian);
+}
+
+static void BM_ComputeMultipleContacts(benchmark::State& state)
+{
+    const auto numCells = static_cast<UInt>(state.range(0));
+    constexpr double delta = 10.0;
+
+    const auto mesh2d = MakeRectangularMeshForTesting(numCells + 1, numCells + 1, delta, Projection::cartesian);
+    const auto mesh1d = MakeMeanderingMesh1D(static_cast<double>(numCells) * delta, 2.5 * delta);
+    const std::vector<bool> oneDNodeMask(mesh1d->GetNumNodes(), true);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Contacts contacts(*mesh1d, *mesh2d);
+        state.ResumeTiming();
+
+        contacts.ComputeMultipleContacts(oneDNodeMask);
+    }
+}
+BENCHMARK(BM_ComputeMultipleContacts)
+    ->ArgName("cells_per_side")
+    ->Arg(100)
+    ->Arg(500)
+    ->Arg(1000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_ComputeSingleContacts(benchmark::State& state)
+{
+    const auto numCells = static_cast<UInt>(state.range(0));
+    constexpr double delta = 10.0;
+
+    const auto mesh2d = MakeRectangularMeshForTesting(numCells + 1, numCells + 1, delta, Projection::cartesian);
+    const auto mesh1d = MakeMeanderingMesh1D(static_cast<double>(numCells) * delta, 2.5 * delta);
+    const std::vector<bool> oneDNodeMask(mesh1d->GetNumNodes(), true);
+    const Polygons polygons({}, Projection::cartesian);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        Contacts contacts(*mesh1d, *mesh2d);
+        state.ResumeTiming();
+
+        contacts.ComputeSingleContacts(oneDNodeMask, polygons, 5.0);
+    }
+}
+BENCHMARK(BM_ComputeSingleContacts)
+    ->ArgName("cells_per_side")
+    ->Arg(100)
+    ->Arg(500)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,92 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include <cmath>
+
+#include <MeshKernel/CurvilinearGrid/CurvilinearGrid.hpp>
+#include <MeshKernel/CurvilinearGrid/CurvilinearGridSmoothing.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace meshkernel;
+
+namespace
+{
+    /// @brief Makes a uniform grid with a smooth perturbation of the internal nodes
+    lin_alg::Matrix<Point> MakePerturbedGridNodes(UInt numN, UInt numM)
+    {
+        lin_alg::Matrix<Point> nodes(numN, numM);
+        for (UInt n = 0; n < numN; ++n)
+        {
+            for (UInt m = 0; m < numM; ++m)
+            {
+                const bool isBoundary = n == 0 || m == 0 || n == numN - 1 || m == numM - 1;
+                const double perturbation = isBoundary ? 0.0 : 0.3 * std::sin(0.05 * n) * std::cos(0.07 * m);
+                nodes(n, m) = Point(m + perturbation, n - perturbation);
+            }
+        }
+        return nodes;
+    }
+} // namespace
+
+static void BM_CurvilinearGridSmoothing(benchmark::State& state)
+{
+    const auto numNodes = static_cast<UInt>(state.range(0));
+    const auto nodes = MakePerturbedGridNodes(numNodes, numNodes);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        CurvilinearGrid grid(nodes, Projection::cartesian);
+        CurvilinearGridSmoothing smoothing(grid, 10);
+        smoothing.SetBlock(Point{0.0, 0.0}, Point{static_cast<double>(numNodes), static_cast<double>(numNodes)});
+        state.ResumeTiming();
+
+        [[maybe_unused]] auto undoAction = smoothing.Compute();
+    }
+}
+BENCHMARK(BM_CurvilinearGridSmoothing)
+    ->ArgNames({"nodes"})
+    ->Arg(500)
+    ->Arg(1000);
+
+static void BM_CurvilinearGridLocationCenters(benchmark::State& state)
+{
+    const auto numNodes = static_cast<UInt>(state.range(0));
+    const CurvilinearGrid grid(MakePerturbedGridNodes(numNodes, numNodes), Projection::cartesian);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(grid.ComputeEdgesCenters());
+        benchmark::DoNotOptimize(grid.ComputeFaceCenters());
+    }
+}
+BENCHMARK(BM_CurvilinearGridLocationCenters)
+    ->ArgNames({"nodes"})
+    ->Arg(500)
+    ->Arg(2000);
@@ -180,7 +180,7 @@ static void BM_CurvilinearFromSplines(benchmark::State& state)
         splinesToCurvilinearParameters.average_width = 50.0;
         splinesToCurvilinearParameters.nodes_on_top_of_each_other_tolerance = 1e-4;
         splinesToCurvilinearParameters.min_cosine_crossing_angles = 0.95;
-        splinesToCurvilinearParameters.check_front_collisions = false;
+        splinesToCurvilinearParameters.check_front_collisions = state.range(2) != 0;
         splinesToCurvilinearParameters.curvature_adapted_grid_spacing = true;
         splinesToCurvilinearParameters.remove_skinny_triangles = 0;
 
@@ -199,9 +199,11 @@ static void BM_CurvilinearFromSplines(benchmark::State& state)
     }
 }
 BENCHMARK(BM_CurvilinearFromSplines)
-    ->ArgNames({"m_refinement", "n_refinement"})
-    ->Args({20, 40})
-    ->Args({200, 400});
+    ->ArgNames({"m_refinement", "n_refinement", "check_front_collisions"})
+    ->Args({20, 40, 0})
+    ->Args({200, 400, 0})
+    ->Args({200, 400, 1})
+    ->Args({2000, 40, 1});
 
 static void BM_CurvilinearFromSplinesTransfinite(benchmark::State& state)
 {
@@ -0,0 +1,162 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/Utilities/CompressedSparseRow.hpp>
+#include <TestUtils/MakeMeshes.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace meshkernel;
+
+// Computes the memory allocated by a nested vector, in bytes
+static std::size_t MemoryUsage(const std::vector<std::vector<UInt>>& rows)
+{
+    std::size_t bytes = rows.capacity() * sizeof(std::vector<UInt>);
+    for (const auto& row : rows)
+    {
+        bytes += row.capacity() * sizeof(UInt);
+    }
+    return bytes;
+}
+
+static void BM_MeshConnectivityBuild(benchmark::State& state)
+{
+    UInt const n = static_cast<UInt>(state.range(0));
+    UInt const m = static_cast<UInt>(state.range(1));
+    const bool compressed = state.range(2) != 0;
+
+    const auto mesh = MakeRectangularMeshForTesting(n, m, 1.0, Projection::cartesian);
+    mesh->Administrate();
+
+    std::size_t bytes = 0;
+    std::size_t allocations = 0;
+    for (auto _ : state)
+    {
+        if (compressed)
+        {
+            const CompressedSparseRow<UInt> nodesEdges(mesh->m_nodesEdges);
+            const CompressedSparseRow<UInt> facesNodes(mesh->m_facesNodes);
+            const CompressedSparseRow<UInt> facesEdges(mesh->m_facesEdges);
+            bytes = nodesEdges.MemoryUsage() + facesNodes.MemoryUsage() + facesEdges.MemoryUsage();
+            allocations = 6;
+        }
+        else
+        {
+            const auto nodesEdges = mesh->m_nodesEdges;
+            const auto facesNodes = mesh->m_facesNodes;
+            const auto facesEdges = mesh->m_facesEdges;
+            bytes = MemoryUsage(nodesEdges) + MemoryUsage(facesNodes) + MemoryUsage(facesEdges);
+            allocations = 3 + nodesEdges.size() + facesNodes.size() + facesEdges.size();
+        }
+        benchmark::DoNotOptimize(bytes);
+    }
+
+    state.counters["bytes"] = static_cast<double>(bytes);
+    state.counters["allocations"] = static_cast<double>(allocations);
+}
+BENCHMARK(BM_MeshConnectivityBuild)
+    ->ArgNames({"x-nodes", "y-nodes", "compressed"})
+    ->Args({500, 500, 0})
+    ->Args({500, 500, 1})
+    ->Args({2000, 2000, 0})
+    ->Args({2000, 2000, 1});
+
+static void BM_MeshAdministration(benchmark::State& state)
+{
+    UInt const n = static_cast<UInt>(state.range(0));
+    UInt const m = static_cast<UInt>(state.range(1));
+    const bool compressed = state.range(2) != 0;
+
+    std::size_t bytes = 0;
+    std::size_t allocations = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        const auto mesh = MakeRectangularMeshForTesting(n, m, 1.0, Projection::cartesian);
+        mesh->SetCompressedConnectivity(compressed);
+        // the mesh is administrated by its constructor, resetting an edge requires a new administration
+        [[maybe_unused]] auto action = mesh->ResetEdge(0, mesh->GetEdge(0));
+        state.ResumeTiming();
+
+        mesh->Administrate();
+
+        state.PauseTiming();
+        // when compressed, the three tables of offsets and values replace the nested vectors
+        bytes = mesh->ConnectivityMemoryUsage();
+        allocations = compressed ? 6 : 3 + mesh->m_nodesEdges.size() + mesh->m_facesNodes.size() + mesh->m_facesEdges.size();
+        state.ResumeTiming();
+    }
+
+    state.counters["connectivity_bytes"] = static_cast<double>(bytes);
+    state.counters["connectivity_allocations"] = static_cast<double>(allocations);
+}
+BENCHMARK(BM_MeshAdministration)
+    ->ArgNames({"x-nodes", "y-nodes", "compressed"})
+    ->Args({500, 500, 0})
+    ->Args({500, 500, 1});
+
+static void BM_MeshConnectivityTraversal(benchmark::State& state)
+{
+    UInt const n = static_cast<UInt>(state.range(0));
+    UInt const m = static_cast<UInt>(state.range(1));
+
+    const auto mesh = MakeRectangularMeshForTesting(n, m, 1.0, Projection::cartesian);
+    mesh->Administrate();
+    mesh->SetCompressedConnectivity(state.range(2) != 0);
+
+    for (auto _ : state)
+    {
+        // visits the nodes and edges of all faces, and the edges of all nodes
+        UInt sum = 0;
+        for (UInt f = 0; f < mesh->GetNumFaces(); ++f)
+        {
+            for (const auto node : mesh->FaceNodes(f))
+            {
+                sum += node;
+            }
+            for (const auto edge : mesh->FaceEdges(f))
+            {
+                sum += edge;
+            }
+        }
+        for (UInt node = 0; node < mesh->GetNumNodes(); ++node)
+        {
+            for (const auto edge : mesh->NodeEdges(node))
+            {
+                sum += edge;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_MeshConnectivityTraversal)
+    ->ArgNames({"x-nodes", "y-nodes", "compressed"})
+    ->Args({500, 500, 0})
+    ->Args({500, 500, 1})
+    ->Args({2000, 2000, 0})
+    ->Args({2000, 2000, 1});
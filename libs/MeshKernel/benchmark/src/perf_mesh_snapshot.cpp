@@ -0,0 +1,76 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include <filesystem>
+
+#include <MeshKernel/Mesh2D.hpp>
+
+#include <TestUtils/MakeMeshes.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace meshkernel;
+
+static void BM_Mesh2DLoad(benchmark::State& state)
+{
+    const auto numberOfNodes = static_cast<UInt>(state.range(0));
+    const bool fromSnapshot = state.range(1) != 0;
+
+    const auto mesh = MakeRectangularMeshForTesting(numberOfNodes, numberOfNodes, 1.0, Projection::cartesian);
+    const auto fileName = (std::filesystem::temp_directory_path() / "BM_Mesh2DLoad.bin").string();
+    mesh->WriteSnapshot(fileName);
+
+    const auto& nodes = mesh->Nodes();
+    const auto& edges = mesh->Edges();
+
+    for (auto _ : state)
+    {
+        if (fromSnapshot)
+        {
+            const auto loaded = Mesh2D::ReadSnapshot(fileName);
+            benchmark::DoNotOptimize(loaded->GetNumFaces());
+        }
+        else
+        {
+            const Mesh2D loaded(edges, nodes, Projection::cartesian);
+            benchmark::DoNotOptimize(loaded.GetNumFaces());
+        }
+    }
+
+    state.counters["faces"] = static_cast<double>(mesh->GetNumFaces());
+    state.counters["bytes"] = static_cast<double>(std::filesystem::file_size(fileName));
+
+    std::filesystem::remove(fileName);
+}
+
+BENCHMARK(BM_Mesh2DLoad)
+    ->ArgNames({"nodes", "snapshot"})
+    ->Args({200, 0})
+    ->Args({200, 1})
+    ->Args({500, 0})
+    ->Args({500, 1});
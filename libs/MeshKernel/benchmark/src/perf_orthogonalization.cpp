@@ -26,6 +26,8 @@
 //------------------------------------------------------------------------------
 
 #include <MeshKernel/Constants.hpp>
+#include <MeshKernel/CurvilinearGrid/CurvilinearGrid.hpp>
+#include <MeshKernel/CurvilinearGrid/CurvilinearGridOrthogonalization.hpp>
 #include <MeshKernel/LandBoundaries.hpp>
 #include <MeshKernel/Mesh2D.hpp>
 #include <MeshKernel/MeshRefinement.hpp>
@@ -108,6 +110,7 @@ static void BM_Orthogonalization(benchmark::State& state)
         orthogonalization_parameters.orthogonalization_to_smoothing_factor = 0.975;
         orthogonalization_parameters.orthogonalization_to_smoothing_factor_at_boundary = 0.975;
         orthogonalization_parameters.areal_to_angle_smoothing_factor = 1.0;
+        orthogonalization_parameters.inner_solver = static_cast<int>(state.range(2));
 
         auto polygon = std::make_unique<Polygons>();
         std::vector<Point> land_boundary{};
@@ -126,9 +129,114 @@ static void BM_Orthogonalization(benchmark::State& state)
         [[maybe_unused]] auto dummyUndoAction = orthogonalization.Initialize();
 
         orthogonalization.Compute();
+
+        // the displacement of the last inner iteration measures the convergence reached with the iteration budget
+        state.counters["residual"] = orthogonalization.Residuals().back();
+        state.counters["colours"] = static_cast<double>(orthogonalization.NumColours());
     }
 }
 BENCHMARK(BM_Orthogonalization)
-    ->ArgNames({"x-nodes", "y-nodes"})
+    ->ArgNames({"x-nodes", "y-nodes", "solver"})
+    ->Args({500, 500, 0})
+    ->Args({500, 500, 1})
+    ->Args({1000, 1000, 0})
+    ->Args({1000, 1000, 1});
+
+static void BM_OrthogonalizationToTolerance(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+
+        UInt const n = static_cast<UInt>(state.range(0));
+        UInt const m = static_cast<UInt>(state.range(1));
+        std::shared_ptr<Mesh2D> mesh = MakeRectangularMeshForTesting(n, m, 10.0, 12.0, Projection::cartesian);
+
+        // skew the internal nodes
+        for (UInt i = 0; i < mesh->GetNumNodes(); ++i)
+        {
+            if (mesh->IsNodeOnBoundary(i) || !mesh->Node(i).IsValid())
+            {
+                continue;
+            }
+
+            Point node = mesh->Node(i);
+            node.x += (i % 2 == 0 ? 1.0 : -1.0) * 10.0 / static_cast<double>(4 * (n - 1));
+            node.y += (i % 3 == 0 ? 1.0 : -1.0) * 12.0 / static_cast<double>(4 * (m - 1));
+            [[maybe_unused]] auto dummyUndoAction = mesh->ResetNode(i, node);
+        }
+
+        mesh->AdministrateNodesEdges();
+
+        OrthogonalizationParameters orthogonalization_parameters;
+        orthogonalization_parameters.inner_iterations = 25;
+        orthogonalization_parameters.boundary_iterations = 25;
+        orthogonalization_parameters.outer_iterations = 1;
+        orthogonalization_parameters.displacement_tolerance = 1.0e-4;
+        orthogonalization_parameters.inner_solver = static_cast<int>(state.range(2));
+
+        auto polygon = std::make_unique<Polygons>();
+        std::vector<Point> land_boundary{};
+        auto landboundaries = std::make_unique<LandBoundaries>(land_boundary, *mesh, *polygon);
+
+        state.ResumeTiming();
+
+        OrthogonalizationAndSmoothing orthogonalization(
+            *mesh,
+            std::move(polygon),
+            std::move(landboundaries),
+            LandBoundaries::ProjectToLandBoundaryOption::DoNotProjectToLandBoundary,
+            orthogonalization_parameters);
+
+        [[maybe_unused]] auto dummyUndoAction = orthogonalization.Initialize();
+
+        orthogonalization.Compute();
+
+        state.counters["iterations"] = static_cast<double>(orthogonalization.Residuals().size());
+    }
+}
+BENCHMARK(BM_OrthogonalizationToTolerance)
+    ->ArgNames({"x-nodes", "y-nodes", "solver"})
+    ->Args({200, 200, 0})
+    ->Args({200, 200, 1})
+    ->Args({500, 500, 0})
+    ->Args({500, 500, 1});
+
+static void BM_CurvilinearGridOrthogonalization(benchmark::State& state)
+{
+    const auto numN = static_cast<UInt>(state.range(0));
+    const auto numM = static_cast<UInt>(state.range(1));
+
+    // a uniform grid with a smooth perturbation of the internal nodes
+    lin_alg::Matrix<Point> nodes(numN, numM);
+    for (UInt n = 0; n < numN; ++n)
+    {
+        for (UInt m = 0; m < numM; ++m)
+        {
+            const bool isBoundary = n == 0 || m == 0 || n == numN - 1 || m == numM - 1;
+            const double perturbation = isBoundary ? 0.0 : 0.3 * std::sin(0.05 * n) * std::cos(0.07 * m);
+            nodes(n, m) = Point(m + perturbation, n - perturbation);
+        }
+    }
+
+    OrthogonalizationParameters orthogonalizationParameters;
+    orthogonalizationParameters.outer_iterations = 1;
+    orthogonalizationParameters.boundary_iterations = 2;
+    orthogonalizationParameters.inner_iterations = 10;
+    orthogonalizationParameters.orthogonalization_to_smoothing_factor = 0.975;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        CurvilinearGrid grid(nodes, Projection::cartesian);
+        CurvilinearGridOrthogonalization orthogonalization(grid, orthogonalizationParameters);
+        orthogonalization.SetBlock(Point{0.0, 0.0}, Point{static_cast<double>(numM), static_cast<double>(numN)});
+        state.ResumeTiming();
+
+        [[maybe_unused]] auto undoAction = orthogonalization.Compute();
+    }
+}
+BENCHMARK(BM_CurvilinearGridOrthogonalization)
+    ->ArgNames({"n-nodes", "m-nodes"})
     ->Args({500, 500})
     ->Args({1000, 1000});
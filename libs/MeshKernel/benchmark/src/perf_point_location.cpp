@@ -0,0 +1,134 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include <cmath>
+#include <random>
+
+#include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/Mesh2DPointLocator.hpp>
+#include <MeshKernel/Operations.hpp>
+#include <TestUtils/MakeMeshes.hpp>
+
+#include <benchmark/benchmark.h>
+
+using namespace meshkernel;
+
+// Generates points in the mesh extent, randomly or along a spiral
+static std::vector<Point> GeneratePoints(UInt n, UInt m, UInt numPoints, bool ordered)
+{
+    std::vector<Point> points;
+    points.reserve(numPoints);
+
+    if (ordered)
+    {
+        const double centreX = 0.5 * static_cast<double>(n - 1);
+        const double centreY = 0.5 * static_cast<double>(m - 1);
+        const double maximumRadius = 0.45 * static_cast<double>(std::min(n, m) - 1);
+        for (UInt i = 0; i < numPoints; ++i)
+        {
+            const double fraction = static_cast<double>(i) / static_cast<double>(numPoints);
+            const double angle = 200.0 * fraction;
+            points.emplace_back(centreX + maximumRadius * fraction * std::cos(angle),
+                                centreY + maximumRadius * fraction * std::sin(angle));
+        }
+        return points;
+    }
+
+    std::uniform_real_distribution<double> distributionX(0.0, static_cast<double>(n - 1));
+    std::uniform_real_distribution<double> distributionY(0.0, static_cast<double>(m - 1));
+    std::default_random_engine engine;
+    for (UInt i = 0; i < numPoints; ++i)
+    {
+        points.emplace_back(distributionX(engine), distributionY(engine));
+    }
+    return points;
+}
+
+// The previous algorithm: the faces of the edge with the nearest centre
+static std::vector<UInt> NearestEdgeFaceIndices(Mesh2D& mesh, const std::vector<Point>& points)
+{
+    std::vector<UInt> result(points.size(), constants::missing::uintValue);
+    std::vector<Point> polygonNodesCache;
+    mesh.BuildTree(Location::Edges);
+
+    for (UInt i = 0; i < points.size(); ++i)
+    {
+        const auto edgeIndex = mesh.FindLocationIndex(points[i], Location::Edges);
+        if (edgeIndex == constants::missing::uintValue)
+        {
+            continue;
+        }
+
+        for (UInt e = 0; e < mesh.GetNumEdgesFaces(edgeIndex); ++e)
+        {
+            const auto faceIndex = mesh.m_edgesFaces[edgeIndex][e];
+            mesh.ComputeFaceClosedPolygon(faceIndex, polygonNodesCache);
+            if (IsPointInPolygonNodes(points[i], polygonNodesCache, mesh.m_projection))
+            {
+                result[i] = faceIndex;
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+static void BM_PointFaceIndices(benchmark::State& state)
+{
+    UInt const n = static_cast<UInt>(state.range(0));
+    UInt const m = static_cast<UInt>(state.range(1));
+    UInt const numPoints = static_cast<UInt>(state.range(2));
+    const bool ordered = state.range(3) != 0;
+    const bool nearestEdge = state.range(4) != 0;
+
+    // a perturbed mesh, its faces are not convex
+    const auto mesh = MakeRectangularMeshForTestingRand(n, m, 1.0, Projection::cartesian, {0.0, 0.0}, 0.8);
+    mesh->Administrate();
+    const auto points = GeneratePoints(n, m, numPoints, ordered);
+
+    std::vector<UInt> faceIndices;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        mesh->SetEdgesRTreeRequiresUpdate(true);
+        state.ResumeTiming();
+
+        faceIndices = nearestEdge ? NearestEdgeFaceIndices(*mesh, points) : mesh->PointFaceIndices(points);
+        benchmark::DoNotOptimize(faceIndices.data());
+    }
+
+    const auto located = std::ranges::count_if(faceIndices, [](UInt face)
+                                               { return face != constants::missing::uintValue; });
+    state.counters["located"] = static_cast<double>(located);
+    state.counters["points/s"] = benchmark::Counter(static_cast<double>(numPoints), benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_PointFaceIndices)
+    ->ArgNames({"x-nodes", "y-nodes", "points", "ordered", "nearest-edge"})
+    ->Args({500, 500, 100000, 0, 1})
+    ->Args({500, 500, 100000, 0, 0})
+    ->Args({500, 500, 100000, 1, 1})
+    ->Args({500, 500, 100000, 1, 0});
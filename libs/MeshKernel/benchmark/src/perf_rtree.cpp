@@ -27,9 +27,13 @@
 
 #include <MeshKernel/Entities.hpp>
 #include <MeshKernel/Utilities/RTree.hpp>
+#include <MeshKernel/Utilities/RTreeFactory.hpp>
 
 #include <benchmark/benchmark.h>
 
+#include <cmath>
+#include <random>
+
 static void BM_RTree(benchmark::State& state)
 {
     for (auto _ : state)
@@ -68,3 +72,74 @@ BENCHMARK(BM_RTree)
     ->Args({2000, 2000})
     ->Args({4000, 4000})
     ->Args({5000, 5000});
+
+// Generates a random sample cloud in a square, with a density of one sample per unit area
+static std::vector<meshkernel::Sample> GenerateSampleCloud(int64_t numSamples)
+{
+    const double length = std::sqrt(static_cast<double>(numSamples));
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(0.0, length);
+
+    std::vector<meshkernel::Sample> samples(numSamples);
+    for (auto& sample : samples)
+    {
+        sample.x = distribution(generator);
+        sample.y = distribution(generator);
+        sample.value = 1.0;
+    }
+    return samples;
+}
+
+static void BM_RTreeSampleCloudBuild(benchmark::State& state)
+{
+    const auto samples = GenerateSampleCloud(state.range(0));
+    const auto rtreeType = static_cast<meshkernel::RTreeFactory::Type>(state.range(1));
+
+    for (auto _ : state)
+    {
+        const auto rtree = meshkernel::RTreeFactory::Create(meshkernel::Projection::cartesian, rtreeType);
+        rtree->BuildTree(samples);
+        benchmark::DoNotOptimize(rtree->Size());
+    }
+}
+BENCHMARK(BM_RTreeSampleCloudBuild)
+    ->ArgNames({"samples", "packed"})
+    ->Args({1000000, 0})
+    ->Args({1000000, 1})
+    ->Args({10000000, 0})
+    ->Args({10000000, 1})
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_RTreeSampleCloudSearch(benchmark::State& state)
+{
+    const auto samples = GenerateSampleCloud(state.range(0));
+    const auto rtreeType = static_cast<meshkernel::RTreeFactory::Type>(state.range(1));
+
+    const auto rtree = meshkernel::RTreeFactory::Create(meshkernel::Projection::cartesian, rtreeType);
+    rtree->BuildTree(samples);
+
+    // one query point every hundred samples, each query finds about 12 samples
+    std::vector<meshkernel::Point> queryPoints;
+    for (std::size_t i = 0; i < samples.size(); i += 100)
+    {
+        queryPoints.emplace_back(samples[i].x, samples[i].y);
+    }
+    const double searchRadiusSquared = 4.0;
+
+    meshkernel::RTreeQueryResults queryResults;
+    for (auto _ : state)
+    {
+        rtree->SearchPoints(queryPoints, searchRadiusSquared, queryResults);
+        benchmark::DoNotOptimize(queryResults.indices.data());
+
+        rtree->SearchNearestPoints(queryPoints, 1, queryResults);
+        benchmark::DoNotOptimize(queryResults.indices.data());
+    }
+}
+BENCHMARK(BM_RTreeSampleCloudSearch)
+    ->ArgNames({"samples", "packed"})
+    ->Args({1000000, 0})
+    ->Args({1000000, 1})
+    ->Args({10000000, 0})
+    ->Args({10000000, 1})
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,94 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include <MeshKernel/CurvilinearGrid/CurvilinearGridFromSplines.hpp>
+#include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Parameters.hpp>
+#include <MeshKernel/Splines.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace meshkernel;
+
+/// @brief Creates a network of wavy centre splines, each crossed by short cross splines
+static std::shared_ptr<Splines> CreateSplineNetwork(UInt numCentreSplines)
+{
+    constexpr UInt numCentreSplineNodes = 20;
+    constexpr UInt numCrossSplinesPerCentreSpline = 4;
+    constexpr double length = 2000.0;
+    constexpr double spacing = 100.0;
+
+    auto splines = std::make_shared<Splines>(Projection::cartesian);
+
+    for (UInt i = 0; i < numCentreSplines; ++i)
+    {
+        const double y = static_cast<double>(i) * spacing;
+
+        std::vector<Point> centreSpline(numCentreSplineNodes);
+        for (UInt n = 0; n < numCentreSplineNodes; ++n)
+        {
+            const double x = length * static_cast<double>(n) / static_cast<double>(numCentreSplineNodes - 1);
+            centreSpline[n] = {x, y + 10.0 * std::sin(x / 50.0)};
+        }
+        splines->AddSpline(centreSpline);
+
+        for (UInt c = 0; c < numCrossSplinesPerCentreSpline; ++c)
+        {
+            const double x = length * (static_cast<double>(c) + 0.5) / static_cast<double>(numCrossSplinesPerCentreSpline);
+            splines->AddSpline(std::vector<Point>{{x, y - 0.4 * spacing}, {x, y + 0.4 * spacing}});
+        }
+    }
+
+    return splines;
+}
+
+static void BM_SplineIntersections(benchmark::State& state)
+{
+    const auto splines = CreateSplineNetwork(static_cast<UInt>(state.range(0)));
+
+    CurvilinearParameters curvilinearParameters;
+    SplinesToCurvilinearParameters splinesToCurvilinearParameters;
+
+    for (auto _ : state)
+    {
+        CurvilinearGridFromSplines curvilinearGridFromSplines(splines, curvilinearParameters, splinesToCurvilinearParameters);
+        curvilinearGridFromSplines.ComputeSplineProperties(false);
+    }
+
+    state.counters["splines"] = static_cast<double>(splines->GetNumSplines());
+}
+BENCHMARK(BM_SplineIntersections)
+    ->ArgName("centre_splines")
+    ->Arg(20)
+    ->Arg(100)
+    ->Arg(200)
+    ->Unit(benchmark::kMillisecond);
@@ -27,7 +27,8 @@
 
 #pragma once
 
-#include "MeshKernel/AveragingStrategies/AveragingStrategy.hpp"
+#include <span>
+
 #include "MeshKernel/Definitions.hpp"
 #include "MeshKernel/Mesh2D.hpp"
 #include "MeshKernel/MeshInterpolation.hpp"
@@ -72,6 +73,12 @@ namespace meshkernel
     ///
     /// -   For the \ref Location Edges location, the interpolated values at the node are
     ///     averaged.
+    ///
+    /// The locations are computed in parallel. The averaging methods are compiled as
+    /// averaging kernels, selected once per computation. The result of a location only depends on
+    /// the samples found for that location, so it is independent of the number of threads.
+    /// Several sample properties sharing the sample locations can be interpolated at once with
+    /// ComputeProperties, the neighbourhood of each location being searched only once.
     class AveragingInterpolation : public MeshInterpolation
     {
     public:
@@ -107,36 +114,126 @@ namespace meshkernel
         /// @brief Compute interpolation
         void Compute() override;
 
+        /// @brief Computes the interpolation of several sample properties at once
+        ///
+        /// The samples passed at construction give the locations of the samples, their values are not used.
+        /// @param[in] sampleValues The values of each property, one value for each sample
+        /// @return For each property, the interpolated values at the interpolation location
+        [[nodiscard]] std::vector<std::vector<double>> ComputeProperties(const std::vector<std::vector<double>>& sampleValues);
+
+        /// @brief Computes the interpolation of several sample properties at a subset of the nodes, or of the faces for the Faces location
+        ///
+        /// For the Edges location the node results are computed, see ComputeEdgeResults.
+        /// @param[in]     sampleValues The values of each property, one value for each sample
+        /// @param[in]     locations    The indices of the nodes or of the faces to compute
+        /// @param[in,out] results      For each property, the values at all nodes or faces. Only the entries of the locations are set
+        void ComputeProperties(const std::vector<std::vector<double>>& sampleValues,
+                               std::span<const UInt> locations,
+                               std::vector<std::vector<double>>& results);
+
+        /// @brief Computes, for each node or face, a bounding box containing all samples used by its interpolation
+        ///
+        /// For the Edges location the boxes of the nodes are computed. For spherical projections the boxes only bound the latitude.
+        /// @return The bounding boxes, a non overlapping bounding box for locations without a valid interpolation point
+        [[nodiscard]] std::vector<BoundingBox> ComputeSearchBoundingBoxes() const;
+
+        /// @brief Averages the node results at the edges
+        /// @param[in] nodeResults The results at the nodes
+        /// @return The results at the edges
+        [[nodiscard]] std::vector<double> ComputeEdgeResults(std::vector<double> const& nodeResults) const;
+
     private:
-        /// @brief Default size for interpolation points and sample caches.
-        static constexpr UInt DefaultMaximumCacheSize = 100;
+        /// @brief The buffers used to compute one location, one instance for each thread
+        struct LocationCache
+        {
+            std::vector<Point> polygon;       ///< The polygon around the location
+            std::vector<Point> searchPolygon; ///< The search polygon
+            std::vector<UInt> queryIndices;   ///< The indices of the samples found by the RTree query
+            std::vector<UInt> sampleIndices;  ///< The indices of the samples inside the search polygon
+        };
 
-        /// @brief Compute the averaging results in polygon
-        /// @param[in]  polygon            The bounding polygon where the samples are included
-        /// @param[in]  interpolationPoint The interpolation point
-        /// @returns The resulting value
-        double ComputeOnPolygon(const std::vector<Point>& polygon,
-                                const Point& interpolationPoint);
+        /// @brief Builds the samples tree, if not built yet
+        void BuildSamplesTree();
+
+        /// @brief Gets the number of nodes, or of faces for the Faces location
+        [[nodiscard]] UInt GetNumLocations() const;
+
+        /// @brief Computes the results of all properties at a subset of the nodes, or of the faces for the Faces location
+        /// @param[in]     sampleValues The values of each property
+        /// @param[in]     locations    The indices of the nodes or of the faces to compute
+        /// @param[in,out] results      The results of each property at all nodes or faces
+        void ComputeOnLocations(const std::vector<std::vector<double>>& sampleValues,
+                                std::span<const UInt> locations,
+                                std::vector<std::vector<double>>& results) const;
+
+        /// @brief Computes the results of all properties at a subset of the nodes, using the dual faces as search polygons
+        /// @tparam Kernel The averaging kernel
+        /// @param[in]     sampleValues The values of each property
+        /// @param[in]     locations    The indices of the nodes to compute
+        /// @param[in,out] results      The results of each property at all nodes
+        template <class Kernel>
+        void ComputeOnNodes(const std::vector<std::vector<double>>& sampleValues,
+                            std::span<const UInt> locations,
+                            std::vector<std::vector<double>>& results) const;
+
+        /// @brief Computes the results of all properties at a subset of the faces
+        /// @tparam Kernel The averaging kernel
+        /// @param[in]     sampleValues The values of each property
+        /// @param[in]     locations    The indices of the faces to compute
+        /// @param[in,out] results      The results of each property at all faces
+        template <class Kernel>
+        void ComputeOnFaces(const std::vector<std::vector<double>>& sampleValues,
+                            std::span<const UInt> locations,
+                            std::vector<std::vector<double>>& results) const;
+
+        /// @brief Computes the results at the faces, decreasing the values of the samples used by faces with a positive result
+        ///
+        /// The faces are computed serially, because the following faces depend on the samples decreased by the previous ones.
+        /// @tparam Kernel The averaging kernel
+        /// @param[in,out] sampleValues The values of the samples, a single property
+        /// @param[out]    results      The results at the faces
+        template <class Kernel>
+        void ComputeOnFacesTransformingSamples(std::vector<std::vector<double>>& sampleValues,
+                                               std::vector<std::vector<double>>& results);
+
+        /// @brief Computes the results of all properties at one location, from the polygon stored in the cache
+        /// @tparam Kernel The averaging kernel
+        /// @param[in]     interpolationPoint The interpolation point
+        /// @param[in]     location           The index of the location
+        /// @param[in]     sampleValues       The values of each property
+        /// @param[in,out] cache              The buffers of the location
+        /// @param[out]    results            The results of each property
+        template <class Kernel>
+        void ComputeOnPolygon(const Point& interpolationPoint,
+                              UInt location,
+                              const std::vector<std::vector<double>>& sampleValues,
+                              LocationCache& cache,
+                              std::vector<std::vector<double>>& results) const;
 
-        /// @brief Decreases the values of samples
-        void DecreaseValueOfSamples();
+        /// @brief Fills the polygon of a face, enlarged or reduced by the relative search radius
+        /// @param[in]  face    The face index
+        /// @param[out] polygon The polygon of the face
+        void ComputeFacePolygon(UInt face, std::vector<Point>& polygon) const;
 
         /// @brief Generate the search polygon from an input polygon
         /// @param[in]  polygon            The input polygon
         /// @param[in]  interpolationPoint The interpolation point
-        /// @return The search polygon
-        [[nodiscard]] std::vector<Point> GetSearchPolygon(std::vector<Point> const& polygon, Point const& interpolationPoint) const;
+        /// @param[out] searchPolygon      The search polygon
+        void ComputeSearchPolygon(std::vector<Point> const& polygon, Point const& interpolationPoint, std::vector<Point>& searchPolygon) const;
 
-        /// @brief Computes the average value from the neighbors using a strategy
-        /// param[in]  strategy            The input strategy
-        /// param[in] searchPolygon        The bounding polygon
-        /// @return The interpolated result
-        [[nodiscard]] double ComputeInterpolationResultFromNeighbors(const Point& interpolationPoint, std::vector<Point> const& searchPolygon);
+        /// @brief Selects the samples found by the RTree query lying inside the search polygon
+        /// @param[in]  searchPolygon The search polygon
+        /// @param[in]  queryIndices  The indices of the samples found by the RTree query
+        /// @param[out] sampleIndices The indices of the samples inside the search polygon
+        void SelectSamplesInPolygon(std::vector<Point> const& searchPolygon,
+                                    std::vector<UInt> const& queryIndices,
+                                    std::vector<UInt>& sampleIndices) const;
 
-        /// @brief Gets the sample value from an r-tree query
-        /// param[in] index            The query index
-        /// @return The sample value
-        [[nodiscard]] double GetSampleValueFromRTree(UInt index);
+        /// @brief Computes the search polygon and the squared search radius of a location, from the polygon stored in the cache
+        /// @param[in]     interpolationPoint The interpolation point
+        /// @param[in,out] cache              The buffers of the location, the search polygon is set
+        /// @return The squared search radius
+        double ComputeSearchArea(const Point& interpolationPoint, LocationCache& cache) const;
 
         /// @brief Compute a search radius from a point and a polygon
         /// @param searchPolygon The input polygon
@@ -147,13 +244,13 @@ namespace meshkernel
 
         Mesh2D& m_mesh;                                 ///< Reference to the mesh
         std::vector<Sample>& m_samples;                 ///< The samples
+        Method m_method;                                ///< The averaging method
         Location m_interpolationLocation;               ///< Interpolation location
         double m_relativeSearchRadius;                  ///< Relative search radius
         bool m_useClosestSampleIfNoneAvailable = false; ///< Whether to use the closest sample if there is none available
         bool m_transformSamples = false;                ///< Wheher to transform samples
-        std::vector<Sample> m_interpolationSampleCache; ///< Cache for interpolation samples
+        UInt m_minNumSamples;                           ///< The minimum number of samples for certain averaging methods
 
-        std::unique_ptr<RTreeBase> m_samplesRtree;                ///< The samples tree
-        std::unique_ptr<averaging::AveragingStrategy> m_strategy; ///< Averaging strategy
+        std::unique_ptr<RTreeBase> m_samplesRtree; ///< The samples tree
     };
 } // namespace meshkernel
@@ -0,0 +1,271 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "MeshKernel/AveragingInterpolation.hpp"
+#include "MeshKernel/Constants.hpp"
+#include "MeshKernel/Definitions.hpp"
+#include "MeshKernel/Entities.hpp"
+#include "MeshKernel/Operations.hpp"
+
+namespace meshkernel::averaging
+{
+    /// @brief The averaging kernels are the statically dispatched counterparts of the averaging strategies.
+    ///
+    /// A kernel is created for one interpolation point, the sample values are added one at the time
+    /// and the result is inquired at the end. All kernels share the same constructor, so they can be used
+    /// as template arguments of the interpolation loops, without virtual calls or copies of the samples.
+    /// The averaging strategies are implemented with the kernels, see ComputeAverage.
+
+    /// @brief Kernel computing the mean of the sample values, see SimpleAveragingStrategy
+    class SimpleAveragingKernel
+    {
+    public:
+        /// @brief Constructor
+        /// @param[in] interpolationPoint The point for which the average is calculated
+        /// @param[in] minNumSamples      The minimum amount of samples for a valid interpolation
+        /// @param[in] projection         The projection used in calculating the distances
+        SimpleAveragingKernel(const Point& interpolationPoint [[maybe_unused]], size_t minNumSamples, Projection projection [[maybe_unused]])
+            : m_minNumSamples(minNumSamples) {}
+
+        /// @brief Adds a sample
+        void Add(const Point& samplePoint [[maybe_unused]], double value)
+        {
+            m_sum += value;
+            ++m_numSamples;
+        }
+
+        /// @brief Gets the average of the added samples
+        [[nodiscard]] double Result() const
+        {
+            return m_numSamples >= m_minNumSamples ? m_sum / static_cast<double>(m_numSamples) : constants::missing::doubleValue;
+        }
+
+    private:
+        size_t m_minNumSamples;  ///< The minimum number of samples for a valid interpolation
+        size_t m_numSamples = 0; ///< The number of samples added
+        double m_sum = 0.0;      ///< The sum of the sample values
+    };
+
+    /// @brief Kernel selecting the value of the closest sample, see ClosestAveragingStrategy
+    class ClosestAveragingKernel
+    {
+    public:
+        /// @brief Constructor
+        /// @param[in] interpolationPoint The point for which the average is calculated
+        /// @param[in] minNumSamples      The minimum amount of samples for a valid interpolation
+        /// @param[in] projection         The projection used in calculating the distances
+        ClosestAveragingKernel(const Point& interpolationPoint, size_t minNumSamples [[maybe_unused]], Projection projection)
+            : m_interpolationPoint(interpolationPoint), m_projection(projection) {}
+
+        /// @brief Adds a sample
+        void Add(const Point& samplePoint, double value)
+        {
+            if (const auto squaredDistance = ComputeSquaredDistance(m_interpolationPoint, samplePoint, m_projection);
+                squaredDistance < m_closestSquaredDistance)
+            {
+                m_closestSquaredDistance = squaredDistance;
+                m_result = value;
+            }
+        }
+
+        /// @brief Gets the value of the closest sample
+        [[nodiscard]] double Result() const { return m_result; }
+
+    private:
+        Point m_interpolationPoint;                                           ///< The interpolation point
+        Projection m_projection;                                              ///< The projection used to calculate the squared distance
+        double m_closestSquaredDistance = std::numeric_limits<double>::max(); ///< The squared distance of the closest sample
+        double m_result = constants::missing::doubleValue;                    ///< The value of the closest sample
+    };
+
+    /// @brief Kernel computing the maximum sample value, see MaxAveragingStrategy
+    class MaxAveragingKernel
+    {
+    public:
+        /// @brief Constructor
+        /// @param[in] interpolationPoint The point for which the average is calculated
+        /// @param[in] minNumSamples      The minimum amount of samples for a valid interpolation
+        /// @param[in] projection         The projection used in calculating the distances
+        MaxAveragingKernel(const Point& interpolationPoint [[maybe_unused]], size_t minNumSamples [[maybe_unused]], Projection projection [[maybe_unused]]) {}
+
+        /// @brief Adds a sample
+        void Add(const Point& samplePoint [[maybe_unused]], double value) { m_result = std::max(m_result, value); }
+
+        /// @brief Gets the maximum of the added samples
+        [[nodiscard]] double Result() const
+        {
+            return m_result != std::numeric_limits<double>::lowest() ? m_result : constants::missing::doubleValue;
+        }
+
+    private:
+        double m_result = std::numeric_limits<double>::lowest(); ///< The maximum value
+    };
+
+    /// @brief Kernel computing the minimum sample value, see MinAveragingStrategy
+    class MinAveragingKernel
+    {
+    public:
+        /// @brief Constructor
+        /// @param[in] interpolationPoint The point for which the average is calculated
+        /// @param[in] minNumSamples      The minimum amount of samples for a valid interpolation
+        /// @param[in] projection         The projection used in calculating the distances
+        MinAveragingKernel(const Point& interpolationPoint [[maybe_unused]], size_t minNumSamples [[maybe_unused]], Projection projection [[maybe_unused]]) {}
+
+        /// @brief Adds a sample
+        void Add(const Point& samplePoint [[maybe_unused]], double value) { m_result = std::min(m_result, value); }
+
+        /// @brief Gets the minimum of the added samples
+        [[nodiscard]] double Result() const
+        {
+            return m_result != std::numeric_limits<double>::max() ? m_result : constants::missing::doubleValue;
+        }
+
+    private:
+        double m_result = std::numeric_limits<double>::max(); ///< The minimum value
+    };
+
+    /// @brief Kernel computing the inverse distance weighted mean, see InverseWeightedAveragingStrategy
+    class InverseWeightedAveragingKernel
+    {
+    public:
+        /// @brief Constructor
+        /// @param[in] interpolationPoint The point for which the average is calculated
+        /// @param[in] minNumSamples      The minimum amount of samples for a valid interpolation
+        /// @param[in] projection         The projection used in calculating the distances
+        InverseWeightedAveragingKernel(const Point& interpolationPoint, size_t minNumSamples, Projection projection)
+            : m_interpolationPoint(interpolationPoint), m_minNumSamples(minNumSamples), m_projection(projection) {}
+
+        /// @brief Adds a sample
+        void Add(const Point& samplePoint, double value)
+        {
+            const double weight = 1.0 / std::max(0.01, ComputeDistance(m_interpolationPoint, samplePoint, m_projection));
+            m_sumWeights += weight;
+            m_result += weight * value;
+        }
+
+        /// @brief Gets the weighted mean of the added samples
+        [[nodiscard]] double Result() const
+        {
+            return m_sumWeights >= static_cast<double>(m_minNumSamples) ? m_result / m_sumWeights : constants::missing::doubleValue;
+        }
+
+    private:
+        Point m_interpolationPoint; ///< The interpolation point
+        size_t m_minNumSamples;     ///< The minimum number of samples for a valid interpolation
+        Projection m_projection;    ///< The projection used to calculate the distance
+        double m_sumWeights = 0.0;  ///< The sum of the weights
+        double m_result = 0.0;      ///< The weighted sum of the sample values
+    };
+
+    /// @brief Kernel computing the minimum absolute sample value, see MinAbsAveragingStrategy
+    class MinAbsAveragingKernel
+    {
+    public:
+        /// @brief Constructor
+        /// @param[in] interpolationPoint The point for which the average is calculated
+        /// @param[in] minNumSamples      The minimum amount of samples for a valid interpolation
+        /// @param[in] projection         The projection used in calculating the distances
+        MinAbsAveragingKernel(const Point& interpolationPoint [[maybe_unused]], size_t minNumSamples [[maybe_unused]], Projection projection [[maybe_unused]]) {}
+
+        /// @brief Adds a sample
+        void Add(const Point& samplePoint [[maybe_unused]], double value) { m_result = std::min(m_result, std::abs(value)); }
+
+        /// @brief Gets the minimum absolute value of the added samples
+        [[nodiscard]] double Result() const
+        {
+            return m_result != std::numeric_limits<double>::max() ? m_result : constants::missing::doubleValue;
+        }
+
+    private:
+        double m_result = std::numeric_limits<double>::max(); ///< The minimum absolute value
+    };
+
+    /// @brief Computes the average of a set of samples with a kernel
+    /// @tparam Kernel The averaging kernel
+    /// @param[in] interpolationPoint The point for which the average is calculated
+    /// @param[in] samples            The sample points and values
+    /// @param[in] minNumSamples      The minimum amount of samples for a valid interpolation
+    /// @param[in] projection         The projection used in calculating the distances
+    /// @return The calculated average
+    template <class Kernel>
+    [[nodiscard]] double ComputeAverage(const Point& interpolationPoint,
+                                        const std::vector<Sample>& samples,
+                                        size_t minNumSamples,
+                                        Projection projection)
+    {
+        Kernel kernel(interpolationPoint, minNumSamples, projection);
+
+        for (const auto& sample : samples)
+        {
+            kernel.Add(sample, sample.value);
+        }
+
+        return kernel.Result();
+    }
+
+    /// @brief Calls a function with the averaging kernel of a method, passed as a std::type_identity
+    /// @param[in] method   The averaging method
+    /// @param[in] function The function called with the kernel type
+    template <class Function>
+    void VisitAveragingKernel(AveragingInterpolation::Method method, Function&& function)
+    {
+        switch (method)
+        {
+        case AveragingInterpolation::Method::SimpleAveraging:
+            function(std::type_identity<SimpleAveragingKernel>{});
+            break;
+        case AveragingInterpolation::Method::Closest:
+            function(std::type_identity<ClosestAveragingKernel>{});
+            break;
+        case AveragingInterpolation::Method::Max:
+            function(std::type_identity<MaxAveragingKernel>{});
+            break;
+        case AveragingInterpolation::Method::Min:
+            function(std::type_identity<MinAveragingKernel>{});
+            break;
+        case AveragingInterpolation::Method::InverseWeightedDistance:
+            function(std::type_identity<InverseWeightedAveragingKernel>{});
+            break;
+        case AveragingInterpolation::Method::MinAbsValue:
+            function(std::type_identity<MinAbsAveragingKernel>{});
+            break;
+        default:
+            throw std::invalid_argument("Unsupported averagingMethod");
+        }
+    }
+
+} // namespace meshkernel::averaging
@@ -28,6 +28,7 @@
 #pragma once
 
 #include <MeshKernel/AveragingInterpolation.hpp>
+#include <MeshKernel/AveragingStrategies/AveragingStrategy.hpp>
 #include <MeshKernel/Entities.hpp>
 
 namespace meshkernel::averaging
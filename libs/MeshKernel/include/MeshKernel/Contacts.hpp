@@ -154,11 +154,14 @@ namespace meshkernel
         /// @return True if the contact is crossing an existing contact
         [[nodiscard]] bool IsContactIntersectingContact(UInt node, UInt face) const;
 
-        /// @brief Connect the current 1D line segment with the faces that intersect a semiline originating from the current node and perpendicular to the current 1D edge.
+        /// @brief Finds the boundary face crossed by the semiline originating from the current node and perpendicular to the current 1D edge.
+        ///
+        /// The face is discarded if the contact is crossing a 1d mesh edge. Does not depend on the contacts already generated.
         /// @param[in] node The 1d node index (start of the contact)
         /// @param[in] projectionFactor The semiline length, as a multiplier of the current ad edge length
-        void Connect1dNodesWithCrossingFaces(UInt node,
-                                             double projectionFactor);
+        /// @return The index of the face to connect, constants::missing::uintValue if none
+        [[nodiscard]] UInt FindCrossingBoundaryFace(UInt node,
+                                                    double projectionFactor) const;
 
         /// @brief Validate checking mesh1d and mesh2d are not empty, throws an exception otherwise
         void Validate() const;
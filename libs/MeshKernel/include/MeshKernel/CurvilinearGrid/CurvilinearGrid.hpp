@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <set>
 #include <vector>
 
@@ -140,6 +141,15 @@ namespace meshkernel
         /// This is just a helper function, it calls GetNode with (index.m_m, index.m_n)
         [[nodiscard]] inline Point const& GetNode(const CurvilinearGridNodeIndices& index) const;
 
+        /// @brief Gets the nodes of the grid line at n, a contiguous array of NumM() nodes
+        /// @note The nodes can be modified through the returned pointer, the spatial trees are flagged for an update
+        /// @param[in] n The n-dimension index
+        [[nodiscard]] inline Point* GetNodeRow(const UInt n);
+
+        /// @brief Gets the nodes of the grid line at n, a contiguous array of NumM() nodes
+        /// @param[in] n The n-dimension index
+        [[nodiscard]] inline Point const* GetNodeRow(const UInt n) const;
+
         /// @brief From a point gets the node indices of the closest edges
         /// @param[in] point The input point
         /// @return The curvilinear grid indices of the closest edge
@@ -440,6 +450,13 @@ namespace meshkernel
         /// @return a copy of the matrix
         lin_alg::Matrix<Point> GetNodes() const { return m_gridNodes; }
 
+        /// @brief Gets the geometry generation, incremented each time the nodes can have been modified
+        /// @note Any non-const access to the nodes counts as a modification
+        std::uint64_t GeometryGeneration() const { return m_geometryGeneration; }
+
+        /// @brief Gets the topology generation, incremented each time the grid dimensions or the node types are recomputed
+        std::uint64_t TopologyGeneration() const { return m_topologyGeneration; }
+
         /// @brief Get the array of nodes at an m-dimension index
         /// @param [in] m the m-dimension index
         /// @return a vector of N nodes
@@ -590,13 +607,16 @@ namespace meshkernel
         bool m_edgesRTreeRequiresUpdate = true;                            ///< m_edgesRTree requires an update
         bool m_facesRTreeRequiresUpdate = true;                            ///< m_facesRTree requires an update
         std::unordered_map<Location, std::unique_ptr<RTreeBase>> m_RTrees; ///< The RTrees to use
-        BoundingBox m_boundingBoxCache;                                    ///< Caches the last bounding box used for selecting the locations
+        std::unordered_map<Location, BoundingBox> m_boundingBoxCache;      ///< Caches, for each location, the last bounding box used for selecting the locations
 
         std::vector<Edge> m_edges; ///< Member variable storing the edges
 
         /// @brief
         CurvilinearGridNodeIndices m_startOffset{0, 0}; ///< Row and column start index offset
         CurvilinearGridNodeIndices m_endOffset{0, 0};   ///< Row and column end index offset
+
+        std::uint64_t m_geometryGeneration = 0; ///< Incremented at each (possible) change of the nodes
+        std::uint64_t m_topologyGeneration = 0; ///< Incremented at each change of the grid dimensions or node types
     };
 } // namespace meshkernel
 
@@ -626,6 +646,7 @@ inline meshkernel::Point& meshkernel::CurvilinearGrid::GetNode(const UInt n, con
     m_nodesRTreeRequiresUpdate = true;
     m_edgesRTreeRequiresUpdate = true;
     m_facesRTreeRequiresUpdate = true;
+    ++m_geometryGeneration;
 
     return m_gridNodes(n + m_startOffset.m_n, m + m_startOffset.m_m);
 }
@@ -645,6 +666,31 @@ meshkernel::Point const& meshkernel::CurvilinearGrid::GetNode(const UInt n, cons
     return m_gridNodes(n + m_startOffset.m_n, m + m_startOffset.m_m);
 }
 
+meshkernel::Point* meshkernel::CurvilinearGrid::GetNodeRow(const UInt n)
+{
+    if (n >= NumN()) [[unlikely]]
+    {
+        throw ConstraintError("Invalid row index {} >= {}", n, NumN());
+    }
+
+    m_nodesRTreeRequiresUpdate = true;
+    m_edgesRTreeRequiresUpdate = true;
+    m_facesRTreeRequiresUpdate = true;
+    ++m_geometryGeneration;
+
+    return &m_gridNodes(n + m_startOffset.m_n, m_startOffset.m_m);
+}
+
+meshkernel::Point const* meshkernel::CurvilinearGrid::GetNodeRow(const UInt n) const
+{
+    if (n >= NumN()) [[unlikely]]
+    {
+        throw ConstraintError("Invalid row index {} >= {}", n, NumN());
+    }
+
+    return &m_gridNodes(n + m_startOffset.m_n, m_startOffset.m_m);
+}
+
 meshkernel::Point& meshkernel::CurvilinearGrid::GetNode(const CurvilinearGridNodeIndices& index)
 {
     if (!index.IsValid()) [[unlikely]]
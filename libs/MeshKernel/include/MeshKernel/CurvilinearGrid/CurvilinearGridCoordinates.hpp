@@ -0,0 +1,108 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "MeshKernel/CurvilinearGrid/CurvilinearGridNodeIndices.hpp"
+#include "MeshKernel/Definitions.hpp"
+#include "MeshKernel/Point.hpp"
+#include "MeshKernel/Utilities/LinearAlgebra.hpp"
+
+namespace meshkernel
+{
+
+    /// @brief Forward declaration of the curvilinear mesh
+    class CurvilinearGrid;
+
+    /// @brief The node coordinates of a curvilinear grid, in structure of arrays layout
+    ///
+    /// The x and y coordinates are stored in separate row major matrices, so kernels iterating along
+    /// the grid lines read contiguous arrays of doubles. The node validity is stored in a packed bit mask.
+    class CurvilinearGridCoordinates
+    {
+    public:
+        /// @brief Default constructor
+        CurvilinearGridCoordinates() = default;
+
+        /// @brief Constructor, copies the node coordinates of a grid
+        explicit CurvilinearGridCoordinates(const CurvilinearGrid& grid);
+
+        /// @brief Copies the node coordinates of a grid
+        void Assign(const CurvilinearGrid& grid);
+
+        /// @brief Copies a block of node coordinates back to a grid
+        /// @param[in,out] grid       The grid the coordinates were assigned from
+        /// @param[in]     lowerLeft  The lower left node of the block
+        /// @param[in]     upperRight The upper right node of the block, included
+        void Store(CurvilinearGrid& grid,
+                   const CurvilinearGridNodeIndices& lowerLeft,
+                   const CurvilinearGridNodeIndices& upperRight) const;
+
+        /// @brief Gets the number of nodes in n direction
+        [[nodiscard]] UInt NumN() const { return static_cast<UInt>(m_x.rows()); }
+
+        /// @brief Gets the number of nodes in m direction
+        [[nodiscard]] UInt NumM() const { return static_cast<UInt>(m_x.cols()); }
+
+        /// @brief Gets the node at (n,m)
+        [[nodiscard]] Point operator()(UInt n, UInt m) const { return {m_x(n, m), m_y(n, m)}; }
+
+        /// @brief Sets the node at (n,m)
+        void Set(UInt n, UInt m, const Point& node);
+
+        /// @brief Determines if the node at (n,m) is valid
+        [[nodiscard]] bool IsValid(UInt n, UInt m) const
+        {
+            const auto index = static_cast<std::size_t>(n) * NumM() + m;
+            return (m_isValid[index / BitsPerWord] >> (index % BitsPerWord) & 1U) != 0;
+        }
+
+        /// @brief Gets the x coordinates of the nodes of the grid line at n
+        [[nodiscard]] const double* X(UInt n) const { return m_x.row(n).data(); }
+
+        /// @brief Gets the x coordinates of the nodes of the grid line at n
+        [[nodiscard]] double* X(UInt n) { return m_x.row(n).data(); }
+
+        /// @brief Gets the y coordinates of the nodes of the grid line at n
+        [[nodiscard]] const double* Y(UInt n) const { return m_y.row(n).data(); }
+
+        /// @brief Gets the y coordinates of the nodes of the grid line at n
+        [[nodiscard]] double* Y(UInt n) { return m_y.row(n).data(); }
+
+    private:
+        static constexpr std::size_t BitsPerWord = 64; ///< The number of nodes in a word of the validity mask
+
+        lin_alg::Matrix<double> m_x;          ///< The x coordinates
+        lin_alg::Matrix<double> m_y;          ///< The y coordinates
+        std::vector<std::uint64_t> m_isValid; ///< One bit per node, set for the valid nodes
+    };
+
+} // namespace meshkernel
@@ -30,6 +30,7 @@
 #include <MeshKernel/Constants.hpp>
 #include <MeshKernel/Entities.hpp>
 #include <MeshKernel/Parameters.hpp>
+#include <MeshKernel/SplineSegmentIndex.hpp>
 #include <MeshKernel/Utilities/LinearAlgebra.hpp>
 
 #include <utility>
@@ -162,6 +163,9 @@ namespace meshkernel
                                      const UInt indexRightOfRight) const;
 
         /// @brief Compute maximum allowable grid layer growth time
+        ///
+        /// The segments of the active layer are checked in parallel. For Cartesian grids only the front segments
+        /// close enough to collide within the time step are checked, found with a spatial index of the front nodes.
         void ComputeMaximumTimeStep(const UInt layerIndex,
                                     const lin_alg::RowVector<Point>& activeLayerPoints,
                                     const std::vector<Point>& velocityVectorAtGridPoints,
@@ -282,8 +286,12 @@ namespace meshkernel
                                      lin_alg::Matrix<double>& heights);
 
         /// @brief Computes the intersections on a given spline (get_crosssplines)
-        /// @brief[in] splineIndex The current spline index
-        void GetSplineIntersections(UInt splineIndex);
+        /// @brief[in] splineIndex  The current spline index
+        /// @brief[in] segmentIndex The index of the segments of all splines
+        /// @brief[in] segmentPairs The pairs of segments of all splines that may cross, empty if the segments are not indexed
+        void GetSplineIntersections(UInt splineIndex,
+                                    const SplineSegmentIndex& segmentIndex,
+                                    std::span<const SplineSegmentIndex::SegmentPair> segmentPairs);
 
         /// @brief Generate a gridline on a spline with a prescribed maximum mesh width (make_gridline)
         /// @param[in] splineIndex  The current spline index
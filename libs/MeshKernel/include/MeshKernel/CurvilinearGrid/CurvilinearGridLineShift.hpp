@@ -31,6 +31,7 @@
 
 #include "MeshKernel/CurvilinearGrid/CurvilinearGrid.hpp"
 #include "MeshKernel/CurvilinearGrid/CurvilinearGridAlgorithm.hpp"
+#include "MeshKernel/CurvilinearGrid/CurvilinearGridCoordinates.hpp"
 #include "MeshKernel/Entities.hpp"
 #include "MeshKernel/UndoActions/UndoAction.hpp"
 
@@ -73,6 +74,7 @@ namespace meshkernel
         /// @return The new displacement
         Point TransformDisplacement(Point const& displacement, CurvilinearGridNodeIndices const& node, bool toLocal) const;
 
-        CurvilinearGrid m_originalGrid; ///< A pointer to the original grid
+        CurvilinearGrid m_originalGrid;                   ///< A pointer to the original grid
+        CurvilinearGridCoordinates m_originalCoordinates; ///< The original node coordinates and validity, for the influence zone updates
     };
 } // namespace meshkernel
@@ -27,10 +27,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "MeshKernel/CurvilinearGrid/CurvilinearGrid.hpp"
 #include "MeshKernel/CurvilinearGrid/CurvilinearGridAlgorithm.hpp"
+#include "MeshKernel/CurvilinearGrid/CurvilinearGridCoordinates.hpp"
 #include "MeshKernel/UndoActions/UndoAction.hpp"
 
 namespace meshkernel
@@ -78,7 +81,12 @@ namespace meshkernel
                                       const double firstLengthSquared,
                                       const double secondLengthSquared) const;
 
-        UInt m_smoothingIterations;              ///< The orthogonalization parameters
-        lin_alg::Matrix<Point> m_gridNodesCache; ///< A cache for storing current iteration node positions
+        /// @brief Computes the nodes of the block smoothed by Solve, the nodes not frozen and not on a corner
+        void ComputeSmoothedNodes();
+
+        UInt m_smoothingIterations;                                      ///< The orthogonalization parameters
+        CurvilinearGridCoordinates m_gridNodesCache;                     ///< A cache for storing current iteration node positions
+        lin_alg::Matrix<std::uint8_t> m_isInternalNodeSmoothed;          ///< For each node, 1 if it is an internal node smoothed by Solve
+        std::vector<CurvilinearGridNodeIndices> m_boundaryNodesSmoothed; ///< The boundary nodes smoothed by Solve
     };
 } // namespace meshkernel
@@ -89,6 +89,10 @@ namespace meshkernel
         /// @brief Snap the mesh nodes to land boundaries (snap_to_landboundary)
         [[nodiscard]] std::unique_ptr<UndoAction> SnapMeshToLandBoundaries() const;
 
+        /// @brief Snap nodes to land boundaries, as SnapMeshToLandBoundaries but without modifying the mesh
+        /// @param[in,out] nodes The coordinates of the mesh nodes, to be snapped
+        void SnapNodesToLandBoundaries(std::vector<Point>& nodes) const;
+
         /// @brief Gets the number of land boundary nodes.
         /// @return The number of land boundary nodes.
         auto GetNumNodes() const { return m_landBoundary.GetNumNodes(); }
@@ -27,7 +27,10 @@
 
 #pragma once
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <span>
+#include <unordered_map>
 
 #include "MeshKernel/BoundingBox.hpp"
 #include "MeshKernel/Constants.hpp"
@@ -45,6 +48,7 @@
 #include "MeshKernel/UndoActions/ResetEdgeAction.hpp"
 #include "MeshKernel/UndoActions/ResetNodeAction.hpp"
 #include "MeshKernel/UndoActions/UndoAction.hpp"
+#include "Utilities/CompressedSparseRow.hpp"
 #include "Utilities/RTreeBase.hpp"
 
 /// \namespace meshkernel
@@ -152,7 +156,7 @@ namespace meshkernel
 
         /// @brief Get the number of valid faces
         /// @return The number of valid faces
-        [[nodiscard]] auto GetNumFaces() const { return static_cast<UInt>(m_facesNodes.size()); }
+        [[nodiscard]] auto GetNumFaces() const { return m_connectivityCompressed ? m_facesNodesCompressed.NumRows() : static_cast<UInt>(m_facesNodes.size()); }
 
         /// @brief Get the number of valid nodes
         /// @return The number of valid nodes
@@ -172,6 +176,41 @@ namespace meshkernel
         /// @return The number of valid faces
         [[nodiscard]] UInt GetNumFaceEdges(UInt faceIndex) const { return static_cast<UInt>(m_numFacesNodes[faceIndex]); }
 
+        /// @brief Enables or disables the compressed sparse row (CSR) storage of the node and face connectivity
+        ///
+        /// When enabled, the node-edge, face-node and face-edge tables are stored in CSR format after each administration,
+        /// and the nested vectors m_nodesEdges, m_facesNodes and m_facesEdges are released: the connectivity must then
+        /// be read with NodeEdges, FaceNodes and FaceEdges. The nested vectors are restored from the compressed tables
+        /// when the mesh requires a new administration, or by DecompressConnectivity before they are modified.
+        /// @param[in] enable True to enable the compressed storage, false to disable it
+        void SetCompressedConnectivity(bool enable);
+
+        /// @brief Determines if the compressed storage of the connectivity is enabled
+        [[nodiscard]] bool CompressedConnectivity() const { return m_compressedConnectivity; }
+
+        /// @brief Restores the nested vectors m_nodesEdges, m_facesNodes and m_facesEdges from the compressed tables
+        ///
+        /// To be called before modifying the nested vectors. Does nothing if the nested vectors are the storage.
+        void DecompressConnectivity();
+
+        /// @brief Gets the memory allocated by the node-edge, face-node and face-edge tables, in bytes, for profiling
+        [[nodiscard]] std::size_t ConnectivityMemoryUsage() const;
+
+        /// @brief Gets the edges connected to a node
+        /// @param[in] nodeIndex The node index
+        /// @return The edge indices, in counterclockwise order
+        [[nodiscard]] std::span<const UInt> NodeEdges(UInt nodeIndex) const;
+
+        /// @brief Gets the nodes of a face
+        /// @param[in] faceIndex The face index
+        /// @return The node indices, in counterclockwise order
+        [[nodiscard]] std::span<const UInt> FaceNodes(UInt faceIndex) const;
+
+        /// @brief Gets the edges of a face
+        /// @param[in] faceIndex The face index
+        /// @return The edge indices, in counterclockwise order
+        [[nodiscard]] std::span<const UInt> FaceEdges(UInt faceIndex) const;
+
         /// @brief Get the number of faces an edges shares
         /// @param[in] edgeIndex The edge index
         /// @return The number of faces an edges shares
@@ -205,6 +244,16 @@ namespace meshkernel
         /// @brief Set all nodes to a new set of values.
         void SetNodes(const std::vector<Point>& newValues);
 
+        /// @brief Swaps the nodes with a vector of new values, of the same size.
+        ///
+        /// Unlike SetNodes, the nodes are not copied and neither the RTrees nor the administration are invalidated.
+        /// Meant for algorithms iterating on the node coordinates, which call InvalidateNodes once done.
+        /// @param[in,out] newValues The new node values, the previous node values on return
+        void SwapNodes(std::vector<Point>& newValues);
+
+        /// @brief Invalidates the RTrees and the administration, after the nodes have been changed with SwapNodes
+        void InvalidateNodes();
+
         /// @brief Set a node to a new value, bypassing the undo action.
         void SetNode(const UInt index, const Point& newValue);
 
@@ -459,6 +508,29 @@ namespace meshkernel
         /// @param[in] value The value of the flag
         void SetFacesRTreeRequiresUpdate(bool value) { m_facesRTreeRequiresUpdate = value; }
 
+        /// @brief Set the fraction of changed nodes or edges above which the RTrees are rebuilt instead of updated
+        ///
+        /// Below this fraction, BuildTree only updates the nodes and edges changed since the last build.
+        /// @param[in] value The fraction, between 0 (always rebuild) and 1
+        void SetRTreeRebuildFraction(double value);
+
+        /// @brief The number of BuildTree requests for a location, by outcome
+        struct RTreeCacheStatistics
+        {
+            UInt hits = 0;    ///< The requests served by the existing RTree
+            UInt updates = 0; ///< The requests served by an incremental update of the RTree
+            UInt misses = 0;  ///< The requests requiring a full build of the RTree
+            UInt visited = 0; ///< The locations visited by the incremental updates to find the changed ones
+        };
+
+        /// @brief Gets the RTree cache statistics of a location, for profiling
+        /// @param[in] location The mesh location
+        /// @return The number of hits, updates and misses since the construction or the last reset
+        [[nodiscard]] const RTreeCacheStatistics& GetRTreeCacheStatistics(Location location) const { return m_rTreeCacheStatistics.at(location); }
+
+        /// @brief Resets the RTree cache statistics of all locations
+        void ResetRTreeCacheStatistics();
+
         /// @brief For a face create a closed polygon
         /// @param[in]     faceIndex         The face index
         /// @param[in,out] polygonNodesCache The cache array to be filled with the nodes values
@@ -472,6 +544,14 @@ namespace meshkernel
         /// This value should be in the range to 0 to 1
         double GetCircumcentreWeight() const;
 
+        /// @brief Gets the geometry generation, incremented each time node coordinates change
+        ///
+        /// Together with TopologyGeneration this can be used to key results computed from the mesh
+        std::uint64_t GeometryGeneration() const { return m_geometryGeneration; }
+
+        /// @brief Gets the topology generation, incremented each time the connectivity changes or is administrated again
+        std::uint64_t TopologyGeneration() const { return m_topologyGeneration; }
+
         // nodes
         std::vector<std::vector<UInt>> m_nodesEdges; ///< For each node, the indices of connected edges (nod%lin)
         std::vector<std::uint8_t> m_nodesNumEdges;   ///< For each node, the number of connected edges (nmk)
@@ -496,6 +576,9 @@ namespace meshkernel
         /// @brief Indicate if an administration is required
         void SetAdministrationRequired(const bool value);
 
+        /// @brief Stores the connectivity tables in CSR format, if the compressed storage is enabled
+        void CompressConnectivity();
+
         // Make private
         std::vector<Point> m_nodes; ///< The mesh nodes (xk, yk)
         std::vector<Edge> m_edges;  ///< The edges, defined as first and second node(kn)
@@ -504,12 +587,33 @@ namespace meshkernel
         static double constexpr m_minimumDeltaCoordinate = 1e-14; ///< Minimum delta coordinate
 
         // RTrees
-        bool m_nodesRTreeRequiresUpdate = true;                            ///< m_nodesRTree requires an update
-        bool m_edgesRTreeRequiresUpdate = true;                            ///< m_edgesRTree requires an update
-        bool m_facesRTreeRequiresUpdate = true;                            ///< m_facesRTree requires an update
-        bool m_administrationRequired = true;                              ///< Indicates if mesh administration requires an update
-        std::unordered_map<Location, std::unique_ptr<RTreeBase>> m_RTrees; ///< The RTrees to use
-        BoundingBox m_boundingBoxCache;                                    ///< Caches the last bounding box used for selecting the locations
+        bool m_nodesRTreeRequiresUpdate = true;                                    ///< m_nodesRTree requires an update
+        bool m_edgesRTreeRequiresUpdate = true;                                    ///< m_edgesRTree requires an update
+        bool m_facesRTreeRequiresUpdate = true;                                    ///< m_facesRTree requires an update
+        bool m_administrationRequired = true;                                      ///< Indicates if mesh administration requires an update
+        bool m_nodesEdgesRequiresUpdate = true;                                    ///< The edges of the nodes changed since the last administration, node moves excluded
+        std::unordered_map<Location, std::unique_ptr<RTreeBase>> m_RTrees;         ///< The RTrees to use
+        std::unordered_map<Location, BoundingBox> m_boundingBoxCache;              ///< Caches, for each location, the last bounding box used for selecting the locations
+        std::unordered_map<Location, RTreeCacheStatistics> m_rTreeCacheStatistics; ///< The RTree cache statistics of each location
+        std::vector<UInt> m_nodesRTreeChangedNodes;                                ///< The nodes changed since the last build of the nodes RTree
+        std::vector<UInt> m_edgesRTreeChangedNodes;                                ///< The nodes changed since the last build of the edges RTree
+        std::vector<UInt> m_edgesRTreeChangedEdges;                                ///< The edges changed since the last build of the edges RTree
+        double m_rTreeRebuildFraction = 0.1;                                       ///< The fraction of changed locations above which the RTrees are rebuilt
+
+        // Cached locations of the RTrees, valid while their generation matches the mesh generation
+        std::uint64_t m_geometryGeneration = 0;                                                  ///< Incremented at each change of the nodes
+        std::uint64_t m_topologyGeneration = 0;                                                  ///< Incremented at each change of the edges or of the administration
+        std::vector<Point> m_edgeCentres;                                                        ///< The cached edge centres
+        std::uint64_t m_edgeCentresGeneration = std::numeric_limits<std::uint64_t>::max();       ///< The mesh generation of the cached edge centres
+        std::vector<Point> m_faceCircumcenters;                                                  ///< The cached face circumcenters
+        std::uint64_t m_faceCircumcentersGeneration = std::numeric_limits<std::uint64_t>::max(); ///< The mesh generation of the cached face circumcenters
+
+        // Compressed connectivity
+        bool m_compressedConnectivity = false;            ///< Indicates if the connectivity is stored in CSR format after each administration
+        bool m_connectivityCompressed = false;            ///< The compressed tables are the storage, the nested vectors are released
+        CompressedSparseRow<UInt> m_nodesEdgesCompressed; ///< The compressed m_nodesEdges, out of date if not the storage
+        CompressedSparseRow<UInt> m_facesNodesCompressed; ///< The compressed m_facesNodes, out of date if not the storage
+        CompressedSparseRow<UInt> m_facesEdgesCompressed; ///< The compressed m_facesEdges, out of date if not the storage
 
         // These two circumcentre related members are to be kept.
         const CircumcentreMethod m_circumcentreMethod = constants::geometric::defaultCircumcentreMethod; ///< The circum-centre method
@@ -518,6 +622,41 @@ namespace meshkernel
         /// @brief Set nodes and edges that are not connected to be invalid.
         void SetUnConnectedNodesAndEdgesToInvalid(CompoundUndoAction* undoAction);
 
+        /// @brief Records a changed node, to update the nodes and edges RTrees instead of rebuilding them
+        /// @param[in] node The index of the changed node
+        void NodeChanged(UInt node);
+
+        /// @brief Requires a new administration after a node move, which does not change the edges of the nodes
+        void SetNodeMovedAdministrationRequired();
+
+        /// @brief Records a changed edge, to update the edges RTree instead of rebuilding it
+        /// @param[in] edge The index of the changed edge
+        void EdgeChanged(UInt edge);
+
+        /// @brief Records the nodes translated by a node translation action
+        /// @param[in] nodeIndices The indices of the translated nodes, empty if all nodes have been translated
+        void NodesTranslated(const std::vector<UInt>& nodeIndices);
+
+        /// @brief Gets the edge centres, computed again only if the mesh changed since they were cached
+        /// @param[in] isChanged True if the edges RTree requires an update, which invalidates the cache
+        const std::vector<Point>& CachedEdgeCentres(bool isChanged);
+
+        /// @brief Gets the face circumcenters, computed again only if the mesh changed since they were cached
+        /// @param[in] isChanged True if the faces RTree requires an update, which invalidates the cache
+        const std::vector<Point>& CachedFaceCircumcenters(bool isChanged);
+
+        /// @brief Gets the combined generation of the geometry and the topology, changes whenever one of them changes
+        std::uint64_t Generation() const { return m_geometryGeneration + m_topologyGeneration; }
+
+        /// @brief Updates the nodes RTree with the nodes changed since the last build
+        /// @param[in] boundingBox The bounding box used to build the tree
+        void UpdateNodesTree(const BoundingBox& boundingBox);
+
+        /// @brief Updates the edges RTree with the edges changed since the last build, and the edges of the changed nodes
+        /// @param[in] boundingBox The bounding box used to build the tree
+        /// @return The number of edges visited to find the changed ones
+        UInt UpdateEdgesTree(const BoundingBox& boundingBox);
+
         /// @brief Find all nodes that are connected to an edge.
         ///
         /// Also count the number of edges that have either invalid index values or
@@ -551,10 +690,27 @@ inline const meshkernel::Point& meshkernel::Mesh::Node(const UInt index) const
 inline void meshkernel::Mesh::SetNodes(const std::vector<Point>& newValues)
 {
     m_nodes = newValues;
+    InvalidateNodes();
+}
+
+inline void meshkernel::Mesh::SwapNodes(std::vector<Point>& newValues)
+{
+    if (newValues.size() != m_nodes.size())
+    {
+        throw ConstraintError("The number of new nodes, {}, does not match the number of nodes, {}.", newValues.size(), m_nodes.size());
+    }
+
+    m_nodes.swap(newValues);
+    ++m_geometryGeneration;
+}
+
+inline void meshkernel::Mesh::InvalidateNodes()
+{
+    ++m_geometryGeneration;
     m_nodesRTreeRequiresUpdate = true;
     m_edgesRTreeRequiresUpdate = true;
     m_facesRTreeRequiresUpdate = true;
-    m_administrationRequired = true;
+    SetAdministrationRequired(true);
 }
 
 inline const meshkernel::Edge& meshkernel::Mesh::GetEdge(const UInt index) const
@@ -574,8 +730,9 @@ inline void meshkernel::Mesh::SetEdge(const UInt index, const Edge& edge)
         throw ConstraintError("The edge index, {}, is not in range.", index);
     }
 
-    m_administrationRequired = true;
+    SetAdministrationRequired(true);
     m_edges[index] = edge;
+    EdgeChanged(index);
 }
 
 inline const std::vector<meshkernel::Edge>& meshkernel::Mesh::Edges() const
@@ -586,10 +743,41 @@ inline const std::vector<meshkernel::Edge>& meshkernel::Mesh::Edges() const
 inline void meshkernel::Mesh::SetEdges(const std::vector<Edge>& newValues)
 {
     m_edges = newValues;
+    ++m_topologyGeneration;
     m_nodesRTreeRequiresUpdate = true;
     m_edgesRTreeRequiresUpdate = true;
     m_facesRTreeRequiresUpdate = true;
-    m_administrationRequired = true;
+    SetAdministrationRequired(true);
+}
+
+inline std::span<const meshkernel::UInt> meshkernel::Mesh::NodeEdges(const UInt nodeIndex) const
+{
+    if (m_connectivityCompressed)
+    {
+        return m_nodesEdgesCompressed[nodeIndex];
+    }
+
+    return {m_nodesEdges[nodeIndex].data(), m_nodesNumEdges[nodeIndex]};
+}
+
+inline std::span<const meshkernel::UInt> meshkernel::Mesh::FaceNodes(const UInt faceIndex) const
+{
+    if (m_connectivityCompressed)
+    {
+        return m_facesNodesCompressed[faceIndex];
+    }
+
+    return m_facesNodes[faceIndex];
+}
+
+inline std::span<const meshkernel::UInt> meshkernel::Mesh::FaceEdges(const UInt faceIndex) const
+{
+    if (m_connectivityCompressed)
+    {
+        return m_facesEdgesCompressed[faceIndex];
+    }
+
+    return m_facesEdges[faceIndex];
 }
 
 inline bool meshkernel::Mesh::AdministrationRequired() const
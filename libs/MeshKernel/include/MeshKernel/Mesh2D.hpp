@@ -27,7 +27,10 @@
 
 #pragma once
 #include <array>
+#include <cstdint>
+#include <memory>
 #include <ranges>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -108,6 +111,26 @@ namespace meshkernel
         /// @brief Perform complete administration
         void Administrate(CompoundUndoAction* undoAction = nullptr) override;
 
+        /// @brief The version of the snapshot format written by WriteSnapshot
+        static constexpr std::uint32_t SnapshotVersion = 1;
+
+        /// @brief Writes the mesh and its administration to a binary snapshot file
+        ///
+        /// The mesh is administrated first. The snapshot stores the nodes, the edges, the node-edge, edge-face,
+        /// face-node and face-edge connectivity, the face areas and mass centres, the node types and the inner boundary polygons.
+        /// The file has a header of 64 bytes with the format version, the byte order, the projection, the number of
+        /// nodes, edges and faces and a checksum, followed by the arrays, each preceded by its size and aligned to 8 bytes.
+        /// @param[in] fileName The name of the snapshot file
+        void WriteSnapshot(const std::string& fileName);
+
+        /// @brief Reads a mesh from a snapshot file written by WriteSnapshot
+        ///
+        /// The file is memory mapped and its arrays are copied into the mesh: no administration is performed.
+        /// The header, the checksum and the ranges of the connectivity indices are checked.
+        /// @param[in] fileName The name of the snapshot file
+        /// @return The mesh, administrated
+        [[nodiscard]] static std::unique_ptr<Mesh2D> ReadSnapshot(const std::string& fileName);
+
         /// @brief Compute face mass center
         void ComputeFaceAreaAndMassCenters(bool computeMassCenters = false);
 
@@ -262,9 +285,12 @@ namespace meshkernel
         [[nodiscard]] std::unique_ptr<UndoAction> DeleteHangingEdges();
 
         /// @brief For a collection of points, compute the face indices including them.
+        ///
+        /// The faces are located in parallel with a Mesh2DPointLocator, consecutive points are located
+        /// with a walk from the face of the previous point.
         /// @param[in] points The input point vector.
         /// @return The face indices including the points.
-        [[nodiscard]] std::vector<UInt> PointFaceIndices(const std::vector<Point>& points);
+        [[nodiscard]] std::vector<UInt> PointFaceIndices(const std::vector<Point>& points) const;
 
         /// @brief Deletes a mesh in a polygon, using several options (delnet)
         /// @param[in] polygon        The polygon where to perform the operation
@@ -470,25 +496,25 @@ namespace meshkernel
         /// If no faces are marked for deletion then return a nullptr for the undo-action
         std::unique_ptr<UndoAction> UpdateFaceInformation(const std::vector<UInt>& faceIndices, const bool appendDeletedFaces);
 
-        /// @brief Find cells recursive, works with an arbitrary number of edges
-        /// @param[in] startNode The starting node
-        /// @param[in] node The current node
-        /// @param[in] previousEdge The previously visited edge
-        /// @param[in] numClosingEdges The number of edges closing a face (3 for triangles, 4 for quads, etc)
-        /// @param[in,out] edges The vector storing the current edges forming a face
-        /// @param[in,out] nodes The vector storing the current nodes forming a face
-        /// @param[in,out] sortedEdges The caching array used for sorting the edges, used to inquire if an edge has been already visited
-        /// @param[in,out] sortedNodes The caching array used for sorting the nodes, used to inquire if a node has been already visited
-        /// @param[in,out] nodalValues The nodal values building a closed polygon
-        void FindFacesRecursive(UInt startNode,
-                                UInt node,
-                                UInt previousEdge,
-                                UInt numClosingEdges,
-                                std::vector<UInt>& edges,
-                                std::vector<UInt>& nodes,
-                                std::vector<UInt>& sortedEdges,
-                                std::vector<UInt>& sortedNodes,
-                                std::vector<Point>& nodalValues);
+        /// @brief The half-edges of the mesh, each edge is traversed once from each of its nodes
+        ///
+        /// The half-edges starting at a node are stored contiguously, in the counterclockwise order of m_nodesEdges.
+        struct HalfEdges
+        {
+            std::vector<UInt> offsets; ///< The first half-edge of each node, has size number of nodes + 1
+            std::vector<UInt> nodes;   ///< The start node of each half-edge
+            std::vector<UInt> edges;   ///< The edge of each half-edge
+            std::vector<UInt> next;    ///< The next half-edge along the face on the left of each half-edge
+        };
+
+        /// @brief Computes the half-edges and the links to the next half-edge around each face
+        /// @returns The half-edges
+        [[nodiscard]] HalfEdges ComputeHalfEdges() const;
+
+        /// @brief Computes, for each half-edge, the face sizes for which a walk along the next half-edges returns to its start node
+        /// @param[in] halfEdges The half-edges
+        /// @returns For each half-edge, bit k is set if the walk of k edges is closed
+        [[nodiscard]] std::vector<std::uint8_t> ComputeClosingWalks(const HalfEdges& halfEdges) const;
 
         /// @brief Checks if a triangle has an acute angle (checktriangle)
         /// @param[in] faceNodes The face nodes composing the triangles
@@ -0,0 +1,113 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "MeshKernel/BoundingBox.hpp"
+#include "MeshKernel/Definitions.hpp"
+#include "MeshKernel/Point.hpp"
+#include "MeshKernel/Utilities/PackedBoxTree.hpp"
+
+namespace meshkernel
+{
+    class Mesh2D;
+
+    /// @brief Locates the faces of a Mesh2D containing points
+    ///
+    /// The bounding boxes of the faces are stored in a PackedBoxTree. A point is located by testing only the faces whose bounding box
+    /// contains it, directly on the mesh nodes. When a start face is given, the point is first searched with a
+    /// visibility walk across the face edges, if the point is close to the start face.
+    ///
+    /// Points inside a face are located exactly. A point on the boundary of several faces is
+    /// assigned to the one with the lowest index, regardless of the start face.
+    /// The locator keeps a reference to the mesh, it must be rebuilt when the mesh changes.
+    class Mesh2DPointLocator
+    {
+    public:
+        /// @brief The maximum number of faces visited by a walk, before falling back to the hierarchy
+        static constexpr UInt MaximumWalkSteps = 16;
+
+        /// @brief The distance around the start face, in units of its size, within which a point is located with a walk
+        static constexpr double WalkExtent = 2.0;
+
+        /// @brief The number of consecutive points located by one thread in FindFaces
+        static constexpr UInt ChunkSize = 256;
+
+        /// @brief Constructor, builds the hierarchy of the face bounding boxes
+        /// @param[in] mesh The mesh, with an up to date administration
+        explicit Mesh2DPointLocator(const Mesh2D& mesh);
+
+        /// @brief Finds the face containing a point
+        /// @param[in] point The point
+        /// @return The face index, constants::missing::uintValue if the point is outside the mesh
+        [[nodiscard]] UInt FindFace(const Point& point) const;
+
+        /// @brief Finds the face containing a point, walking from a start face
+        /// @param[in] point     The point
+        /// @param[in] startFace The face to start the walk from, usually the face of a previous nearby point
+        /// @return The face index, constants::missing::uintValue if the point is outside the mesh
+        [[nodiscard]] UInt FindFace(const Point& point, UInt startFace) const;
+
+        /// @brief Finds the faces containing a sequence of points, in parallel
+        ///
+        /// The points are split into chunks of consecutive points. Within a chunk, each walk starts from the face of
+        /// the previous point, so ordered points, for example along a polyline, are located in a few steps.
+        /// @param[in] points The points
+        /// @return For each point, the face index or constants::missing::uintValue if the point is outside the mesh
+        [[nodiscard]] std::vector<UInt> FindFaces(std::span<const Point> points) const;
+
+    private:
+        /// @brief The position of a point with respect to a face
+        enum class Containment
+        {
+            Outside,   ///< The point is outside the face
+            Inside,    ///< The point is strictly inside the face
+            OnBoundary ///< The point is on an edge or a node of the face
+        };
+
+        /// @brief Determines the position of a point with respect to a face
+        [[nodiscard]] Containment Classify(const Point& point, UInt face) const;
+
+        /// @brief Finds the face containing a point by traversing the hierarchy
+        [[nodiscard]] UInt Search(const Point& point) const;
+
+        /// @brief Determines if a point is close enough to a start face to be located with a walk
+        [[nodiscard]] bool IsWithinWalkExtent(const Point& point, UInt startFace) const;
+
+        /// @brief Walks from a start face towards a point
+        /// @return The face strictly containing the point, constants::missing::uintValue if the walk fails
+        [[nodiscard]] UInt Walk(const Point& point, UInt startFace) const;
+
+        const Mesh2D& m_mesh;               ///< The mesh
+        PackedBoxTree m_tree;               ///< The hierarchy of the face bounding boxes, the items are the faces
+        bool m_isSphericalAccurate = false; ///< The walk is disabled for accurate spherical meshes, their edges are not straight
+    };
+
+} // namespace meshkernel
@@ -37,6 +37,6 @@ namespace meshkernel::algo
     void ComputeEdgeCentres(const Mesh& mesh, std::span<Point> edgeCentres);
 
     /// @brief Return the centre point of the edge
-    static Point ComputeEdgeCentre(const Mesh& mesh, const UInt edgeId);
+    Point ComputeEdgeCentre(const Mesh& mesh, const UInt edgeId);
 
 } // namespace meshkernel::algo
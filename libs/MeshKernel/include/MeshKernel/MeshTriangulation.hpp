@@ -43,67 +43,6 @@
 namespace meshkernel
 {
 
-    /// @brief A simple bounded stack
-    template <const UInt Dimension>
-    class BoundedStack
-    {
-    public:
-        /// @brief Number of elements in the array
-        UInt size() const
-        {
-            return m_size;
-        }
-
-        /// @brief Add an element to the end of the array
-        void push_back(const UInt index)
-        {
-            if (m_size == Dimension - 1)
-            {
-                throw ConstraintError("array already at size limit: {}", Dimension);
-            }
-
-            m_indices[m_size] = index;
-            ++m_size;
-        }
-
-        /// @brief Get the element at the position
-        UInt operator[](const UInt index) const
-        {
-            return m_indices[index];
-        }
-
-        /// @brief Get the element at the position
-        UInt& operator[](const UInt index)
-        {
-            return m_indices[index];
-        }
-
-        /// @brief The iterator at the start of the array
-        std::array<UInt, Dimension>::const_iterator begin() const
-        {
-            return m_indices.begin();
-        }
-
-        /// @brief The iterator at the end of the array
-        std::array<UInt, Dimension>::const_iterator end() const
-        {
-            return m_indices.begin() + m_size;
-        }
-
-        /// @brief Does the array contain the element value or not.
-        bool contains(const UInt index) const
-        {
-            return std::find(begin(), end(), index) != end();
-        }
-
-    private:
-        /// @brief stack based array containing the values.
-        std::array<UInt, Dimension> m_indices;
-
-        /// @brief The current number of elements in the array
-        UInt m_size = 0;
-    };
-
     /// @brief Contains a mesh triangulated from a set of points.
     ///
     /// Contains the original set of nodes, the edges connecting nodes
@@ -152,14 +91,28 @@ namespace meshkernel
         /// May return invalid identifier in one or both values
         const std::array<UInt, 2>& GetFaceIds(const UInt edgeId) const;
 
-        /// @brief Find the nearest face to the point
+        /// @brief Find the face containing the point.
+        ///
+        /// The search walks through the triangulation from the face with the nearest centre.
+        /// Returns the invalid identifier if the point lies outside the triangulation.
+        /// Can be called concurrently from several threads.
         UInt FindNearestFace(const Point& pnt) const;
 
+        /// @brief Find the face containing the point, walking through the triangulation from the start face.
+        ///
+        /// The walk is short if the start face is close to the point, e.g. the face of the previous point
+        /// when the points are spatially sorted. If the start face is the invalid identifier, the walk starts
+        /// from the face with the nearest centre. Can be called concurrently from several threads.
+        UInt FindFace(const Point& pnt, const UInt startFaceId) const;
+
         /// @brief Determine if the point lies within the element
         bool PointIsInElement(const Point& pnt, const UInt faceId) const;
 
     private:
-        static constexpr UInt MaximumNumberOfEdgesPerNode = 16; ///< Maximum number of edges per node
+        /// @brief Walk from the start face towards the point, crossing an edge separating the current face from the point.
+        ///
+        /// Returns the face containing the point or the invalid identifier if the walk leaves the triangulation.
+        UInt WalkToFace(const Point& pnt, const UInt startFaceId) const;
 
         /// @brief Compute the triangulation.
         void Compute(const std::span<const double>& xNodes,
@@ -170,7 +123,6 @@ namespace meshkernel
         std::vector<UInt> m_edgeNodes;                 ///< Edge nodes flat array passed to the triangulation library
         std::vector<UInt> m_faceEdges;                 ///< Face edges flat array passed to the triangulation library
         std::vector<std::array<UInt, 2>> m_edgesFaces; ///< edge-face connectivity, generated from triangulation data
-        std::vector<std::vector<UInt>> m_nodesEdges;   ///< node-edge connectivity, generated from triangulation data
 
         std::vector<Point> m_elementCentres; ///< Array of the centres of the elements
 
@@ -179,7 +131,6 @@ namespace meshkernel
 
         Projection m_projection = Projection::cartesian; ///< The projection used
         std::unique_ptr<RTreeBase> m_elementCentreRTree; ///< RTree of element centres
-        std::unique_ptr<RTreeBase> m_nodeRTree;          ///< RTree of mesh nods
     };
 
 } // namespace meshkernel
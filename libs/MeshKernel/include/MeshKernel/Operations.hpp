@@ -89,15 +89,15 @@ namespace meshkernel
     }
 
     /// @brief Find index of a certain element
-    /// @param[in] vec The vector to search in
+    /// @param[in] values The values to search in
     /// @param[in] el The element to search for
     /// @returns The index of element
     template <typename T>
-    [[nodiscard]] UInt FindIndex(const std::vector<T>& vec, T el)
+    [[nodiscard]] UInt FindIndex(std::span<const T> values, T el)
     {
-        for (UInt n = 0; n < vec.size(); n++)
+        for (UInt n = 0; n < values.size(); n++)
         {
-            if (vec[n] == el)
+            if (values[n] == el)
             {
                 return n;
             }
@@ -106,6 +106,16 @@ namespace meshkernel
         return constants::missing::uintValue;
     }
 
+    /// @brief Find index of a certain element
+    /// @param[in] vec The vector to search in
+    /// @param[in] el The element to search for
+    /// @returns The index of element
+    template <typename T>
+    [[nodiscard]] UInt FindIndex(const std::vector<T>& vec, T el)
+    {
+        return FindIndex(std::span<const T>(vec), el);
+    }
+
     /// @brief Find the next index in the vector, wraps around when current is the last index
     template <typename T>
     UInt FindNextIndex(const std::vector<T>& vec, UInt current)
@@ -33,6 +33,7 @@
 #include <MeshKernel/Parameters.hpp>
 #include <MeshKernel/Smoother.hpp>
 #include <MeshKernel/UndoActions/UndoAction.hpp>
+#include <MeshKernel/Utilities/CompressedSparseRow.hpp>
 
 namespace meshkernel
 {
@@ -79,10 +80,29 @@ namespace meshkernel
     ///     boundaries. An OpenMP parallelization is used in
     ///     `OrthogonalizationAndSmoothing::Solve` because the update
     ///     of the nodal coordinates is made iteration-independent.
+    ///     The updated coordinates are computed in a second buffer, which is swapped with the mesh nodes.
+    ///     With the multicolour Gauss-Seidel solver (`OrthogonalizationParameters::inner_solver`), the nodes are
+    ///     coloured such that no node reads a node of its own colour. The colours are updated one after the other,
+    ///     in place in the buffer, and the nodes of a colour are updated in parallel.
+    ///     In `OrthogonalizationAndSmoothing::Compute`, the mesh RTrees and administration are invalidated
+    ///     once per outer iteration instead of after each inner iteration.
+    ///
+    /// -   A convergence check: the node displacement of each inner iteration (maximum or root mean square,
+    ///     see `OrthogonalizationParameters::displacement_norm`) is stored as residual. `OrthogonalizationAndSmoothing::Compute`
+    ///     ends the inner iterations once the residual drops below `OrthogonalizationParameters::displacement_tolerance`,
+    ///     and the outer iterations once the maximum edge orthogonality drops below `OrthogonalizationParameters::orthogonality_tolerance`
+    ///     or the first inner iteration of an outer iteration has converged.
     class OrthogonalizationAndSmoothing
     {
 
     public:
+        /// @brief The solver of the inner iterations
+        enum class InnerSolver
+        {
+            Jacobi = 0,                ///< All nodes are updated from the previous iterate
+            MulticolourGaussSeidel = 1 ///< The nodes of each colour are updated from the latest iterate
+        };
+
         /// Set the parameters
         /// @param[in] mesh The mesh to orthogonalize
         /// @param[in] polygon The polygon where orthogonalization should occur
@@ -110,6 +130,15 @@ namespace meshkernel
         /// @brief Finalize the outer iteration, computes new mu and face areas, masscenters, circumcenters
         void FinalizeOuterIteration();
 
+        /// @brief Gets the node displacement of each inner iteration performed since the initialization
+        [[nodiscard]] const std::vector<double>& Residuals() const { return m_residuals; }
+
+        /// @brief Gets the number of colours of the multicolour Gauss-Seidel solver, zero for the Jacobi solver
+        [[nodiscard]] UInt NumColours() const { return m_colouredNodes.NumRows(); }
+
+        /// @brief Gets the maximum edge orthogonality after each outer iteration of \ref Compute, only computed if the orthogonality tolerance is set
+        [[nodiscard]] const std::vector<double>& OrthogonalityResiduals() const { return m_orthogonalityResiduals; }
+
     private:
         /// @brief Get the node type
         MeshNodeType GetNodeType(const UInt nodeId) const { return m_nodesTypes[nodeId]; }
@@ -120,25 +149,51 @@ namespace meshkernel
                                            UInt& leftNode,
                                            UInt& rightNode) const;
 
-        /// @brief Project mesh nodes back to the original mesh boundary (orthonet_project_on_boundary)
+        /// @brief Project the updated boundary nodes back to the original mesh boundary (orthonet_project_on_boundary)
         void SnapMeshToOriginalMeshBoundary();
 
+        /// @brief Project an updated boundary node back to the original mesh boundary
+        /// @param[in] n The index of the boundary node
+        void SnapNodeToOriginalMeshBoundary(UInt n);
+
+        /// @brief Performs an inner iteration, without invalidating the mesh RTrees and administration
+        /// @returns The node displacement of the iteration, also appended to the residuals
+        double UpdateNodes();
+
+        /// @brief Determines if the node is moved by the inner iterations
+        [[nodiscard]] bool IsNodeUpdated(UInt nodeIndex) const;
+
+        /// @brief Colours the nodes moved by the inner iterations, such that no node reads the coordinates of a node of its own colour
+        void ComputeNodeColours();
+
+        /// @brief Computes the norm of the displacement between the current mesh nodes and the orthogonalized nodes
+        [[nodiscard]] double ComputeDisplacement();
+
+        /// @brief Computes the maximum orthogonality of the mesh edges
+        [[nodiscard]] double ComputeMaximumOrthogonality() const;
+
+        /// @brief Determines if a residual is below a tolerance, a zero tolerance disables the check
+        [[nodiscard]] static bool IsConverged(double residual, double tolerance) { return tolerance > 0.0 && residual <= tolerance; }
+
         /// @brief Assembles the contributions of smoother and orthogonalizer
         void ComputeLinearSystemTerms();
 
         /// Computes how much the coordinates of a node need to be incremented at each inner iteration.
         /// @param[in] nodeIndex The node index
+        /// @param[in] nodes The current node coordinates
         /// @param[out] dx0 The computed x increment
         /// @param[out] dy0 The computed y increment
         /// @param[out] weightsSum The sum of the weights in x and y
         void ComputeLocalIncrements(UInt nodeIndex,
+                                    const std::vector<Point>& nodes,
                                     double& dx0,
                                     double& dy0,
                                     std::array<double, 2>& weightsSum);
 
         /// @brief Update the nodal coordinates based on the increments
         /// @param[in] nodeIndex
-        void UpdateNodeCoordinates(UInt nodeIndex);
+        /// @param[in] nodes The current node coordinates, the mesh nodes (Jacobi) or the orthogonalized nodes (Gauss-Seidel)
+        void UpdateNodeCoordinates(UInt nodeIndex, const std::vector<Point>& nodes);
 
         /// @brief Allocate linear system vectors
         void AllocateLinearSystem();
@@ -157,10 +212,14 @@ namespace meshkernel
         LandBoundaries::ProjectToLandBoundaryOption m_projectToLandBoundaryOption; ///< The project to land boundary option
         OrthogonalizationParameters m_orthogonalizationParameters;                 ///< The orthogonalization parameters
 
-        std::vector<UInt> m_localCoordinatesIndices; ///< Used in sphericalAccurate projection (iloc)
-        std::vector<Point> m_localCoordinates;       ///< Used in sphericalAccurate projection (xloc,yloc)
-        std::vector<Point> m_orthogonalCoordinates;  ///< A copy of the mesh node, orthogonalized
-        std::vector<Point> m_originalNodes;          ///< The original mesh
+        std::vector<UInt> m_localCoordinatesIndices;  ///< Used in sphericalAccurate projection (iloc)
+        std::vector<Point> m_localCoordinates;        ///< Used in sphericalAccurate projection (xloc,yloc)
+        std::vector<Point> m_orthogonalCoordinates;   ///< The orthogonalized mesh nodes, swapped with the mesh nodes after each inner iteration
+        std::vector<Point> m_originalNodes;           ///< The original mesh
+        std::vector<UInt> m_boundaryNodes;            ///< The nodes projected to the original mesh boundary
+        std::vector<double> m_squaredDisplacements;   ///< The squared node displacements of the last inner iteration
+        std::vector<double> m_residuals;              ///< The node displacement of each inner iteration
+        std::vector<double> m_orthogonalityResiduals; ///< The maximum edge orthogonality after each outer iteration
 
         // Linear system terms
         std::vector<UInt> m_compressedEndNodeIndex;   ///< Start index in m_compressedWeightX
@@ -169,6 +228,7 @@ namespace meshkernel
         std::vector<double> m_compressedWeightY;      ///< The computed weights Y
         std::vector<double> m_compressedRhs;          ///< The right hand side
         std::vector<UInt> m_compressedNodesNodes;     ///< The indices of the neighbouring nodes
+        CompressedSparseRow<UInt> m_colouredNodes;    ///< The nodes of each colour, for the multicolour Gauss-Seidel solver
 
         // run-time parameters
         double m_mumax = 0.0; ///< Mumax stored for runtime
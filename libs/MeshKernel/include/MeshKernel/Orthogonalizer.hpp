@@ -27,9 +27,11 @@
 
 #pragma once
 
+#include <array>
 #include <vector>
 
 #include "MeshKernel/Definitions.hpp"
+#include "MeshKernel/Utilities/CompressedSparseRow.hpp"
 
 namespace meshkernel
 {
@@ -78,7 +80,7 @@ namespace meshkernel
         const std::vector<std::vector<UInt>>& m_nodesNodes; ///< Node-node connectivity
         const std::vector<MeshNodeType>& m_nodeType;        ///< Type of each node
         std::vector<double> m_aspectRatios;                 ///< Aspect ratios
-        std::vector<std::vector<double>> m_weights;         ///< Weights
-        std::vector<std::vector<double>> m_rhs;             ///< Right hand side
+        CompressedSparseRow<double> m_weights;              ///< Weights, for each node and connected edge
+        std::vector<std::array<double, 2>> m_rhs;           ///< Right hand side
     };
 } // namespace meshkernel
@@ -253,6 +253,18 @@ namespace meshkernel
 
         /// @brief Factor between smoother 1d0 and area-homogenizer 0d0
         double areal_to_angle_smoothing_factor = 1.0;
+
+        /// @brief Node displacement below which the inner iterations of mesh2d orthogonalization stop (0.0 disables the criterion)
+        double displacement_tolerance = 0.0;
+
+        /// @brief Norm of the node displacements used as residual, the maximum (0) or the root mean square (1)
+        int displacement_norm = 0;
+
+        /// @brief Maximum edge orthogonality below which the outer iterations of mesh2d orthogonalization stop (0.0 disables the criterion)
+        double orthogonality_tolerance = 0.0;
+
+        /// @brief Solver of the mesh2d inner iterations, Jacobi (0) or multicolour Gauss-Seidel (1)
+        int inner_solver = 0;
     };
 
     inline static void CheckOrthogonalizationParameters(OrthogonalizationParameters const& parameters)
@@ -263,6 +275,10 @@ namespace meshkernel
         range_check::CheckInClosedInterval(parameters.orthogonalization_to_smoothing_factor, {0.0, 1.0}, "Orthogonalization-to-smoothing_factor");
         range_check::CheckInClosedInterval(parameters.orthogonalization_to_smoothing_factor_at_boundary, {0.0, 1.0}, "orthogonalization-to-smoothing factor at boundary");
         range_check::CheckInClosedInterval(parameters.areal_to_angle_smoothing_factor, {0.0, 1.0}, "area to angle smoothing factor");
+        range_check::CheckGreaterEqual(parameters.displacement_tolerance, 0.0, "Displacement tolerance");
+        range_check::CheckOneOf(parameters.displacement_norm, {0, 1}, "Displacement norm");
+        range_check::CheckGreaterEqual(parameters.orthogonality_tolerance, 0.0, "Orthogonality tolerance");
+        range_check::CheckOneOf(parameters.inner_solver, {0, 1}, "Inner solver");
     }
 
     /// @brief Parameters used by the sample interpolation
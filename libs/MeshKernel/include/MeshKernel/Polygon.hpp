@@ -31,8 +31,10 @@
 #include <vector>
 
 #include "MeshKernel/BoundingBox.hpp"
+#include "MeshKernel/Cartesian3DPoint.hpp"
 #include "MeshKernel/Definitions.hpp"
 #include "MeshKernel/Point.hpp"
+#include "MeshKernel/Utilities/PolygonSlabIndex.hpp"
 
 namespace meshkernel
 {
@@ -43,6 +45,11 @@ namespace meshkernel
     /// @brief A closed polygon.
     ///
     /// A polygon consists of at least 3 distinct points, and 1 point to close the polygon.
+    ///
+    /// The data used by the point containment queries is prepared when the polygon is constructed:
+    /// the segments of large Cartesian and spherical polygons are indexed in horizontal slabs, such that a query
+    /// only tests the segments crossing the slab of the point, and the 3D coordinates of accurate spherical
+    /// polygons are computed once. Nodes modified through the non-const Node accessor are not accounted for.
     class Polygon
     {
     public:
@@ -97,6 +104,8 @@ namespace meshkernel
         const BoundingBox& GetBoundingBox() const;
 
         /// @brief Determine if the polygon contains the point
+        ///
+        /// The query only reads the polygon, concurrent queries are thread safe.
         bool Contains(const Point& point) const;
 
         /// @brief Snap the section of the polygon defined by start- and end-index to the land boundary
@@ -201,6 +210,12 @@ namespace meshkernel
         /// @brief Check polygon has a valid state and initialise it.
         void Initialise();
 
+        /// @brief Prepare the data used by the containment queries, the slab index or the 3D coordinates
+        void PrepareContainment();
+
+        /// @brief Update the winding number with the crossing of a segment, returns true if the point lies on the segment
+        bool UpdateWindingNumber(UInt segment, const Point& point, int& windingNumber) const;
+
         /// @brief Determine if the polygon contains the point for Cartesian coordinate system
         ///
         /// Also for spherical coordinates
@@ -217,6 +232,15 @@ namespace meshkernel
 
         /// @brief The bounding box containing the polygon
         BoundingBox m_boundingBox;
+
+        /// @brief The minimum number of nodes of a Cartesian or spherical polygon for which the segments are indexed
+        static constexpr UInt MinimumNumberOfIndexedNodes = 64;
+
+        /// @brief The segments of the polygon, indexed in horizontal slabs
+        PolygonSlabIndex m_slabIndex;
+
+        /// @brief The 3D coordinates of the nodes of an accurate spherical polygon, enlarged around the polygon centre
+        std::vector<Cartesian3DPoint> m_cartesian3DNodes;
     };
 
 } // namespace meshkernel
@@ -68,6 +68,11 @@ namespace meshkernel
         /// @brief Get the number of nodes of size of the sample data.
         UInt Size() const override;
 
+        /// @brief Get the sample point
+        Point SamplePoint(const UInt index) const override;
+
+        using SampleInterpolator::Interpolate;
+
         /// @brief Interpolate the sample data set at the interpolation nodes.
         void Interpolate(const int propertyId, const std::span<const Point> iterpolationNodes, std::span<double> result) const override;
 
@@ -83,6 +88,21 @@ namespace meshkernel
         /// can be obtained using the Interpolate function above.
         double InterpolateValue(const int propertyId, const Point& evaluationPoint) const override;
 
+        /// @brief Determine if the interpolation can be expressed as an interpolation operator
+        ///
+        /// Only the simple averaging and inverse weighted distance methods are linear in the sample values.
+        bool CanComputeOperator() const override;
+
+        /// @brief Compute the operator interpolating any sample data set at the interpolation nodes.
+        ///
+        /// Only available for the simple averaging and inverse weighted distance methods.
+        SampleInterpolationOperator ComputeOperator(const std::span<const Point> interpolationNodes) const override;
+
+        /// @brief Compute the operator interpolating any sample data set at the location (nodes, edges, faces) of the mesh.
+        ///
+        /// Only available for the simple averaging and inverse weighted distance methods.
+        SampleInterpolationOperator ComputeOperator(const Mesh2D& mesh, const Location location) const override;
+
     private:
         static constexpr UInt MaximumNumberOfEdgesPerNode = 16; ///< Maximum number of edges per node
 
@@ -97,6 +117,7 @@ namespace meshkernel
                                 std::vector<Point>& polygon,
                                 const Point& interpolationPoint,
                                 const Projection projection,
+                                std::vector<UInt>& queryCache,
                                 std::vector<Sample>& sampleCache) const;
 
         /// @brief Compute the search radius
@@ -110,15 +131,33 @@ namespace meshkernel
                                    std::vector<Point>& polygon,
                                    const Projection projection) const;
 
-        /// @brief Get the sample value at the index from the rtree result cache
-        double GetSampleValueFromRTree(const int propertyId, const UInt index) const;
+        /// @brief Find the samples of an interpolation point, within its search polygon or the closest sample
+        ///
+        /// The polygon is scaled to the search polygon.
+        /// @returns True if the closest sample is used as it is, because none was found within the search radius
+        bool FindPolygonSamples(std::vector<Point>& polygon,
+                                const Point& interpolationPoint,
+                                const Projection projection,
+                                std::vector<UInt>& sampleIndices) const;
+
+        /// @brief Throws if the averaging method cannot be expressed as an interpolation operator
+        void CheckOperatorMethod() const;
+
+        /// @brief Compute the operator row averaging the samples, with the weights of the averaging method
+        SampleInterpolationOperator::Row ComputeRow(const Point& interpolationPoint,
+                                                    const std::vector<UInt>& sampleIndices) const;
+
+        /// @brief Compute the operator row of the samples found within a polygon
+        SampleInterpolationOperator::Row ComputeRowOnPolygon(std::vector<Point>& polygon,
+                                                             const Point& interpolationPoint,
+                                                             const Projection projection,
+                                                             std::vector<UInt>& queryCache) const;
 
-        /// @brief Compute the average from the neighbours.
-        double ComputeInterpolationResultFromNeighbors(const int propertyId,
-                                                       const Point& interpolationPoint,
-                                                       const std::vector<Point>& searchPolygon,
-                                                       const Projection projection,
-                                                       std::vector<Sample>& sampleCache) const;
+        /// @brief Compute the operator rows at the mesh nodes
+        std::vector<SampleInterpolationOperator::Row> ComputeRowsAtNodes(const Mesh2D& mesh) const;
+
+        /// @brief Compute the operator rows at the face centres
+        std::vector<SampleInterpolationOperator::Row> ComputeRowsAtFaces(const Mesh2D& mesh) const;
 
         /// @brief Interpolate at the mesh nodes
         void InterpolateAtNodes(const int propertyId, const Mesh2D& mesh,
@@ -156,6 +195,11 @@ namespace meshkernel
 
 } // namespace meshkernel
 
+inline meshkernel::Point meshkernel::SampleAveragingInterpolator::SamplePoint(const UInt index) const
+{
+    return m_samplePoints[index];
+}
+
 inline meshkernel::UInt meshkernel::SampleAveragingInterpolator::Size() const
 {
     return static_cast<UInt>(m_samplePoints.size());
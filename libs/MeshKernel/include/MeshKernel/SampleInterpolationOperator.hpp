@@ -0,0 +1,111 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "MeshKernel/Definitions.hpp"
+#include "MeshKernel/Entities.hpp"
+
+namespace meshkernel
+{
+
+    /// @brief The geometric part of a sample interpolation, stored as a sparse weight matrix.
+    ///
+    /// Each row holds the indices of the samples contributing to an interpolated value and their weights,
+    /// in compressed sparse row format. Once computed, the operator can be applied to any number of
+    /// sample data sets defined at the same sample points, without locating the interpolation points again.
+    class SampleInterpolationOperator
+    {
+    public:
+        /// @brief How the weighted sum of the sample values of a row gives the interpolated value
+        enum class Normalisation
+        {
+            None,     ///< The weighted sum, missing if any sample value of the row is missing
+            WeightSum ///< The weighted sum of the valid sample values divided by the sum of their weights, missing if below the minimum weight sum of the row
+        };
+
+        /// @brief The samples contributing to a single interpolated value
+        struct Row
+        {
+            std::vector<UInt> sampleIndices; ///< The indices of the contributing samples
+            std::vector<double> weights;     ///< The weight of each contributing sample
+            double minimumWeightSum = 0.0;   ///< The minimum sum of the weights of the valid samples (WeightSum normalisation only)
+        };
+
+        /// @brief Default constructor, an operator without rows
+        SampleInterpolationOperator() = default;
+
+        /// @brief Constructor
+        /// @param[in] numberOfSamples The number of sample points the operator applies to
+        /// @param[in] normalisation   How the interpolated values are computed from the weighted sums
+        /// @param[in] rows            The rows of the operator, an empty row gives a missing value
+        SampleInterpolationOperator(UInt numberOfSamples, Normalisation normalisation, const std::vector<Row>& rows);
+
+        /// @brief Averages the values of pairs of rows, for example from the mesh nodes to the mesh edges.
+        ///
+        /// The result of a pair is missing if any of the two row values is missing.
+        /// @param[in] rowPairs The pairs of row indices, each pair gives one interpolated value
+        void SetRowPairs(std::vector<Edge> rowPairs);
+
+        /// @brief Gets the number of sample points the operator applies to
+        [[nodiscard]] UInt NumberOfSamples() const { return m_numberOfSamples; }
+
+        /// @brief Gets the number of rows
+        [[nodiscard]] UInt NumberOfRows() const { return static_cast<UInt>(m_offsets.size() - 1); }
+
+        /// @brief Gets the number of interpolated values
+        [[nodiscard]] UInt Size() const { return m_rowPairs.empty() ? NumberOfRows() : static_cast<UInt>(m_rowPairs.size()); }
+
+        /// @brief Gets the indices of the samples contributing to a row
+        [[nodiscard]] std::span<const UInt> RowSampleIndices(UInt row) const;
+
+        /// @brief Gets the weights of the samples contributing to a row
+        [[nodiscard]] std::span<const double> RowWeights(UInt row) const;
+
+        /// @brief Interpolates a sample data set
+        /// @param[in]  sampleValues The sample values, one for each sample point
+        /// @param[out] result       The interpolated values, must have the operator size
+        void Apply(std::span<const double> sampleValues, std::span<double> result) const;
+
+    private:
+        /// @brief Computes the values of all rows
+        void ApplyRows(std::span<const double> sampleValues, std::span<double> rowValues) const;
+
+        UInt m_numberOfSamples = 0;                          ///< The number of sample points
+        Normalisation m_normalisation = Normalisation::None; ///< How the interpolated values are computed
+        std::vector<UInt> m_offsets{0};                      ///< The start of each row in m_sampleIndices, has size number of rows + 1
+        std::vector<UInt> m_sampleIndices;                   ///< The indices of the contributing samples of all rows
+        std::vector<double> m_weights;                       ///< The weights of the contributing samples of all rows
+        std::vector<double> m_minimumWeightSums;             ///< The minimum weight sum of each row
+        std::vector<Edge> m_rowPairs;                        ///< The pairs of rows averaged to give the interpolated values, if not empty
+    };
+
+} // namespace meshkernel
@@ -43,6 +43,7 @@
 #include "MeshKernel/MeshTriangulation.hpp"
 #include "MeshKernel/Operations.hpp"
 #include "MeshKernel/Point.hpp"
+#include "MeshKernel/SampleInterpolationOperator.hpp"
 #include "MeshKernel/Utilities/RTreeFactory.hpp"
 
 namespace meshkernel
@@ -58,9 +59,18 @@ namespace meshkernel
         /// @brief Set sample data
         void SetData(const int propertyId, const std::span<const double> sampleData);
 
+        /// @brief Remove the sample data set
+        void RemoveData(const int propertyId);
+
         /// @brief Get the number of sample points
         virtual UInt Size() const = 0;
 
+        /// @brief Get the sample point
+        virtual Point SamplePoint(const UInt index) const = 0;
+
+        /// @brief Determine if the sample points are the same as the points given
+        bool HasSamePoints(const std::span<const double> xNodes, const std::span<const double> yNodes) const;
+
         /// @brief Determine if the SampleInterpolator already has this sample set.
         bool Contains(const int propertyId) const;
 
@@ -81,6 +91,32 @@ namespace meshkernel
         /// can be obtained using the Interpolate function above.
         virtual double InterpolateValue(const int propertyId, const Point& evaluationPoint) const = 0;
 
+        /// @brief Interpolate several sample data sets at the location (nodes, edges, faces) of the mesh.
+        ///
+        /// The result of the i-th property is stored from i * (result size / number of properties).
+        /// The interpolation points are located only once, if the interpolation can be expressed as an operator.
+        void Interpolate(const std::span<const int> propertyIds, const Mesh2D& mesh, const Location location, std::span<double> result) const;
+
+        /// @brief Determine if the interpolation can be expressed as an interpolation operator
+        virtual bool CanComputeOperator() const;
+
+        /// @brief Compute the operator interpolating any sample data set at the interpolation nodes.
+        ///
+        /// Applying the operator gives the same values as the Interpolate function, without locating the nodes again.
+        virtual SampleInterpolationOperator ComputeOperator(const std::span<const Point> interpolationNodes) const = 0;
+
+        /// @brief Compute the operator interpolating any sample data set at the location (nodes, edges, faces) of the mesh.
+        virtual SampleInterpolationOperator ComputeOperator(const Mesh2D& mesh, const Location location) const = 0;
+
+        /// @brief Store an interpolation operator, to be applied to any of the sample data sets
+        void SetOperator(const int operatorId, SampleInterpolationOperator interpolationOperator);
+
+        /// @brief Determine if the SampleInterpolator already has this operator.
+        bool ContainsOperator(const int operatorId) const;
+
+        /// @brief Interpolate the sample data set using a stored interpolation operator.
+        void ApplyOperator(const int propertyId, const int operatorId, std::span<double> result) const;
+
     protected:
         /// @brief Get the sample property data for the id.
         const std::vector<double>& GetSampleData(const int propertyId) const;
@@ -88,6 +124,9 @@ namespace meshkernel
     private:
         /// @brief Map from sample id (int) to sample data.
         std::map<int, std::vector<double>> m_sampleData;
+
+        /// @brief Map from operator id (int) to interpolation operator.
+        std::map<int, SampleInterpolationOperator> m_operators;
     };
 
 } // namespace meshkernel
@@ -96,3 +135,13 @@ inline bool meshkernel::SampleInterpolator::Contains(const int propertyId) const
 {
     return m_sampleData.contains(propertyId);
 }
+
+inline bool meshkernel::SampleInterpolator::CanComputeOperator() const
+{
+    return true;
+}
+
+inline bool meshkernel::SampleInterpolator::ContainsOperator(const int operatorId) const
+{
+    return m_operators.contains(operatorId);
+}
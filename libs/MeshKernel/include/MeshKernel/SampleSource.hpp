@@ -0,0 +1,143 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "MeshKernel/Entities.hpp"
+
+namespace meshkernel
+{
+    /// @brief A source of samples read in chunks, so that sample sets larger than the memory can be processed
+    class SampleSource
+    {
+    public:
+        /// @brief Virtual destructor
+        virtual ~SampleSource() = default;
+
+        /// @brief Gets the number of samples
+        [[nodiscard]] virtual std::uint64_t Size() const = 0;
+
+        /// @brief Reads consecutive samples
+        /// @param[in]  first   The index of the first sample to read
+        /// @param[in]  count   The number of samples to read
+        /// @param[out] samples The samples read, resized to count
+        virtual void Read(std::uint64_t first, UInt count, std::vector<Sample>& samples) const = 0;
+
+        /// @brief Calls a function for each chunk of samples, in the order of the source
+        /// @param[in] chunkSize The maximum number of samples in a chunk
+        /// @param[in] function  The function, called with the index of the first sample of the chunk and the samples of the chunk
+        template <class Function>
+        void ForEachChunk(UInt chunkSize, Function&& function) const;
+    };
+
+    /// @brief A sample source reading from samples in memory
+    class SampleVectorSource final : public SampleSource
+    {
+    public:
+        /// @brief Constructor
+        /// @param[in] samples The samples, not copied: they must outlive the source
+        explicit SampleVectorSource(std::span<const Sample> samples) : m_samples(samples) {}
+
+        /// @brief Gets the number of samples
+        [[nodiscard]] std::uint64_t Size() const override { return m_samples.size(); }
+
+        /// @brief Reads consecutive samples
+        /// @param[in]  first   The index of the first sample to read
+        /// @param[in]  count   The number of samples to read
+        /// @param[out] samples The samples read, resized to count
+        void Read(std::uint64_t first, UInt count, std::vector<Sample>& samples) const override;
+
+    private:
+        std::span<const Sample> m_samples; ///< The samples
+    };
+
+    /// @brief A sample source reading from a memory mapped binary sample file
+    ///
+    /// The file starts with a header of 16 bytes: the 8 characters of MagicNumber followed by the number of samples,
+    /// an unsigned 64 bit integer. The samples follow, each as three 64 bit floating point values: x, y and value.
+    /// All numbers are stored in the byte order of the machine writing the file.
+    /// Only the pages of the file being read are loaded in memory by the operating system.
+    class MappedSampleFile final : public SampleSource
+    {
+    public:
+        /// @brief The characters identifying a sample file
+        static constexpr char MagicNumber[8] = {'M', 'K', 'S', 'A', 'M', 'P', 'L', '1'};
+
+        /// @brief The size in bytes of the file header
+        static constexpr std::uint64_t HeaderSize = sizeof(MagicNumber) + sizeof(std::uint64_t);
+
+        /// @brief The size in bytes of a sample in the file
+        static constexpr std::uint64_t RecordSize = 3 * sizeof(double);
+
+        /// @brief Maps a sample file in memory
+        /// @param[in] fileName The name of the sample file
+        explicit MappedSampleFile(const std::string& fileName);
+
+        /// @brief Writes samples to a sample file
+        /// @param[in] fileName The name of the sample file
+        /// @param[in] samples  The samples
+        static void Write(const std::string& fileName, std::span<const Sample> samples);
+
+        /// @brief Gets the number of samples
+        [[nodiscard]] std::uint64_t Size() const override { return m_size; }
+
+        /// @brief Reads consecutive samples
+        /// @param[in]  first   The index of the first sample to read
+        /// @param[in]  count   The number of samples to read
+        /// @param[out] samples The samples read, resized to count
+        void Read(std::uint64_t first, UInt count, std::vector<Sample>& samples) const override;
+
+    private:
+        boost::interprocess::file_mapping m_file;    ///< The mapped file
+        boost::interprocess::mapped_region m_region; ///< The mapped region, the whole file
+        std::uint64_t m_size = 0;                    ///< The number of samples
+    };
+
+} // namespace meshkernel
+
+template <class Function>
+void meshkernel::SampleSource::ForEachChunk(UInt chunkSize, Function&& function) const
+{
+    std::vector<Sample> chunk;
+
+    for (std::uint64_t first = 0; first < Size(); first += chunkSize)
+    {
+        const auto count = static_cast<UInt>(std::min<std::uint64_t>(chunkSize, Size() - first));
+        Read(first, count, chunk);
+        function(first, std::span<const Sample>(chunk));
+    }
+}
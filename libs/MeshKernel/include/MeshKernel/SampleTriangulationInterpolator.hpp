@@ -27,7 +27,9 @@
 
 #pragma once
 
+#include <array>
 #include <map>
+#include <optional>
 #include <span>
 #include <vector>
 
@@ -64,6 +66,11 @@ namespace meshkernel
         /// @brief Get the number of nodes of size of the sample data.
         UInt Size() const override;
 
+        /// @brief Get the sample point
+        Point SamplePoint(const UInt index) const override;
+
+        using SampleInterpolator::Interpolate;
+
         /// @brief Interpolate the sample data at the points for the location (nodes, edges, faces)
         void Interpolate(const int propertyId, const Mesh2D& mesh, const Location location,
                          std::span<double> result,
@@ -71,6 +78,9 @@ namespace meshkernel
                          std::span<double> yCoordinates = std::span<double>{}) const override;
 
         /// @brief Interpolate the sample data set at the interpolation nodes.
+        ///
+        /// The nodes are interpolated in parallel, the element containing a node is found by walking
+        /// from the element of the previous node, so spatially sorted nodes are located faster.
         void Interpolate(const int propertyId, const std::span<const Point> iterpolationNodes,
                          std::span<double> result) const override;
 
@@ -80,7 +90,26 @@ namespace meshkernel
         /// can be obtained using the Interpolate function above.
         double InterpolateValue(const int propertyId, const Point& evaluationPoint) const override;
 
+        /// @brief Compute the operator interpolating any sample data set at the interpolation nodes.
+        SampleInterpolationOperator ComputeOperator(const std::span<const Point> interpolationNodes) const override;
+
+        /// @brief Compute the operator interpolating any sample data set at the points for the location (nodes, edges, faces)
+        SampleInterpolationOperator ComputeOperator(const Mesh2D& mesh, const Location location) const override;
+
     private:
+        /// @brief Get the interpolation points of the location (nodes, edges, faces) of the mesh
+        static std::span<const Point> GetLocationPoints(const Mesh2D& mesh, const Location location, std::vector<Point>& meshPoints);
+
+        /// @brief Compute the barycentric weights of the element nodes at the interpolation point.
+        ///
+        /// No weights are computed if the element is degenerate.
+        std::optional<std::array<double, 3>> ComputeBarycentricWeights(const UInt elementId, const Point& interpolationPoint) const;
+
+        /// @brief Compute the linear interpolation weights of the element nodes at the interpolation point.
+        ///
+        /// The row is empty if the element is degenerate.
+        SampleInterpolationOperator::Row ComputeRowOnElement(const UInt elementId, const Point& interpolationPoint) const;
+
         /// @brief Interpolate the sample data on the element at the interpolation point.
         double InterpolateOnElement(const UInt elementId, const Point& interpolationPoint, const std::vector<double>& sampleValues) const;
 
@@ -90,6 +119,11 @@ namespace meshkernel
 
 } // namespace meshkernel
 
+inline meshkernel::Point meshkernel::SampleTriangulationInterpolator::SamplePoint(const UInt index) const
+{
+    return m_triangulation.GetNode(index);
+}
+
 inline meshkernel::UInt meshkernel::SampleTriangulationInterpolator::Size() const
 {
     return m_triangulation.NumberOfNodes();
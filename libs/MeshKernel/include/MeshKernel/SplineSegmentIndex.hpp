@@ -0,0 +1,100 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <vector>
+
+#include "MeshKernel/BoundingBox.hpp"
+#include "MeshKernel/Definitions.hpp"
+#include "MeshKernel/Point.hpp"
+#include "MeshKernel/Utilities/PackedBoxTree.hpp"
+
+namespace meshkernel
+{
+    /// @brief A static spatial index of the segments connecting the nodes of splines
+    ///
+    /// Two segments can only cross if their bounding boxes overlap. The bounding boxes of the segments are
+    /// stored in a PackedBoxTree, so the candidate crossing segments are found in O((n + k) log n), for n segments and k candidates, instead of testing all segment pairs.
+    ///
+    /// The segments are straight lines in the coordinate space only for Cartesian projections: for spherical
+    /// projections all segments are candidates. The index does not keep a reference to the splines, it must be
+    /// rebuilt when the splines change.
+    class SplineSegmentIndex
+    {
+    public:
+        /// @brief A segment of a spline
+        struct Segment
+        {
+            UInt spline;  ///< The spline index
+            UInt segment; ///< The segment index, connecting the spline nodes segment and segment + 1
+        };
+
+        /// @brief Two segments of different splines with overlapping bounding boxes
+        struct SegmentPair
+        {
+            UInt firstSpline;   ///< The index of the first spline, smaller than the index of the second spline
+            UInt secondSpline;  ///< The index of the second spline
+            UInt firstSegment;  ///< The segment index in the first spline
+            UInt secondSegment; ///< The segment index in the second spline
+        };
+
+        /// @brief The relative amount by which the segment bounding boxes are enlarged, so touching segments are found despite rounding
+        static constexpr double RelativeMargin = 1.0e-8;
+
+        /// @brief Constructor, builds the hierarchy of the segment bounding boxes
+        /// @param[in] splineNodes The nodes of each spline
+        /// @param[in] projection  The projection of the spline nodes
+        SplineSegmentIndex(const std::vector<std::vector<Point>>& splineNodes, Projection projection);
+
+        /// @brief Finds the segments whose bounding box overlaps the bounding box of a segment
+        /// @param[in]  first    The first point of the segment
+        /// @param[in]  second   The second point of the segment
+        /// @param[out] segments The segments found, sorted by spline and segment index
+        void FindSegments(const Point& first, const Point& second, std::vector<Segment>& segments) const;
+
+        /// @brief Finds all pairs of segments of different splines with overlapping bounding boxes, in parallel
+        /// @return The pairs, sorted by first spline, second spline, first segment and second segment index
+        [[nodiscard]] std::vector<SegmentPair> FindSegmentPairs() const;
+
+        /// @brief Determines if the segments are indexed, false for spherical projections where all segments are candidates
+        [[nodiscard]] bool IsIndexed() const { return m_isIndexed; }
+
+    private:
+        /// @brief Computes the bounding box of a segment, enlarged by the relative margin
+        [[nodiscard]] static BoundingBox SegmentBoundingBox(const Point& first, const Point& second);
+
+        /// @brief Finds the indices of the segments whose bounding box overlaps a box, all segments if not indexed
+        void Search(const BoundingBox& box, std::vector<UInt>& segmentIndices) const;
+
+        std::vector<Segment> m_segments; ///< The segments of all splines, in spline and segment order
+        PackedBoxTree m_tree;            ///< The hierarchy of the segment bounding boxes, the items are the indices in m_segments
+        bool m_isIndexed = true;         ///< False for spherical projections, where all segments are candidates
+    };
+
+} // namespace meshkernel
@@ -32,8 +32,13 @@
 #include "MeshKernel/Entities.hpp"
 #include "MeshKernel/LandBoundary.hpp"
 #include "MeshKernel/Operations.hpp"
+#include "MeshKernel/SplineSegmentIndex.hpp"
 #include "MeshKernel/Utilities/LinearAlgebra.hpp"
 
+#include <optional>
+#include <span>
+#include <utility>
+
 namespace meshkernel
 {
     class CurvilinearGrid;
@@ -48,6 +53,9 @@ namespace meshkernel
     {
 
     public:
+        /// @brief The indices of a segment of a first spline and of a segment of a second spline
+        using SegmentIndices = std::pair<UInt, UInt>;
+
         /// @brief Default constructor
         Splines() = default;
 
@@ -105,6 +113,41 @@ namespace meshkernel
                                  std::vector<double>& xCrossOver,
                                  std::vector<double>& yCrossOver) const;
 
+        /// @brief Computes the intersection of a spline with all splines, testing only the segments found in an index
+        /// @param[in]  spline        The spline nodes
+        /// @param[in]  segmentIndex  The index of the segments of all splines
+        /// @param[out] splineIndices The indices of the splines crossed
+        /// @param[out] angles        The crossing angles
+        /// @param[out] xCrossOver    The x-coordinates of the intersections
+        /// @param[out] yCrossOver    The y-coordinates of the intersections
+        void GetAllIntersections(const std::vector<Point>& spline,
+                                 const SplineSegmentIndex& segmentIndex,
+                                 std::vector<int>& splineIndices,
+                                 std::vector<double>& angles,
+                                 std::vector<double>& xCrossOver,
+                                 std::vector<double>& yCrossOver) const;
+
+        /// @brief Computes the intersection of two splines, testing only candidate pairs of crossing segments (sect3r)
+        ///
+        /// The result is the same as testing all segment pairs, if the pairs not given do not cross.
+        /// @param[in] first The index of the first spline
+        /// @param[in] second The index of the second spline
+        /// @param[in] segmentPairs The segments of the first and second spline that may cross, sorted by first then second segment
+        /// @param[out] crossProductIntersection The cross product of the intersection
+        /// @param[out] intersectionAngle The angle of the intersection
+        /// @param[out] intersectionPoint The intersection point
+        /// @param[out] firstSplineRatio The ratio of the first spline length where the intersection occurs
+        /// @param[out] secondSplineRatio The ratio of the second spline length where the intersection occurs
+        /// @returns If a valid intersection is found
+        bool GetSplinesIntersection(UInt first,
+                                    UInt second,
+                                    std::span<const SegmentIndices> segmentPairs,
+                                    double& crossProductIntersection,
+                                    double& intersectionAngle,
+                                    Point& intersectionPoint,
+                                    double& firstSplineRatio,
+                                    double& secondSplineRatio) const;
+
         /// @brief Computes the intersection of two splines (sect3r)
         /// @param[in] first The index of the first spline
         /// @param[in] second The index of the second spline
@@ -190,11 +233,13 @@ namespace meshkernel
         Projection m_projection = Projection::cartesian;     ///< The map projection
 
     private:
+        /// @brief Computes the intersection of two splines, from all segment pairs or from candidate segment pairs only
         /// @returns If a valid intersection is found
         bool GetSplinesIntersection(const std::vector<Point>& firstSpline,
                                     const std::vector<Point>& firstSplineDerivative,
                                     const std::vector<Point>& secondSpline,
                                     const std::vector<Point>& secondSplineDerivative,
+                                    std::optional<std::span<const SegmentIndices>> segmentPairs,
                                     double& crossProductIntersection,
                                     double& intersectionAngle,
                                     Point& intersectionPoint,
@@ -0,0 +1,105 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <vector>
+
+#include "MeshKernel/AveragingInterpolation.hpp"
+#include "MeshKernel/Definitions.hpp"
+#include "MeshKernel/Mesh2D.hpp"
+#include "MeshKernel/MeshInterpolation.hpp"
+#include "MeshKernel/SampleSource.hpp"
+
+namespace meshkernel
+{
+    /// @brief Averaging interpolation of samples streamed from a SampleSource, computed tile by tile with bounded memory
+    ///
+    /// The interpolation locations are distributed over a regular grid of tiles. For each tile, the bounding box of the
+    /// search areas of its locations is computed and the sample source is streamed in chunks, keeping only the samples
+    /// inside that box. The locations of the tile are then interpolated as by AveragingInterpolation.
+    /// Each location belongs to exactly one tile and its search area is fully covered by the samples of the tile,
+    /// so the results are identical to the ones of AveragingInterpolation on all samples, whatever the number of tiles.
+    ///
+    /// The samples outside the search areas are never stored: the memory used depends on the density of the samples
+    /// around a tile, not on the size of the source. Use more tiles to use less memory, at the cost of more passes over the source.
+    ///
+    /// Using the closest sample if none is found and transforming the samples are not supported, because both require
+    /// all samples at once.
+    class TiledAveragingInterpolation : public MeshInterpolation
+    {
+    public:
+        /// @brief The default number of samples read at once from the source
+        static constexpr UInt DefaultChunkSize = 1 << 20;
+
+        /// @brief Constructor
+        /// @param[in] mesh                 The input mesh
+        /// @param[in] samples              The sample source, read at each computation
+        /// @param[in] method               The averaging method to use
+        /// @param[in] locationType         The location type (faces, edges, nodes)
+        /// @param[in] relativeSearchRadius The relative search radius, used to enlarge the search area when looking for samples
+        /// @param[in] minNumSamples        The minimum a of samples used for certain interpolation algorithms
+        /// @param[in] numTilesPerDirection The number of tiles in the x and in the y direction
+        /// @param[in] chunkSize            The number of samples read at once from the source
+        TiledAveragingInterpolation(Mesh2D& mesh,
+                                    const SampleSource& samples,
+                                    AveragingInterpolation::Method method,
+                                    Location locationType,
+                                    double relativeSearchRadius,
+                                    UInt minNumSamples,
+                                    UInt numTilesPerDirection,
+                                    UInt chunkSize = DefaultChunkSize);
+
+        /// @brief Compute interpolation
+        void Compute() override;
+
+        /// @brief Gets the largest number of samples held at once by the last computation
+        [[nodiscard]] UInt GetMaximumTileSize() const { return m_maximumTileSize; }
+
+    private:
+        /// @brief Assigns the locations to the tiles
+        /// @param[in] interpolationPoints The interpolation point of each location
+        /// @return The locations of each tile, in increasing order
+        [[nodiscard]] std::vector<std::vector<UInt>> ComputeTileLocations(const std::vector<Point>& interpolationPoints) const;
+
+        /// @brief Reads the samples inside a bounding box from the source
+        /// @param[in]  boundingBox The bounding box
+        /// @param[out] samples     The samples inside the bounding box, in the order of the source
+        void ReadSamples(const BoundingBox& boundingBox, std::vector<Sample>& samples) const;
+
+        Mesh2D& m_mesh;                          ///< Reference to the mesh
+        const SampleSource& m_samples;           ///< The sample source
+        AveragingInterpolation::Method m_method; ///< The averaging method
+        Location m_interpolationLocation;        ///< Interpolation location
+        double m_relativeSearchRadius;           ///< Relative search radius
+        UInt m_minNumSamples;                    ///< The minimum number of samples for certain averaging methods
+        UInt m_numTilesPerDirection;             ///< The number of tiles in each direction
+        UInt m_chunkSize;                        ///< The number of samples read at once
+        UInt m_maximumTileSize = 0;              ///< The largest number of samples held at once
+    };
+} // namespace meshkernel
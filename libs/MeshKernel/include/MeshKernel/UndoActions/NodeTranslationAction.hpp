@@ -67,6 +67,9 @@ namespace meshkernel
         /// @brief Get the number of bytes used by this object.
         std::uint64_t MemorySize() const override;
 
+        /// @brief Get the indices of the translated nodes, empty if all nodes have been translated
+        const std::vector<UInt>& NodeIndices() const { return m_nodeIndices; }
+
     protected:
         /// @brief Get the number of nodes
         UInt NumberOfNodes() const;
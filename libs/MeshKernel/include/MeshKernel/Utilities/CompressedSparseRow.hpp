@@ -0,0 +1,165 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include "MeshKernel/Definitions.hpp"
+
+namespace meshkernel
+{
+    /// @brief A table of rows of varying length, stored in compressed sparse row (CSR) format.
+    ///
+    /// The values of all rows are stored contiguously, the row r spans [offsets[r], offsets[r + 1]).
+    /// Compared to a std::vector<std::vector<T>>, the table uses two allocations instead of one per row,
+    /// and the values of consecutive rows are adjacent in memory.
+    ///
+    /// @tparam T The type of the values
+    template <typename T>
+    class CompressedSparseRow
+    {
+    public:
+        /// @brief Default constructor, an empty table
+        CompressedSparseRow() = default;
+
+        /// @brief Constructs the table from the leading values of each row of a nested vector
+        /// @param[in] rows     The nested vector
+        /// @param[in] rowSizes The number of values to take from each row
+        template <typename Size>
+        CompressedSparseRow(const std::vector<std::vector<T>>& rows, const std::vector<Size>& rowSizes)
+        {
+            Assign(rows, rowSizes);
+        }
+
+        /// @brief Constructs the table from all values of a nested vector
+        /// @param[in] rows The nested vector
+        explicit CompressedSparseRow(const std::vector<std::vector<T>>& rows)
+        {
+            Assign(rows);
+        }
+
+        /// @brief Replaces the content of the table with the leading values of each row of a nested vector
+        /// @param[in] rows     The nested vector
+        /// @param[in] rowSizes The number of values to take from each row
+        template <typename Size>
+        void Assign(const std::vector<std::vector<T>>& rows, const std::vector<Size>& rowSizes)
+        {
+            SetRowSizes(rowSizes);
+            for (UInt r = 0; r < NumRows(); ++r)
+            {
+                std::copy_n(rows[r].begin(), RowSize(r), m_values.begin() + m_offsets[r]);
+            }
+        }
+
+        /// @brief Replaces the content of the table with all values of a nested vector
+        /// @param[in] rows The nested vector
+        void Assign(const std::vector<std::vector<T>>& rows)
+        {
+            std::vector<UInt> rowSizes(rows.size());
+            std::ranges::transform(rows, rowSizes.begin(), [](const auto& row)
+                                   { return static_cast<UInt>(row.size()); });
+            Assign(rows, rowSizes);
+        }
+
+        /// @brief Sets the number of values of each row, and fills all values with a value
+        /// @param[in] rowSizes The number of values of each row
+        /// @param[in] value    The fill value
+        template <typename Size>
+        void SetRowSizes(const std::vector<Size>& rowSizes, const T& value = T{})
+        {
+            m_offsets.resize(rowSizes.size() + 1);
+            m_offsets[0] = 0;
+            for (UInt r = 0; r < rowSizes.size(); ++r)
+            {
+                m_offsets[r + 1] = m_offsets[r] + static_cast<UInt>(rowSizes[r]);
+            }
+            m_values.assign(m_offsets.back(), value);
+        }
+
+        /// @brief Converts the table to a nested vector, for algorithms working on nested vectors
+        [[nodiscard]] std::vector<std::vector<T>> ToNested() const
+        {
+            std::vector<std::vector<T>> rows(NumRows());
+            for (UInt r = 0; r < NumRows(); ++r)
+            {
+                rows[r].assign(m_values.begin() + m_offsets[r], m_values.begin() + m_offsets[r + 1]);
+            }
+            return rows;
+        }
+
+        /// @brief Removes all rows, keeping the allocated memory
+        void Clear()
+        {
+            m_offsets.clear();
+            m_values.clear();
+        }
+
+        /// @brief Gets the values of a row
+        [[nodiscard]] std::span<T> operator[](UInt row)
+        {
+            return {m_values.data() + m_offsets[row], m_values.data() + m_offsets[row + 1]};
+        }
+
+        /// @brief Gets the values of a row
+        [[nodiscard]] std::span<const T> operator[](UInt row) const
+        {
+            return {m_values.data() + m_offsets[row], m_values.data() + m_offsets[row + 1]};
+        }
+
+        /// @brief Gets the number of values of a row
+        [[nodiscard]] UInt RowSize(UInt row) const { return m_offsets[row + 1] - m_offsets[row]; }
+
+        /// @brief Gets the number of rows
+        [[nodiscard]] UInt NumRows() const { return m_offsets.empty() ? 0 : static_cast<UInt>(m_offsets.size() - 1); }
+
+        /// @brief Gets the number of values of all rows
+        [[nodiscard]] UInt NumValues() const { return static_cast<UInt>(m_values.size()); }
+
+        /// @brief Determines if the table has no rows
+        [[nodiscard]] bool Empty() const { return m_offsets.empty(); }
+
+        /// @brief Gets the offset of each row in the values, followed by the number of values
+        [[nodiscard]] std::span<const UInt> Offsets() const { return m_offsets; }
+
+        /// @brief Gets the values of all rows
+        [[nodiscard]] std::span<const T> Values() const { return m_values; }
+
+        /// @brief Gets the memory allocated by the table, in bytes
+        [[nodiscard]] std::size_t MemoryUsage() const
+        {
+            return m_offsets.capacity() * sizeof(UInt) + m_values.capacity() * sizeof(T);
+        }
+
+    private:
+        std::vector<UInt> m_offsets; ///< The offset of each row in m_values, followed by the number of values
+        std::vector<T> m_values;     ///< The values of all rows
+    };
+
+} // namespace meshkernel
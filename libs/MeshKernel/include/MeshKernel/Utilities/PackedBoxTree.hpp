@@ -0,0 +1,131 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "MeshKernel/BoundingBox.hpp"
+#include "MeshKernel/Definitions.hpp"
+
+#include <boost/container/small_vector.hpp>
+
+namespace meshkernel
+{
+    /// @brief A static hierarchy of the bounding boxes of items, bulk loaded with the sort-tile-recursive (STR) algorithm
+    ///
+    /// The items are sorted such that each run of NodeCapacity consecutive items forms a leaf, and each run of
+    /// NodeCapacity consecutive nodes forms a node of the level above. The item ids and the bounding boxes of
+    /// all levels are stored in contiguous arrays. The items with an empty bounding box are not indexed.
+    class PackedBoxTree
+    {
+    public:
+        /// @brief The number of children of a node, and the number of items in a leaf
+        static constexpr UInt NodeCapacity = 16;
+
+        /// @brief Default constructor, an empty tree
+        PackedBoxTree() = default;
+
+        /// @brief Constructor, builds the hierarchy in parallel
+        /// @param[in] itemBoxes The bounding box of each item, the item ids are the indices in the vector
+        explicit PackedBoxTree(std::vector<BoundingBox> itemBoxes);
+
+        /// @brief Gets the number of items, including those not indexed
+        [[nodiscard]] UInt NumberOfItems() const { return static_cast<UInt>(m_itemBoxes.size()); }
+
+        /// @brief Gets the bounding box of an item
+        [[nodiscard]] const BoundingBox& ItemBox(UInt item) const { return m_itemBoxes[item]; }
+
+        /// @brief Finds the items whose bounding box overlaps a box
+        /// @param[in]  box   The box
+        /// @param[out] items The ids of the items found, in hierarchy order
+        void Search(const BoundingBox& box, std::vector<UInt>& items) const;
+
+        /// @brief Calls a function for each item whose bounding box overlaps a box, in hierarchy order
+        /// @param[in] box      The box
+        /// @param[in] function The function, called with the item id, returning false to stop the search
+        template <class Function>
+        void Search(const BoundingBox& box, Function&& function) const;
+
+    private:
+        /// @brief Gets the number of nodes at a level, level 0 being the leaves
+        [[nodiscard]] UInt NumberOfNodes(UInt level) const { return m_levelOffsets[level + 1] - m_levelOffsets[level]; }
+
+        std::vector<BoundingBox> m_itemBoxes; ///< The bounding box of each item, in item order
+        std::vector<UInt> m_items;            ///< The indexed items, in hierarchy order
+        std::vector<BoundingBox> m_boxes;     ///< The bounding boxes of the nodes of all levels, leaves first
+        std::vector<UInt> m_levelOffsets;     ///< The offset of each level in m_boxes, followed by the number of boxes
+    };
+
+} // namespace meshkernel
+
+template <class Function>
+void meshkernel::PackedBoxTree::Search(const BoundingBox& box, Function&& function) const
+{
+    if (m_items.empty())
+    {
+        return;
+    }
+
+    // depth first traversal, the stack holds the levels and indices of the nodes to visit
+    boost::container::small_vector<std::pair<UInt, UInt>, 4 * NodeCapacity> stack;
+    const auto rootLevel = static_cast<UInt>(m_levelOffsets.size() - 2);
+    stack.emplace_back(rootLevel, 0);
+
+    while (!stack.empty())
+    {
+        const auto [level, node] = stack.back();
+        stack.pop_back();
+
+        if (!m_boxes[m_levelOffsets[level] + node].Overlaps(box))
+        {
+            continue;
+        }
+
+        const auto begin = node * NodeCapacity;
+        if (level > 0)
+        {
+            const auto end = std::min(begin + NodeCapacity, NumberOfNodes(level - 1));
+            for (auto child = begin; child < end; ++child)
+            {
+                stack.emplace_back(level - 1, child);
+            }
+            continue;
+        }
+
+        const auto end = std::min(begin + NodeCapacity, static_cast<UInt>(m_items.size()));
+        for (auto i = begin; i < end; ++i)
+        {
+            if (m_itemBoxes[m_items[i]].Overlaps(box) && !function(m_items[i]))
+            {
+                return;
+            }
+        }
+    }
+}
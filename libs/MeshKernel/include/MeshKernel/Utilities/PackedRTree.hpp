@@ -0,0 +1,209 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include "MeshKernel/BoundingBox.hpp"
+#include "MeshKernel/Entities.hpp"
+#include "MeshKernel/Utilities/RTreeBase.hpp"
+
+#include <boost/container/small_vector.hpp>
+
+namespace meshkernel
+{
+    /// @brief A static spatial index, bulk loaded with the sort-tile-recursive (STR) algorithm.
+    ///
+    /// The points are sorted such that each run of NodeCapacity consecutive points forms a leaf,
+    /// and each run of NodeCapacity consecutive nodes forms a node of the level above.
+    /// The sorted coordinates, the original indices and the bounding boxes of all levels are stored
+    /// in contiguous arrays: the index uses less than half of the memory of the boost::geometry rtree and
+    /// its traversal is cache friendly.
+    ///
+    /// The index is meant for data that does not change once the tree is built, such as sample clouds.
+    /// Points can be deleted, but not inserted. The tree is built in parallel.
+    ///
+    /// @tparam Dimension 2 for Cartesian coordinates, 3 for spherical coordinates converted to 3D Cartesian coordinates
+    template <UInt Dimension>
+    class PackedRTree : public RTreeBase
+    {
+        static_assert(Dimension == 2 || Dimension == 3, "PackedRTree supports only 2 or 3 dimensions");
+
+    public:
+        /// @brief The coordinates of a point in the index
+        using Coordinates = std::array<double, Dimension>;
+
+        /// @brief The bounding box of a node of the index
+        struct Box
+        {
+            Coordinates lower; ///< The lower corner
+            Coordinates upper; ///< The upper corner
+        };
+
+        /// @brief The number of children of a node, and the number of points in a leaf
+        static constexpr UInt NodeCapacity = 16;
+
+        /// @brief Builds the tree from a vector of Points
+        /// @param[in] nodes The vector of nodes
+        void BuildTree(const std::vector<Point>& nodes) override;
+
+        /// @brief Builds the tree from a vector of samples
+        /// @param[in] samples The vector of samples
+        void BuildTree(const std::vector<Sample>& samples) override;
+
+        /// @brief Builds the tree from a vector of points within a bounding box
+        /// @param[in] nodes The vector of nodes
+        /// @param[in] boundingBox The vector bounding box
+        void BuildTree(const std::vector<Point>& nodes, const BoundingBox& boundingBox) override;
+
+        /// @brief Builds the tree from a vector of samples within a bounding box
+        /// @param[in] samples The vector of samples
+        /// @param[in] boundingBox The vector bounding box
+        void BuildTree(const std::vector<Sample>& samples, const BoundingBox& boundingBox) override;
+
+        /// @brief Finds all nodes in the search radius and stores the results in the query cache, to be inquired later
+        /// @param[in] node The node
+        /// @param[in] searchRadiusSquared The squared search radius around the node
+        void SearchPoints(Point const& node, double searchRadiusSquared) override;
+
+        /// @brief Finds the nearest node in the search radius and stores the results in the query cache, to be inquired later
+        /// @param[in] node The node
+        /// @param[in] searchRadiusSquared The squared search radius around the node
+        void SearchNearestPoint(Point const& node, double searchRadiusSquared) override;
+
+        /// @brief Gets the nearest of all nodes
+        /// @param[in] node The node
+        void SearchNearestPoint(Point const& node) override;
+
+        /// @brief Finds all nodes in the search radius and stores their indices in a caller-owned result vector
+        /// @param[in]  node                The node
+        /// @param[in]  searchRadiusSquared The squared search radius around the node
+        /// @param[out] queryResult         The indices of the nodes found
+        void SearchPoints(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const override;
+
+        /// @brief Finds the nearest node in the search radius and stores its index in a caller-owned result vector
+        /// @param[in]  node                The node
+        /// @param[in]  searchRadiusSquared The squared search radius around the node
+        /// @param[out] queryResult         The index of the nearest node, empty if none is found
+        void SearchNearestPoint(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const override;
+
+        /// @brief Finds the nearest of all nodes and stores its index in a caller-owned result vector
+        /// @param[in]  node        The node
+        /// @param[out] queryResult The index of the nearest node
+        void SearchNearestPoint(Point const& node, std::vector<UInt>& queryResult) const override;
+
+        /// @brief Finds, for each node, all nodes in the same search radius
+        /// @param[in]  nodes               The nodes
+        /// @param[in]  searchRadiusSquared The squared search radius around each node
+        /// @param[out] queryResults        The indices of the nodes found for each node
+        void SearchPoints(std::span<const Point> nodes, double searchRadiusSquared, RTreeQueryResults& queryResults) const override;
+
+        /// @brief Finds, for each node, all nodes in a search radius specific to the node
+        /// @param[in]  nodes              The nodes
+        /// @param[in]  searchRadiiSquared The squared search radius around each node
+        /// @param[out] queryResults       The indices of the nodes found for each node
+        void SearchPoints(std::span<const Point> nodes, std::span<const double> searchRadiiSquared, RTreeQueryResults& queryResults) const override;
+
+        /// @brief Finds, for each node, the k nearest nodes, sorted by increasing distance
+        /// @param[in]  nodes              The nodes
+        /// @param[in]  numberOfNeighbours The number of nearest nodes to find for each node
+        /// @param[out] queryResults       The indices of the nearest nodes found for each node
+        void SearchNearestPoints(std::span<const Point> nodes, UInt numberOfNeighbours, RTreeQueryResults& queryResults) const override;
+
+        /// @brief Deletes a node
+        /// @param[in] position The index of the node in the vector the tree was built from
+        void DeleteNode(UInt position) override;
+
+        /// @brief Not supported, the packed index is static: rebuild the tree instead
+        /// @param[in] position The index of the node in the vector the tree was built from
+        /// @param[in] node     The new value of the node
+        void UpdateNode(UInt position, Point const& node) override;
+
+        /// @brief Determines size of the RTree
+        [[nodiscard]] UInt Size() const override { return m_size; }
+
+        /// @brief Determines if the RTree is empty
+        [[nodiscard]] bool Empty() const override { return m_size == 0; }
+
+        /// @brief Gets the size of the query
+        [[nodiscard]] UInt GetQueryResultSize() const override { return static_cast<UInt>(m_queryIndices.size()); }
+
+        /// @brief Gets the index of a sample in the query
+        [[nodiscard]] UInt GetQueryResult(UInt index) const override { return m_queryIndices[index]; }
+
+        /// @brief True if a query has results, false otherwise
+        [[nodiscard]] bool HasQueryResults() const override { return !m_queryIndices.empty(); }
+
+    private:
+        /// @brief The squared distances and indices of the nearest points found, sorted by increasing distance
+        using NearestPoints = boost::container::small_vector<std::pair<double, UInt>, NodeCapacity>;
+
+        /// @brief Converts a point to the coordinates used in the index
+        static Coordinates Convert(const Point& point);
+
+        /// @brief Computes the squared distance between a point and a box, zero if the point is inside the box
+        static double SquaredDistance(const Box& box, const Coordinates& point);
+
+        /// @brief Determines if two boxes overlap
+        static bool Overlaps(const Box& first, const Box& second);
+
+        /// @brief Computes the squared distance between two points
+        static double SquaredDistance(const Coordinates& first, const Coordinates& second);
+
+        /// @brief Builds the tree from the points satisfying a predicate
+        template <std::derived_from<Point> SourcePoint, typename Predicate>
+        void Build(const std::vector<SourcePoint>& sourcePoints, Predicate isIncluded);
+
+        /// @brief Gets the number of nodes at a level, level 0 being the leaves
+        [[nodiscard]] UInt NumberOfNodes(UInt level) const { return m_levelOffsets[level + 1] - m_levelOffsets[level]; }
+
+        /// @brief Gets the range of the children of a node, points for a leaf, nodes of the level below otherwise
+        [[nodiscard]] std::pair<UInt, UInt> Children(UInt level, UInt node) const;
+
+        /// @brief Finds all points in the search radius, recursively from a node
+        void SearchRadius(UInt level, UInt node, const Coordinates& point, const Box& searchBox, double searchRadiusSquared, std::vector<UInt>& queryResult) const;
+
+        /// @brief Updates the nearest points with those below a node, recursively
+        void SearchNearest(UInt level, UInt node, const Coordinates& point, UInt numberOfNeighbours, double maximumDistanceSquared, NearestPoints& nearestPoints) const;
+
+        /// @brief Finds the nearest points, by increasing distance, within a maximum squared distance
+        void SearchNearest(const Coordinates& point, UInt numberOfNeighbours, double maximumDistanceSquared, std::vector<UInt>& queryResult) const;
+
+        std::vector<Coordinates> m_coordinates; ///< The coordinates of the points, in tree order
+        std::vector<UInt> m_indices;            ///< The index in the source vector of each point in tree order, missing if deleted
+        std::vector<Box> m_boxes;               ///< The bounding boxes of the nodes of all levels, leaves first
+        std::vector<UInt> m_levelOffsets;       ///< The offset of each level in m_boxes, followed by the number of boxes
+        std::vector<UInt> m_positions;          ///< The tree position of each source index, built on the first deletion
+        UInt m_size = 0;                        ///< The number of points in the tree
+        std::vector<UInt> m_queryIndices;       ///< The query indices
+        UInt m_queryVectorCapacity = 100;       ///< Capacity of the query vector
+    };
+
+} // namespace meshkernel
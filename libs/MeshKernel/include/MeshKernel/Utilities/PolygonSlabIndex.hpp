@@ -0,0 +1,82 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "MeshKernel/Definitions.hpp"
+#include "MeshKernel/Point.hpp"
+#include "MeshKernel/Utilities/CompressedSparseRow.hpp"
+
+namespace meshkernel
+{
+    /// @brief An index of the segments of a closed polyline, bucketed in horizontal slabs of equal height.
+    ///
+    /// Each segment is stored in all slabs its y-range overlaps, such that the segments whose closed y-range
+    /// contains a given y are all found in the slab containing y. The number of slabs is chosen such that each
+    /// slab holds about twice the number of segments crossed by a horizontal line, keeping the index size linear
+    /// in the number of segments. Segments of zero length are stored in every slab.
+    class PolygonSlabIndex
+    {
+    public:
+        /// @brief Default constructor, an empty index
+        PolygonSlabIndex() = default;
+
+        /// @brief Constructs the index of the segments of a polyline
+        /// @param[in] nodes The nodes of the polyline, the segment i connects the nodes i and i + 1
+        explicit PolygonSlabIndex(std::span<const Point> nodes);
+
+        /// @brief Builds the index of the segments of a polyline
+        /// @param[in] nodes The nodes of the polyline, the segment i connects the nodes i and i + 1
+        void Build(std::span<const Point> nodes);
+
+        /// @brief Removes all slabs
+        void Clear();
+
+        /// @brief Determines if the index is empty
+        [[nodiscard]] bool Empty() const { return m_slabSegments.Empty(); }
+
+        /// @brief Gets the number of slabs
+        [[nodiscard]] UInt NumberOfSlabs() const { return m_slabSegments.NumRows(); }
+
+        /// @brief Gets the segments whose y-range may contain a y coordinate, empty if the y coordinate is outside of the polyline y-range
+        /// @param[in] y The y coordinate
+        [[nodiscard]] std::span<const UInt> Segments(double y) const;
+
+    private:
+        /// @brief Gets the slab containing a y coordinate, clamped to the valid slabs
+        [[nodiscard]] UInt Slab(double y, UInt numSlabs) const;
+
+        double m_lowerY = 0.0;                     ///< The lowest y coordinate of the polyline
+        double m_upperY = 0.0;                     ///< The highest y coordinate of the polyline
+        double m_inverseSlabHeight = 0.0;          ///< The inverse of the slab height, zero for a single slab
+        CompressedSparseRow<UInt> m_slabSegments; ///< The segments of each slab
+    };
+
+} // namespace meshkernel
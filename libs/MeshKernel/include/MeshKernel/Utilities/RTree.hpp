@@ -36,12 +36,15 @@
 #include <boost/geometry.hpp>
 #include <boost/geometry/geometries/point.hpp>
 #include <boost/geometry/index/rtree.hpp>
+#include <boost/iterator/function_output_iterator.hpp>
 #undef BOOST_ALLOW_DEPRECATED_HEADERS
 
 #include "MeshKernel/BoundingBox.hpp"
 #include "MeshKernel/Utilities/RTreeBase.hpp"
 
+#include <cmath>
 #include <concepts>
+#include <span>
 #include <utility>
 
 // r-tree
@@ -65,10 +68,13 @@ namespace meshkernel
     /// The RTree class is primarily utilized within the mesh library for efficiently querying
     /// the closest mesh nodes and edges to a specified point. It employs the RTreeBase class as its base.
     ///
-    /// Internally, the RTree class maintains a query cache (`m_queryCache`) which is a vector used
-    /// to collect and store query results. This design helps optimize performance by avoiding frequent
+    /// Internally, the RTree class maintains a vector of query indices (`m_queryIndices`) used
+    /// to store the results of the non-const queries. This design helps optimize performance by avoiding frequent
     /// reallocations when the number of results changes between queries.
     ///
+    /// The const overloads of SearchPoints and SearchNearestPoint write into a caller-owned vector instead,
+    /// so a single tree can be queried concurrently, for example from an OpenMP parallel loop.
+    ///
     /// Example usage:
     /// @code
     /// // Create an RTree instance with the default Cartesian projection.
@@ -104,6 +110,7 @@ namespace meshkernel
             auto convert = [](const Point& p)
             { return Point2D(p.x, p.y); };
             BuildTreeFromVector(nodes, m_points2D, convert);
+            ComputePositions(static_cast<UInt>(nodes.size()), m_points2D, m_positions);
             m_rtree2D = RTree2D(m_points2D);
         }
 
@@ -114,6 +121,7 @@ namespace meshkernel
             auto convert = [](const Point& p)
             { return Point2D(p.x, p.y); };
             BuildTreeFromVector(samples, m_points2D, convert);
+            ComputePositions(static_cast<UInt>(samples.size()), m_points2D, m_positions);
             m_rtree2D = RTree2D(m_points2D);
         }
 
@@ -125,6 +133,7 @@ namespace meshkernel
             auto convert = [](const Point& p)
             { return Point2D(p.x, p.y); };
             BuildTreeFromVectorWithinBoundingBox(nodes, m_points2D, convert, boundingBox);
+            ComputePositions(static_cast<UInt>(nodes.size()), m_points2D, m_positions);
             m_rtree2D = RTree2D(m_points2D);
         }
 
@@ -136,6 +145,7 @@ namespace meshkernel
             auto convert = [](const Point& p)
             { return Point2D(p.x, p.y); };
             BuildTreeFromVectorWithinBoundingBox(samples, m_points2D, convert, boundingBox);
+            ComputePositions(static_cast<UInt>(samples.size()), m_points2D, m_positions);
             m_rtree2D = RTree2D(m_points2D);
         }
 
@@ -153,10 +163,50 @@ namespace meshkernel
         /// @param[in] node The node
         void SearchNearestPoint(Point const& node) override;
 
+        /// @brief Finds all nodes in the search radius and stores their indices in a caller-owned result vector
+        /// @param[in]  node                The node
+        /// @param[in]  searchRadiusSquared The squared search radius around the node
+        /// @param[out] queryResult         The indices of the nodes found
+        void SearchPoints(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const override;
+
+        /// @brief Finds the nearest node in the search radius and stores its index in a caller-owned result vector
+        /// @param[in]  node                The node
+        /// @param[in]  searchRadiusSquared The squared search radius around the node
+        /// @param[out] queryResult         The index of the nearest node, empty if none is found
+        void SearchNearestPoint(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const override;
+
+        /// @brief Finds the nearest of all nodes and stores its index in a caller-owned result vector
+        /// @param[in]  node        The node
+        /// @param[out] queryResult The index of the nearest node
+        void SearchNearestPoint(Point const& node, std::vector<UInt>& queryResult) const override;
+
+        /// @brief Finds, for each node, all nodes in the same search radius
+        /// @param[in]  nodes               The nodes
+        /// @param[in]  searchRadiusSquared The squared search radius around each node
+        /// @param[out] queryResults        The indices of the nodes found for each node
+        void SearchPoints(std::span<const Point> nodes, double searchRadiusSquared, RTreeQueryResults& queryResults) const override;
+
+        /// @brief Finds, for each node, all nodes in a search radius specific to the node
+        /// @param[in]  nodes              The nodes
+        /// @param[in]  searchRadiiSquared The squared search radius around each node
+        /// @param[out] queryResults       The indices of the nodes found for each node
+        void SearchPoints(std::span<const Point> nodes, std::span<const double> searchRadiiSquared, RTreeQueryResults& queryResults) const override;
+
+        /// @brief Finds, for each node, the k nearest nodes, sorted by increasing distance
+        /// @param[in]  nodes              The nodes
+        /// @param[in]  numberOfNeighbours The number of nearest nodes to find for each node
+        /// @param[out] queryResults       The indices of the nearest nodes found for each node
+        void SearchNearestPoints(std::span<const Point> nodes, UInt numberOfNeighbours, RTreeQueryResults& queryResults) const override;
+
         /// @brief Deletes a node
-        /// @param[in] position The index of the point to remove in m_points2D
+        /// @param[in] position The index of the node in the vector the tree was built from
         void DeleteNode(UInt position) override;
 
+        /// @brief Inserts, moves or removes a node without rebuilding the tree
+        /// @param[in] position The index of the node in the vector the tree was built from
+        /// @param[in] node     The new value of the node
+        void UpdateNode(UInt position, Point const& node) override;
+
         /// @brief Determines size of the RTree
         [[nodiscard]] UInt Size() const override { return static_cast<UInt>(m_rtree2D.size()); };
 
@@ -164,40 +214,40 @@ namespace meshkernel
         [[nodiscard]] bool Empty() const override { return m_rtree2D.empty(); }
 
         /// @brief Gets the size of the query
-        [[nodiscard]] UInt GetQueryResultSize() const override { return static_cast<UInt>(m_queryCache.size()); }
+        [[nodiscard]] UInt GetQueryResultSize() const override { return static_cast<UInt>(m_queryIndices.size()); }
 
         /// @brief Gets the index of a sample in the query
         [[nodiscard]] UInt GetQueryResult(UInt index) const override { return m_queryIndices[index]; }
 
         /// @brief True if a query has results, false otherwise
-        [[nodiscard]] bool HasQueryResults() const override { return !m_queryCache.empty(); }
+        [[nodiscard]] bool HasQueryResults() const override { return !m_queryIndices.empty(); }
 
     private:
         /// @brief Performs a spatial search within a search radius
         /// @param[in] node The reference point for the search.
         /// @param[in] searchRadiusSquared The squared search radius.
+        /// @param[in] searchRadius The search radius, the square root of searchRadiusSquared.
         /// @param[in] findNearest If true, finds the nearest point; otherwise, finds all points within the radius.
-        void Search(Point const& node, double searchRadiusSquared, bool findNearest);
+        /// @param[out] queryResult The indices of the points found
+        void Search(Point const& node, double searchRadiusSquared, double searchRadius, bool findNearest, std::vector<UInt>& queryResult) const;
 
         RTree2D m_rtree2D;                                ///< The 2D RTree
         std::vector<std::pair<Point2D, UInt>> m_points2D; ///< The points
-        std::vector<Value2D> m_queryCache;                ///< The query cache
+        std::vector<UInt> m_positions;                    ///< The position in m_points2D of each node, missing if the node is not in the tree
         std::vector<UInt> m_queryIndices;                 ///< The query indices
         UInt m_queryVectorCapacity = 100;                 ///< Capacity of the query vector
     };
 
     template <typename projection>
-    void RTree<projection>::Search(Point const& node, double searchRadiusSquared, bool findNearest)
+    void RTree<projection>::Search(Point const& node, double searchRadiusSquared, double searchRadius, bool findNearest, std::vector<UInt>& queryResult) const
     {
         if (Empty())
         {
             throw AlgorithmError("RTree is empty, search cannot be performed");
         }
 
-        m_queryCache.reserve(m_queryVectorCapacity);
-        m_queryCache.clear();
+        queryResult.clear();
         const Point2D nodeSought = Point2D(node.x, node.y);
-        const auto searchRadius = std::sqrt(searchRadiusSquared);
         Box2D const box(Point2D(node.x - searchRadius, node.y - searchRadius),
                         Point2D(node.x + searchRadius, node.y + searchRadius));
 
@@ -212,81 +262,134 @@ namespace meshkernel
                    bg::within(p, box);
         };
 
+        // Only the indices are stored, the values are not copied into an intermediate vector
+        auto storeIndex = boost::make_function_output_iterator([&queryResult](Value2D const& v)
+                                                               { queryResult.emplace_back(v.second); });
+
         if constexpr (std::is_same<projection, bg::cs::cartesian>::value)
         {
             if (findNearest)
             {
-                m_rtree2D.query(bgi::within(box) && bgi::satisfies(pointIsNearby) && bgi::nearest(nodeSought, 1),
-                                std::back_inserter(m_queryCache));
+                m_rtree2D.query(bgi::within(box) && bgi::satisfies(pointIsNearby) && bgi::nearest(nodeSought, 1), storeIndex);
             }
             else
             {
-                m_rtree2D.query(bgi::within(box) && bgi::satisfies(pointIsNearby),
-                                std::back_inserter(m_queryCache));
+                m_rtree2D.query(bgi::within(box) && bgi::satisfies(pointIsNearby), storeIndex);
             }
         }
         else if constexpr (std::is_same<projection, bg::cs::geographic<bg::degree>>::value)
         {
             if (findNearest)
             {
-                m_rtree2D.query(bgi::satisfies(atPoleOrInBox) && bgi::satisfies(pointIsNearby) && bgi::nearest(nodeSought, 1),
-                                std::back_inserter(m_queryCache));
+                m_rtree2D.query(bgi::satisfies(atPoleOrInBox) && bgi::satisfies(pointIsNearby) && bgi::nearest(nodeSought, 1), storeIndex);
             }
             else
             {
-                m_rtree2D.query(bgi::satisfies(atPoleOrInBox) && bgi::satisfies(pointIsNearby),
-                                std::back_inserter(m_queryCache));
+                m_rtree2D.query(bgi::satisfies(atPoleOrInBox) && bgi::satisfies(pointIsNearby), storeIndex);
             }
         }
         else
         {
             throw ConstraintError("Searching for points has not been implemented for this projection type");
         }
-
-        m_queryIndices.clear();
-        if (findNearest && !m_queryCache.empty())
-        {
-            m_queryIndices.emplace_back(m_queryCache[0].second);
-        }
-        else
-        {
-            for (const auto& entry : m_queryCache)
-            {
-                m_queryIndices.emplace_back(entry.second);
-            }
-        }
     }
 
     template <typename projection>
     void RTree<projection>::SearchPoints(Point const& node, double searchRadiusSquared)
     {
-        Search(node, searchRadiusSquared, false);
+        m_queryIndices.reserve(m_queryVectorCapacity);
+        Search(node, searchRadiusSquared, std::sqrt(searchRadiusSquared), false, m_queryIndices);
     }
 
     template <typename projection>
     void RTree<projection>::SearchNearestPoint(Point const& node, double searchRadiusSquared)
     {
-        Search(node, searchRadiusSquared, true);
+        m_queryIndices.reserve(m_queryVectorCapacity);
+        Search(node, searchRadiusSquared, std::sqrt(searchRadiusSquared), true, m_queryIndices);
     }
 
     template <typename projection>
     void RTree<projection>::SearchNearestPoint(Point const& node)
+    {
+        m_queryIndices.reserve(m_queryVectorCapacity);
+        SearchNearestPoint(node, m_queryIndices);
+    }
+
+    template <typename projection>
+    void RTree<projection>::SearchPoints(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const
+    {
+        Search(node, searchRadiusSquared, std::sqrt(searchRadiusSquared), false, queryResult);
+    }
+
+    template <typename projection>
+    void RTree<projection>::SearchNearestPoint(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const
+    {
+        Search(node, searchRadiusSquared, std::sqrt(searchRadiusSquared), true, queryResult);
+    }
+
+    template <typename projection>
+    void RTree<projection>::SearchNearestPoint(Point const& node, std::vector<UInt>& queryResult) const
     {
         if (Empty())
         {
             throw AlgorithmError("RTree is empty, search cannot be performed");
         }
 
-        m_queryCache.reserve(m_queryVectorCapacity);
-        m_queryCache.clear();
+        queryResult.clear();
         const Point2D nodeSought = Point2D(node.x, node.y);
-        m_rtree2D.query(bgi::nearest(nodeSought, 1), std::back_inserter(m_queryCache));
+        m_rtree2D.query(bgi::nearest(nodeSought, 1),
+                        boost::make_function_output_iterator([&queryResult](Value2D const& v)
+                                                             { queryResult.emplace_back(v.second); }));
+    }
+
+    template <typename projection>
+    void RTree<projection>::SearchPoints(std::span<const Point> nodes, double searchRadiusSquared, RTreeQueryResults& queryResults) const
+    {
+        // the square root is computed once for all nodes
+        const auto searchRadius = std::sqrt(searchRadiusSquared);
+        SearchBatch(
+            static_cast<UInt>(nodes.size()),
+            [&](UInt n, std::vector<UInt>& queryResult)
+            { Search(nodes[n], searchRadiusSquared, searchRadius, false, queryResult); },
+            queryResults);
+    }
 
-        if (!m_queryCache.empty())
+    template <typename projection>
+    void RTree<projection>::SearchPoints(std::span<const Point> nodes, std::span<const double> searchRadiiSquared, RTreeQueryResults& queryResults) const
+    {
+        if (nodes.size() != searchRadiiSquared.size())
         {
-            m_queryIndices.clear();
-            m_queryIndices.emplace_back(m_queryCache[0].second);
+            throw ConstraintError("The number of nodes ({}) and the number of search radii ({}) are not equal", nodes.size(), searchRadiiSquared.size());
         }
+
+        SearchBatch(
+            static_cast<UInt>(nodes.size()),
+            [&](UInt n, std::vector<UInt>& queryResult)
+            { Search(nodes[n], searchRadiiSquared[n], std::sqrt(searchRadiiSquared[n]), false, queryResult); },
+            queryResults);
+    }
+
+    template <typename projection>
+    void RTree<projection>::SearchNearestPoints(std::span<const Point> nodes, UInt numberOfNeighbours, RTreeQueryResults& queryResults) const
+    {
+        if (Empty() && !nodes.empty())
+        {
+            throw AlgorithmError("RTree is empty, search cannot be performed");
+        }
+
+        // the query iterators return the nearest values ordered by increasing distance
+        SearchBatch(
+            static_cast<UInt>(nodes.size()),
+            [&](UInt n, std::vector<UInt>& queryResult)
+            {
+                queryResult.clear();
+                const Point2D nodeSought = Point2D(nodes[n].x, nodes[n].y);
+                for (auto it = m_rtree2D.qbegin(bgi::nearest(nodeSought, numberOfNeighbours)); it != m_rtree2D.qend(); ++it)
+                {
+                    queryResult.emplace_back(it->second);
+                }
+            },
+            queryResults);
     }
 
     template <typename projection>
@@ -297,11 +400,51 @@ namespace meshkernel
             throw AlgorithmError("RTree is empty, deletion cannot performed");
         }
 
-        if (const auto numberRemoved = m_rtree2D.remove(m_points2D[position]); numberRemoved != 1)
+        if (position >= m_positions.size() || m_positions[position] == constants::missing::uintValue)
+        {
+            return;
+        }
+
+        auto& value = m_points2D[m_positions[position]];
+        if (const auto numberRemoved = m_rtree2D.remove(value); numberRemoved != 1)
         {
             return;
         }
-        m_points2D[position] = {Point2D{constants::missing::doubleValue, constants::missing::doubleValue}, std::numeric_limits<UInt>::max()};
+        value = {Point2D{constants::missing::doubleValue, constants::missing::doubleValue}, std::numeric_limits<UInt>::max()};
+    }
+
+    template <typename projection>
+    void RTree<projection>::UpdateNode(UInt position, Point const& node)
+    {
+        if (position >= m_positions.size())
+        {
+            m_positions.resize(position + 1, constants::missing::uintValue);
+        }
+
+        if (m_positions[position] == constants::missing::uintValue)
+        {
+            if (!node.IsValid())
+            {
+                return;
+            }
+
+            m_positions[position] = static_cast<UInt>(m_points2D.size());
+            m_points2D.emplace_back(Point2D{constants::missing::doubleValue, constants::missing::doubleValue}, std::numeric_limits<UInt>::max());
+        }
+
+        // the slot of the node is reused, the values of the tree are copies of the slots
+        auto& value = m_points2D[m_positions[position]];
+        if (value.second != std::numeric_limits<UInt>::max())
+        {
+            m_rtree2D.remove(value);
+            value = {Point2D{constants::missing::doubleValue, constants::missing::doubleValue}, std::numeric_limits<UInt>::max()};
+        }
+
+        if (node.IsValid())
+        {
+            value = {Point2D(node.x, node.y), position};
+            m_rtree2D.insert(value);
+        }
     }
 
 } // namespace meshkernel
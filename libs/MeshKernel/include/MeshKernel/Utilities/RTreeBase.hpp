@@ -30,8 +30,37 @@
 #include "MeshKernel/BoundingBox.hpp"
 #include <MeshKernel/Entities.hpp>
 
+#include <algorithm>
+#include <exception>
+#include <numeric>
+#include <span>
+#include <vector>
+
 namespace meshkernel
 {
+    /// @brief The results of a batch of RTree queries, stored in compressed sparse row format
+    ///
+    /// The indices found for query q are stored in indices[offsets[q]], ..., indices[offsets[q + 1] - 1]
+    struct RTreeQueryResults
+    {
+        std::vector<UInt> offsets; ///< The start of the results of each query in indices, has size number of queries + 1
+        std::vector<UInt> indices; ///< The indices found by all queries
+
+        /// @brief Gets the number of queries
+        [[nodiscard]] UInt Size() const { return offsets.empty() ? 0 : static_cast<UInt>(offsets.size() - 1); }
+
+        /// @brief Gets the number of indices found by a query
+        /// @param[in] query The index of the query
+        [[nodiscard]] UInt Size(UInt query) const { return offsets[query + 1] - offsets[query]; }
+
+        /// @brief Gets the indices found by a query
+        /// @param[in] query The index of the query
+        [[nodiscard]] std::span<const UInt> operator[](UInt query) const
+        {
+            return std::span<const UInt>(indices.data() + offsets[query], offsets[query + 1] - offsets[query]);
+        }
+    };
+
     /// @brief RTree interface
     class RTreeBase
     {
@@ -71,10 +100,57 @@ namespace meshkernel
         /// @param[in] node The node
         virtual void SearchNearestPoint(Point const& node) = 0;
 
+        /// @brief Finds all nodes in the search radius and stores their indices in a caller-owned result vector
+        ///
+        /// The tree is not modified, so the function can be called concurrently (e.g. from an OpenMP region)
+        /// provided that each thread uses its own result vector.
+        /// @param[in]  node                The node
+        /// @param[in]  searchRadiusSquared The squared search radius around the node
+        /// @param[out] queryResult         The indices of the nodes found, cleared before the search
+        virtual void SearchPoints(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const = 0;
+
+        /// @brief Finds the nearest node in the search radius and stores its index in a caller-owned result vector
+        /// @param[in]  node                The node
+        /// @param[in]  searchRadiusSquared The squared search radius around the node
+        /// @param[out] queryResult         The index of the nearest node, empty if none is found
+        virtual void SearchNearestPoint(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const = 0;
+
+        /// @brief Finds the nearest of all nodes and stores its index in a caller-owned result vector
+        /// @param[in]  node        The node
+        /// @param[out] queryResult The index of the nearest node
+        virtual void SearchNearestPoint(Point const& node, std::vector<UInt>& queryResult) const = 0;
+
+        /// @brief Finds, for each node, all nodes in the same search radius
+        ///
+        /// The queries are performed in parallel, the results are ordered as the nodes.
+        /// @param[in]  nodes               The nodes
+        /// @param[in]  searchRadiusSquared The squared search radius around each node
+        /// @param[out] queryResults        The indices of the nodes found for each node
+        virtual void SearchPoints(std::span<const Point> nodes, double searchRadiusSquared, RTreeQueryResults& queryResults) const = 0;
+
+        /// @brief Finds, for each node, all nodes in a search radius specific to the node
+        /// @param[in]  nodes                The nodes
+        /// @param[in]  searchRadiiSquared   The squared search radius around each node, must have the same size as nodes
+        /// @param[out] queryResults         The indices of the nodes found for each node
+        virtual void SearchPoints(std::span<const Point> nodes, std::span<const double> searchRadiiSquared, RTreeQueryResults& queryResults) const = 0;
+
+        /// @brief Finds, for each node, the k nearest nodes, sorted by increasing distance
+        /// @param[in]  nodes                The nodes
+        /// @param[in]  numberOfNeighbours   The number of nearest nodes to find for each node
+        /// @param[out] queryResults         The indices of the nearest nodes found for each node
+        virtual void SearchNearestPoints(std::span<const Point> nodes, UInt numberOfNeighbours, RTreeQueryResults& queryResults) const = 0;
+
         /// @brief Deletes a node
-        /// @param[in] position The index of the point to remove in m_points
+        /// @param[in] position The index of the node in the vector the tree was built from
         virtual void DeleteNode(UInt position) = 0;
 
+        /// @brief Inserts, moves or removes a node without rebuilding the tree
+        ///
+        /// Indices beyond the size of the vector the tree was built from are appended, invalid nodes are removed.
+        /// @param[in] position The index of the node in the vector the tree was built from
+        /// @param[in] node     The new value of the node
+        virtual void UpdateNode(UInt position, Point const& node) = 0;
+
         /// @brief Determines size of the RTree
         virtual UInt Size() const = 0;
 
@@ -91,6 +167,76 @@ namespace meshkernel
         virtual bool HasQueryResults() const = 0;
 
     protected:
+        /// @brief Performs a batch of independent queries in parallel and gathers the results in compressed sparse row format
+        ///
+        /// The queries are processed in blocks, each block collects its results in its own buffer.
+        /// The buffers are then concatenated in query order, so the results do not depend on the number of threads.
+        /// @param[in]  numberOfQueries The number of queries
+        /// @param[in]  search          Performs one query, with signature void(UInt query, std::vector<UInt>& queryResult)
+        /// @param[out] queryResults    The results of all queries
+        template <typename Search>
+        static void SearchBatch(UInt numberOfQueries, Search search, RTreeQueryResults& queryResults)
+        {
+            constexpr UInt blockSize = 256;
+            const UInt numberOfBlocks = (numberOfQueries + blockSize - 1) / blockSize;
+
+            queryResults.offsets.assign(numberOfQueries + 1, 0);
+            std::vector<std::vector<UInt>> blockIndices(numberOfBlocks);
+            std::vector<UInt> queryResult;
+            std::exception_ptr exception;
+
+#pragma omp parallel for private(queryResult) schedule(dynamic)
+            for (int b = 0; b < static_cast<int>(numberOfBlocks); ++b)
+            {
+                try
+                {
+                    const UInt start = static_cast<UInt>(b) * blockSize;
+                    const UInt end = std::min(start + blockSize, numberOfQueries);
+                    for (UInt q = start; q < end; ++q)
+                    {
+                        search(q, queryResult);
+                        queryResults.offsets[q + 1] = static_cast<UInt>(queryResult.size());
+                        blockIndices[b].insert(blockIndices[b].end(), queryResult.begin(), queryResult.end());
+                    }
+                }
+                catch (...)
+                {
+#pragma omp critical
+                    if (!exception)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+
+            std::partial_sum(queryResults.offsets.begin(), queryResults.offsets.end(), queryResults.offsets.begin());
+            queryResults.indices.resize(queryResults.offsets.back());
+
+#pragma omp parallel for
+            for (int b = 0; b < static_cast<int>(numberOfBlocks); ++b)
+            {
+                std::ranges::copy(blockIndices[b], queryResults.indices.begin() + queryResults.offsets[b * blockSize]);
+            }
+        }
+
+        /// @brief Computes the position in the target points of each source point, missing if the source point is not in the tree
+        template <typename TargetPoint>
+        static void ComputePositions(UInt numberOfSourcePoints,
+                                     const std::vector<std::pair<TargetPoint, UInt>>& targetPoints,
+                                     std::vector<UInt>& positions)
+        {
+            positions.assign(numberOfSourcePoints, constants::missing::uintValue);
+            for (UInt p = 0; p < targetPoints.size(); ++p)
+            {
+                positions[targetPoints[p].second] = p;
+            }
+        }
+
         /// @brief Builds the tree from a vector of types derived from Point
         template <std::derived_from<Point> SourcePoint, typename TargetPoint, typename Conversion>
         static void BuildTreeFromVector(const std::vector<SourcePoint>& sourcePoints,
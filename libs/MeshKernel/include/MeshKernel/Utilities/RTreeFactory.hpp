@@ -39,9 +39,17 @@ namespace meshkernel
     /// @brief Factory class for creating instances of RTree with different projections.
     struct RTreeFactory
     {
+        /// @brief The type of spatial index
+        enum class Type
+        {
+            Dynamic, ///< The boost::geometry rtree, suited for data that is edited after the tree is built
+            Packed   ///< The packed static index, faster and smaller, suited for data that does not change such as sample clouds
+        };
+
         /// @brief Creates and returns a shared pointer to an instance of RTree with the specified projection.
         ///
         /// @param projection The projection type for the RTree.
+        /// @param type The type of spatial index.
         /// @return A shared pointer to the created RTree instance.
         ///
         /// This factory method creates an RTree instance based on the specified projection type.
@@ -51,10 +59,11 @@ namespace meshkernel
         /// auto cartesianRTree = RTreeFactory::create(Projection::cartesian);
         /// auto sphericalRTree = RTreeFactory::create(Projection::spherical);
         /// auto sphericalAccurateRTree = RTreeFactory::create(Projection::sphericalAccurate);
+        /// auto samplesRTree = RTreeFactory::create(Projection::cartesian, RTreeFactory::Type::Packed);
         /// @endcode
         ///
         /// @throws std::invalid_argument if an invalid projection value is provided.
-        static std::unique_ptr<RTreeBase> Create(Projection projection);
+        static std::unique_ptr<RTreeBase> Create(Projection projection, Type type = Type::Dynamic);
     };
 
 } // namespace meshkernel
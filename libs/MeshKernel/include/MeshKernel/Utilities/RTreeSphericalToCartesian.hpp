@@ -35,12 +35,14 @@
 #include <boost/geometry.hpp>
 #include <boost/geometry/geometries/point.hpp>
 #include <boost/geometry/index/rtree.hpp>
+#include <boost/iterator/function_output_iterator.hpp>
 #undef BOOST_ALLOW_DEPRECATED_HEADERS
 
 #include "MeshKernel/BoundingBox.hpp"
 #include "MeshKernel/Utilities/RTreeBase.hpp"
 
 #include <concepts>
+#include <span>
 #include <utility>
 
 // r-tree
@@ -64,10 +66,13 @@ namespace meshkernel
     /// The RTree class is primarily utilized within the mesh library for efficiently querying
     /// the closest mesh nodes and edges to a specified point. It employs the RTreeBase class as its base.
     ///
-    /// Internally, the RTree class maintains a query cache (`m_queryCache`) which is a vector used
-    /// to collect and store query results. This design helps optimize performance by avoiding frequent
+    /// Internally, the RTree class maintains a vector of query indices (`m_queryIndices`) used
+    /// to store the results of the non-const queries. This design helps optimize performance by avoiding frequent
     /// reallocations when the number of results changes between queries.
     ///
+    /// The const overloads of SearchPoints and SearchNearestPoint write into a caller-owned vector instead,
+    /// so a single tree can be queried concurrently, for example from an OpenMP parallel loop.
+    ///
     /// Example usage:
     /// @code
     /// // Create an RTree instance with the default Cartesian projection.
@@ -102,6 +107,7 @@ namespace meshkernel
             auto conversion = [](const Point& p)
             { return convert(p); };
             BuildTreeFromVector(nodes, m_points3D, conversion);
+            ComputePositions(static_cast<UInt>(nodes.size()), m_points3D, m_positions);
             m_rtree3D = RTree3D(m_points3D);
         }
 
@@ -112,6 +118,7 @@ namespace meshkernel
             auto conversion = [](const Point& p)
             { return convert(p); };
             BuildTreeFromVector(samples, m_points3D, conversion);
+            ComputePositions(static_cast<UInt>(samples.size()), m_points3D, m_positions);
             m_rtree3D = RTree3D(m_points3D);
         }
 
@@ -123,6 +130,7 @@ namespace meshkernel
             auto conversion = [](const Point& p)
             { return convert(p); };
             BuildTreeFromVectorWithinBoundingBox(nodes, m_points3D, conversion, boundingBox);
+            ComputePositions(static_cast<UInt>(nodes.size()), m_points3D, m_positions);
             m_rtree3D = RTree3D(m_points3D);
         }
 
@@ -134,6 +142,7 @@ namespace meshkernel
             auto conversion = [](const Point& p)
             { return convert(p); };
             BuildTreeFromVectorWithinBoundingBox(samples, m_points3D, conversion, boundingBox);
+            ComputePositions(static_cast<UInt>(samples.size()), m_points3D, m_positions);
             m_rtree3D = RTree3D(m_points3D);
         }
 
@@ -151,10 +160,50 @@ namespace meshkernel
         /// @param[in] node The node
         void SearchNearestPoint(Point const& node) override;
 
+        /// @brief Finds all nodes in the search radius and stores their indices in a caller-owned result vector
+        /// @param[in]  node                The node
+        /// @param[in]  searchRadiusSquared The squared search radius around the node
+        /// @param[out] queryResult         The indices of the nodes found
+        void SearchPoints(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const override;
+
+        /// @brief Finds the nearest node in the search radius and stores its index in a caller-owned result vector
+        /// @param[in]  node                The node
+        /// @param[in]  searchRadiusSquared The squared search radius around the node
+        /// @param[out] queryResult         The index of the nearest node, empty if none is found
+        void SearchNearestPoint(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const override;
+
+        /// @brief Finds the nearest of all nodes and stores its index in a caller-owned result vector
+        /// @param[in]  node        The node
+        /// @param[out] queryResult The index of the nearest node
+        void SearchNearestPoint(Point const& node, std::vector<UInt>& queryResult) const override;
+
+        /// @brief Finds, for each node, all nodes in the same search radius
+        /// @param[in]  nodes               The nodes
+        /// @param[in]  searchRadiusSquared The squared search radius around each node
+        /// @param[out] queryResults        The indices of the nodes found for each node
+        void SearchPoints(std::span<const Point> nodes, double searchRadiusSquared, RTreeQueryResults& queryResults) const override;
+
+        /// @brief Finds, for each node, all nodes in a search radius specific to the node
+        /// @param[in]  nodes              The nodes
+        /// @param[in]  searchRadiiSquared The squared search radius around each node
+        /// @param[out] queryResults       The indices of the nodes found for each node
+        void SearchPoints(std::span<const Point> nodes, std::span<const double> searchRadiiSquared, RTreeQueryResults& queryResults) const override;
+
+        /// @brief Finds, for each node, the k nearest nodes, sorted by increasing distance
+        /// @param[in]  nodes              The nodes
+        /// @param[in]  numberOfNeighbours The number of nearest nodes to find for each node
+        /// @param[out] queryResults       The indices of the nearest nodes found for each node
+        void SearchNearestPoints(std::span<const Point> nodes, UInt numberOfNeighbours, RTreeQueryResults& queryResults) const override;
+
         /// @brief Deletes a node
-        /// @param[in] position The index of the point to remove in m_points3D
+        /// @param[in] position The index of the node in the vector the tree was built from
         void DeleteNode(UInt position) override;
 
+        /// @brief Inserts, moves or removes a node without rebuilding the tree
+        /// @param[in] position The index of the node in the vector the tree was built from
+        /// @param[in] node     The new value of the node
+        void UpdateNode(UInt position, Point const& node) override;
+
         /// @brief Determines size of the RTree
         [[nodiscard]] UInt Size() const override { return static_cast<UInt>(m_rtree3D.size()); };
 
@@ -162,13 +211,13 @@ namespace meshkernel
         [[nodiscard]] bool Empty() const override { return m_rtree3D.empty(); }
 
         /// @brief Gets the size of the query
-        [[nodiscard]] UInt GetQueryResultSize() const override { return static_cast<UInt>(m_queryCache.size()); }
+        [[nodiscard]] UInt GetQueryResultSize() const override { return static_cast<UInt>(m_queryIndices.size()); }
 
         /// @brief Gets the index of a sample in the query
         [[nodiscard]] UInt GetQueryResult(UInt index) const override { return m_queryIndices[index]; }
 
         /// @brief True if a query has results, false otherwise
-        [[nodiscard]] bool HasQueryResults() const override { return !m_queryCache.empty(); }
+        [[nodiscard]] bool HasQueryResults() const override { return !m_queryIndices.empty(); }
 
     private:
         /// @brief Convert 2d point in spherical coordinates to 3d point in Cartesian coordinates.
@@ -177,12 +226,14 @@ namespace meshkernel
         /// @brief Performs a spatial search within a search radius
         /// @param[in] node The reference point for the search.
         /// @param[in] searchRadiusSquared The squared search radius.
+        /// @param[in] searchRadius The search radius, the square root of searchRadiusSquared.
         /// @param[in] findNearest If true, finds the nearest point; otherwise, finds all points within the radius.
-        void Search(Point const& node, double searchRadiusSquared, bool findNearest);
+        /// @param[out] queryResult The indices of the points found
+        void Search(Point const& node, double searchRadiusSquared, double searchRadius, bool findNearest, std::vector<UInt>& queryResult) const;
 
         RTree3D m_rtree3D;                                ///< The 3D RTree
         std::vector<std::pair<Point3D, UInt>> m_points3D; ///< The points
-        std::vector<Value3D> m_queryCache;                ///< The query cache
+        std::vector<UInt> m_positions;                    ///< The position in m_points3D of each node, missing if the node is not in the tree
         std::vector<UInt> m_queryIndices;                 ///< The query indices
         UInt m_queryVectorCapacity = 100;                 ///< Capacity of the query vector
     };
@@ -26,14 +26,20 @@
 //------------------------------------------------------------------------------
 
 #include "MeshKernel/AveragingInterpolation.hpp"
-#include "MeshKernel/AveragingStrategies/AveragingStrategyFactory.hpp"
+#include "MeshKernel/AveragingStrategies/AveragingKernels.hpp"
 #include "MeshKernel/Exceptions.hpp"
 #include "MeshKernel/Mesh2D.hpp"
 #include "MeshKernel/MeshEdgeCenters.hpp"
 #include "MeshKernel/Operations.hpp"
 #include "MeshKernel/Utilities/RTreeFactory.hpp"
 
+#include <cmath>
+#include <exception>
+#include <numeric>
+#include <type_traits>
+
 using meshkernel::AveragingInterpolation;
+using meshkernel::averaging::VisitAveragingKernel;
 
 AveragingInterpolation::AveragingInterpolation(Mesh2D& mesh,
                                                std::vector<Sample>& samples,
@@ -45,17 +51,18 @@ AveragingInterpolation::AveragingInterpolation(Mesh2D& mesh,
                                                UInt minNumSamples)
     : m_mesh(mesh),
       m_samples(samples),
+      m_method(method),
       m_interpolationLocation(locationType),
       m_relativeSearchRadius(relativeSearchRadius),
       m_useClosestSampleIfNoneAvailable(useClosestSampleIfNoneAvailable),
       m_transformSamples(transformSamples),
-      m_samplesRtree(RTreeFactory::Create(mesh.m_projection)),
-      m_strategy(averaging::AveragingStrategyFactory::GetAveragingStrategy(method, minNumSamples, m_mesh.m_projection))
+      m_minNumSamples(minNumSamples),
+      m_samplesRtree(RTreeFactory::Create(mesh.m_projection, RTreeFactory::Type::Packed))
 {
-    m_interpolationSampleCache.reserve(DefaultMaximumCacheSize);
+    VisitAveragingKernel(m_method, []<class Kernel>(std::type_identity<Kernel>) {});
 }
 
-void AveragingInterpolation::Compute()
+void AveragingInterpolation::BuildSamplesTree()
 {
     if (m_samples.empty())
     {
@@ -66,82 +73,371 @@ void AveragingInterpolation::Compute()
     {
         m_samplesRtree->BuildTree(m_samples);
     }
+}
+
+meshkernel::UInt AveragingInterpolation::GetNumLocations() const
+{
+    return m_interpolationLocation == Location::Faces ? m_mesh.GetNumFaces() : m_mesh.GetNumNodes();
+}
+
+void AveragingInterpolation::Compute()
+{
+    BuildSamplesTree();
+
+    std::vector<std::vector<double>> sampleValues(1, std::vector<double>(m_samples.size()));
+    std::ranges::transform(m_samples, sampleValues[0].begin(), [](const Sample& sample)
+                           { return sample.value; });
+
+    std::vector<std::vector<double>> results;
+
+    if (m_interpolationLocation == Location::Faces && m_transformSamples)
+    {
+        VisitAveragingKernel(m_method, [&]<class Kernel>(std::type_identity<Kernel>)
+                             { ComputeOnFacesTransformingSamples<Kernel>(sampleValues, results); });
+    }
+    else
+    {
+        std::vector<UInt> locations(GetNumLocations());
+        std::iota(locations.begin(), locations.end(), 0);
+        results.assign(1, std::vector<double>(locations.size(), constants::missing::doubleValue));
+        ComputeOnLocations(sampleValues, locations, results);
+    }
 
     if (m_interpolationLocation == Location::Nodes || m_interpolationLocation == Location::Edges)
     {
-        m_nodeResults.resize(m_mesh.GetNumNodes(), constants::missing::doubleValue);
-        std::ranges::fill(m_nodeResults, constants::missing::doubleValue);
+        m_nodeResults = std::move(results[0]);
+    }
+
+    // for edges, an average of the nodal interpolated value is made
+    if (m_interpolationLocation == Location::Edges)
+    {
+        m_edgeResults = ComputeEdgeResults(m_nodeResults);
+    }
+
+    if (m_interpolationLocation == Location::Faces)
+    {
+        m_faceResults = std::move(results[0]);
+    }
+}
+
+std::vector<std::vector<double>> AveragingInterpolation::ComputeProperties(const std::vector<std::vector<double>>& sampleValues)
+{
+    std::vector<UInt> locations(GetNumLocations());
+    std::iota(locations.begin(), locations.end(), 0);
+
+    std::vector<std::vector<double>> results(sampleValues.size(), std::vector<double>(locations.size(), constants::missing::doubleValue));
+    ComputeProperties(sampleValues, locations, results);
+
+    if (m_interpolationLocation == Location::Edges)
+    {
+        std::ranges::transform(results, results.begin(), [this](const std::vector<double>& nodeResults)
+                               { return ComputeEdgeResults(nodeResults); });
+    }
+
+    return results;
+}
 
-        std::vector<Point> edgeCentres = algo::ComputeEdgeCentres(m_mesh);
+void AveragingInterpolation::ComputeProperties(const std::vector<std::vector<double>>& sampleValues,
+                                               std::span<const UInt> locations,
+                                               std::vector<std::vector<double>>& results)
+{
+    if (m_transformSamples)
+    {
+        throw AlgorithmError("AveragingInterpolation::ComputeProperties: Transforming the samples is only supported by Compute.");
+    }
 
-        std::vector<Point> dualFacePolygon;
-        for (UInt n = 0; n < m_mesh.GetNumNodes(); ++n)
+    for (UInt p = 0; p < sampleValues.size(); ++p)
+    {
+        if (sampleValues[p].size() != m_samples.size())
         {
-            m_mesh.MakeDualFace(edgeCentres, n, m_relativeSearchRadius, dualFacePolygon);
-            const auto result = ComputeOnPolygon(dualFacePolygon, m_mesh.Node(n));
-            m_nodeResults[n] = result;
+            throw ConstraintError("AveragingInterpolation::ComputeProperties: The number of values of property {}, {}, differs from the number of samples, {}.",
+                                  p, sampleValues[p].size(), m_samples.size());
         }
     }
 
-    // for edges, an average of the nodal interpolated value is made
-    if (m_interpolationLocation == Location::Edges)
+    if (results.size() != sampleValues.size() || std::ranges::any_of(results, [this](const std::vector<double>& values)
+                                                                      { return values.size() != GetNumLocations(); }))
     {
-        m_edgeResults.resize(m_mesh.GetNumEdges(), constants::missing::doubleValue);
-        std::ranges::fill(m_edgeResults, constants::missing::doubleValue);
+        throw ConstraintError("AveragingInterpolation::ComputeProperties: The results must have {} values for each of the {} properties.",
+                              GetNumLocations(), sampleValues.size());
+    }
+
+    BuildSamplesTree();
 
-        for (UInt e = 0; e < m_mesh.GetNumEdges(); ++e)
+    ComputeOnLocations(sampleValues, locations, results);
+}
+
+std::vector<meshkernel::BoundingBox> AveragingInterpolation::ComputeSearchBoundingBoxes() const
+{
+    const UInt numLocations = GetNumLocations();
+    std::vector<BoundingBox> boundingBoxes(numLocations, CreateNonOverlappingBoundingBox());
+
+    // A small margin, so samples on the search radius are included despite rounding
+    constexpr double relativeMargin = 1.0e-6;
+
+    const std::vector<Point> edgeCentres = m_interpolationLocation == Location::Faces ? std::vector<Point>{} : algo::ComputeEdgeCentres(m_mesh);
+
+    LocationCache cache;
+    std::exception_ptr exception;
+
+#pragma omp parallel for private(cache)
+    for (int l = 0; l < static_cast<int>(numLocations); ++l)
+    {
+        try
         {
-            const auto& [first, second] = m_mesh.GetEdge(e);
+            Point interpolationPoint;
+
+            if (m_interpolationLocation == Location::Faces)
+            {
+                ComputeFacePolygon(l, cache.polygon);
+                interpolationPoint = m_mesh.m_facesMassCenters[l];
+            }
+            else
+            {
+                m_mesh.MakeDualFace(edgeCentres, l, m_relativeSearchRadius, cache.polygon);
+                interpolationPoint = m_mesh.Node(l);
+            }
+
+            if (!interpolationPoint.IsValid())
+            {
+                continue;
+            }
 
-            const auto& firstValue = m_nodeResults[first];
-            const auto& secondValue = m_nodeResults[second];
+            const double searchRadius = std::sqrt(std::max(0.0, ComputeSearchArea(interpolationPoint, cache))) * (1.0 + relativeMargin);
 
-            if (!IsEqual(firstValue, constants::missing::doubleValue) && !IsEqual(secondValue, constants::missing::doubleValue))
+            if (m_mesh.m_projection == Projection::cartesian)
+            {
+                boundingBoxes[l] = BoundingBox({interpolationPoint.x - searchRadius, interpolationPoint.y - searchRadius},
+                                               {interpolationPoint.x + searchRadius, interpolationPoint.y + searchRadius});
+            }
+            else
+            {
+                // The radius is a chord length: bound the arc length, and therefore the latitude difference
+                const double halfChord = std::min(1.0, 0.5 * searchRadius * constants::geometric::inverse_earth_radius);
+                const double latitudeDifference = 2.0 * std::asin(halfChord) * constants::conversion::radToDeg * (1.0 + relativeMargin);
+                boundingBoxes[l] = BoundingBox({std::numeric_limits<double>::lowest(), interpolationPoint.y - latitudeDifference},
+                                               {std::numeric_limits<double>::max(), interpolationPoint.y + latitudeDifference});
+            }
+        }
+        catch (...)
+        {
+#pragma omp critical
+            if (!exception)
             {
-                m_edgeResults[e] = 0.5 * (firstValue + secondValue);
+                exception = std::current_exception();
             }
         }
     }
 
-    if (m_interpolationLocation == Location::Faces)
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+
+    return boundingBoxes;
+}
+
+void AveragingInterpolation::ComputeOnLocations(const std::vector<std::vector<double>>& sampleValues,
+                                                std::span<const UInt> locations,
+                                                std::vector<std::vector<double>>& results) const
+{
+    VisitAveragingKernel(m_method, [&]<class Kernel>(std::type_identity<Kernel>)
+                         {
+                             if (m_interpolationLocation == Location::Faces)
+                             {
+                                 ComputeOnFaces<Kernel>(sampleValues, locations, results);
+                             }
+                             else
+                             {
+                                 ComputeOnNodes<Kernel>(sampleValues, locations, results);
+                             } });
+}
+
+template <class Kernel>
+void AveragingInterpolation::ComputeOnNodes(const std::vector<std::vector<double>>& sampleValues,
+                                            std::span<const UInt> locations,
+                                            std::vector<std::vector<double>>& results) const
+{
+    const std::vector<Point> edgeCentres = algo::ComputeEdgeCentres(m_mesh);
+
+    LocationCache cache;
+    std::exception_ptr exception;
+
+#pragma omp parallel for private(cache)
+    for (int i = 0; i < static_cast<int>(locations.size()); ++i)
+    {
+        try
+        {
+            const UInt n = locations[i];
+            m_mesh.MakeDualFace(edgeCentres, n, m_relativeSearchRadius, cache.polygon);
+            ComputeOnPolygon<Kernel>(m_mesh.Node(n), n, sampleValues, cache, results);
+        }
+        catch (...)
+        {
+#pragma omp critical
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+        }
+    }
+
+    if (exception)
     {
-        std::vector<bool> visitedSamples(m_samples.size(), false); ///< The visited samples
-        std::vector<Point> polygonNodesCache(constants::geometric::maximumNumberOfNodesPerFace + 1);
-        m_faceResults.resize(m_mesh.GetNumFaces(), constants::missing::doubleValue);
-        std::ranges::fill(m_faceResults, constants::missing::doubleValue);
+        std::rethrow_exception(exception);
+    }
+}
+
+template <class Kernel>
+void AveragingInterpolation::ComputeOnFaces(const std::vector<std::vector<double>>& sampleValues,
+                                            std::span<const UInt> locations,
+                                            std::vector<std::vector<double>>& results) const
+{
+    LocationCache cache;
+    std::exception_ptr exception;
 
-        for (UInt f = 0; f < m_mesh.GetNumFaces(); ++f)
+#pragma omp parallel for private(cache)
+    for (int i = 0; i < static_cast<int>(locations.size()); ++i)
+    {
+        try
         {
-            polygonNodesCache.clear();
+            const UInt f = locations[i];
+            ComputeFacePolygon(f, cache.polygon);
+            ComputeOnPolygon<Kernel>(m_mesh.m_facesMassCenters[f], f, sampleValues, cache, results);
+        }
+        catch (...)
+        {
+#pragma omp critical
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+        }
+    }
 
-            for (UInt n = 0; n < m_mesh.GetNumFaceEdges(f); ++n)
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+template <class Kernel>
+void AveragingInterpolation::ComputeOnFacesTransformingSamples(std::vector<std::vector<double>>& sampleValues,
+                                                               std::vector<std::vector<double>>& results)
+{
+    results.assign(1, std::vector<double>(m_mesh.GetNumFaces(), constants::missing::doubleValue));
+
+    // The sample values are decreased after each face, so the following faces depend on the previous ones
+    std::vector<bool> visitedSamples(m_samples.size(), false);
+    LocationCache cache;
+
+    for (UInt f = 0; f < m_mesh.GetNumFaces(); ++f)
+    {
+        ComputeFacePolygon(f, cache.polygon);
+        ComputeOnPolygon<Kernel>(m_mesh.m_facesMassCenters[f], f, sampleValues, cache, results);
+
+        if (results[0][f] > 0)
+        {
+            // for certain algorithms we want to decrease the values of the samples (e.g. refinement)
+            // it is difficult to do it otherwise without sharing or caching the query result
+            for (const auto sample : cache.queryIndices)
             {
-                polygonNodesCache.emplace_back(m_mesh.m_facesMassCenters[f] + (m_mesh.Node(m_mesh.m_facesNodes[f][n]) - m_mesh.m_facesMassCenters[f]) * m_relativeSearchRadius);
+                if (!visitedSamples[sample])
+                {
+                    visitedSamples[sample] = true;
+                    sampleValues[0][sample] -= 1;
+                    m_samples[sample].value -= 1;
+                }
             }
-            polygonNodesCache.emplace_back(polygonNodesCache[0]);
+        }
+    }
+}
+
+template <class Kernel>
+void AveragingInterpolation::ComputeOnPolygon(const Point& interpolationPoint,
+                                              UInt location,
+                                              const std::vector<std::vector<double>>& sampleValues,
+                                              LocationCache& cache,
+                                              std::vector<std::vector<double>>& results) const
+{
+    if (!interpolationPoint.IsValid())
+    {
+        throw std::invalid_argument("AveragingInterpolation::ComputeOnPolygon invalid interpolation point");
+    }
+
+    double const searchRadiusSquared = ComputeSearchArea(interpolationPoint, cache);
 
-            m_faceResults[f] = ComputeOnPolygon(polygonNodesCache, m_mesh.m_facesMassCenters[f]);
+    if (searchRadiusSquared <= 0.0)
+    {
+        throw std::invalid_argument("AveragingInterpolation::ComputeOnPolygon search radius <= 0");
+    }
+
+    m_samplesRtree->SearchPoints(interpolationPoint, searchRadiusSquared, cache.queryIndices);
 
-            if (m_transformSamples && m_faceResults[f] > 0)
+    if (cache.queryIndices.empty())
+    {
+        if (m_useClosestSampleIfNoneAvailable)
+        {
+            m_samplesRtree->SearchNearestPoint(interpolationPoint, cache.queryIndices);
+
+            if (!cache.queryIndices.empty())
             {
-                // for certain algorithms we want to decrease the values of the samples (e.g. refinement)
-                // it is difficult to do it otherwise without sharing or caching the query result
-                for (UInt i = 0; i < m_samplesRtree->GetQueryResultSize(); ++i)
+                for (UInt p = 0; p < sampleValues.size(); ++p)
                 {
-                    if (const auto sample = m_samplesRtree->GetQueryResult(i); !visitedSamples[sample])
-                    {
-                        visitedSamples[sample] = true;
-                        m_samples[sample].value -= 1;
-                    }
+                    results[p][location] = sampleValues[p][cache.queryIndices[0]];
                 }
             }
         }
+        return;
     }
+
+    SelectSamplesInPolygon(cache.searchPolygon, cache.queryIndices, cache.sampleIndices);
+
+    // The samples are averaged in the order of the sample vector, not in the order of the tree,
+    // so the results do not depend on how the samples are indexed, for example when the samples are tiled
+    std::ranges::sort(cache.sampleIndices);
+
+    for (UInt p = 0; p < sampleValues.size(); ++p)
+    {
+        const auto& values = sampleValues[p];
+        Kernel kernel(interpolationPoint, m_minNumSamples, m_mesh.m_projection);
+
+        for (const auto sampleIndex : cache.sampleIndices)
+        {
+            if (values[sampleIndex] == constants::missing::doubleValue)
+            {
+                continue;
+            }
+
+            kernel.Add(m_samples[sampleIndex], values[sampleIndex]);
+        }
+
+        results[p][location] = kernel.Result();
+    }
+}
+
+double AveragingInterpolation::ComputeSearchArea(const Point& interpolationPoint, LocationCache& cache) const
+{
+    ComputeSearchPolygon(cache.polygon, interpolationPoint, cache.searchPolygon);
+    return GetSearchRadiusSquared(cache.searchPolygon, interpolationPoint);
 }
 
-std::vector<meshkernel::Point> AveragingInterpolation::GetSearchPolygon(std::vector<Point> const& polygon, Point const& interpolationPoint) const
+void AveragingInterpolation::ComputeFacePolygon(UInt face, std::vector<Point>& polygon) const
 {
-    std::vector<Point> searchPolygon(polygon.size());
+    polygon.clear();
+
+    for (UInt n = 0; n < m_mesh.GetNumFaceEdges(face); ++n)
+    {
+        polygon.emplace_back(m_mesh.m_facesMassCenters[face] + (m_mesh.Node(m_mesh.FaceNodes(face)[n]) - m_mesh.m_facesMassCenters[face]) * m_relativeSearchRadius);
+    }
+    polygon.emplace_back(polygon[0]);
+}
+
+void AveragingInterpolation::ComputeSearchPolygon(std::vector<Point> const& polygon,
+                                                  Point const& interpolationPoint,
+                                                  std::vector<Point>& searchPolygon) const
+{
+    searchPolygon.resize(polygon.size());
     std::ranges::transform(std::begin(polygon),
                            std::end(polygon),
                            begin(searchPolygon),
@@ -155,7 +451,7 @@ std::vector<meshkernel::Point> AveragingInterpolation::GetSearchPolygon(std::vec
         const auto upperRight = boundingBox.upperRight();
 
         if (upperRight.x - lowerLeft.x <= 180.0)
-            return searchPolygon;
+            return;
 
         auto const x_mean = 0.5 * (upperRight.x + lowerLeft.x);
 
@@ -167,8 +463,6 @@ std::vector<meshkernel::Point> AveragingInterpolation::GetSearchPolygon(std::vec
             }
         }
     }
-
-    return searchPolygon;
 }
 
 double AveragingInterpolation::GetSearchRadiusSquared(std::vector<Point> const& searchPolygon,
@@ -185,69 +479,39 @@ double AveragingInterpolation::GetSearchRadiusSquared(std::vector<Point> const&
     return result;
 }
 
-double AveragingInterpolation::GetSampleValueFromRTree(UInt const index)
-{
-    auto sample_index = m_samplesRtree->GetQueryResult(index);
-    return m_samples[sample_index].value;
-}
-
-double AveragingInterpolation::ComputeInterpolationResultFromNeighbors(const Point& interpolationPoint,
-                                                                       std::vector<Point> const& searchPolygon)
+void AveragingInterpolation::SelectSamplesInPolygon(std::vector<Point> const& searchPolygon,
+                                                    std::vector<UInt> const& queryIndices,
+                                                    std::vector<UInt>& sampleIndices) const
 {
-    m_interpolationSampleCache.clear();
+    sampleIndices.clear();
 
     BoundingBox boundingBox(searchPolygon);
 
-    for (UInt i = 0; i < m_samplesRtree->GetQueryResultSize(); ++i)
+    for (const auto sampleIndex : queryIndices)
     {
-        auto const sampleIndex = m_samplesRtree->GetQueryResult(i);
-        auto const sampleValue = m_samples[sampleIndex].value;
-
-        if (sampleValue == constants::missing::doubleValue)
-        {
-            continue;
-        }
-
-        Point samplePoint{m_samples[sampleIndex].x, m_samples[sampleIndex].y};
-
-        if (IsPointInPolygonNodes(samplePoint, searchPolygon, m_mesh.m_projection, boundingBox))
+        if (IsPointInPolygonNodes(m_samples[sampleIndex], searchPolygon, m_mesh.m_projection, boundingBox))
         {
-            m_interpolationSampleCache.emplace_back(samplePoint.x, samplePoint.y, sampleValue);
+            sampleIndices.emplace_back(sampleIndex);
         }
     }
-
-    return m_strategy->Calculate(interpolationPoint, m_interpolationSampleCache);
 }
 
-double AveragingInterpolation::ComputeOnPolygon(const std::vector<Point>& polygon,
-                                                const Point& interpolationPoint)
+std::vector<double> AveragingInterpolation::ComputeEdgeResults(std::vector<double> const& nodeResults) const
 {
+    std::vector<double> edgeResults(m_mesh.GetNumEdges(), constants::missing::doubleValue);
 
-    if (!interpolationPoint.IsValid())
+    for (UInt e = 0; e < m_mesh.GetNumEdges(); ++e)
     {
-        throw std::invalid_argument("AveragingInterpolation::ComputeOnPolygon invalid interpolation point");
-    }
+        const auto& [first, second] = m_mesh.GetEdge(e);
 
-    auto const searchPolygon = GetSearchPolygon(polygon, interpolationPoint);
+        const auto& firstValue = nodeResults[first];
+        const auto& secondValue = nodeResults[second];
 
-    double const searchRadiusSquared = GetSearchRadiusSquared(searchPolygon, interpolationPoint);
-
-    if (searchRadiusSquared <= 0.0)
-    {
-        throw std::invalid_argument("AveragingInterpolation::ComputeOnPolygon search radius <= 0");
-    }
-
-    m_samplesRtree->SearchPoints(interpolationPoint, searchRadiusSquared);
-
-    if (!m_samplesRtree->HasQueryResults() && m_useClosestSampleIfNoneAvailable)
-    {
-        m_samplesRtree->SearchNearestPoint(interpolationPoint);
-        return m_samplesRtree->HasQueryResults() ? GetSampleValueFromRTree(0) : constants::missing::doubleValue;
-    }
-    if (m_samplesRtree->HasQueryResults())
-    {
-        return ComputeInterpolationResultFromNeighbors(interpolationPoint, searchPolygon);
+        if (!IsEqual(firstValue, constants::missing::doubleValue) && !IsEqual(secondValue, constants::missing::doubleValue))
+        {
+            edgeResults[e] = 0.5 * (firstValue + secondValue);
+        }
     }
 
-    return constants::missing::doubleValue;
+    return edgeResults;
 }
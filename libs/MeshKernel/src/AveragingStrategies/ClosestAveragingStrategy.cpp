@@ -25,8 +25,8 @@
 //
 //------------------------------------------------------------------------------
 
+#include <MeshKernel/AveragingStrategies/AveragingKernels.hpp>
 #include <MeshKernel/AveragingStrategies/ClosestAveragingStrategy.hpp>
-#include <MeshKernel/Operations.hpp>
 
 namespace meshkernel::averaging
 {
@@ -35,20 +35,7 @@ namespace meshkernel::averaging
     double ClosestAveragingStrategy::Calculate(const Point& interpolationPoint,
                                                const std::vector<Sample>& samples) const
     {
-        double result = constants::missing::doubleValue;
-        double closestSquaredValue = std::numeric_limits<double>::max();
-
-        for (UInt i = 0; i < samples.size(); ++i)
-        {
-            if (const auto squaredDistance = ComputeSquaredDistance(interpolationPoint, samples[i], m_projection);
-                squaredDistance < closestSquaredValue)
-            {
-                closestSquaredValue = squaredDistance;
-                result = samples[i].value;
-            }
-        }
-
-        return result;
+        return ComputeAverage<ClosestAveragingKernel>(interpolationPoint, samples, 0, m_projection);
     }
 
 } // namespace meshkernel::averaging
@@ -25,8 +25,8 @@
 //
 //------------------------------------------------------------------------------
 
+#include <MeshKernel/AveragingStrategies/AveragingKernels.hpp>
 #include <MeshKernel/AveragingStrategies/InverseWeightedAveragingStrategy.hpp>
-#include <MeshKernel/Operations.hpp>
 
 namespace meshkernel::averaging
 {
@@ -37,17 +37,7 @@ namespace meshkernel::averaging
     double InverseWeightedAveragingStrategy::Calculate(const Point& interpolationPoint,
                                                        const std::vector<Sample>& samples) const
     {
-        double result = 0.0;
-        double wall = 0.0;
-
-        for (UInt i = 0; i < samples.size(); ++i)
-        {
-            double weight = 1.0 / std::max(0.01, ComputeDistance(interpolationPoint, samples[i], m_projection));
-            wall += weight;
-            result += weight * samples[i].value;
-        }
-
-        return wall >= static_cast<double>(m_minNumSamples) ? result / wall : constants::missing::doubleValue;
+        return ComputeAverage<InverseWeightedAveragingKernel>(interpolationPoint, samples, m_minNumSamples, m_projection);
     }
 
 } // namespace meshkernel::averaging
@@ -25,22 +25,16 @@
 //
 //------------------------------------------------------------------------------
 
+#include <MeshKernel/AveragingStrategies/AveragingKernels.hpp>
 #include <MeshKernel/AveragingStrategies/MaxAveragingStrategy.hpp>
 
 namespace meshkernel::averaging
 {
 
-    double MaxAveragingStrategy::Calculate(const Point& interpolationPoint [[maybe_unused]],
+    double MaxAveragingStrategy::Calculate(const Point& interpolationPoint,
                                            const std::vector<Sample>& samples) const
     {
-        double result = std::numeric_limits<double>::lowest();
-
-        for (UInt i = 0; i < samples.size(); ++i)
-        {
-            result = std::max(result, samples[i].value);
-        }
-
-        return result != std::numeric_limits<double>::lowest() ? result : constants::missing::doubleValue;
+        return ComputeAverage<MaxAveragingKernel>(interpolationPoint, samples, 0, Projection::cartesian);
     }
 
 } // namespace meshkernel::averaging
@@ -25,22 +25,16 @@
 //
 //------------------------------------------------------------------------------
 
+#include <MeshKernel/AveragingStrategies/AveragingKernels.hpp>
 #include <MeshKernel/AveragingStrategies/MinAbsAveragingStrategy.hpp>
 
 namespace meshkernel::averaging
 {
 
-    double MinAbsAveragingStrategy::Calculate(const Point& interpolationPoint [[maybe_unused]],
+    double MinAbsAveragingStrategy::Calculate(const Point& interpolationPoint,
                                               const std::vector<Sample>& samples) const
     {
-        double result = std::numeric_limits<double>::max();
-
-        for (UInt i = 0; i < samples.size(); ++i)
-        {
-            result = std::min(result, std::abs(samples[i].value));
-        }
-
-        return result != std::numeric_limits<double>::max() ? result : constants::missing::doubleValue;
+        return ComputeAverage<MinAbsAveragingKernel>(interpolationPoint, samples, 0, Projection::cartesian);
     }
 
 } // namespace meshkernel::averaging
@@ -25,22 +25,16 @@
 //
 //------------------------------------------------------------------------------
 
+#include <MeshKernel/AveragingStrategies/AveragingKernels.hpp>
 #include <MeshKernel/AveragingStrategies/MinAveragingStrategy.hpp>
 
 namespace meshkernel::averaging
 {
 
-    double MinAveragingStrategy::Calculate(const Point& interpolationPoint [[maybe_unused]],
+    double MinAveragingStrategy::Calculate(const Point& interpolationPoint,
                                            const std::vector<Sample>& samples) const
     {
-        double result = std::numeric_limits<double>::max();
-
-        for (UInt i = 0; i < samples.size(); ++i)
-        {
-            result = std::min(result, samples[i].value);
-        }
-
-        return result != std::numeric_limits<double>::max() ? result : constants::missing::doubleValue;
+        return ComputeAverage<MinAveragingKernel>(interpolationPoint, samples, 0, Projection::cartesian);
     }
 
 } // namespace meshkernel::averaging
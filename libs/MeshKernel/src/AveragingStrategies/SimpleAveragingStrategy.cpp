@@ -25,8 +25,7 @@
 //
 //------------------------------------------------------------------------------
 
-#include <algorithm>
-
+#include <MeshKernel/AveragingStrategies/AveragingKernels.hpp>
 #include <MeshKernel/AveragingStrategies/SimpleAveragingStrategy.hpp>
 
 namespace meshkernel::averaging
@@ -34,13 +33,10 @@ namespace meshkernel::averaging
 
     SimpleAveragingStrategy::SimpleAveragingStrategy(size_t minNumSamples) : m_minNumPoints(minNumSamples) {}
 
-    double SimpleAveragingStrategy::Calculate(const Point& interpolationPoint [[maybe_unused]],
+    double SimpleAveragingStrategy::Calculate(const Point& interpolationPoint,
                                               const std::vector<Sample>& samples) const
     {
-        auto sumSampleValue = [](double value, const Sample& sample)
-        { return value + sample.value; };
-        double result = std::accumulate(samples.begin(), samples.end(), 0.0, sumSampleValue);
-        return samples.size() >= m_minNumPoints ? result / static_cast<double>(samples.size()) : constants::missing::doubleValue;
+        return ComputeAverage<SimpleAveragingKernel>(interpolationPoint, samples, m_minNumPoints, Projection::cartesian);
     }
 
 } // namespace meshkernel::averaging
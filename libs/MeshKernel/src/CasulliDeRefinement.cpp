@@ -71,7 +71,7 @@ void meshkernel::CasulliDeRefinement::FindDirectlyConnectedFaces(const Mesh2D& m
 
     for (UInt i = 0; i < mesh.m_numFacesNodes[elementId]; ++i)
     {
-        UInt edgeId = mesh.m_facesEdges[elementId][i];
+        UInt edgeId = mesh.FaceEdges(elementId)[i];
 
         if (mesh.GetNumEdgesFaces(edgeId) < 2)
         {
@@ -92,11 +92,11 @@ void meshkernel::CasulliDeRefinement::FindIndirectlyConnectedFaces(const Mesh2D&
 
     for (UInt i = 0; i < mesh.m_numFacesNodes[elementId]; ++i)
     {
-        UInt nodeId = mesh.m_facesNodes[elementId][i];
+        UInt nodeId = mesh.FaceNodes(elementId)[i];
 
         for (UInt j = 0; j < mesh.GetNumNodesEdges(nodeId); ++j)
         {
-            UInt edgeId = mesh.m_nodesEdges[nodeId][j];
+            UInt edgeId = mesh.NodeEdges(nodeId)[j];
 
             for (UInt k = 0; k < mesh.GetNumEdgesFaces(edgeId); ++k)
             {
@@ -172,7 +172,7 @@ void meshkernel::CasulliDeRefinement::FindAdjacentFaces(const Mesh2D& mesh,
 
         for (UInt j = 0; j < mesh.m_numFacesNodes[elementId]; ++j)
         {
-            UInt edgeId = mesh.m_facesEdges[elementId][j];
+            UInt edgeId = mesh.FaceEdges(elementId)[j];
 
             if (mesh.GetNumEdgesFaces(edgeId) < 2)
             {
@@ -212,7 +212,7 @@ bool meshkernel::CasulliDeRefinement::ElementIsSeed(const Mesh2D& mesh,
 
     for (UInt i = 0; i < mesh.m_numFacesNodes[element]; ++i)
     {
-        if (nodeTypes[mesh.m_facesNodes[element][i]] == 0)
+        if (nodeTypes[mesh.FaceNodes(element)[i]] == 0)
         {
             isSeed = false;
             break;
@@ -461,6 +461,9 @@ std::vector<meshkernel::CasulliDeRefinement::ElementType> meshkernel::CasulliDeR
 
 bool meshkernel::CasulliDeRefinement::DoDeRefinement(Mesh2D& mesh, const Polygons& polygon)
 {
+    // The de-refinement updates the node-edge, face-node and face-edge connectivity in place
+    mesh.DecompressConnectivity();
+
     std::vector<UInt> directlyConnected;
     std::vector<UInt> indirectlyConnected;
     std::vector<std::array<int, 2>> edgeFaces(maximumSize);
@@ -503,7 +506,7 @@ bool meshkernel::CasulliDeRefinement::ElementCannotBeDeleted(const Mesh2D& mesh,
 
     for (UInt i = 0; i < mesh.m_numFacesNodes[elementId]; ++i)
     {
-        UInt edgeId = mesh.m_facesEdges[elementId][i];
+        UInt edgeId = mesh.FaceEdges(elementId)[i];
 
         if (mesh.GetEdge(edgeId).first == constants::missing::uintValue ||
             mesh.GetEdge(edgeId).second == constants::missing::uintValue)
@@ -525,7 +528,7 @@ bool meshkernel::CasulliDeRefinement::ElementCannotBeDeleted(const Mesh2D& mesh,
 
     for (UInt i = 0; i < mesh.m_numFacesNodes[elementId]; ++i)
     {
-        UInt nodeId = mesh.m_facesNodes[elementId][i];
+        UInt nodeId = mesh.FaceNodes(elementId)[i];
 
         if (nodeTypes[nodeId] == 3 && mesh.GetNumNodesEdges(nodeId) <= 2)
         {
@@ -539,7 +542,7 @@ bool meshkernel::CasulliDeRefinement::ElementCannotBeDeleted(const Mesh2D& mesh,
     // check if all nodes are in the selecting polygon
     for (UInt i = 0; i < mesh.m_numFacesNodes[elementId]; ++i)
     {
-        UInt nodeId = mesh.m_facesNodes[elementId][i];
+        UInt nodeId = mesh.FaceNodes(elementId)[i];
 
         if (!polygon.IsPointInAnyPolygon(mesh.Node(nodeId)))
         {
@@ -562,7 +565,7 @@ meshkernel::Point meshkernel::CasulliDeRefinement::ComputeNewNodeCoordinates(con
     for (UInt i = 0; i < mesh.m_numFacesNodes[elementId]; ++i)
     {
         double fac = 1.0;
-        UInt nodeId = mesh.m_facesNodes[elementId][i];
+        UInt nodeId = mesh.FaceNodes(elementId)[i];
 
         if (nodeTypes[nodeId] == 2 || nodeTypes[nodeId] == 4)
         {
@@ -597,7 +600,7 @@ std::tuple<meshkernel::UInt, meshkernel::UInt> meshkernel::CasulliDeRefinement::
 {
     for (UInt j = 0; j < mesh.m_numFacesNodes[leftElementId]; ++j)
     {
-        UInt edgeId = mesh.m_facesEdges[leftElementId][j];
+        UInt edgeId = mesh.FaceEdges(leftElementId)[j];
 
         if (mesh.GetNumEdgesFaces(edgeId) < 2)
         {
@@ -784,7 +787,7 @@ int meshkernel::CasulliDeRefinement::GetNodeCode(const Mesh2D& mesh,
 
     for (UInt i = 0; i < mesh.m_numFacesNodes[elementId]; ++i)
     {
-        nodeCode = std::max(nodeCode, nodeTypes[mesh.m_facesNodes[elementId][i]]);
+        nodeCode = std::max(nodeCode, nodeTypes[mesh.FaceNodes(elementId)[i]]);
     }
 
     return nodeCode;
@@ -1098,7 +1101,7 @@ std::vector<meshkernel::Point> meshkernel::CasulliDeRefinement::ElementsToDelete
 
             for (UInt j = 0; j < mesh.m_numFacesNodes[k]; ++j)
             {
-                if (nodeTypes[mesh.m_facesNodes[k][j]] > 0)
+                if (nodeTypes[mesh.FaceNodes(k)[j]] > 0)
                 {
                     toDelete = true;
                     break;
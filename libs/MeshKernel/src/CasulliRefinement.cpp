@@ -156,7 +156,7 @@ void meshkernel::CasulliRefinement::InitialiseCornerNodes(const Mesh2D& mesh, st
 
         for (UInt j = 0; j < mesh.GetNumNodesEdges(i); ++j)
         {
-            UInt edge1 = mesh.m_nodesEdges[i][j];
+            UInt edge1 = mesh.NodeEdges(i)[j];
 
             if (mesh.GetNumEdgesFaces(edge1) != 1)
             {
@@ -167,14 +167,14 @@ void meshkernel::CasulliRefinement::InitialiseCornerNodes(const Mesh2D& mesh, st
             UInt nodeCount = mesh.m_numFacesNodes[elementId];
 
             UInt faceEdgeIndex = 0;
-            UInt edge2 = mesh.m_facesEdges[elementId][faceEdgeIndex];
+            UInt edge2 = mesh.FaceEdges(elementId)[faceEdgeIndex];
 
             // Check the loop termination, especially the faceEdgeIndex < nodeCount - 1
             // Perhaps change to for loop checking the condition then break.
             while (((mesh.GetEdge(edge2).first != i && mesh.GetEdge(edge2).second != i) || edge2 == edge1) && faceEdgeIndex < nodeCount - 1)
             {
                 ++faceEdgeIndex;
-                edge2 = mesh.m_facesEdges[elementId][faceEdgeIndex];
+                edge2 = mesh.FaceEdges(elementId)[faceEdgeIndex];
             }
 
             if (mesh.GetNumEdgesFaces(edge2) == 1)
@@ -262,13 +262,12 @@ void meshkernel::CasulliRefinement::RefineNodeMaskBasedOnDepths(const Mesh2D& me
 
     refinementRequested = false;
 
-    for (size_t i = 0; i < mesh.GetNumNodes(); ++i)
+    for (UInt i = 0; i < mesh.GetNumNodes(); ++i)
     {
         bool refineNode = false;
 
-        for (size_t j = 0; j < mesh.m_nodesEdges[i].size(); ++j)
+        for (const UInt edgeId : mesh.NodeEdges(i))
         {
-            UInt edgeId = mesh.m_nodesEdges[i][j];
             double depth = depthValues[edgeId];
 
             if (depth == constants::missing::doubleValue || (minimumDepthRefinement != constants::missing::doubleValue && depth < minimumDepthRefinement))
@@ -488,8 +487,8 @@ void meshkernel::CasulliRefinement::ConnectFaceNodes(Mesh2D& mesh, const UInt cu
     {
         const UInt previousIndex = (j == 0 ? (mesh.m_numFacesNodes[currentFace] - 1) : (j - 1));
 
-        const UInt edgeId = mesh.m_facesEdges[currentFace][j];
-        const UInt previousEdgeId = mesh.m_facesEdges[currentFace][previousIndex];
+        const UInt edgeId = mesh.FaceEdges(currentFace)[j];
+        const UInt previousEdgeId = mesh.FaceEdges(currentFace)[previousIndex];
 
         oldIndex[j] = mesh.GetEdge(edgeId).first;
         newIndex[j] = newNodes[edgeId][2];
@@ -561,7 +560,7 @@ void meshkernel::CasulliRefinement::ConnectEdges(Mesh2D& mesh, const UInt curren
 
     for (UInt j = 0; j < mesh.GetNumNodesEdges(currentNode); ++j)
     {
-        UInt edgeId = mesh.m_nodesEdges[currentNode][j];
+        UInt edgeId = mesh.NodeEdges(currentNode)[j];
 
         if (mesh.GetNumEdgesFaces(edgeId) == 0)
         {
@@ -684,9 +683,9 @@ void meshkernel::CasulliRefinement::ConnectNewNodes(Mesh2D& mesh, const std::vec
 
         bool faceIsActive = true;
 
-        for (UInt j = 0; j < mesh.m_facesNodes[i].size(); ++j)
+        for (UInt j = 0; j < mesh.FaceNodes(i).size(); ++j)
         {
-            if (nodeMask[mesh.m_facesNodes[i][j]] == NodeMask::Unassigned)
+            if (nodeMask[mesh.FaceNodes(i)[j]] == NodeMask::Unassigned)
             {
                 faceIsActive = false;
                 break;
@@ -711,7 +710,7 @@ void meshkernel::CasulliRefinement::ConnectNewNodes(Mesh2D& mesh, const std::vec
 
         for (UInt j = 0; j < mesh.GetNumNodesEdges(i); ++j)
         {
-            const UInt edgeId = mesh.m_nodesEdges[i][j];
+            const UInt edgeId = mesh.NodeEdges(i)[j];
 
             if (mesh.GetNumEdgesFaces(edgeId) == 0)
             {
@@ -755,16 +754,16 @@ void meshkernel::CasulliRefinement::ComputeNewFaceNodes(Mesh2D& mesh, std::vecto
 
         for (UInt j = 0; j < mesh.m_numFacesNodes[i]; ++j)
         {
-            const UInt elementNode = mesh.m_facesNodes[i][j];
+            const UInt elementNode = mesh.FaceNodes(i)[j];
 
             UInt firstEdgeId = constants::missing::uintValue;
             UInt secondEdgeId = constants::missing::uintValue;
             UInt newNodeId = constants::missing::uintValue;
             std::unique_ptr<AddNodeAction> nodeInsertionAction;
 
-            for (UInt k = 0; k < mesh.m_facesEdges[i].size(); ++k)
+            for (UInt k = 0; k < mesh.FaceEdges(i).size(); ++k)
             {
-                UInt edgeId = mesh.m_facesEdges[i][k];
+                UInt edgeId = mesh.FaceEdges(i)[k];
 
                 if (mesh.GetEdge(edgeId).first == elementNode || mesh.GetEdge(edgeId).second == elementNode)
                 {
@@ -36,6 +36,8 @@
 #include "MeshKernel/Polygons.hpp"
 #include "MeshKernel/Utilities/RTreeFactory.hpp"
 
+#include <exception>
+
 using meshkernel::Contacts;
 
 Contacts::Contacts(Mesh1D& mesh1d, Mesh2D& mesh2d)
@@ -74,16 +76,51 @@ void Contacts::ComputeSingleContacts(const std::vector<bool>& oneDNodeMask,
 
     const auto nodePolygonIndices = polygons.PointsInPolygons(m_mesh1d.Nodes());
 
-    for (UInt n = 0; n < m_mesh1d.GetNumNodes(); ++n)
+    // a 1d node is connected if included in the polygons and, if oneDNodeMask is not empty, if its mask value is true
+    const auto isNodeToConnect = [&](UInt n)
+    {
+        return nodePolygonIndices[n] && (oneDNodeMask.empty() || oneDNodeMask[n]);
+    };
+
+    // first phase: for the 1d nodes outside the 2d mesh, compute in parallel the boundary faces crossed by the right and the left projected segments.
+    // These candidates do not depend on the contacts generated for the other nodes
+    const auto numNodes = m_mesh1d.GetNumNodes();
+    std::vector<UInt> rightCrossingFaces(numNodes, constants::missing::uintValue);
+    std::vector<UInt> leftCrossingFaces(numNodes, constants::missing::uintValue);
+    std::exception_ptr exception;
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int n = 0; n < static_cast<int>(numNodes); ++n)
     {
-        // connect only nodes included in the polygons
-        if (!nodePolygonIndices[n])
+        if (!isNodeToConnect(n) || node1dFaceIndices[n] != constants::missing::uintValue)
         {
             continue;
         }
 
-        // if oneDNodeMask is not empty, connect only if the mask value for the current node is true
-        if (!oneDNodeMask.empty() && !oneDNodeMask[n])
+        try
+        {
+            rightCrossingFaces[n] = FindCrossingBoundaryFace(n, projectionFactor);
+            leftCrossingFaces[n] = FindCrossingBoundaryFace(n, -projectionFactor);
+        }
+        catch (...)
+        {
+#pragma omp critical
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+        }
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+
+    // second phase: generate the contacts in node order, a candidate contact is discarded if crossing a contact generated before
+    for (UInt n = 0; n < numNodes; ++n)
+    {
+        if (!isNodeToConnect(n))
         {
             continue;
         }
@@ -96,27 +133,32 @@ void Contacts::ComputeSingleContacts(const std::vector<bool>& oneDNodeMask,
             continue;
         }
 
-        // connect faces crossing the right projected segment
-        Connect1dNodesWithCrossingFaces(n, projectionFactor);
-        // connect faces crossing the left projected segment
-        Connect1dNodesWithCrossingFaces(n, -projectionFactor);
+        // connect faces crossing the right and then the left projected segment
+        for (const auto face : {rightCrossingFaces[n], leftCrossingFaces[n]})
+        {
+            if (face != constants::missing::uintValue && !IsContactIntersectingContact(n, face))
+            {
+                m_mesh1dIndices.emplace_back(n);
+                m_mesh2dIndices.emplace_back(face);
+            }
+        }
     }
 }
 
-void Contacts::Connect1dNodesWithCrossingFaces(UInt node,
-                                               double projectionFactor)
+meshkernel::UInt Contacts::FindCrossingBoundaryFace(UInt node,
+                                                    double projectionFactor) const
 {
     const auto projectedNode = m_mesh1d.ComputeProjectedNode(node, projectionFactor);
 
     const auto [intersectedFace, intersectedEdge] = m_mesh2d.IsSegmentCrossingABoundaryEdge(m_mesh1d.Node(node), projectedNode);
     if (intersectedFace != constants::missing::uintValue &&
         intersectedEdge != constants::missing::uintValue &&
-        !IsContactIntersectingMesh1d(node, intersectedFace) &&
-        !IsContactIntersectingContact(node, intersectedFace))
+        !IsContactIntersectingMesh1d(node, intersectedFace))
     {
-        m_mesh1dIndices.emplace_back(node);
-        m_mesh2dIndices.emplace_back(intersectedFace);
+        return intersectedFace;
     }
+
+    return constants::missing::uintValue;
 }
 
 bool Contacts::IsContactIntersectingMesh1d(UInt node,
@@ -198,35 +240,45 @@ void Contacts::ComputeMultipleContacts(const std::vector<bool>& oneDNodeMask)
     m_mesh2d.BuildTree(Location::Faces);
     auto& rtree = m_mesh2d.GetRTree(Location::Faces);
 
-    // loop over 1d mesh edges
-    for (UInt e = 0; e < m_mesh1d.GetNumEdges(); ++e)
+    // the search radius around the first node of each 1d mesh edge
+    const auto numEdges1d = m_mesh1d.GetNumEdges();
+    std::vector<Point> searchNodes(numEdges1d);
+    std::vector<double> searchRadiiSquared(numEdges1d);
+
+#pragma omp parallel for
+    for (int e = 0; e < static_cast<int>(numEdges1d); ++e)
     {
-        // get the mesh1d edge nodes
         const auto firstNode1dMeshEdge = m_mesh1d.GetEdge(e).first;
-        const auto secondNode1dMeshEdge = m_mesh1d.GetEdge(e).second;
-
-        // computes the maximum edge length
         const auto maxEdgeLength = algo::MaxLengthSurroundingEdges(m_mesh1d, firstNode1dMeshEdge, mesh1dEdgeLengths);
+        searchNodes[e] = m_mesh1d.Node(firstNode1dMeshEdge);
+        searchRadiiSquared[e] = 1.1 * maxEdgeLength * maxEdgeLength;
+    }
 
-        // compute the nearest 2d face indices
-        rtree.SearchPoints(m_mesh1d.Node(firstNode1dMeshEdge), 1.1 * maxEdgeLength * maxEdgeLength);
+    // compute the nearest 2d face indices of all 1d mesh edges in one batch
+    RTreeQueryResults nearestFaces;
+    rtree.SearchPoints(searchNodes, searchRadiiSquared, nearestFaces);
 
-        // for each face determine if it is crossing the current 1d edge
-        const auto numNeighbours = rtree.GetQueryResultSize();
-        for (UInt f = 0; f < numNeighbours; ++f)
-        {
-            const auto face = rtree.GetQueryResult(f);
+    // first phase: for each 1d edge and each nearby face, compute in parallel the 1d node to connect to the face, if any.
+    // The candidates are stored in the same order as the faces found by the search and do not depend on the contacts generated for other edges
+    std::vector<UInt> nodesToConnect(nearestFaces.indices.size(), constants::missing::uintValue);
 
-            // the face is already connected to a 1d node, nothing to do
-            if (isFaceAlreadyConnected[face])
-            {
-                continue;
-            }
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int e = 0; e < static_cast<int>(numEdges1d); ++e)
+    {
+        // get the mesh1d edge nodes
+        const auto firstNode1dMeshEdge = m_mesh1d.GetEdge(e).first;
+        const auto secondNode1dMeshEdge = m_mesh1d.GetEdge(e).second;
+
+        const auto faces = nearestFaces[e];
+        for (UInt f = 0; f < faces.size(); ++f)
+        {
+            const auto face = faces[f];
 
-            // determine which of the mesh2d edges is crossing the current 1d edge
+            // determine if one of the mesh2d edges is crossing the current 1d edge
+            bool isFaceCrossed = false;
             for (UInt ee = 0; ee < m_mesh2d.m_numFacesNodes[face]; ++ee)
             {
-                const auto edge = m_mesh2d.m_facesEdges[face][ee];
+                const auto edge = m_mesh2d.FaceEdges(face)[ee];
                 const auto firstNode2dMeshEdge = m_mesh2d.GetEdge(edge).first;
                 const auto secondNode2dMeshEdge = m_mesh2d.GetEdge(edge).second;
 
@@ -243,34 +295,58 @@ void Contacts::ComputeMultipleContacts(const std::vector<bool>& oneDNodeMask)
                                         false,
                                         m_mesh1d.m_projection);
 
-                // nothing is crossing, continue
-                if (!areCrossing)
+                if (areCrossing)
                 {
-                    continue;
+                    isFaceCrossed = true;
+                    break;
                 }
+            }
 
-                // compute the distance between the face circumcenter and the crossed 1d edge nodes.
-                const auto leftDistance = ComputeDistance(m_mesh1d.Node(firstNode1dMeshEdge), m_facesCircumcenters[face], m_mesh1d.m_projection);
-                const auto rightDistance = ComputeDistance(m_mesh1d.Node(secondNode1dMeshEdge), m_facesCircumcenters[face], m_mesh1d.m_projection);
-                const auto nodeToConnect = leftDistance <= rightDistance ? firstNode1dMeshEdge : secondNode1dMeshEdge;
+            // nothing is crossing, continue
+            if (!isFaceCrossed)
+            {
+                continue;
+            }
 
-                // if oneDNodeMask is not empty, connect only if the mask value for the current node is true
-                if (!oneDNodeMask.empty() && !oneDNodeMask[nodeToConnect])
-                {
-                    continue;
-                }
+            // compute the distance between the face circumcenter and the crossed 1d edge nodes.
+            const auto leftDistance = ComputeDistance(m_mesh1d.Node(firstNode1dMeshEdge), m_facesCircumcenters[face], m_mesh1d.m_projection);
+            const auto rightDistance = ComputeDistance(m_mesh1d.Node(secondNode1dMeshEdge), m_facesCircumcenters[face], m_mesh1d.m_projection);
+            const auto nodeToConnect = leftDistance <= rightDistance ? firstNode1dMeshEdge : secondNode1dMeshEdge;
 
-                // the 1d mesh node to be connected needs to be included in the 2d mesh
-                if (node1dFaceIndices[nodeToConnect] == constants::missing::uintValue)
-                {
-                    continue;
-                }
+            // if oneDNodeMask is not empty, connect only if the mask value for the current node is true
+            if (!oneDNodeMask.empty() && !oneDNodeMask[nodeToConnect])
+            {
+                continue;
+            }
 
-                m_mesh1dIndices.emplace_back(nodeToConnect);
-                m_mesh2dIndices.emplace_back(face);
-                isFaceAlreadyConnected[face] = true;
-                break;
+            // the 1d mesh node to be connected needs to be included in the 2d mesh
+            if (node1dFaceIndices[nodeToConnect] == constants::missing::uintValue)
+            {
+                continue;
             }
+
+            nodesToConnect[nearestFaces.offsets[e] + f] = nodeToConnect;
+        }
+    }
+
+    // second phase: generate the contacts in 1d edge order, each face is connected to the first candidate 1d node only
+    for (UInt e = 0; e < numEdges1d; ++e)
+    {
+        const auto faces = nearestFaces[e];
+        for (UInt f = 0; f < faces.size(); ++f)
+        {
+            const auto face = faces[f];
+            const auto nodeToConnect = nodesToConnect[nearestFaces.offsets[e] + f];
+
+            // no candidate or the face is already connected to a 1d node, nothing to do
+            if (nodeToConnect == constants::missing::uintValue || isFaceAlreadyConnected[face])
+            {
+                continue;
+            }
+
+            m_mesh1dIndices.emplace_back(nodeToConnect);
+            m_mesh2dIndices.emplace_back(face);
+            isFaceAlreadyConnected[face] = true;
         }
     }
 }
@@ -366,11 +442,15 @@ void Contacts::ComputeContactsWithPoints(const std::vector<bool>& oneDNodeMask,
     Validate();
 
     m_mesh1d.BuildTree(Location::Nodes);
-    auto& rtree = m_mesh1d.GetRTree(Location::Nodes);
+    const auto& rtree = m_mesh1d.GetRTree(Location::Nodes);
 
     // find the face indices containing the 1d points
     const auto pointsFaceIndices = m_mesh2d.PointFaceIndices(points);
 
+    // find the closest 1d node of all points in one batch
+    RTreeQueryResults closest1dNodes;
+    rtree.SearchNearestPoints(points, 1, closest1dNodes);
+
     // for each 1d node in the 2d mesh, find the closest 1d node.
     for (UInt i = 0; i < points.size(); ++i)
     {
@@ -381,15 +461,12 @@ void Contacts::ComputeContactsWithPoints(const std::vector<bool>& oneDNodeMask,
             continue;
         }
 
-        // get the closest 1d node
-        rtree.SearchNearestPoint(points[i]);
-
-        if (rtree.GetQueryResultSize() == 0)
+        if (closest1dNodes.Size(i) == 0)
         {
             continue;
         }
 
-        UInt closest1dNodeindex = rtree.GetQueryResult(0);
+        UInt closest1dNodeindex = closest1dNodes[i][0];
 
         // form the 1d-2d contact
         // Account for 1d node mask
@@ -421,7 +498,7 @@ void Contacts::ComputeBoundaryContacts(const std::vector<bool>& oneDNodeMask,
     Validate();
 
     // build mesh2d face circumcenters r-tree
-    const auto faceCircumcentersRTree = RTreeFactory::Create(m_mesh2d.m_projection);
+    const auto faceCircumcentersRTree = RTreeFactory::Create(m_mesh2d.m_projection, RTreeFactory::Type::Packed);
     faceCircumcentersRTree->BuildTree(m_facesCircumcenters);
 
     // get the indices
@@ -435,10 +512,27 @@ void Contacts::ComputeBoundaryContacts(const std::vector<bool>& oneDNodeMask,
         localSearchRadius = searchRadius;
     }
 
-    // Loop over 1d edges
+    // the search radius around each 1d node
+    const auto numNodes1d = m_mesh1d.GetNumNodes();
+    std::vector<double> searchRadiiSquared(numNodes1d, localSearchRadius * localSearchRadius);
+    if (computeLocalSearchRadius)
+    {
+#pragma omp parallel for
+        for (int n = 0; n < static_cast<int>(numNodes1d); ++n)
+        {
+            const auto maxEdgeLength = algo::MaxLengthSurroundingEdges(m_mesh1d, n, mesh1dEdgeLengths);
+            searchRadiiSquared[n] = maxEdgeLength * maxEdgeLength;
+        }
+    }
+
+    // compute the nearest 2d face indices of all 1d nodes in one batch
+    RTreeQueryResults nearestFaces;
+    faceCircumcentersRTree->SearchPoints(m_mesh1d.Nodes(), searchRadiiSquared, nearestFaces);
+
+    // Loop over 1d nodes
     std::vector<bool> isValidFace(m_mesh2d.GetNumFaces(), true);
     std::vector<UInt> faceTo1DNode(m_mesh2d.GetNumFaces(), constants::missing::uintValue);
-    for (UInt n = 0; n < m_mesh1d.GetNumNodes(); ++n)
+    for (UInt n = 0; n < numNodes1d; ++n)
     {
         // Account for 1d node mask if present
         if (!oneDNodeMask.empty() && !oneDNodeMask[n])
@@ -446,17 +540,8 @@ void Contacts::ComputeBoundaryContacts(const std::vector<bool>& oneDNodeMask,
             continue;
         }
 
-        if (computeLocalSearchRadius)
-        {
-            localSearchRadius = algo::MaxLengthSurroundingEdges(m_mesh1d, n, mesh1dEdgeLengths);
-        }
-
-        // compute the nearest 2d face indices
-        faceCircumcentersRTree->SearchPoints(m_mesh1d.Node(n), localSearchRadius * localSearchRadius);
-
-        for (UInt f = 0; f < faceCircumcentersRTree->GetQueryResultSize(); ++f)
+        for (const auto face : nearestFaces[n])
         {
-            const auto face = faceCircumcentersRTree->GetQueryResult(f);
 
             // the face is already marked as invalid, nothing to do
             if (!isValidFace[face])
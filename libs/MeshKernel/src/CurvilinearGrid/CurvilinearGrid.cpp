@@ -95,9 +95,11 @@ CurvilinearGrid& CurvilinearGrid::operator=(CurvilinearGrid&& copy) noexcept
         m_nodesRTreeRequiresUpdate = std::exchange(copy.m_nodesRTreeRequiresUpdate, false);
         m_edgesRTreeRequiresUpdate = std::exchange(copy.m_edgesRTreeRequiresUpdate, false);
         m_facesRTreeRequiresUpdate = std::exchange(copy.m_facesRTreeRequiresUpdate, false);
-        m_boundingBoxCache = std::exchange(copy.m_boundingBoxCache, BoundingBox());
+        m_boundingBoxCache = std::exchange(copy.m_boundingBoxCache, {});
         m_startOffset = std::exchange(copy.m_startOffset, CurvilinearGridNodeIndices(0, 0));
         m_endOffset = std::exchange(copy.m_endOffset, CurvilinearGridNodeIndices(0, 0));
+        ++m_geometryGeneration;
+        ++m_topologyGeneration;
     }
 
     return *this;
@@ -116,6 +118,8 @@ CurvilinearGrid& CurvilinearGrid::operator=(const CurvilinearGrid& copy)
         m_nodesRTreeRequiresUpdate = true;
         m_edgesRTreeRequiresUpdate = true;
         m_facesRTreeRequiresUpdate = true;
+        ++m_geometryGeneration;
+        ++m_topologyGeneration;
 
         m_RTrees.emplace(Location::Nodes, RTreeFactory::Create(m_projection));
         m_RTrees.emplace(Location::Edges, RTreeFactory::Create(m_projection));
@@ -165,6 +169,8 @@ void CurvilinearGrid::SetGridNodes(const lin_alg::Matrix<Point>& gridNodes)
     m_nodesRTreeRequiresUpdate = true;
     m_edgesRTreeRequiresUpdate = true;
     m_facesRTreeRequiresUpdate = true;
+    ++m_geometryGeneration;
+    ++m_topologyGeneration;
 
     m_gridIndices = ComputeNodeIndices();
 }
@@ -198,6 +204,8 @@ void CurvilinearGrid::SetGridNodes(lin_alg::Matrix<Point>&& gridNodes)
     m_nodesRTreeRequiresUpdate = true;
     m_edgesRTreeRequiresUpdate = true;
     m_facesRTreeRequiresUpdate = true;
+    ++m_geometryGeneration;
+    ++m_topologyGeneration;
 
     // Compute new indices
     m_gridIndices = ComputeNodeIndices();
@@ -378,34 +386,37 @@ void CurvilinearGrid::Delete(std::shared_ptr<Polygons> polygons, UInt polygonInd
 
 void CurvilinearGrid::BuildTree(Location location, const BoundingBox& boundingBox)
 {
+    // each location has its own bounding box, building one RTree does not invalidate the others
+    auto& boundingBoxCache = m_boundingBoxCache[location];
+
     switch (location)
     {
     case Location::Faces:
-        if (m_facesRTreeRequiresUpdate || m_boundingBoxCache != boundingBox)
+        if (m_facesRTreeRequiresUpdate || boundingBoxCache != boundingBox)
         {
             const auto faceCenters = ComputeFaceCenters();
             m_RTrees.at(Location::Faces)->BuildTree(faceCenters, boundingBox);
             m_facesRTreeRequiresUpdate = false;
-            m_boundingBoxCache = boundingBox;
+            boundingBoxCache = boundingBox;
         }
         break;
     case Location::Nodes:
-        if (m_nodesRTreeRequiresUpdate || m_boundingBoxCache != boundingBox)
+        if (m_nodesRTreeRequiresUpdate || boundingBoxCache != boundingBox)
         {
             const auto nodes = ComputeNodes();
             m_RTrees.at(Location::Nodes)->BuildTree(nodes, boundingBox);
             m_nodesRTreeRequiresUpdate = false;
-            m_boundingBoxCache = boundingBox;
+            boundingBoxCache = boundingBox;
         }
         break;
     case Location::Edges:
-        if (m_edgesRTreeRequiresUpdate || m_boundingBoxCache != boundingBox)
+        if (m_edgesRTreeRequiresUpdate || boundingBoxCache != boundingBox)
         {
             m_edges = ComputeEdges();
             const auto edgeCenters = ComputeEdgesCenters();
             m_RTrees.at(Location::Edges)->BuildTree(edgeCenters, boundingBox);
             m_edgesRTreeRequiresUpdate = false;
-            m_boundingBoxCache = boundingBox;
+            boundingBoxCache = boundingBox;
         }
         break;
     case Location::Unknown:
@@ -687,6 +698,7 @@ meshkernel::NodeType CurvilinearGrid::GetInteriorNodeType(const UInt n, const UI
 
 void CurvilinearGrid::ComputeGridNodeTypes()
 {
+    ++m_topologyGeneration;
     RemoveInvalidNodes(true);
     lin_alg::ResizeAndFillMatrix(m_gridNodesTypes, FullNumN(), FullNumM(), false, NodeType::Invalid);
 
@@ -1430,14 +1442,26 @@ std::vector<meshkernel::Point> CurvilinearGrid::ComputeEdgesCenters() const
     std::vector<Point> result(GetNumEdges());
     UInt index = 0;
 
-    const auto edgeIndices = ComputeEdgeIndices();
+    // Same ordering as ComputeEdgeIndices, the edges along n first
+    for (UInt n = 0; n + 1 < NumN(); ++n)
+    {
+        const Point* nodes = GetNodeRow(n);
+        const Point* nextNodes = GetNodeRow(n + 1);
+        for (UInt m = 0; m < NumM(); ++m)
+        {
+            result[index + m] = (nodes[m] + nextNodes[m]) * 0.5;
+        }
+        index += NumM();
+    }
 
-    for (const auto& edgeIndex : edgeIndices)
+    for (UInt n = 0; n < NumN(); ++n)
     {
-        const auto first = edgeIndex[0];
-        const auto second = edgeIndex[1];
-        result[index] = (GetNode(first.m_n, first.m_m) + GetNode(second.m_n, second.m_m)) * 0.5;
-        index++;
+        const Point* nodes = GetNodeRow(n);
+        for (UInt m = 0; m + 1 < NumM(); ++m)
+        {
+            result[index + m] = (nodes[m] + nodes[m + 1]) * 0.5;
+        }
+        index += NumM() - 1;
     }
 
     return result;
@@ -1609,14 +1633,17 @@ std::vector<meshkernel::Point> CurvilinearGrid::ComputeFaceCenters() const
 
     for (UInt n = 0; n < NumN() - 1; n++)
     {
+        const Point* nodes = GetNodeRow(n);
+        const Point* nextNodes = GetNodeRow(n + 1);
+
         for (UInt m = 0; m < NumM() - 1; m++)
         {
             Point massCenter{0.0, 0.0};
 
-            massCenter += GetNode(n, m);
-            massCenter += GetNode(n, m + 1);
-            massCenter += GetNode(n + 1, m + 1);
-            massCenter += GetNode(n + 1, m);
+            massCenter += nodes[m];
+            massCenter += nodes[m + 1];
+            massCenter += nextNodes[m + 1];
+            massCenter += nextNodes[m];
 
             result.push_back(massCenter * 0.25);
         }
@@ -0,0 +1,95 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include "MeshKernel/CurvilinearGrid/CurvilinearGridCoordinates.hpp"
+#include "MeshKernel/CurvilinearGrid/CurvilinearGrid.hpp"
+
+using meshkernel::CurvilinearGridCoordinates;
+
+CurvilinearGridCoordinates::CurvilinearGridCoordinates(const CurvilinearGrid& grid)
+{
+    Assign(grid);
+}
+
+void CurvilinearGridCoordinates::Assign(const CurvilinearGrid& grid)
+{
+    const auto numN = grid.NumN();
+    const auto numM = grid.NumM();
+
+    lin_alg::ResizeAndFillMatrix(m_x, numN, numM);
+    lin_alg::ResizeAndFillMatrix(m_y, numN, numM);
+    m_isValid.assign((static_cast<std::size_t>(numN) * numM + BitsPerWord - 1) / BitsPerWord, 0);
+
+    for (UInt n = 0; n < numN; ++n)
+    {
+        const Point* nodes = grid.GetNodeRow(n);
+        double* x = X(n);
+        double* y = Y(n);
+
+        for (UInt m = 0; m < numM; ++m)
+        {
+            x[m] = nodes[m].x;
+            y[m] = nodes[m].y;
+        }
+
+        const auto first = static_cast<std::size_t>(n) * numM;
+        for (UInt m = 0; m < numM; ++m)
+        {
+            const auto index = first + m;
+            const std::uint64_t isValid = x[m] != constants::missing::doubleValue && y[m] != constants::missing::doubleValue;
+            m_isValid[index / BitsPerWord] |= isValid << (index % BitsPerWord);
+        }
+    }
+}
+
+void CurvilinearGridCoordinates::Store(CurvilinearGrid& grid,
+                                       const CurvilinearGridNodeIndices& lowerLeft,
+                                       const CurvilinearGridNodeIndices& upperRight) const
+{
+    for (UInt n = lowerLeft.m_n; n <= upperRight.m_n; ++n)
+    {
+        Point* nodes = grid.GetNodeRow(n);
+        const double* x = X(n);
+        const double* y = Y(n);
+
+        for (UInt m = lowerLeft.m_m; m <= upperRight.m_m; ++m)
+        {
+            nodes[m] = {x[m], y[m]};
+        }
+    }
+}
+
+void CurvilinearGridCoordinates::Set(UInt n, UInt m, const Point& node)
+{
+    m_x(n, m) = node.x;
+    m_y(n, m) = node.y;
+
+    const auto index = static_cast<std::size_t>(n) * NumM() + m;
+    const auto bit = std::uint64_t{1} << (index % BitsPerWord);
+    m_isValid[index / BitsPerWord] = node.IsValid() ? m_isValid[index / BitsPerWord] | bit : m_isValid[index / BitsPerWord] & ~bit;
+}
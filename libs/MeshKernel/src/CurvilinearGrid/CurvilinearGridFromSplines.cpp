@@ -33,7 +33,10 @@
 #include <MeshKernel/Parameters.hpp>
 #include <MeshKernel/SplineAlgorithms.hpp>
 #include <MeshKernel/Splines.hpp>
+#include <MeshKernel/Utilities/RTreeFactory.hpp>
 
+#include <algorithm>
+#include <numeric>
 #include <span>
 
 namespace meshkernel
@@ -835,116 +838,227 @@ namespace meshkernel
                                                             double& otherTimeStep,
                                                             std::vector<double>& otherTimeStepMax) const
     {
-        double maximumTimeStep = timeStep;
+        const auto numActiveSegments = static_cast<UInt>(activeLayerPoints.size()) - 1;
+        const auto numFrontSegments = static_cast<UInt>(frontGridPoints.size()) - 1;
+
+        // Spherical distances are in metres while the velocities are in degrees, no search radius can be derived:
+        // all front segments are checked
+        const bool useFrontIndex = m_splines->m_projection == Projection::cartesian;
 
-        std::vector<double> tmax(activeLayerPoints.size(), timeStep);
+        // A small margin, so front segments on the search radius are included despite rounding
+        constexpr double relativeMargin = 1.0e-6;
 
-        for (UInt i = 0; i < activeLayerPoints.size() - 1; ++i)
+        double maximumFrontVelocity = 0.0;
+        double maximumFrontSegmentLength = 0.0;
+        const auto frontNodesRTree = RTreeFactory::Create(Projection::cartesian, RTreeFactory::Type::Packed);
+
+        if (useFrontIndex)
         {
-            if (!activeLayerPoints[i].IsValid() || !activeLayerPoints[i + 1].IsValid())
+            for (UInt j = 0; j < numFrontSegments; ++j)
             {
-                continue;
+                if (frontGridPoints[j].IsValid() && frontGridPoints[j + 1].IsValid())
+                {
+                    maximumFrontVelocity = std::max({maximumFrontVelocity, std::sqrt(lengthSquared(frontVelocities[j])), std::sqrt(lengthSquared(frontVelocities[j + 1]))});
+                    maximumFrontSegmentLength = std::max(maximumFrontSegmentLength, ComputeDistance(frontGridPoints[j], frontGridPoints[j + 1], m_splines->m_projection));
+                }
             }
 
-            const Point x1 = activeLayerPoints[i];
-            const Point x2 = activeLayerPoints[i + 1];
-
-            const Point v1 = velocityVectorAtGridPoints[i];
-            const Point v2 = velocityVectorAtGridPoints[i + 1];
-
-            const double dL1 = ComputeDistance(x1, activeLayerPoints[i + 1], m_splines->m_projection);
-            UInt indexLeft;
-            UInt indexLeftOfLeft;
-            UInt indexRight;
-            UInt indexRightOfRight;
-            UInt dummy;
+            frontNodesRTree->BuildTree(frontGridPoints);
+        }
 
-            std::tie(indexLeft, dummy) = GetNeighbours(activeLayerPoints, i);
-            std::tie(dummy, indexRight) = GetNeighbours(activeLayerPoints, i + 1);
+        // The segments of the active layer are checked independently: each one records the smallest crossing times
+        // of its nodes and the resulting time step, these are combined afterwards in segment order
+        std::vector<double> leftNodeTimeStep(numActiveSegments);
+        std::vector<double> rightNodeTimeStep(numActiveSegments);
+        std::vector<double> segmentTimeStep(numActiveSegments, timeStep);
+        std::exception_ptr exception;
 
-            std::tie(indexLeftOfLeft, dummy) = GetNeighbours(activeLayerPoints, indexLeft);
-            std::tie(dummy, indexRightOfRight) = GetNeighbours(activeLayerPoints, indexRight);
+#pragma omp parallel
+        {
+            std::vector<UInt> queryResult;
+            std::vector<UInt> frontSegments;
 
-            for (UInt j = 0; j < frontGridPoints.size() - 1; ++j)
+#pragma omp for
+            for (int i = 0; i < static_cast<int>(numActiveSegments); ++i)
             {
-                if (!frontGridPoints[j].IsValid() || !frontGridPoints[j + 1].IsValid())
+                try
                 {
-                    continue;
-                }
+                    double& leftTimeStep = leftNodeTimeStep[i];
+                    double& rightTimeStep = rightNodeTimeStep[i];
+                    double& maximumTimeStep = segmentTimeStep[i];
 
-                const Point x3 = frontGridPoints[j];
-                const Point x4 = frontGridPoints[j + 1];
+                    leftTimeStep = otherTimeStepMax[i];
+                    rightTimeStep = otherTimeStepMax[i + 1];
 
-                const Point v3 = frontVelocities[j];
-                const Point v4 = frontVelocities[j + 1];
+                    if (!activeLayerPoints[i].IsValid() || !activeLayerPoints[i + 1].IsValid())
+                    {
+                        continue;
+                    }
 
-                const double dL2 = ComputeDistance(x3, x4, m_splines->m_projection);
+                    const Point x1 = activeLayerPoints[i];
+                    const Point x2 = activeLayerPoints[i + 1];
 
-                const double d1 = ComputeDistance(x1, x3, m_splines->m_projection);
-                const double d2 = ComputeDistance(x2, x3, m_splines->m_projection);
-                const double d3 = ComputeDistance(x1, x4, m_splines->m_projection);
-                const double d4 = ComputeDistance(x2, x4, m_splines->m_projection);
+                    const Point v1 = velocityVectorAtGridPoints[i];
+                    const Point v2 = velocityVectorAtGridPoints[i + 1];
 
-                if (d1 < tolerance || d2 < tolerance || d3 < tolerance || d4 < tolerance)
-                {
-                    continue;
-                }
+                    const double dL1 = ComputeDistance(x1, x2, m_splines->m_projection);
+                    UInt indexLeft;
+                    UInt indexLeftOfLeft;
+                    UInt indexRight;
+                    UInt indexRightOfRight;
+                    UInt dummy;
 
-                if (!IncludeDirectNeighbours(layerIndex, j, gridPointsIndices, indexLeftOfLeft, indexRightOfRight))
-                {
-                    continue;
-                }
+                    std::tie(indexLeft, dummy) = GetNeighbours(activeLayerPoints, i);
+                    std::tie(dummy, indexRight) = GetNeighbours(activeLayerPoints, i + 1);
 
-                const double dmin = std::min({d1, d2, d3, d4});
+                    std::tie(indexLeftOfLeft, dummy) = GetNeighbours(activeLayerPoints, indexLeft);
+                    std::tie(dummy, indexRightOfRight) = GetNeighbours(activeLayerPoints, indexRight);
 
-                // get a lower bound for the cross time
-                const double hlow2 = 0.25 * std::max(dmin * dmin - std::pow(0.5 * std::max(dL1, dL2), 2), 0.0);
+                    frontSegments.clear();
 
-                // check if the lower bounds is larger than the minimum found so far
-                const double vv1 = std::sqrt(lengthSquared(v3 - v1));
-                const double vv2 = std::sqrt(lengthSquared(v3 - v2));
-                const double vv3 = std::sqrt(lengthSquared(v4 - v1));
-                const double vv4 = std::sqrt(lengthSquared(v4 - v2));
+                    if (useFrontIndex)
+                    {
+                        // The lower bound of the crossing time exceeds the time step when the closest end points are further
+                        // apart than twice the largest relative displacement plus half of the longest segment
+                        const double maximumRelativeVelocity = std::max(std::sqrt(lengthSquared(v1)), std::sqrt(lengthSquared(v2))) + maximumFrontVelocity;
+                        const double searchRadius = (2.0 * maximumRelativeVelocity * timeStep +
+                                                     0.5 * std::max(dL1, maximumFrontSegmentLength)) *
+                                                        (1.0 + relativeMargin) +
+                                                    tolerance;
+
+                        for (const auto& node : {x1, x2})
+                        {
+                            frontNodesRTree->SearchPoints(node, searchRadius * searchRadius, queryResult);
+
+                            for (const auto frontNode : queryResult)
+                            {
+                                if (frontNode > 0)
+                                {
+                                    frontSegments.emplace_back(frontNode - 1);
+                                }
+                                if (frontNode < numFrontSegments)
+                                {
+                                    frontSegments.emplace_back(frontNode);
+                                }
+                            }
+                        }
 
-                const double maxvv = std::max(std::max(vv1, vv2), std::max(vv3, vv4));
+                        // Check the segments in the order of the front, the check of a segment stops at the first touching segment
+                        std::ranges::sort(frontSegments);
+                        const auto duplicates = std::ranges::unique(frontSegments);
+                        frontSegments.erase(duplicates.begin(), duplicates.end());
+                    }
+                    else
+                    {
+                        frontSegments.resize(numFrontSegments);
+                        std::iota(frontSegments.begin(), frontSegments.end(), 0);
+                    }
 
-                if (std::sqrt(hlow2) > maxvv * std::min(tmax[i], tmax[i + 1]))
-                {
-                    continue;
-                }
+                    for (const auto j : frontSegments)
+                    {
+                        if (!frontGridPoints[j].IsValid() || !frontGridPoints[j + 1].IsValid())
+                        {
+                            continue;
+                        }
 
-                const double t1 = ComputeNodeSegmentCrossingTime(x1, x3, x4, v1, v3, v4);
-                const double t2 = ComputeNodeSegmentCrossingTime(x2, x3, x4, v2, v3, v4);
-                const double t3 = ComputeNodeSegmentCrossingTime(x3, x1, x2, v3, v1, v2);
-                const double t4 = ComputeNodeSegmentCrossingTime(x4, x1, x2, v4, v1, v2);
+                        const Point x3 = frontGridPoints[j];
+                        const Point x4 = frontGridPoints[j + 1];
 
-                const double tmin1234 = std::min(std::min(t1, t2), std::min(t3, t4));
+                        const Point v3 = frontVelocities[j];
+                        const Point v4 = frontVelocities[j + 1];
 
-                if (t1 == tmin1234)
-                {
-                    otherTimeStepMax[i] = std::min(otherTimeStepMax[i], tmin1234);
-                    maximumTimeStep = std::min(maximumTimeStep, otherTimeStepMax[i]);
-                }
-                else if (t2 == tmin1234)
-                {
-                    otherTimeStepMax[i + 1] = std::min(otherTimeStepMax[i + 1], tmin1234);
-                    maximumTimeStep = std::min(maximumTimeStep, otherTimeStepMax[i + 1]);
-                }
-                else if (t3 == tmin1234 || t4 == tmin1234)
-                {
-                    otherTimeStepMax[i] = std::min(otherTimeStepMax[i], tmin1234);
-                    otherTimeStepMax[i + 1] = std::min(otherTimeStepMax[i + 1], tmin1234);
-                    maximumTimeStep = std::min(maximumTimeStep, otherTimeStepMax[i]);
-                    maximumTimeStep = std::min(maximumTimeStep, otherTimeStepMax[i + 1]);
-                }
+                        const double dL2 = ComputeDistance(x3, x4, m_splines->m_projection);
+
+                        const double d1 = ComputeDistance(x1, x3, m_splines->m_projection);
+                        const double d2 = ComputeDistance(x2, x3, m_splines->m_projection);
+                        const double d3 = ComputeDistance(x1, x4, m_splines->m_projection);
+                        const double d4 = ComputeDistance(x2, x4, m_splines->m_projection);
+
+                        if (d1 < tolerance || d2 < tolerance || d3 < tolerance || d4 < tolerance)
+                        {
+                            continue;
+                        }
+
+                        if (!IncludeDirectNeighbours(layerIndex, j, gridPointsIndices, indexLeftOfLeft, indexRightOfRight))
+                        {
+                            continue;
+                        }
+
+                        const double dmin = std::min({d1, d2, d3, d4});
+
+                        // get a lower bound for the cross time
+                        const double hlow2 = 0.25 * std::max(dmin * dmin - std::pow(0.5 * std::max(dL1, dL2), 2), 0.0);
+
+                        // check if the lower bounds is larger than the time step
+                        const double vv1 = std::sqrt(lengthSquared(v3 - v1));
+                        const double vv2 = std::sqrt(lengthSquared(v3 - v2));
+                        const double vv3 = std::sqrt(lengthSquared(v4 - v1));
+                        const double vv4 = std::sqrt(lengthSquared(v4 - v2));
+
+                        const double maxvv = std::max(std::max(vv1, vv2), std::max(vv3, vv4));
+
+                        if (std::sqrt(hlow2) > maxvv * timeStep)
+                        {
+                            continue;
+                        }
+
+                        const double t1 = ComputeNodeSegmentCrossingTime(x1, x3, x4, v1, v3, v4);
+                        const double t2 = ComputeNodeSegmentCrossingTime(x2, x3, x4, v2, v3, v4);
+                        const double t3 = ComputeNodeSegmentCrossingTime(x3, x1, x2, v3, v1, v2);
+                        const double t4 = ComputeNodeSegmentCrossingTime(x4, x1, x2, v4, v1, v2);
+
+                        const double tmin1234 = std::min(std::min(t1, t2), std::min(t3, t4));
+
+                        if (t1 == tmin1234)
+                        {
+                            leftTimeStep = std::min(leftTimeStep, tmin1234);
+                            maximumTimeStep = std::min(maximumTimeStep, leftTimeStep);
+                        }
+                        else if (t2 == tmin1234)
+                        {
+                            rightTimeStep = std::min(rightTimeStep, tmin1234);
+                            maximumTimeStep = std::min(maximumTimeStep, rightTimeStep);
+                        }
+                        else if (t3 == tmin1234 || t4 == tmin1234)
+                        {
+                            leftTimeStep = std::min(leftTimeStep, tmin1234);
+                            rightTimeStep = std::min(rightTimeStep, tmin1234);
+                            maximumTimeStep = std::min(maximumTimeStep, leftTimeStep);
+                            maximumTimeStep = std::min(maximumTimeStep, rightTimeStep);
+                        }
 
-                if (tmin1234 == 0.0)
+                        if (tmin1234 == 0.0)
+                        {
+                            break;
+                        }
+                    }
+                }
+                catch (...)
                 {
-                    break;
+#pragma omp critical
+                    if (!exception)
+                    {
+                        exception = std::current_exception();
+                    }
                 }
             }
         }
 
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+
+        // A node shared by two segments takes the smallest of their crossing times. The time step of a segment
+        // can be larger than this smallest time only if the neighbouring segment has a smaller time step.
+        double maximumTimeStep = timeStep;
+        for (UInt i = 0; i < numActiveSegments; ++i)
+        {
+            otherTimeStepMax[i] = std::min(otherTimeStepMax[i], leftNodeTimeStep[i]);
+            otherTimeStepMax[i + 1] = std::min(otherTimeStepMax[i + 1], rightNodeTimeStep[i]);
+            maximumTimeStep = std::min(maximumTimeStep, segmentTimeStep[i]);
+        }
+
         otherTimeStep = maximumTimeStep;
     }
 
@@ -1156,7 +1270,8 @@ namespace meshkernel
         std::vector<double> edgeIncrement(coordinates.size() - 1);
         const double minEdgeWidth = 1e-8;
         const double dt = 1.0;
-        for (UInt i = 0; i < coordinates.size() - 1; ++i)
+#pragma omp parallel for
+        for (int i = 0; i < static_cast<int>(coordinates.size()) - 1; ++i)
         {
             if (!coordinates[i].IsValid() || !coordinates[i + 1].IsValid())
             {
@@ -1279,7 +1394,8 @@ namespace meshkernel
         std::vector<int> frontPosition(m_gridPoints.cols() - 2,
                                        static_cast<int>(m_gridPoints.rows()));
 
-        for (UInt m = 0; m < frontPosition.size(); ++m)
+#pragma omp parallel for
+        for (int m = 0; m < static_cast<int>(frontPosition.size()); ++m)
         {
             for (UInt n = 0; n < m_gridPoints.rows(); ++n)
             {
@@ -1385,17 +1501,21 @@ namespace meshkernel
     {
         std::vector<Point> velocityVector(m_numM);
         std::fill(velocityVector.begin(), velocityVector.end(), Point());
-        Point normalVectorLeft;
-        Point normalVectorRight;
         const double cosTolerance = 1e-8;
         const double eps = 1e-10;
-        for (UInt m = 0; m < velocityVector.size(); ++m)
+
+        // The velocity of a grid point depends only on the current layer
+#pragma omp parallel for
+        for (int m = 0; m < static_cast<int>(velocityVector.size()); ++m)
         {
             if (!m_gridPoints(layerIndex, m).IsValid())
             {
                 continue;
             }
 
+            Point normalVectorLeft;
+            Point normalVectorRight;
+
             const auto [currentLeftIndex, currentRightIndex] = GetNeighbours(m_gridPoints.row(layerIndex), m);
             const auto squaredLeftRightDistance = ComputeSquaredDistance(m_gridPoints(layerIndex, currentLeftIndex),
                                                                          m_gridPoints(layerIndex, currentRightIndex),
@@ -2017,7 +2137,9 @@ namespace meshkernel
         }
     }
 
-    void CurvilinearGridFromSplines::GetSplineIntersections(UInt splineIndex)
+    void CurvilinearGridFromSplines::GetSplineIntersections(UInt splineIndex,
+                                                            const SplineSegmentIndex& segmentIndex,
+                                                            std::span<const SplineSegmentIndex::SegmentPair> segmentPairs)
     {
         m_numCrossingSplines[splineIndex] = 0;
         const auto numSplines = m_splines->GetNumSplines();
@@ -2026,6 +2148,8 @@ namespace meshkernel
         std::fill(m_crossSplineCoordinates.row(splineIndex).begin(), m_crossSplineCoordinates.row(splineIndex).end(), std::numeric_limits<double>::max());
         std::fill(m_cosCrossingAngle.row(splineIndex).begin(), m_cosCrossingAngle.row(splineIndex).end(), constants::missing::doubleValue);
 
+        std::vector<Splines::SegmentIndices> candidateSegments;
+
         for (UInt s = 0; s < numSplines; ++s)
         {
             // a crossing is a spline with 2 nodes and another with more than 2 nodes
@@ -2042,7 +2166,39 @@ namespace meshkernel
             double intersectionAngle;
             double firstSplineRatio;
             double secondSplineRatio;
-            bool crossing = m_splines->GetSplinesIntersection(splineIndex, s, crossProductIntersection, intersectionAngle, intersectionPoint, firstSplineRatio, secondSplineRatio);
+            bool crossing;
+
+            if (segmentIndex.IsIndexed())
+            {
+                // only the segments with overlapping bounding boxes can cross
+                const auto [firstSpline, secondSpline] = std::minmax(splineIndex, s);
+                const auto candidates = std::ranges::equal_range(segmentPairs,
+                                                                 std::pair{firstSpline, secondSpline},
+                                                                 {},
+                                                                 [](const SplineSegmentIndex::SegmentPair& pair)
+                                                                 { return std::pair{pair.firstSpline, pair.secondSpline}; });
+                if (candidates.empty())
+                {
+                    continue;
+                }
+
+                candidateSegments.clear();
+                for (const auto& pair : candidates)
+                {
+                    candidateSegments.emplace_back(splineIndex == firstSpline ? Splines::SegmentIndices{pair.firstSegment, pair.secondSegment}
+                                                                              : Splines::SegmentIndices{pair.secondSegment, pair.firstSegment});
+                }
+                if (splineIndex != firstSpline)
+                {
+                    std::ranges::sort(candidateSegments);
+                }
+
+                crossing = m_splines->GetSplinesIntersection(splineIndex, s, candidateSegments, crossProductIntersection, intersectionAngle, intersectionPoint, firstSplineRatio, secondSplineRatio);
+            }
+            else
+            {
+                crossing = m_splines->GetSplinesIntersection(splineIndex, s, crossProductIntersection, intersectionAngle, intersectionPoint, firstSplineRatio, secondSplineRatio);
+            }
 
             if (std::abs(crossProductIntersection) < m_splinesToCurvilinearParameters.min_cosine_crossing_angles)
             {
@@ -2205,9 +2361,31 @@ namespace meshkernel
     {
         AllocateSplinesProperties();
 
-        for (UInt s = 0; s < m_splines->GetNumSplines(); ++s)
+        const SplineSegmentIndex segmentIndex(m_splines->m_splineNodes, m_splines->m_projection);
+        const auto segmentPairs = segmentIndex.IsIndexed() ? segmentIndex.FindSegmentPairs() : std::vector<SplineSegmentIndex::SegmentPair>{};
+
+        // each spline fills its own row of the intersection properties
+        std::exception_ptr exception;
+#pragma omp parallel for schedule(dynamic)
+        for (int s = 0; s < static_cast<int>(m_splines->GetNumSplines()); ++s)
+        {
+            try
+            {
+                GetSplineIntersections(static_cast<UInt>(s), segmentIndex, segmentPairs);
+            }
+            catch (...)
+            {
+#pragma omp critical
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        if (exception)
         {
-            GetSplineIntersections(s);
+            std::rethrow_exception(exception);
         }
 
         // select all non-cross splines only
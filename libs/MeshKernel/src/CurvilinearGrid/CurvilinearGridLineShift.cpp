@@ -37,7 +37,8 @@ using meshkernel::CurvilinearGridNodeIndices;
 using meshkernel::Point;
 
 CurvilinearGridLineShift::CurvilinearGridLineShift(CurvilinearGrid& grid) : CurvilinearGridAlgorithm(grid),
-                                                                            m_originalGrid(grid)
+                                                                            m_originalGrid(grid),
+                                                                            m_originalCoordinates(grid)
 
 {
 }
@@ -125,7 +126,7 @@ void CurvilinearGridLineShift::TransformGrid(CurvilinearGridNodeIndices const& n
             m_lines[0].IsMGridLine() ? node.m_m : i,
         };
 
-        if (!m_originalGrid.GetNode(currentNode.m_n, currentNode.m_m).IsValid())
+        if (!m_originalCoordinates.IsValid(currentNode.m_n, currentNode.m_m))
         {
             continue;
         }
@@ -142,7 +143,7 @@ void CurvilinearGridLineShift::TransformGrid(CurvilinearGridNodeIndices const& n
         }
 
         currentDelta = m_originalGrid.TransformDisplacement(currentDelta, currentNode, false);
-        m_grid.GetNode(currentNode.m_n, currentNode.m_m) = m_originalGrid.GetNode(currentNode.m_n, currentNode.m_m) + currentDelta;
+        m_grid.GetNode(currentNode.m_n, currentNode.m_m) = m_originalCoordinates(currentNode.m_n, currentNode.m_m) + currentDelta;
     }
 }
 
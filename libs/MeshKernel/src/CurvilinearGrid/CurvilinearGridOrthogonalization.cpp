@@ -25,7 +25,10 @@
 //
 //------------------------------------------------------------------------------
 
+#include <cstdint>
+
 #include <MeshKernel/CurvilinearGrid/CurvilinearGrid.hpp>
+#include <MeshKernel/CurvilinearGrid/CurvilinearGridCoordinates.hpp>
 #include <MeshKernel/CurvilinearGrid/CurvilinearGridDeRefinement.hpp>
 #include <MeshKernel/CurvilinearGrid/CurvilinearGridNodeIndices.hpp>
 #include <MeshKernel/CurvilinearGrid/CurvilinearGridOrthogonalization.hpp>
@@ -279,35 +282,61 @@ void CurvilinearGridOrthogonalization::Solve()
     const auto maxMInternal = std::min(m_upperRight.m_m + 1, m_grid.NumM() - 1);
     const auto maxNInternal = std::min(m_upperRight.m_n + 1, m_grid.NumN() - 1);
 
-    for (auto innerIterations = 0; innerIterations < m_orthogonalizationParameters.inner_iterations; ++innerIterations)
+    if (minNInternal >= maxNInternal || minMInternal >= maxMInternal)
     {
-        for (auto n = minNInternal; n < maxNInternal; ++n)
-        {
-            for (auto m = minMInternal; m < maxMInternal; ++m)
-            {
-                if (m_grid.GetNodeType(n, m) != NodeType::InternalValid)
-                {
-                    continue;
-                }
+        return;
+    }
 
-                if (m_isGridNodeFrozen(n, m))
-                {
-                    continue;
-                }
+    // The node types and the frozen nodes do not change during the sweeps
+    lin_alg::Matrix<std::uint8_t> isUpdated(m_grid.NumN(), m_grid.NumM());
+    isUpdated.fill(0);
+    for (auto n = minNInternal; n < maxNInternal; ++n)
+    {
+        for (auto m = minMInternal; m < maxMInternal; ++m)
+        {
+            isUpdated(n, m) = m_grid.GetNodeType(n, m) == NodeType::InternalValid && !m_isGridNodeFrozen(n, m);
+        }
+    }
 
-                const auto residual =
-                    m_grid.GetNode(n + 1, m) * m_orthoEqTerms.a(n, m) +
-                    m_grid.GetNode(n - 1, m) * m_orthoEqTerms.b(n, m) +
-                    m_grid.GetNode(n, m + 1) * m_orthoEqTerms.c(n, m) +
-                    m_grid.GetNode(n, m - 1) * m_orthoEqTerms.d(n, m) +
-                    m_grid.GetNode(n, m) * m_orthoEqTerms.e(n, m);
+    // The sweeps work on separate x and y arrays, stored back to the grid at the end
+    CurvilinearGridCoordinates coordinates(m_grid);
 
-                // No update to perform if residual is too small
-                if (IsEqual(residual.x, 0.0) && IsEqual(residual.y, 0.0))
+    for (auto innerIterations = 0; innerIterations < m_orthogonalizationParameters.inner_iterations; ++innerIterations)
+    {
+        // Red-black ordering: a node only depends on the nodes of the other colour, the rows of a colour are updated in parallel
+        for (UInt colour = 0; colour < 2; ++colour)
+        {
+#pragma omp parallel for
+            for (int nn = static_cast<int>(minNInternal); nn < static_cast<int>(maxNInternal); ++nn)
+            {
+                const auto n = static_cast<UInt>(nn);
+                const double* previousX = coordinates.X(n - 1);
+                const double* previousY = coordinates.Y(n - 1);
+                const double* nextX = coordinates.X(n + 1);
+                const double* nextY = coordinates.Y(n + 1);
+                double* x = coordinates.X(n);
+                double* y = coordinates.Y(n);
+
+                const double* a = m_orthoEqTerms.a.row(n).data();
+                const double* b = m_orthoEqTerms.b.row(n).data();
+                const double* c = m_orthoEqTerms.c.row(n).data();
+                const double* d = m_orthoEqTerms.d.row(n).data();
+                const double* e = m_orthoEqTerms.e.row(n).data();
+                const std::uint8_t* updated = isUpdated.row(n).data();
+
+                const auto firstM = minMInternal + (n + minMInternal + colour) % 2;
+                for (auto m = firstM; m < maxMInternal; m += 2)
                 {
-                    continue;
+                    const double residualX = nextX[m] * a[m] + previousX[m] * b[m] + x[m + 1] * c[m] + x[m - 1] * d[m] + x[m] * e[m];
+                    const double residualY = nextY[m] * a[m] + previousY[m] * b[m] + y[m + 1] * c[m] + y[m - 1] * d[m] + y[m] * e[m];
+
+                    // Select instead of branching, the values of the nodes not updated are discarded
+                    const double relaxation = omega / e[m];
+                    const double newX = x[m] - residualX * relaxation;
+                    const double newY = y[m] - residualY * relaxation;
+                    x[m] = updated[m] != 0 ? newX : x[m];
+                    y[m] = updated[m] != 0 ? newY : y[m];
                 }
-                m_grid.GetNode(n, m) = m_grid.GetNode(n, m) - residual / m_orthoEqTerms.e(n, m) * omega;
             }
         }
 
@@ -320,6 +349,8 @@ void CurvilinearGridOrthogonalization::Solve()
             omega = 1.0 / (1.0 - omega * 0.25 * factor);
         }
     }
+
+    coordinates.Store(m_grid, {minNInternal, minMInternal}, {maxNInternal - 1, maxMInternal - 1});
 }
 
 void CurvilinearGridOrthogonalization::ComputeCoefficients()
@@ -25,6 +25,8 @@
 //
 //------------------------------------------------------------------------------
 
+#include <algorithm>
+
 #include <MeshKernel/CurvilinearGrid/CurvilinearGrid.hpp>
 #include <MeshKernel/CurvilinearGrid/CurvilinearGridLine.hpp>
 #include <MeshKernel/CurvilinearGrid/CurvilinearGridNodeIndices.hpp>
@@ -40,9 +42,6 @@ CurvilinearGridSmoothing::CurvilinearGridSmoothing(CurvilinearGrid& grid, UInt s
                                                                                                       m_smoothingIterations(smoothingIterations)
 
 {
-    // Allocate cache for storing grid nodes values
-    lin_alg::ResizeAndFillMatrix(m_gridNodesCache, m_grid.NumN(), m_grid.NumM(), true);
-
     // Compute the grid node types
     m_grid.ComputeGridNodeTypes();
 }
@@ -57,6 +56,8 @@ meshkernel::UndoActionPtr CurvilinearGridSmoothing::Compute()
 
     // Compute the frozen nodes
     ComputeFrozenNodes();
+    ComputeSmoothedNodes();
+    m_gridNodesCache.Assign(m_grid);
 
     // Perform smoothing iterations
     for (UInt smoothingIterations = 0; smoothingIterations < m_smoothingIterations; ++smoothingIterations)
@@ -163,7 +164,7 @@ void CurvilinearGridSmoothing::SolveDirectional(const CurvilinearGridLine& gridL
 {
 
     // assign current nodal values to the m_gridNodesCache
-    m_gridNodesCache = m_grid.GetNodes();
+    m_gridNodesCache.Assign(m_grid);
 
     auto isInvalidValidNode = [&](auto const& n, auto const& m)
     {
@@ -212,10 +213,89 @@ void CurvilinearGridSmoothing::Solve()
     double const a = 0.5;
     double const b = 1.0 - a;
 
-    // assign current nodal values to the m_gridNodesCache
-    m_gridNodesCache = m_grid.GetNodes();
+    // Apply smoothing to the boundary nodes first, the cache holds the node positions of the previous iteration
+    for (const auto& node : m_boundaryNodesSmoothed)
+    {
+        const auto n = node.m_n;
+        const auto m = node.m_m;
+
+        // For the point on the boundaries first computed the new position
+        Point newNodePosition;
+        if (m_grid.GetNodeType(n, m) == NodeType::Bottom)
+        {
+            newNodePosition = m_gridNodesCache(n, m) * a + (m_gridNodesCache(n - 1, m) + m_gridNodesCache(n + 1, m) + m_gridNodesCache(n, m + 1)) * constants::numeric::oneThird * b;
+        }
+        if (m_grid.GetNodeType(n, m) == NodeType::Up)
+        {
+            newNodePosition = m_gridNodesCache(n, m) * a + (m_gridNodesCache(n - 1, m) + m_gridNodesCache(n + 1, m) + m_gridNodesCache(n, m - 1)) * constants::numeric::oneThird * b;
+        }
+        if (m_grid.GetNodeType(n, m) == NodeType::Right)
+        {
+            newNodePosition = m_gridNodesCache(n, m) * a + (m_gridNodesCache(n, m - 1) + m_gridNodesCache(n, m + 1) + m_gridNodesCache(n - 1, m)) * constants::numeric::oneThird * b;
+        }
+        if (m_grid.GetNodeType(n, m) == NodeType::Left)
+        {
+            newNodePosition = m_gridNodesCache(n, m) * a + (m_gridNodesCache(n, m - 1) + m_gridNodesCache(n, m + 1) + m_gridNodesCache(n + 1, m)) * constants::numeric::oneThird * b;
+        }
+
+        ProjectPointOnClosestGridBoundary(newNodePosition, n, m);
+    }
+
+    // Apply smoothing to the internal nodes, along the grid lines with a branch free loop.
+    // The cache is updated in place, the previous positions of the lines n - 1 and n are kept in line buffers
+    const auto firstN = std::max(m_lowerLeft.m_n, UInt{1});
+    const auto endN = std::min(m_upperRight.m_n + 1, m_grid.NumN() - 1);
+    const auto firstM = std::max(m_lowerLeft.m_m, UInt{1});
+    const auto endM = std::min(m_upperRight.m_m + 1, m_grid.NumM() - 1);
+
+    if (firstN < endN && firstM < endM)
+    {
+        const auto numM = m_grid.NumM();
+
+        std::vector<double> previousX(m_gridNodesCache.X(firstN - 1), m_gridNodesCache.X(firstN - 1) + numM);
+        std::vector<double> previousY(m_gridNodesCache.Y(firstN - 1), m_gridNodesCache.Y(firstN - 1) + numM);
+        std::vector<double> currentX(numM);
+        std::vector<double> currentY(numM);
+
+        for (auto n = firstN; n < endN; ++n)
+        {
+            double* x = m_gridNodesCache.X(n);
+            double* y = m_gridNodesCache.Y(n);
+            const double* nextX = m_gridNodesCache.X(n + 1);
+            const double* nextY = m_gridNodesCache.Y(n + 1);
+            const std::uint8_t* isSmoothed = m_isInternalNodeSmoothed.row(n).data();
+            Point* nodes = m_grid.GetNodeRow(n);
+
+            std::copy(x, x + numM, currentX.begin());
+            std::copy(y, y + numM, currentY.begin());
+
+            for (auto m = firstM; m < endM; ++m)
+            {
+                const double newX = currentX[m] * a + (previousX[m] + nextX[m]) * 0.25 * b + (currentX[m - 1] + currentX[m + 1]) * 0.25 * b;
+                const double newY = currentY[m] * a + (previousY[m] + nextY[m]) * 0.25 * b + (currentY[m - 1] + currentY[m + 1]) * 0.25 * b;
+                x[m] = isSmoothed[m] != 0 ? newX : x[m];
+                y[m] = isSmoothed[m] != 0 ? newY : y[m];
+                nodes[m].x = isSmoothed[m] != 0 ? newX : nodes[m].x;
+                nodes[m].y = isSmoothed[m] != 0 ? newY : nodes[m].y;
+            }
+
+            std::swap(previousX, currentX);
+            std::swap(previousY, currentY);
+        }
+    }
+
+    // Update the cache with the new positions of the boundary nodes
+    for (const auto& node : m_boundaryNodesSmoothed)
+    {
+        m_gridNodesCache.Set(node.m_n, node.m_m, m_grid.GetNode(node.m_n, node.m_m));
+    }
+}
+
+void CurvilinearGridSmoothing::ComputeSmoothedNodes()
+{
+    lin_alg::ResizeAndFillMatrix(m_isInternalNodeSmoothed, m_grid.NumN(), m_grid.NumM(), false, std::uint8_t{0});
+    m_boundaryNodesSmoothed.clear();
 
-    // Apply smoothing
     for (auto n = m_lowerLeft.m_n; n <= m_upperRight.m_n; ++n)
     {
         for (auto m = m_lowerLeft.m_m; m <= m_upperRight.m_m; ++m)
@@ -226,46 +306,17 @@ void CurvilinearGridSmoothing::Solve()
                 continue;
             }
 
-            // It is invalid or a corner point, skip smoothing
-            if (m_grid.GetNodeType(n, m) == NodeType::Invalid ||
-                m_grid.GetNodeType(n, m) == NodeType::BottomLeft ||
-                m_grid.GetNodeType(n, m) == NodeType::UpperLeft ||
-                m_grid.GetNodeType(n, m) == NodeType::BottomRight ||
-                m_grid.GetNodeType(n, m) == NodeType::UpperRight)
-            {
-                continue;
-            }
-
-            // Compute new position based on a smoothing operator
-            if (m_grid.GetNodeType(n, m) == NodeType::InternalValid)
+            const auto nodeType = m_grid.GetNodeType(n, m);
+            if (nodeType == NodeType::InternalValid)
             {
-                const auto val = m_gridNodesCache(n, m) * a + (m_gridNodesCache(n - 1, m) + m_gridNodesCache(n + 1, m)) * 0.25 * b +
-                                 (m_gridNodesCache(n, m - 1) + m_gridNodesCache(n, m + 1)) * 0.25 * b;
-
-                m_grid.GetNode(n, m) = val;
-                continue;
+                m_isInternalNodeSmoothed(n, m) = 1;
             }
 
-            // For the point on the boundaries first computed the new position
-            Point newNodePosition;
-            if (m_grid.GetNodeType(n, m) == NodeType::Bottom)
-            {
-                newNodePosition = m_gridNodesCache(n, m) * a + (m_gridNodesCache(n - 1, m) + m_gridNodesCache(n + 1, m) + m_gridNodesCache(n, m + 1)) * constants::numeric::oneThird * b;
-            }
-            if (m_grid.GetNodeType(n, m) == NodeType::Up)
-            {
-                newNodePosition = m_gridNodesCache(n, m) * a + (m_gridNodesCache(n - 1, m) + m_gridNodesCache(n + 1, m) + m_gridNodesCache(n, m - 1)) * constants::numeric::oneThird * b;
-            }
-            if (m_grid.GetNodeType(n, m) == NodeType::Right)
+            // Corner points are not smoothed
+            if (nodeType == NodeType::Bottom || nodeType == NodeType::Up || nodeType == NodeType::Left || nodeType == NodeType::Right)
             {
-                newNodePosition = m_gridNodesCache(n, m) * a + (m_gridNodesCache(n, m - 1) + m_gridNodesCache(n, m + 1) + m_gridNodesCache(n - 1, m)) * constants::numeric::oneThird * b;
+                m_boundaryNodesSmoothed.emplace_back(n, m);
             }
-            if (m_grid.GetNodeType(n, m) == NodeType::Left)
-            {
-                newNodePosition = m_gridNodesCache(n, m) * a + (m_gridNodesCache(n, m - 1) + m_gridNodesCache(n, m + 1) + m_gridNodesCache(n + 1, m)) * constants::numeric::oneThird * b;
-            }
-
-            ProjectPointOnClosestGridBoundary(newNodePosition, n, m);
         }
     }
 }
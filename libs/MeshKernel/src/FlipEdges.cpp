@@ -75,6 +75,9 @@ std::unique_ptr<meshkernel::UndoAction> FlipEdges::Compute(const Polygons& polyg
     UInt numFlippedEdges = constants::missing::uintValue;
     std::vector<Boolean> nodeInsidePolygon(m_mesh.IsLocationInPolygon(polygon, Location::Nodes));
 
+    // The flips update the node-edge, face-node and face-edge connectivity in place
+    m_mesh.DecompressConnectivity();
+
     for (UInt iteration = 0; iteration < MaxIter; ++iteration)
     {
         if (numFlippedEdges == 0)
@@ -319,8 +322,8 @@ int FlipEdges::ComputeTopologyFunctional(UInt edge,
     UInt sumIndicesRightFace = 0;
     for (auto i = 0; i < 3; i++)
     {
-        sumIndicesLeftFace += m_mesh.m_facesNodes[faceL][i];
-        sumIndicesRightFace += m_mesh.m_facesNodes[faceR][i];
+        sumIndicesLeftFace += m_mesh.FaceNodes(faceL)[i];
+        sumIndicesRightFace += m_mesh.FaceNodes(faceR)[i];
     }
 
     nodeLeft = sumIndicesLeftFace - firstNode - secondNode;
@@ -335,7 +338,7 @@ int FlipEdges::ComputeTopologyFunctional(UInt edge,
     bool nodeFound = false;
     for (UInt i = 0; i < NumEdgesLeftFace; i++)
     {
-        if (m_mesh.m_facesNodes[faceL][i] == nodeLeft)
+        if (m_mesh.FaceNodes(faceL)[i] == nodeLeft)
         {
             nodeFound = true;
             break;
@@ -351,7 +354,7 @@ int FlipEdges::ComputeTopologyFunctional(UInt edge,
     nodeFound = false;
     for (UInt i = 0; i < NumEdgesRightFace; i++)
     {
-        if (m_mesh.m_facesNodes[faceR][i] == nodeRight)
+        if (m_mesh.FaceNodes(faceR)[i] == nodeRight)
         {
             nodeFound = true;
             break;
@@ -427,7 +430,7 @@ int FlipEdges::DifferenceFromOptimum(UInt nodeIndex, UInt firstNode, UInt second
     UInt edgeIndexConnectingFirstNode = constants::missing::uintValue;
     for (UInt i = 0; i < m_mesh.m_nodesNumEdges[nodeIndex]; i++)
     {
-        const auto edgeIndex = m_mesh.m_nodesEdges[nodeIndex][i];
+        const auto edgeIndex = m_mesh.NodeEdges(nodeIndex)[i];
 
         if (m_mesh.GetEdge(edgeIndex).first == firstNode || m_mesh.GetEdge(edgeIndex).second == firstNode)
         {
@@ -445,7 +448,7 @@ int FlipEdges::DifferenceFromOptimum(UInt nodeIndex, UInt firstNode, UInt second
     UInt edgeIndexConnectingSecondNode = constants::missing::uintValue;
     for (UInt i = 0; i < m_mesh.m_nodesNumEdges[nodeIndex]; i++)
     {
-        const auto edgeIndex = m_mesh.m_nodesEdges[nodeIndex][i];
+        const auto edgeIndex = m_mesh.NodeEdges(nodeIndex)[i];
 
         if (m_mesh.GetEdge(edgeIndex).first == secondNode || m_mesh.GetEdge(edgeIndex).second == secondNode)
         {
@@ -462,7 +465,7 @@ int FlipEdges::DifferenceFromOptimum(UInt nodeIndex, UInt firstNode, UInt second
     // Count the numbers of edges clockwise from the one connecting indexFirstNode
     // that are not in a land or mesh boundary path
     auto currentEdgeIndexInNodeEdges = edgeIndexConnectingFirstNode;
-    auto edgeIndex = m_mesh.m_nodesEdges[nodeIndex][currentEdgeIndexInNodeEdges];
+    auto edgeIndex = m_mesh.NodeEdges(nodeIndex)[currentEdgeIndexInNodeEdges];
     auto otherNode = OtherNodeOfEdge(m_mesh.GetEdge(edgeIndex), nodeIndex);
 
     UInt num = 1;
@@ -471,7 +474,7 @@ int FlipEdges::DifferenceFromOptimum(UInt nodeIndex, UInt firstNode, UInt second
            currentEdgeIndexInNodeEdges != edgeIndexConnectingSecondNode)
     {
         currentEdgeIndexInNodeEdges = NextCircularBackwardIndex(currentEdgeIndexInNodeEdges, m_mesh.m_nodesNumEdges[nodeIndex]);
-        edgeIndex = m_mesh.m_nodesEdges[nodeIndex][currentEdgeIndexInNodeEdges];
+        edgeIndex = m_mesh.NodeEdges(nodeIndex)[currentEdgeIndexInNodeEdges];
         otherNode = OtherNodeOfEdge(m_mesh.GetEdge(edgeIndex), nodeIndex);
         num++;
     }
@@ -488,7 +491,7 @@ int FlipEdges::DifferenceFromOptimum(UInt nodeIndex, UInt firstNode, UInt second
     if (currentEdgeIndexInNodeEdges != edgeIndexConnectingSecondNode)
     {
         currentEdgeIndexInNodeEdges = edgeIndexConnectingSecondNode;
-        edgeIndex = m_mesh.m_nodesEdges[nodeIndex][currentEdgeIndexInNodeEdges];
+        edgeIndex = m_mesh.NodeEdges(nodeIndex)[currentEdgeIndexInNodeEdges];
         otherNode = OtherNodeOfEdge(m_mesh.GetEdge(edgeIndex), nodeIndex);
         num = num + 1;
         while (m_landBoundaries.m_meshNodesLandBoundarySegments[otherNode] == constants::missing::uintValue &&
@@ -497,7 +500,7 @@ int FlipEdges::DifferenceFromOptimum(UInt nodeIndex, UInt firstNode, UInt second
                edgeIndex != firstEdgeInPathIndex)
         {
             currentEdgeIndexInNodeEdges = NextCircularForwardIndex(currentEdgeIndexInNodeEdges, m_mesh.m_nodesNumEdges[nodeIndex]);
-            edgeIndex = m_mesh.m_nodesEdges[nodeIndex][currentEdgeIndexInNodeEdges];
+            edgeIndex = m_mesh.NodeEdges(nodeIndex)[currentEdgeIndexInNodeEdges];
             otherNode = OtherNodeOfEdge(m_mesh.GetEdge(edgeIndex), nodeIndex);
 
             if (currentEdgeIndexInNodeEdges != edgeIndexConnectingFirstNode && edgeIndex != firstEdgeInPathIndex)
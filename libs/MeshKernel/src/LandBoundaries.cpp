@@ -258,7 +258,7 @@ void LandBoundaries::AssignLandBoundaryPolylineToMeshNodes(UInt edgeIndex, bool
 
     for (UInt e = 0; e < m_mesh.GetNumNodesEdges(lastVisitedNode); e++)
     {
-        const auto edge = m_mesh.m_nodesEdges[lastVisitedNode][e];
+        const auto edge = m_mesh.NodeEdges(lastVisitedNode)[e];
 
         if (!m_mesh.IsEdgeOnBoundary(edge))
             continue;
@@ -551,7 +551,7 @@ void LandBoundaries::ComputeMeshNodeMask(UInt landBoundaryIndex)
             {
                 for (UInt n = 0; n < m_mesh.GetNumFaceEdges(f); n++)
                 {
-                    m_nodeMask[m_mesh.m_facesNodes[f][n]] = landBoundaryIndex;
+                    m_nodeMask[m_mesh.FaceNodes(f)[n]] = landBoundaryIndex;
                 }
             }
         }
@@ -580,7 +580,7 @@ void LandBoundaries::ComputeMeshNodeMask(UInt landBoundaryIndex)
 bool LandBoundaries::ContainsCrossedFace(const UInt landBoundaryIndex, const UInt otherFace)
 {
     bool isFaceFound = false;
-    for (const auto& edge : m_mesh.m_facesEdges[otherFace])
+    for (const auto& edge : m_mesh.FaceEdges(otherFace))
     {
         if (m_edgeMask[edge] == 1)
         {
@@ -625,7 +625,7 @@ void LandBoundaries::MaskFacesCloseToBoundary(const UInt landBoundaryIndex)
             continue;
         }
 
-        for (const auto& edge : m_mesh.m_facesEdges[face])
+        for (const auto& edge : m_mesh.FaceEdges(face))
         {
             const auto landBoundaryNode = IsMeshEdgeCloseToLandBoundaries(landBoundaryIndex, edge);
             if (landBoundaryNode != constants::missing::uintValue)
@@ -662,7 +662,7 @@ void LandBoundaries::MaskMeshFaceMask(UInt landBoundaryIndex, const std::vector<
                 continue;
             }
 
-            for (const auto& currentEdge : m_mesh.m_facesEdges[face])
+            for (const auto& currentEdge : m_mesh.FaceEdges(face))
             {
                 // If it is a boundary edge, continue
                 if (m_mesh.IsEdgeOnBoundary(currentEdge))
@@ -924,7 +924,7 @@ std::vector<meshkernel::UInt> LandBoundaries::ShortestPath(UInt landBoundaryInde
             throw AlgorithmError("ShortestPath: Cannot compute the nearest node on the land boundary.");
         }
 
-        for (const auto& edgeIndex : m_mesh.m_nodesEdges[currentNodeIndex])
+        for (const auto& edgeIndex : m_mesh.NodeEdges(currentNodeIndex))
         {
             if (m_mesh.GetEdge(edgeIndex).first == constants::missing::uintValue || m_mesh.GetEdge(edgeIndex).second == constants::missing::uintValue)
             {
@@ -1076,3 +1076,30 @@ std::unique_ptr<meshkernel::UndoAction> LandBoundaries::SnapMeshToLandBoundaries
 
     return action;
 }
+
+void LandBoundaries::SnapNodesToLandBoundaries(std::vector<Point>& nodes) const
+{
+    if (m_landBoundary.IsEmpty() || m_meshNodesLandBoundarySegments.empty())
+    {
+        return;
+    }
+
+    if (nodes.size() != m_mesh.GetNumNodes())
+    {
+        throw ConstraintError("The number of nodes, {}, does not match the number of mesh nodes, {}.", nodes.size(), m_mesh.GetNumNodes());
+    }
+
+    for (UInt n = 0; n < m_mesh.GetNumNodes(); ++n)
+    {
+        if (m_mesh.GetNodeType(n) == MeshNodeType::Internal || m_mesh.GetNodeType(n) == MeshNodeType::Boundary || m_mesh.GetNodeType(n) == MeshNodeType::Corner)
+        {
+            const auto meshNodeToLandBoundarySegment = m_meshNodesLandBoundarySegments[n];
+            if (meshNodeToLandBoundarySegment == constants::missing::uintValue)
+            {
+                continue;
+            }
+
+            nodes[n] = std::get<1>(NearestLandBoundarySegment(meshNodeToLandBoundarySegment, nodes[n]));
+        }
+    }
+}
@@ -54,6 +54,12 @@ Mesh::Mesh(Projection projection) : m_projection(projection)
     m_RTrees.emplace(Location::Nodes, RTreeFactory::Create(m_projection));
     m_RTrees.emplace(Location::Edges, RTreeFactory::Create(m_projection));
     m_RTrees.emplace(Location::Faces, RTreeFactory::Create(m_projection));
+
+    for (const auto location : {Location::Nodes, Location::Edges, Location::Faces})
+    {
+        m_boundingBoxCache.emplace(location, BoundingBox());
+        m_rTreeCacheStatistics.emplace(location, RTreeCacheStatistics());
+    }
 }
 
 Mesh::Mesh(const std::vector<Edge>& edges,
@@ -66,6 +72,12 @@ Mesh::Mesh(const std::vector<Edge>& edges,
     m_RTrees.emplace(Location::Nodes, RTreeFactory::Create(m_projection));
     m_RTrees.emplace(Location::Edges, RTreeFactory::Create(m_projection));
     m_RTrees.emplace(Location::Faces, RTreeFactory::Create(m_projection));
+
+    for (const auto location : {Location::Nodes, Location::Edges, Location::Faces})
+    {
+        m_boundingBoxCache.emplace(location, BoundingBox());
+        m_rTreeCacheStatistics.emplace(location, RTreeCacheStatistics());
+    }
     DeleteInvalidNodesAndEdges();
 }
 
@@ -250,6 +262,10 @@ void Mesh::DeleteInvalidNodesAndEdges()
     const auto endEdgeVector = std::remove_if(m_edges.begin(), m_edges.end(), [](const Edge& e)
                                               { return e.first == constants::missing::uintValue || e.second == constants::missing::uintValue; });
     m_edges.erase(endEdgeVector, m_edges.end());
+
+    // the nodes and edges are renumbered
+    m_nodesRTreeRequiresUpdate = true;
+    m_edgesRTreeRequiresUpdate = true;
     SetAdministrationRequired(true);
 }
 
@@ -329,6 +345,8 @@ std::unique_ptr<meshkernel::UndoAction> Mesh::MergeTwoNodes(UInt firstNodeIndex,
         return nullptr;
     }
 
+    DecompressConnectivity();
+
     std::unique_ptr<CompoundUndoAction> undoAction = CompoundUndoAction::Create();
 
     auto edgeIndex = FindEdge(firstNodeIndex, secondNodeIndex);
@@ -424,8 +442,6 @@ std::unique_ptr<meshkernel::UndoAction> Mesh::MergeTwoNodes(UInt firstNodeIndex,
     // Set the node to be invalid
     undoAction->Add(ResetNode(firstNodeIndex, {constants::missing::doubleValue, constants::missing::doubleValue}));
 
-    m_nodesRTreeRequiresUpdate = true;
-    m_edgesRTreeRequiresUpdate = true;
     return undoAction;
 }
 
@@ -468,6 +484,24 @@ std::unique_ptr<meshkernel::UndoAction> Mesh::MergeNodesInPolygon(const Polygons
     // merge the closest nodes
     auto const mergingDistanceSquared = mergingDistance * mergingDistance;
 
+    // The neighbourhoods of all filtered nodes are independent of the merging, compute them in parallel
+    std::vector<std::vector<UInt>> nodesInMergingDistance(filteredNodes.size());
+    std::vector<UInt> queryCache;
+
+#pragma omp parallel for private(queryCache)
+    for (int i = 0; i < static_cast<int>(filteredNodes.size()); ++i)
+    {
+        nodesRtree->SearchPoints(filteredNodes[i], mergingDistanceSquared, queryCache);
+
+        if (queryCache.size() > 1)
+        {
+            nodesInMergingDistance[i] = queryCache;
+        }
+    }
+
+    // Nodes merged into another node are no longer available for merging
+    std::vector<bool> isMerged(filteredNodes.size(), false);
+
     for (size_t ii = filteredNodes.size(); ii > 0; --ii)
     {
         const UInt i = static_cast<UInt>(ii - 1);
@@ -477,25 +511,14 @@ std::unique_ptr<meshkernel::UndoAction> Mesh::MergeNodesInPolygon(const Polygons
             continue;
         }
 
-        nodesRtree->SearchPoints(filteredNodes[i], mergingDistanceSquared);
-
-        const UInt resultSize = nodesRtree->GetQueryResultSize();
-
-        if (resultSize > 1)
+        for (const auto nodeIndexInFilteredNodes : nodesInMergingDistance[i])
         {
-
-            for (UInt j = 0; j < nodesRtree->GetQueryResultSize(); j++)
+            if (nodeIndexInFilteredNodes != i && !isMerged[nodeIndexInFilteredNodes] && originalNodeIndices[nodeIndexInFilteredNodes] != constants::missing::uintValue)
             {
-                const auto nodeIndexInFilteredNodes = nodesRtree->GetQueryResult(j);
-
-                if (nodeIndexInFilteredNodes != i && originalNodeIndices[nodeIndexInFilteredNodes] != constants::missing::uintValue)
-                {
-
-                    undoAction->Add(MergeTwoNodes(originalNodeIndices[i], originalNodeIndices[nodeIndexInFilteredNodes]));
-                    nodesRtree->DeleteNode(i);
+                undoAction->Add(MergeTwoNodes(originalNodeIndices[i], originalNodeIndices[nodeIndexInFilteredNodes]));
+                isMerged[i] = true;
 
-                    SetAdministrationRequired(true);
-                }
+                SetAdministrationRequired(true);
             }
         }
     }
@@ -508,6 +531,7 @@ std::tuple<meshkernel::UInt, std::unique_ptr<meshkernel::AddNodeAction>> Mesh::I
 {
     const auto newNodeIndex = GetNumNodes();
 
+    DecompressConnectivity();
     m_nodes.resize(newNodeIndex + 1);
     m_nodesNumEdges.resize(newNodeIndex + 1);
     m_nodesEdges.resize(newNodeIndex + 1);
@@ -554,7 +578,6 @@ std::unique_ptr<meshkernel::ResetNodeAction> Mesh::ResetNode(const UInt nodeId,
 
     std::unique_ptr<ResetNodeAction> undoAction = ResetNodeAction::Create(*this, nodeId, m_nodes[nodeId], newValue);
     CommitAction(*undoAction);
-    SetAdministrationRequired(true);
     return undoAction;
 }
 
@@ -565,8 +588,9 @@ void Mesh::SetNode(const UInt nodeId, const Point& newValue)
         throw ConstraintError("The node index, {}, is not in range.", nodeId);
     }
 
-    SetAdministrationRequired(true);
+    SetNodeMovedAdministrationRequired();
     m_nodes[nodeId] = newValue;
+    NodeChanged(nodeId);
 }
 
 std::unique_ptr<meshkernel::DeleteEdgeAction> Mesh::DeleteEdge(UInt edge, const bool collectUndo)
@@ -660,9 +684,8 @@ meshkernel::UInt Mesh::FindEdge(UInt firstNodeIndex, UInt secondNodeIndex) const
         throw ConstraintError("Mesh::FindEdge: Invalid node index: first {}, second {}", firstNodeIndex, secondNodeIndex);
     }
 
-    for (UInt n = 0; n < m_nodesNumEdges[firstNodeIndex]; n++)
+    for (const auto edgeIndex : NodeEdges(firstNodeIndex))
     {
-        const auto edgeIndex = m_nodesEdges[firstNodeIndex][n];
         const auto firstEdgeOtherNode = OtherNodeOfEdge(m_edges[edgeIndex], firstNodeIndex);
         const auto edgeFound = firstEdgeOtherNode == secondNodeIndex;
         if (edgeFound)
@@ -788,10 +811,9 @@ std::unique_ptr<meshkernel::UndoAction> Mesh::MoveNode(Point newPoint, UInt node
     for (UInt i = 0; i < movedNodeIndex.size(); ++i)
     {
         m_nodes[movedNodeIndex[i]] += nodeDisplacement[i];
+        NodeChanged(movedNodeIndex[i]);
     }
 
-    m_nodesRTreeRequiresUpdate = true;
-    m_edgesRTreeRequiresUpdate = true;
     return undoAction;
 }
 
@@ -810,7 +832,7 @@ bool Mesh::IsFaceOnBoundary(UInt face) const
 
     for (UInt e = 0; e < GetNumFaceEdges(face); ++e)
     {
-        const auto edge = m_facesEdges[face][e];
+        const auto edge = FaceEdges(face)[e];
         if (IsEdgeOnBoundary(edge))
         {
             isFaceOnBoundary = true;
@@ -901,16 +923,24 @@ void Mesh::Administrate(CompoundUndoAction* undoAction)
 {
     if (!AdministrationRequired())
     {
+        // the connectivity may have been decompressed for an edit in place
+        CompressConnectivity();
         return;
     }
 
     AdministrateNodesEdges(undoAction);
 
+    CompressConnectivity();
+
     SetAdministrationRequired(false);
 }
 
 void Mesh::AdministrateNodesEdges(CompoundUndoAction* undoAction)
 {
+    // Invalid nodes and edges can be removed, and the connectivity is rebuilt
+    ++m_topologyGeneration;
+    DecompressConnectivity();
+
     SetUnConnectedNodesAndEdgesToInvalid(undoAction);
 
     // return if there are no nodes or no edges
@@ -976,7 +1006,7 @@ meshkernel::UInt Mesh::GetLocalFaceNodeIndex(const UInt faceIndex, const UInt no
 
     for (UInt n = 0; n < numFaceNodes; ++n)
     {
-        if (m_facesNodes[faceIndex][n] == nodeIndex)
+        if (FaceNodes(faceIndex)[n] == nodeIndex)
         {
             faceNodeIndex = n;
             break;
@@ -1097,7 +1127,7 @@ meshkernel::UInt Mesh::GetEdgeIndex(const UInt elementId, const UInt edgeId) con
         throw ConstraintError("edge id is greater than the number of edges: {} >= {}", edgeId, GetNumEdges());
     }
 
-    const std::vector<UInt>& edgeIds = m_facesEdges[elementId];
+    const auto edgeIds = FaceEdges(elementId);
 
     for (UInt e = 0; e < edgeIds.size(); ++e)
     {
@@ -1127,7 +1157,7 @@ meshkernel::UInt Mesh::GetNodeIndex(const UInt elementId, const UInt nodeId) con
         throw ConstraintError("node id is greater than the number of nodes: {} >= {}", nodeId, GetNumValidNodes());
     }
 
-    const std::vector<UInt>& nodeIds = m_facesNodes[elementId];
+    const auto nodeIds = FaceNodes(elementId);
 
     // TODO use Operations::FindIndex when curvilinear grid from splines has been added to master
     // return FindIndex (m_facesNodes[elementId], nodeId);
@@ -1197,7 +1227,7 @@ bool Mesh::IsValidFace(const UInt faceId) const
         throw ConstraintError("The face index is out of bounds. {} >= {}.", faceId, GetNumFaces());
     }
 
-    for (UInt edgeId : m_facesEdges[faceId])
+    for (UInt edgeId : FaceEdges(faceId))
     {
 
         if (!IsValidEdge(edgeId))
@@ -1211,45 +1241,338 @@ bool Mesh::IsValidFace(const UInt faceId) const
 
 void Mesh::BuildTree(Location location, const BoundingBox& boundingBox)
 {
+    if (!m_boundingBoxCache.contains(location))
+    {
+        throw std::runtime_error("Invalid location");
+    }
+
+    // each location has its own bounding box, building one RTree does not invalidate the others
+    auto& boundingBoxCache = m_boundingBoxCache.at(location);
+    auto& statistics = m_rTreeCacheStatistics.at(location);
+
     switch (location)
     {
     case Location::Faces:
-        if (m_facesRTreeRequiresUpdate || m_boundingBoxCache != boundingBox)
+        if (m_facesRTreeRequiresUpdate || boundingBoxCache != boundingBox)
         {
             Administrate();
-            std::vector<Point> facesCircumcenters = algo::ComputeFaceCircumcenters(*this);
-
-            m_RTrees.at(Location::Faces)->BuildTree(facesCircumcenters, boundingBox);
+            m_RTrees.at(Location::Faces)->BuildTree(CachedFaceCircumcenters(m_facesRTreeRequiresUpdate), boundingBox);
             m_facesRTreeRequiresUpdate = false;
-            m_boundingBoxCache = boundingBox;
+            boundingBoxCache = boundingBox;
+            ++statistics.misses;
+        }
+        else
+        {
+            ++statistics.hits;
         }
         break;
     case Location::Nodes:
-        if (m_nodesRTreeRequiresUpdate || m_boundingBoxCache != boundingBox)
+        if (m_nodesRTreeRequiresUpdate || boundingBoxCache != boundingBox)
         {
             m_RTrees.at(Location::Nodes)->BuildTree(m_nodes, boundingBox);
             m_nodesRTreeRequiresUpdate = false;
-            m_boundingBoxCache = boundingBox;
+            m_nodesRTreeChangedNodes.clear();
+            boundingBoxCache = boundingBox;
+            ++statistics.misses;
+        }
+        else if (!m_nodesRTreeChangedNodes.empty())
+        {
+            statistics.visited += static_cast<UInt>(m_nodesRTreeChangedNodes.size());
+            UpdateNodesTree(boundingBox);
+            ++statistics.updates;
+        }
+        else
+        {
+            ++statistics.hits;
         }
         break;
     case Location::Edges:
-        if (m_edgesRTreeRequiresUpdate || m_boundingBoxCache != boundingBox)
+        if (m_edgesRTreeRequiresUpdate || boundingBoxCache != boundingBox)
         {
-            std::vector<Point> edgeCentres = algo::ComputeEdgeCentres(*this);
-            m_RTrees.at(Location::Edges)->BuildTree(edgeCentres, boundingBox);
+            m_RTrees.at(Location::Edges)->BuildTree(CachedEdgeCentres(m_edgesRTreeRequiresUpdate), boundingBox);
             m_edgesRTreeRequiresUpdate = false;
-            m_boundingBoxCache = boundingBox;
+            m_edgesRTreeChangedNodes.clear();
+            m_edgesRTreeChangedEdges.clear();
+            boundingBoxCache = boundingBox;
+            ++statistics.misses;
+        }
+        else if (!m_edgesRTreeChangedNodes.empty() || !m_edgesRTreeChangedEdges.empty())
+        {
+            statistics.visited += UpdateEdgesTree(boundingBox);
+            ++statistics.updates;
+        }
+        else
+        {
+            ++statistics.hits;
         }
         break;
     case Location::Unknown:
     default:
-        throw std::runtime_error("Invalid location");
+        break;
+    }
+}
+
+const std::vector<meshkernel::Point>& Mesh::CachedEdgeCentres(bool isChanged)
+{
+    if (isChanged || m_edgeCentresGeneration != Generation())
+    {
+        m_edgeCentres = algo::ComputeEdgeCentres(*this);
+        m_edgeCentresGeneration = Generation();
+    }
+
+    return m_edgeCentres;
+}
+
+const std::vector<meshkernel::Point>& Mesh::CachedFaceCircumcenters(bool isChanged)
+{
+    if (isChanged || m_faceCircumcentersGeneration != Generation())
+    {
+        m_faceCircumcenters = algo::ComputeFaceCircumcenters(*this);
+        m_faceCircumcentersGeneration = Generation();
+    }
+
+    return m_faceCircumcenters;
+}
+
+void Mesh::ResetRTreeCacheStatistics()
+{
+    for (auto& [location, statistics] : m_rTreeCacheStatistics)
+    {
+        statistics = RTreeCacheStatistics();
+    }
+}
+
+void Mesh::UpdateNodesTree(const BoundingBox& boundingBox)
+{
+    auto& rtree = *m_RTrees.at(Location::Nodes);
+    const Point invalidNode{constants::missing::doubleValue, constants::missing::doubleValue};
+
+    // the nodes outside the bounding box are not in the tree, as in a full build
+    for (const auto n : m_nodesRTreeChangedNodes)
+    {
+        const bool isInTree = n < m_nodes.size() && boundingBox.Contains(m_nodes[n]);
+        rtree.UpdateNode(n, isInTree ? m_nodes[n] : invalidNode);
     }
+
+    m_nodesRTreeChangedNodes.clear();
+}
+
+meshkernel::UInt Mesh::UpdateEdgesTree(const BoundingBox& boundingBox)
+{
+    auto& rtree = *m_RTrees.at(Location::Edges);
+    const Point invalidEdgeCentre{constants::missing::doubleValue, constants::missing::doubleValue};
+    auto numVisitedEdges = static_cast<UInt>(m_edgesRTreeChangedEdges.size());
+
+    const auto updateEdge = [&](UInt e)
+    {
+        if (e >= m_edges.size())
+        {
+            rtree.UpdateNode(e, invalidEdgeCentre);
+            return;
+        }
+
+        const auto edgeCentre = algo::ComputeEdgeCentre(*this, e);
+        rtree.UpdateNode(e, boundingBox.Contains(edgeCentre) ? edgeCentre : invalidEdgeCentre);
+    };
+
+    for (const auto e : m_edgesRTreeChangedEdges)
+    {
+        updateEdge(e);
+    }
+
+    // the edges of the changed nodes are found with the node-edge connectivity when it is up to date,
+    // node moves do not change it
+    if (!m_nodesEdgesRequiresUpdate && m_nodesNumEdges.size() == m_nodes.size())
+    {
+        for (const auto n : m_edgesRTreeChangedNodes)
+        {
+            if (n >= m_nodes.size())
+            {
+                continue;
+            }
+
+            const auto nodeEdges = NodeEdges(n);
+            numVisitedEdges += static_cast<UInt>(nodeEdges.size());
+            for (const auto e : nodeEdges)
+            {
+                updateEdge(e);
+            }
+        }
+    }
+    // otherwise by a scan of all edges
+    else if (!m_edgesRTreeChangedNodes.empty())
+    {
+        numVisitedEdges += static_cast<UInt>(m_edges.size());
+        std::vector<bool> isNodeChanged(m_nodes.size(), false);
+        for (const auto n : m_edgesRTreeChangedNodes)
+        {
+            if (n < m_nodes.size())
+            {
+                isNodeChanged[n] = true;
+            }
+        }
+
+        for (UInt e = 0; e < m_edges.size(); ++e)
+        {
+            const auto [firstNode, secondNode] = m_edges[e];
+            if (firstNode == constants::missing::uintValue || secondNode == constants::missing::uintValue)
+            {
+                continue;
+            }
+
+            if (isNodeChanged[firstNode] || isNodeChanged[secondNode])
+            {
+                updateEdge(e);
+            }
+        }
+    }
+
+    m_edgesRTreeChangedNodes.clear();
+    m_edgesRTreeChangedEdges.clear();
+
+    return numVisitedEdges;
+}
+
+void Mesh::NodeChanged(UInt node)
+{
+    ++m_geometryGeneration;
+
+    const auto maximumNumberOfChanges = m_rTreeRebuildFraction * static_cast<double>(GetNumNodes());
+
+    if (!m_nodesRTreeRequiresUpdate)
+    {
+        m_nodesRTreeChangedNodes.emplace_back(node);
+        m_nodesRTreeRequiresUpdate = static_cast<double>(m_nodesRTreeChangedNodes.size()) > maximumNumberOfChanges;
+    }
+
+    if (!m_edgesRTreeRequiresUpdate)
+    {
+        m_edgesRTreeChangedNodes.emplace_back(node);
+        m_edgesRTreeRequiresUpdate = static_cast<double>(m_edgesRTreeChangedNodes.size()) > maximumNumberOfChanges;
+    }
+}
+
+void Mesh::SetNodeMovedAdministrationRequired()
+{
+    const bool nodesEdgesRequiresUpdate = m_nodesEdgesRequiresUpdate;
+    SetAdministrationRequired(true);
+    m_nodesEdgesRequiresUpdate = nodesEdgesRequiresUpdate;
+}
+
+void Mesh::EdgeChanged(UInt edge)
+{
+    ++m_topologyGeneration;
+
+    if (!m_edgesRTreeRequiresUpdate)
+    {
+        m_edgesRTreeChangedEdges.emplace_back(edge);
+        m_edgesRTreeRequiresUpdate = static_cast<double>(m_edgesRTreeChangedEdges.size()) > m_rTreeRebuildFraction * static_cast<double>(GetNumEdges());
+    }
+}
+
+void Mesh::NodesTranslated(const std::vector<UInt>& nodeIndices)
+{
+    // an empty vector means that all nodes have been translated
+    if (nodeIndices.empty())
+    {
+        ++m_geometryGeneration;
+        m_nodesRTreeRequiresUpdate = true;
+        m_edgesRTreeRequiresUpdate = true;
+        return;
+    }
+
+    for (const auto n : nodeIndices)
+    {
+        NodeChanged(n);
+    }
+}
+
+void Mesh::SetRTreeRebuildFraction(double value)
+{
+    if (value < 0.0 || value > 1.0)
+    {
+        throw ConstraintError("The RTree rebuild fraction must be between 0 and 1, {} given", value);
+    }
+
+    m_rTreeRebuildFraction = value;
 }
 
 void Mesh::SetAdministrationRequired(const bool value)
 {
     m_administrationRequired = value;
+    m_nodesEdgesRequiresUpdate = value;
+
+    if (value)
+    {
+        ++m_topologyGeneration;
+        DecompressConnectivity();
+    }
+}
+
+void Mesh::SetCompressedConnectivity(bool enable)
+{
+    if (!enable)
+    {
+        DecompressConnectivity();
+        m_nodesEdgesCompressed = CompressedSparseRow<UInt>();
+        m_facesNodesCompressed = CompressedSparseRow<UInt>();
+        m_facesEdgesCompressed = CompressedSparseRow<UInt>();
+    }
+
+    m_compressedConnectivity = enable;
+
+    if (!AdministrationRequired())
+    {
+        CompressConnectivity();
+    }
+}
+
+void Mesh::CompressConnectivity()
+{
+    if (!m_compressedConnectivity || m_connectivityCompressed)
+    {
+        return;
+    }
+
+    m_nodesEdgesCompressed.Assign(m_nodesEdges, m_nodesNumEdges);
+    m_facesNodesCompressed.Assign(m_facesNodes);
+    m_facesEdgesCompressed.Assign(m_facesEdges);
+
+    // the compressed tables replace the nested vectors
+    m_nodesEdges = std::vector<std::vector<UInt>>();
+    m_facesNodes = std::vector<std::vector<UInt>>();
+    m_facesEdges = std::vector<std::vector<UInt>>();
+    m_connectivityCompressed = true;
+}
+
+void Mesh::DecompressConnectivity()
+{
+    if (!m_connectivityCompressed)
+    {
+        return;
+    }
+
+    // the compressed tables are kept allocated, so the views taken before the modification remain valid
+    m_nodesEdges = m_nodesEdgesCompressed.ToNested();
+    m_facesNodes = m_facesNodesCompressed.ToNested();
+    m_facesEdges = m_facesEdgesCompressed.ToNested();
+    m_connectivityCompressed = false;
+}
+
+std::size_t Mesh::ConnectivityMemoryUsage() const
+{
+    const auto nestedMemoryUsage = [](const std::vector<std::vector<UInt>>& rows)
+    {
+        std::size_t bytes = rows.capacity() * sizeof(std::vector<UInt>);
+        for (const auto& row : rows)
+        {
+            bytes += row.capacity() * sizeof(UInt);
+        }
+        return bytes;
+    };
+
+    return nestedMemoryUsage(m_nodesEdges) + nestedMemoryUsage(m_facesNodes) + nestedMemoryUsage(m_facesEdges) +
+           m_nodesEdgesCompressed.MemoryUsage() + m_facesNodesCompressed.MemoryUsage() + m_facesEdgesCompressed.MemoryUsage();
 }
 
 //--------------------------------
@@ -1258,54 +1581,55 @@ void Mesh::CommitAction(const AddNodeAction& undoAction)
 {
     m_nodes[undoAction.NodeId()] = undoAction.Node();
     m_nodesNumEdges[undoAction.NodeId()] = 0;
-    m_nodesRTreeRequiresUpdate = true;
+    NodeChanged(undoAction.NodeId());
     SetAdministrationRequired(true);
 }
 
 void Mesh::CommitAction(const AddEdgeAction& undoAction)
 {
     m_edges[undoAction.EdgeId()] = undoAction.GetEdge();
-    m_edgesRTreeRequiresUpdate = true;
+    EdgeChanged(undoAction.EdgeId());
     SetAdministrationRequired(true);
 }
 
 void Mesh::CommitAction(const ResetNodeAction& undoAction)
 {
     m_nodes[undoAction.NodeId()] = undoAction.UpdatedNode();
-    m_nodesRTreeRequiresUpdate = true;
-    m_edgesRTreeRequiresUpdate = true;
-    SetAdministrationRequired(true);
+    NodeChanged(undoAction.NodeId());
+    SetNodeMovedAdministrationRequired();
 }
 
 void Mesh::CommitAction(const ResetEdgeAction& undoAction)
 {
     m_edges[undoAction.EdgeId()] = undoAction.UpdatedEdge();
-    m_edgesRTreeRequiresUpdate = true;
+    EdgeChanged(undoAction.EdgeId());
     SetAdministrationRequired(true);
 }
 
 void Mesh::CommitAction(const DeleteEdgeAction& undoAction)
 {
     m_edges[undoAction.EdgeId()] = {constants::missing::uintValue, constants::missing::uintValue};
-    m_edgesRTreeRequiresUpdate = true;
+    EdgeChanged(undoAction.EdgeId());
     SetAdministrationRequired(true);
 }
 
 void Mesh::CommitAction(const DeleteNodeAction& undoAction)
 {
     m_nodes[undoAction.NodeId()] = {constants::missing::doubleValue, constants::missing::doubleValue};
-    m_nodesRTreeRequiresUpdate = true;
+    NodeChanged(undoAction.NodeId());
     SetAdministrationRequired(true);
 }
 
 void Mesh::CommitAction(NodeTranslationAction& undoAction)
 {
     undoAction.Swap(m_nodes);
+    NodesTranslated(undoAction.NodeIndices());
 }
 
 void Mesh::CommitAction(MeshConversionAction& undoAction)
 {
     undoAction.Swap(m_nodes, m_projection);
+    ++m_geometryGeneration;
 }
 
 void Mesh::CommitAction(FullUnstructuredGridUndo& undoAction)
@@ -1319,54 +1643,55 @@ void Mesh::RestoreAction(const AddNodeAction& undoAction)
 {
     m_nodes[undoAction.NodeId()] = Point(constants::missing::doubleValue, constants::missing::doubleValue);
     m_nodesNumEdges[undoAction.NodeId()] = 0;
-    m_nodesRTreeRequiresUpdate = true;
+    NodeChanged(undoAction.NodeId());
     SetAdministrationRequired(true);
 }
 
 void Mesh::RestoreAction(const AddEdgeAction& undoAction)
 {
     m_edges[undoAction.EdgeId()] = {constants::missing::uintValue, constants::missing::uintValue};
-    m_edgesRTreeRequiresUpdate = true;
+    EdgeChanged(undoAction.EdgeId());
     SetAdministrationRequired(true);
 }
 
 void Mesh::RestoreAction(const ResetNodeAction& undoAction)
 {
     m_nodes[undoAction.NodeId()] = undoAction.InitialNode();
-    m_nodesRTreeRequiresUpdate = true;
-    m_edgesRTreeRequiresUpdate = true;
-    SetAdministrationRequired(true);
+    NodeChanged(undoAction.NodeId());
+    SetNodeMovedAdministrationRequired();
 }
 
 void Mesh::RestoreAction(const ResetEdgeAction& undoAction)
 {
     m_edges[undoAction.EdgeId()] = undoAction.InitialEdge();
-    m_edgesRTreeRequiresUpdate = true;
+    EdgeChanged(undoAction.EdgeId());
     SetAdministrationRequired(true);
 }
 
 void Mesh::RestoreAction(const DeleteEdgeAction& undoAction)
 {
     m_edges[undoAction.EdgeId()] = undoAction.GetEdge();
-    m_edgesRTreeRequiresUpdate = true;
+    EdgeChanged(undoAction.EdgeId());
     SetAdministrationRequired(true);
 }
 
 void Mesh::RestoreAction(const DeleteNodeAction& undoAction)
 {
     m_nodes[undoAction.NodeId()] = undoAction.Node();
-    m_nodesRTreeRequiresUpdate = true;
+    NodeChanged(undoAction.NodeId());
     SetAdministrationRequired(true);
 }
 
 void Mesh::RestoreAction(NodeTranslationAction& undoAction)
 {
     undoAction.Swap(m_nodes);
+    NodesTranslated(undoAction.NodeIndices());
 }
 
 void Mesh::RestoreAction(MeshConversionAction& undoAction)
 {
     undoAction.Swap(m_nodes, m_projection);
+    ++m_geometryGeneration;
 }
 
 void Mesh::RestoreAction(FullUnstructuredGridUndo& undoAction)
@@ -1386,7 +1711,7 @@ void Mesh::ComputeFaceClosedPolygon(UInt faceIndex, std::vector<Point>& polygonN
 
     for (UInt n = 0; n < numFaceNodes; n++)
     {
-        polygonNodesCache.push_back(m_nodes[m_facesNodes[faceIndex][n]]);
+        polygonNodesCache.push_back(m_nodes[FaceNodes(faceIndex)[n]]);
     }
 
     polygonNodesCache.push_back(polygonNodesCache.front());
@@ -91,7 +91,7 @@ Point Mesh1D::ComputeProjectedNode(UInt node, double distanceFactor) const
     if (IsNodeOnBoundary(node))
     {
         // A boundary edge: compute the projection by taking the current node and the other node of the edge.
-        const auto edge = m_nodesEdges[node][0];
+        const auto edge = NodeEdges(node)[0];
 
         const auto otherNode = m_edges[edge].first == node ? m_edges[edge].second : m_edges[edge].first;
 
@@ -104,8 +104,8 @@ Point Mesh1D::ComputeProjectedNode(UInt node, double distanceFactor) const
     }
 
     // Not a boundary edge: compute the projection by taking the leftmost and rightmost nodes of two consecutive edges sharing the input node.
-    const auto left1dEdge = m_nodesEdges[node][0];
-    const auto right1dEdge = m_nodesEdges[node][1];
+    const auto left1dEdge = NodeEdges(node)[0];
+    const auto right1dEdge = NodeEdges(node)[1];
 
     const auto otherLeft1dNode = m_edges[left1dEdge].first == node ? m_edges[left1dEdge].second : m_edges[left1dEdge].first;
     const auto otherRight1dNode = m_edges[right1dEdge].first == node ? m_edges[right1dEdge].second : m_edges[right1dEdge].first;
@@ -25,7 +25,9 @@
 //
 //------------------------------------------------------------------------------
 
+#include <bit>
 #include <numeric>
+#include <tuple>
 
 #include "MeshKernel/Constants.hpp"
 #include "MeshKernel/Definitions.hpp"
@@ -33,6 +35,7 @@
 #include "MeshKernel/Exceptions.hpp"
 #include "MeshKernel/Mesh2D.hpp"
 #include "MeshKernel/Mesh2DIntersections.hpp"
+#include "MeshKernel/Mesh2DPointLocator.hpp"
 #include "MeshKernel/MeshBoundaryExtractor.hpp"
 #include "MeshKernel/MeshFaceCenters.hpp"
 #include "MeshKernel/MeshOrthogonality.hpp"
@@ -182,6 +185,8 @@ void Mesh2D::DoAdministration(CompoundUndoAction* undoAction)
 {
     if (!AdministrationRequired())
     {
+        // the connectivity may have been decompressed for an edit in place
+        CompressConnectivity();
         return;
     }
 
@@ -201,6 +206,8 @@ void Mesh2D::DoAdministration(CompoundUndoAction* undoAction)
     // classify node types
     ClassifyNodes();
 
+    CompressConnectivity();
+
     SetAdministrationRequired(false);
 }
 
@@ -223,6 +230,8 @@ void Mesh2D::DoAdministrationGivenFaceNodesMapping(const std::vector<std::vector
 
     // classify node types
     ClassifyNodes();
+
+    CompressConnectivity();
 }
 
 void Mesh2D::Administrate(CompoundUndoAction* undoAction)
@@ -275,9 +284,9 @@ std::unique_ptr<meshkernel::UndoAction> Mesh2D::DeleteDegeneratedTriangles()
         {
             continue;
         }
-        auto firstNode = m_facesNodes[f][0];
-        auto secondNode = m_facesNodes[f][1];
-        auto thirdNode = m_facesNodes[f][2];
+        auto firstNode = FaceNodes(f)[0];
+        auto secondNode = FaceNodes(f)[1];
+        auto thirdNode = FaceNodes(f)[2];
 
         // account for periodic spherical coordinate
         if ((m_projection == Projection::spherical || m_projection == Projection::sphericalAccurate) && IsPointOnPole(m_nodes[firstNode]))
@@ -301,7 +310,7 @@ std::unique_ptr<meshkernel::UndoAction> Mesh2D::DeleteDegeneratedTriangles()
             // Flag edges to remove
             for (UInt e = 0; e < constants::geometric::numNodesInTriangle; ++e)
             {
-                const auto edge = m_facesEdges[f][e];
+                const auto edge = FaceEdges(f)[e];
                 undoAction->Add(ResetEdge(edge, {constants::missing::uintValue, constants::missing::uintValue}));
             }
             // save degenerated face index
@@ -312,9 +321,9 @@ std::unique_ptr<meshkernel::UndoAction> Mesh2D::DeleteDegeneratedTriangles()
     // collapse secondNode and thirdNode into firstNode, change coordinate of the firstNode to triangle center of mass
     for (auto const& face : degeneratedTriangles)
     {
-        const auto firstNode = m_facesNodes[face][0];
-        const auto secondNode = m_facesNodes[face][1];
-        const auto thirdNode = m_facesNodes[face][2];
+        const auto firstNode = FaceNodes(face)[0];
+        const auto secondNode = FaceNodes(face)[1];
+        const auto thirdNode = FaceNodes(face)[2];
 
         undoAction->Add(ResetNode(thirdNode, m_facesMassCenters[face]));
         undoAction->Add(MergeTwoNodes(secondNode, firstNode));
@@ -436,145 +445,266 @@ void Mesh2D::ResizeAndInitializeFaceVectors()
     m_numFacesNodes.reserve(GetNumNodes());
 }
 
-void Mesh2D::FindFacesRecursive(UInt startNode,
-                                UInt node,
-                                UInt previousEdge,
-                                UInt numClosingEdges,
-                                std::vector<UInt>& edges,
-                                std::vector<UInt>& nodes,
-                                std::vector<UInt>& sortedEdgesFaces,
-                                std::vector<UInt>& sortedNodes,
-                                std::vector<Point>& nodalValues)
+Mesh2D::HalfEdges Mesh2D::ComputeHalfEdges() const
 {
-    // The selected edge does not exist.
-    if (nodes.size() >= numClosingEdges)
-    {
-        return;
-    }
+    const auto numNodes = GetNumNodes();
 
-    if (m_edges[previousEdge].first == constants::missing::uintValue || m_edges[previousEdge].second == constants::missing::uintValue)
+    HalfEdges halfEdges;
+    halfEdges.offsets.resize(numNodes + 1, 0);
+    for (UInt n = 0; n < numNodes; ++n)
     {
-        throw std::invalid_argument("Mesh2D::FindFacesRecursive: The selected edge is invalid. This should not happen since all invalid edges should have been cleaned up.");
+        halfEdges.offsets[n + 1] = halfEdges.offsets[n] + m_nodesNumEdges[n];
     }
 
-    // Check if the faces are already found
-    if (m_edgesNumFaces[previousEdge] >= 2)
+    const auto numHalfEdges = halfEdges.offsets.back();
+    halfEdges.nodes.resize(numHalfEdges);
+    halfEdges.edges.resize(numHalfEdges);
+    halfEdges.next.resize(numHalfEdges, constants::missing::uintValue);
+
+#pragma omp parallel for
+    for (int n = 0; n < static_cast<int>(numNodes); ++n)
     {
-        return;
-    }
+        const auto node = static_cast<UInt>(n);
+        for (UInt e = 0; e < m_nodesNumEdges[node]; ++e)
+        {
+            const auto halfEdge = halfEdges.offsets[node] + e;
+            const auto edge = m_nodesEdges[node][e];
+            halfEdges.nodes[halfEdge] = node;
+            halfEdges.edges[halfEdge] = edge;
 
-    edges.push_back(previousEdge);
-    nodes.push_back(node);
+            if (m_edges[edge].first == constants::missing::uintValue || m_edges[edge].second == constants::missing::uintValue)
+            {
+                continue;
+            }
 
-    const auto otherNode = OtherNodeOfEdge(m_edges[previousEdge], node);
+            // at the other node, the face continues along the edge preceding the current edge in counterclockwise order
+            const auto otherNode = OtherNodeOfEdge(m_edges[edge], node);
+            UInt edgeIndexOtherNode = 0;
+            for (UInt oe = 0; oe < m_nodesNumEdges[otherNode]; ++oe)
+            {
+                if (m_nodesEdges[otherNode][oe] == edge)
+                {
+                    edgeIndexOtherNode = oe;
+                    break;
+                }
+            }
 
-    // enclosure found
-    if (otherNode == startNode && nodes.size() == numClosingEdges)
-    {
-        // no duplicated nodes allowed
-        if (HasDuplicateNodes(numClosingEdges, nodes, sortedNodes))
-        {
-            return;
+            edgeIndexOtherNode = edgeIndexOtherNode == 0 ? m_nodesNumEdges[otherNode] - 1 : edgeIndexOtherNode - 1;
+            halfEdges.next[halfEdge] = halfEdges.offsets[otherNode] + edgeIndexOtherNode;
         }
+    }
+
+    return halfEdges;
+}
+
+std::vector<std::uint8_t> Mesh2D::ComputeClosingWalks(const HalfEdges& halfEdges) const
+{
+    const auto numHalfEdges = static_cast<UInt>(halfEdges.next.size());
+    std::vector<std::uint8_t> closingWalks(numHalfEdges, 0);
+    bool hasInvalidEdges = false;
 
-        // we need to add a face when at least one edge has no faces
-        auto oneEdgeHasNoFace = false;
+#pragma omp parallel for reduction(|| : hasInvalidEdges)
+    for (int h = 0; h < static_cast<int>(numHalfEdges); ++h)
+    {
+        const auto startNode = halfEdges.nodes[h];
+        auto halfEdge = static_cast<UInt>(h);
 
-        for (const auto& edge : edges)
+        for (UInt numEdges = 1; numEdges <= constants::geometric::maximumNumberOfEdgesPerFace; ++numEdges)
         {
-            if (m_edgesNumFaces[edge] == 0)
+            halfEdge = halfEdges.next[halfEdge];
+            if (halfEdge == constants::missing::uintValue)
             {
-                oneEdgeHasNoFace = true;
+                hasInvalidEdges = true;
                 break;
             }
-        }
 
-        // check if least one edge has no face and there are no duplicate edge-faces.
-        if (!oneEdgeHasNoFace && HasDuplicateEdgeFaces(numClosingEdges, edges, sortedEdgesFaces))
-        {
-            return;
+            if (numEdges >= constants::geometric::numNodesInTriangle && halfEdges.nodes[halfEdge] == startNode)
+            {
+                closingWalks[h] |= static_cast<std::uint8_t>(1U << numEdges);
+            }
         }
+    }
+
+    if (hasInvalidEdges)
+    {
+        throw std::invalid_argument("Mesh2D::FindFaces: The selected edge is invalid. This should not happen since all invalid edges should have been cleaned up.");
+    }
 
-        // the order of the edges in a new face must be counterclockwise
-        // in order to evaluate the clockwise order, the signed face area is computed
+    return closingWalks;
+}
+
+void Mesh2D::FindFaces()
+{
+    const auto halfEdges = ComputeHalfEdges();
+    const auto closingWalks = ComputeClosingWalks(halfEdges);
+    const auto numHalfEdges = static_cast<UInt>(halfEdges.next.size());
 
-        // The nodes array does not represent a closed polygon.
-        auto const [area, center_of_mass, direction] = Polygon::FaceAreaAndCenterOfMass(m_nodes, nodes, m_projection, /* isClosed = */ false);
+    // The faces of a conforming mesh are the closed walks with distinct nodes, each found from the half-edge with the
+    // lowest index along the walk. Their area, mass centre and orientation are computed in parallel, the faces are
+    // then accepted sequentially in the order of the number of edges, the start node and the start edge.
+    std::vector<UInt> faceHalfEdges;
+    for (UInt h = 0; h < numHalfEdges; ++h)
+    {
+        if (closingWalks[h] == 0)
+        {
+            continue;
+        }
 
-        if (direction == TraversalDirection::Clockwise)
+        const auto numClosingEdges = static_cast<UInt>(std::countr_zero(closingWalks[h]));
+        bool isFirstHalfEdge = true;
+        auto halfEdge = h;
+        for (UInt e = 1; e < numClosingEdges && isFirstHalfEdge; ++e)
         {
-            return;
+            halfEdge = halfEdges.next[halfEdge];
+            isFirstHalfEdge = halfEdge > h;
         }
 
-        // increase m_edgesNumFaces
-        for (const auto& edge : edges)
+        if (isFirstHalfEdge && halfEdges.next[halfEdge] == h)
         {
-            // Increment the number of shared faces for the edge.
-            ++m_edgesNumFaces[edge];
-            const auto numFace = m_edgesNumFaces[edge];
-            m_edgesFaces[edge][numFace - 1] = GetNumFaces();
+            faceHalfEdges.emplace_back(h);
         }
+    }
 
-        // store the result
-        m_facesNodes.emplace_back(nodes);
-        m_facesEdges.emplace_back(edges);
-        m_faceArea.emplace_back(area);
-        m_facesMassCenters.emplace_back(center_of_mass);
-        m_numFacesNodes.emplace_back(static_cast<UInt>(nodes.size()));
+    std::vector<double> faceAreas(faceHalfEdges.size());
+    std::vector<Point> faceCenters(faceHalfEdges.size());
+    std::vector<TraversalDirection> faceDirections(faceHalfEdges.size());
 
-        return;
-    }
+    std::vector<UInt> nodes;
+    nodes.reserve(constants::geometric::maximumNumberOfEdgesPerFace);
 
-    UInt edgeIndexOtherNode = 0;
-    for (UInt e = 0; e < m_nodesNumEdges[otherNode]; e++)
+#pragma omp parallel for firstprivate(nodes)
+    for (int f = 0; f < static_cast<int>(faceHalfEdges.size()); ++f)
     {
-        if (m_nodesEdges[otherNode][e] == previousEdge)
+        nodes.clear();
+        const auto numClosingEdges = static_cast<UInt>(std::countr_zero(closingWalks[faceHalfEdges[f]]));
+        auto halfEdge = faceHalfEdges[f];
+        for (UInt e = 0; e < numClosingEdges; ++e)
         {
-            edgeIndexOtherNode = e;
-            break;
+            nodes.emplace_back(halfEdges.nodes[halfEdge]);
+            halfEdge = halfEdges.next[halfEdge];
         }
-    }
 
-    if (edgeIndexOtherNode == 0)
-    {
-        edgeIndexOtherNode = m_nodesNumEdges[otherNode] - 1;
-    }
-    else if (edgeIndexOtherNode > m_nodesNumEdges[otherNode])
-    {
-        edgeIndexOtherNode = edgeIndexOtherNode - m_nodesNumEdges[otherNode] - 1;
-    }
-    else
-    {
-        edgeIndexOtherNode = edgeIndexOtherNode - 1;
+        std::tie(faceAreas[f], faceCenters[f], faceDirections[f]) = Polygon::FaceAreaAndCenterOfMass(m_nodes, nodes, m_projection, /* isClosed = */ false);
     }
 
-    auto const edge = m_nodesEdges[otherNode][edgeIndexOtherNode];
-    FindFacesRecursive(startNode, otherNode, edge, numClosingEdges, edges, nodes, sortedEdgesFaces, sortedNodes, nodalValues);
-}
-
-void Mesh2D::FindFaces()
-{
     std::vector<UInt> sortedEdgesFaces(constants::geometric::maximumNumberOfEdgesPerFace);
     std::vector<UInt> sortedNodes(constants::geometric::maximumNumberOfEdgesPerFace);
-    std::vector<Point> nodalValues(constants::geometric::maximumNumberOfEdgesPerFace);
     std::vector<UInt> edges(constants::geometric::maximumNumberOfEdgesPerFace);
-    std::vector<UInt> nodes(constants::geometric::maximumNumberOfEdgesPerFace);
 
-    for (UInt numEdgesPerFace = constants::geometric::numNodesInTriangle; numEdgesPerFace <= constants::geometric::maximumNumberOfEdgesPerFace; ++numEdgesPerFace)
+    // The walks from the half-edges of an accepted face would only find the same face again, and are skipped
+    std::vector<bool> isInFace(numHalfEdges, false);
+    std::vector<UInt> acceptedHalfEdges;
+    acceptedHalfEdges.reserve(faceHalfEdges.size());
+
+    for (UInt numClosingEdges = constants::geometric::numNodesInTriangle; numClosingEdges <= constants::geometric::maximumNumberOfEdgesPerFace; ++numClosingEdges)
     {
-        for (UInt n = 0; n < GetNumNodes(); n++)
+        auto face = faceHalfEdges.begin();
+        for (UInt h = 0; h < numHalfEdges; ++h)
         {
-            if (!m_nodes[n].IsValid())
+            if ((closingWalks[h] & (1U << numClosingEdges)) == 0 || isInFace[h] || !m_nodes[halfEdges.nodes[h]].IsValid())
             {
                 continue;
             }
 
-            for (UInt e = 0; e < m_nodesNumEdges[n]; e++)
+            nodes.clear();
+            edges.clear();
+
+            // walks along edges shared by less than two faces
+            auto halfEdge = h;
+            for (UInt e = 0; e < numClosingEdges && m_edgesNumFaces[halfEdges.edges[halfEdge]] < 2; ++e)
             {
-                nodes.clear();
-                edges.clear();
-                FindFacesRecursive(n, n, m_nodesEdges[n][e], numEdgesPerFace, edges, nodes, sortedEdgesFaces, sortedNodes, nodalValues);
+                nodes.emplace_back(halfEdges.nodes[halfEdge]);
+                edges.emplace_back(halfEdges.edges[halfEdge]);
+                halfEdge = halfEdges.next[halfEdge];
             }
+
+            if (nodes.size() != numClosingEdges)
+            {
+                continue;
+            }
+
+            // no duplicated nodes allowed
+            if (HasDuplicateNodes(numClosingEdges, nodes, sortedNodes))
+            {
+                continue;
+            }
+
+            // we need to add a face when at least one edge has no faces
+            const bool oneEdgeHasNoFace = std::ranges::any_of(edges, [this](UInt edge)
+                                                              { return m_edgesNumFaces[edge] == 0; });
+
+            // check if least one edge has no face and there are no duplicate edge-faces.
+            if (!oneEdgeHasNoFace && HasDuplicateEdgeFaces(numClosingEdges, edges, sortedEdgesFaces))
+            {
+                continue;
+            }
+
+            // the order of the edges in a new face must be counterclockwise
+            // in order to evaluate the clockwise order, the signed face area is computed
+            double area;
+            Point centerOfMass;
+            TraversalDirection direction;
+            while (face != faceHalfEdges.end() && *face < h)
+            {
+                ++face;
+            }
+            if (face != faceHalfEdges.end() && *face == h && std::countr_zero(closingWalks[h]) == static_cast<int>(numClosingEdges))
+            {
+                const auto f = static_cast<UInt>(face - faceHalfEdges.begin());
+                std::tie(area, centerOfMass, direction) = std::tie(faceAreas[f], faceCenters[f], faceDirections[f]);
+            }
+            else
+            {
+                std::tie(area, centerOfMass, direction) = Polygon::FaceAreaAndCenterOfMass(m_nodes, nodes, m_projection, /* isClosed = */ false);
+            }
+
+            if (direction == TraversalDirection::Clockwise)
+            {
+                continue;
+            }
+
+            if (halfEdge == h)
+            {
+                for (UInt e = 0; e < numClosingEdges; ++e)
+                {
+                    isInFace[halfEdge] = true;
+                    halfEdge = halfEdges.next[halfEdge];
+                }
+            }
+
+            // increase m_edgesNumFaces
+            for (const auto& edge : edges)
+            {
+                // Increment the number of shared faces for the edge.
+                ++m_edgesNumFaces[edge];
+                const auto numFace = m_edgesNumFaces[edge];
+                m_edgesFaces[edge][numFace - 1] = static_cast<UInt>(m_numFacesNodes.size());
+            }
+
+            // store the result, the face nodes and edges are stored afterwards
+            acceptedHalfEdges.emplace_back(h);
+            m_faceArea.emplace_back(area);
+            m_facesMassCenters.emplace_back(centerOfMass);
+            m_numFacesNodes.emplace_back(static_cast<UInt>(nodes.size()));
+        }
+    }
+
+    const auto numFaces = static_cast<UInt>(acceptedHalfEdges.size());
+    m_facesNodes.resize(numFaces);
+    m_facesEdges.resize(numFaces);
+
+#pragma omp parallel for
+    for (int f = 0; f < static_cast<int>(numFaces); ++f)
+    {
+        m_facesNodes[f].resize(m_numFacesNodes[f]);
+        m_facesEdges[f].resize(m_numFacesNodes[f]);
+
+        auto halfEdge = acceptedHalfEdges[f];
+        for (UInt e = 0; e < m_numFacesNodes[f]; ++e)
+        {
+            m_facesNodes[f][e] = halfEdges.nodes[halfEdge];
+            m_facesEdges[f][e] = halfEdges.edges[halfEdge];
+            halfEdge = halfEdges.next[halfEdge];
         }
     }
 }
@@ -723,7 +853,7 @@ meshkernel::MeshNodeType Mesh2D::ClassifyNode(const UInt nodeId) const
         UInt secondNode = constants::missing::uintValue;
         for (UInt i = 0; i < m_nodesNumEdges[nodeId]; ++i)
         {
-            const auto edgeIndex = m_nodesEdges[nodeId][i];
+            const auto edgeIndex = NodeEdges(nodeId)[i];
 
             if (!IsEdgeOnBoundary(edgeIndex))
             {
@@ -821,9 +951,9 @@ void Mesh2D::ComputeFaceClosedPolygonWithLocalMappings(UInt faceIndex,
 
     for (UInt n = 0; n < numFaceNodes; n++)
     {
-        polygonNodesCache.emplace_back(m_nodes[m_facesNodes[faceIndex][n]]);
+        polygonNodesCache.emplace_back(m_nodes[FaceNodes(faceIndex)[n]]);
         localNodeIndicesCache.emplace_back(n);
-        globalEdgeIndicesCache.emplace_back(m_facesEdges[faceIndex][n]);
+        globalEdgeIndicesCache.emplace_back(FaceEdges(faceIndex)[n]);
     }
     polygonNodesCache.emplace_back(polygonNodesCache.front());
     localNodeIndicesCache.emplace_back(0);
@@ -897,9 +1027,9 @@ std::vector<meshkernel::Point> Mesh2D::GetObtuseTrianglesCenters()
         // a triangle
         if (m_numFacesNodes[f] == 3)
         {
-            const auto firstNode = m_facesNodes[f][0];
-            const auto secondNode = m_facesNodes[f][1];
-            const auto thirdNode = m_facesNodes[f][2];
+            const auto firstNode = FaceNodes(f)[0];
+            const auto secondNode = FaceNodes(f)[1];
+            const auto thirdNode = FaceNodes(f)[2];
             // compute squared edge lengths
             const auto firstEdgeSquaredLength = ComputeSquaredDistance(m_nodes[secondNode], m_nodes[firstNode], m_projection);
             const auto secondEdgeSquaredLength = ComputeSquaredDistance(m_nodes[thirdNode], m_nodes[firstNode], m_projection);
@@ -991,7 +1121,7 @@ void Mesh2D::ComputeAverageAreOfNeighbouringFaces(const UInt faceId, UInt& numNo
     for (UInt e = 0; e < constants::geometric::numNodesInTriangle; ++e)
     {
         // the edge must not be at the boundary, otherwise there is no "other" face
-        const auto edge = m_facesEdges[faceId][e];
+        const auto edge = FaceEdges(faceId)[e];
         if (IsEdgeOnBoundary(edge))
         {
             continue;
@@ -1028,9 +1158,9 @@ void Mesh2D::FindSmallestCornerAngle(const UInt faceId,
         const auto previousEdge = NextCircularBackwardIndex(e, constants::geometric::numNodesInTriangle);
         const auto nextEdge = NextCircularForwardIndex(e, constants::geometric::numNodesInTriangle);
 
-        const auto k0 = m_facesNodes[faceId][previousEdge];
-        const auto k1 = m_facesNodes[faceId][e];
-        const auto k2 = m_facesNodes[faceId][nextEdge];
+        const auto k0 = FaceNodes(faceId)[previousEdge];
+        const auto k1 = FaceNodes(faceId)[e];
+        const auto k2 = FaceNodes(faceId)[nextEdge];
 
         // compute the angles between the edges
         const auto cosphi = std::abs(NormalizedInnerProductTwoSegments(m_nodes[k0], m_nodes[k1], m_nodes[k1], m_nodes[k2], m_projection));
@@ -1041,7 +1171,7 @@ void Mesh2D::FindSmallestCornerAngle(const UInt faceId,
             nodeToPreserve = k1;
             firstNodeToMerge = k0;
             secondNodeToMerge = k2;
-            thirdEdgeSmallTriangle = m_facesEdges[faceId][nextEdge];
+            thirdEdgeSmallTriangle = FaceEdges(faceId)[nextEdge];
         }
     }
 }
@@ -1055,7 +1185,7 @@ void Mesh2D::DeleteSmallTriangle(const UInt nodeToPreserve,
     UInt numInternalEdges = 0;
     for (UInt e = 0; e < m_nodesNumEdges[firstNodeToMerge]; ++e)
     {
-        if (!IsEdgeOnBoundary(m_nodesEdges[firstNodeToMerge][e]))
+        if (!IsEdgeOnBoundary(NodeEdges(firstNodeToMerge)[e]))
         {
             numInternalEdges++;
         }
@@ -1071,7 +1201,7 @@ void Mesh2D::DeleteSmallTriangle(const UInt nodeToPreserve,
     numInternalEdges = 0;
     for (UInt e = 0; e < m_nodesNumEdges[secondNodeToMerge]; ++e)
     {
-        if (!IsEdgeOnBoundary(m_nodesEdges[secondNodeToMerge][e]))
+        if (!IsEdgeOnBoundary(NodeEdges(secondNodeToMerge)[e]))
         {
             numInternalEdges++;
         }
@@ -1153,7 +1283,7 @@ void Mesh2D::ComputeNodeNeighbours(std::vector<std::vector<UInt>>& nodesNodes, U
 
         for (UInt nn = 0; nn < m_nodesNumEdges[n]; nn++)
         {
-            const auto edge = m_edges[m_nodesEdges[n][nn]];
+            const auto edge = m_edges[NodeEdges(n)[nn]];
             nodesNodes[n][nn] = OtherNodeOfEdge(edge, n);
         }
     }
@@ -1225,9 +1355,9 @@ void Mesh2D::ComputeAverageEdgeLength(const std::vector<double>& edgesLength,
         {
             if (numberOfFaceNodes != constants::geometric::numNodesInQuadrilateral)
             {
-                curvilinearGridIndicator[m_facesNodes[f][n]] = false;
+                curvilinearGridIndicator[FaceNodes(f)[n]] = false;
             }
-            const auto edgeIndex = m_facesEdges[f][n];
+            const auto edgeIndex = FaceEdges(f)[n];
 
             if (m_edgesNumFaces[edgeIndex] == 0)
             {
@@ -1249,7 +1379,7 @@ void Mesh2D::ComputeAverageEdgeLength(const std::vector<double>& edgesLength,
                     kkp2 = kkp2 - numberOfFaceNodes;
                 }
 
-                const auto klinkp2 = m_facesEdges[f][kkp2];
+                const auto klinkp2 = FaceEdges(f)[kkp2];
                 edgeLength = 0.5 * (edgesLength[edgeIndex] + edgesLength[klinkp2]);
             }
 
@@ -1340,9 +1470,9 @@ std::unique_ptr<meshkernel::UndoAction> Mesh2D::TriangulateFaces(const Polygons&
         bool elementIsOutsidePolygon = false;
 
         // Determine if any node is outside the polygon
-        for (UInt j = 0; j < m_facesNodes[i].size(); ++j)
+        for (UInt j = 0; j < FaceNodes(i).size(); ++j)
         {
-            if (!nodeInsidePolygon[m_facesNodes[i][j]])
+            if (!nodeInsidePolygon[FaceNodes(i)[j]])
             {
                 elementIsOutsidePolygon = true;
             }
@@ -1354,10 +1484,10 @@ std::unique_ptr<meshkernel::UndoAction> Mesh2D::TriangulateFaces(const Polygons&
             continue;
         }
 
-        const auto indexFirstNode = m_facesNodes[i][0];
+        const auto indexFirstNode = FaceNodes(i)[0];
         for (UInt j = 2; j < NumEdges - 1; j++)
         {
-            const auto nodeIndex = m_facesNodes[i][j];
+            const auto nodeIndex = FaceNodes(i)[j];
 
             auto [edgeId, edgeConnectionAction] = ConnectNodes(indexFirstNode, nodeIndex);
             triangulationAction->Add(std::move(edgeConnectionAction));
@@ -1395,7 +1525,7 @@ void Mesh2D::MakeDualFace(const std::span<const Point> edgeCentres,
 
     for (UInt e = 0; e < numEdges; ++e)
     {
-        const auto edgeIndex = m_nodesEdges[node][e];
+        const auto edgeIndex = NodeEdges(node)[e];
 
         if (m_edgesNumFaces[edgeIndex] == 0)
         {
@@ -1467,7 +1597,7 @@ std::vector<meshkernel::UInt> Mesh2D::SortedFacesAroundNode(UInt node) const
     std::vector<UInt> result;
     for (UInt e = 0; e < numEdges; ++e)
     {
-        const auto firstEdge = m_nodesEdges[node][e];
+        const auto firstEdge = NodeEdges(node)[e];
 
         // no faces for this edge
         if (m_edgesNumFaces[firstEdge] == 0)
@@ -1476,7 +1606,7 @@ std::vector<meshkernel::UInt> Mesh2D::SortedFacesAroundNode(UInt node) const
         }
 
         auto const ee = NextCircularForwardIndex(e, numEdges);
-        const auto secondEdge = m_nodesEdges[node][ee];
+        const auto secondEdge = NodeEdges(node)[ee];
         const auto firstFace = m_edgesFaces[firstEdge][0];
 
         UInt secondFace = constants::missing::uintValue;
@@ -1489,7 +1619,7 @@ std::vector<meshkernel::UInt> Mesh2D::SortedFacesAroundNode(UInt node) const
         UInt firstEdgeIndexInFirstFace = 0;
         for (UInt n = 0; n < m_numFacesNodes[firstFace]; ++n)
         {
-            if (m_facesEdges[firstFace][n] == firstEdge)
+            if (FaceEdges(firstFace)[n] == firstEdge)
             {
                 firstEdgeIndexInFirstFace = n;
                 break;
@@ -1499,7 +1629,7 @@ std::vector<meshkernel::UInt> Mesh2D::SortedFacesAroundNode(UInt node) const
         // check if previous edge in firstFace is secondEdge (so at least two edges share the same edge)
         auto const secondEdgeindexInFirstFace = NextCircularBackwardIndex(firstEdgeIndexInFirstFace, m_numFacesNodes[firstFace]);
 
-        if (m_facesEdges[firstFace][secondEdgeindexInFirstFace] == secondEdge)
+        if (FaceEdges(firstFace)[secondEdgeindexInFirstFace] == secondEdge)
         {
             result.emplace_back(firstFace);
         }
@@ -1663,7 +1793,7 @@ std::vector<bool> Mesh2D::FilterBasedOnMetric(Location location,
         UInt numEdgesFiltered = 0;
         for (UInt e = 0; e < numFaceEdges; ++e)
         {
-            const auto edge = m_facesEdges[f][e];
+            const auto edge = FaceEdges(f)[e];
             const double metricValue = metricValues[edge];
             if (metricValue < minValue || metricValue > maxValue)
             {
@@ -1716,7 +1846,7 @@ std::vector<bool> Mesh2D::FindFacesEntirelyInsidePolygon(const std::vector<bool>
     {
         for (UInt n = 0; n < GetNumFaceEdges(f); ++n)
         {
-            const auto nodeIndex = m_facesNodes[f][n];
+            const auto nodeIndex = FaceNodes(f)[n];
             if (!isNodeInsidePolygon[nodeIndex])
             {
                 isFaceCompletlyIncludedInPolygon[f] = false;
@@ -1844,12 +1974,12 @@ void Mesh2D::AppendCellPolygon(const UInt faceId)
 
     for (UInt i = 0; i < m_numFacesNodes[faceId]; ++i)
     {
-        m_invalidCellPolygons[pointIndex] = m_nodes[m_facesNodes[faceId][i]];
+        m_invalidCellPolygons[pointIndex] = m_nodes[FaceNodes(faceId)[i]];
         ++pointIndex;
     }
 
     // Close the polygon
-    m_invalidCellPolygons[pointIndex] = m_nodes[m_facesNodes[faceId][0]];
+    m_invalidCellPolygons[pointIndex] = m_nodes[FaceNodes(faceId)[0]];
 }
 
 void Mesh2D::DeleteMeshHoles(CompoundUndoAction* undoAction)
@@ -2011,6 +2141,8 @@ std::unique_ptr<meshkernel::UndoAction> Mesh2D::UpdateFaceInformation(const std:
         m_faceArea.erase(m_faceArea.begin() + faceId);
     }
 
+    CompressConnectivity();
+
     ReconstructInvalidCellsPolygon();
 
     return deleteMeshAction;
@@ -2170,37 +2302,10 @@ std::unique_ptr<meshkernel::UndoAction> Mesh2D::DeleteHangingEdges()
     return deleteAction;
 }
 
-std::vector<meshkernel::UInt> Mesh2D::PointFaceIndices(const std::vector<Point>& points)
+std::vector<meshkernel::UInt> Mesh2D::PointFaceIndices(const std::vector<Point>& points) const
 {
-    const auto numPoints = static_cast<UInt>(points.size());
-    std::vector<UInt> result;
-    result.resize(numPoints, constants::missing::uintValue);
-    std::vector<Point> polygonNodesCache;
-    BuildTree(Location::Edges);
-
-    for (UInt i = 0; i < numPoints; ++i)
-    {
-        const auto edgeIndex = FindLocationIndex(points[i], Location::Edges);
-
-        if (edgeIndex == constants::missing::uintValue)
-        {
-            result[i] = constants::missing::uintValue;
-            continue;
-        }
-
-        for (UInt e = 0; e < m_edgesNumFaces[edgeIndex]; ++e)
-        {
-            const auto faceIndex = m_edgesFaces[edgeIndex][e];
-            ComputeFaceClosedPolygon(faceIndex, polygonNodesCache);
-            const auto isPointInFace = IsPointInPolygonNodes(points[i], polygonNodesCache, m_projection);
-            if (isPointInFace)
-            {
-                result[i] = faceIndex;
-                break;
-            }
-        }
-    }
-    return result;
+    const Mesh2DPointLocator pointLocator(*this);
+    return pointLocator.FindFaces(points);
 }
 
 std::tuple<meshkernel::UInt, meshkernel::UInt> Mesh2D::IsSegmentCrossingABoundaryEdge(const Point& firstPoint,
@@ -2299,7 +2404,7 @@ void Mesh2D::RemoveIntersected(const std::vector<int>& edgeMask,
 
         for (UInt n = 0; n < GetNumFaceEdges(f); ++n)
         {
-            const auto edgeIndex = m_facesEdges[f][n];
+            const auto edgeIndex = FaceEdges(f)[n];
 
             if (edgeIndex != constants::missing::uintValue && edgeMask[edgeIndex] == 0)
             {
@@ -2312,7 +2417,7 @@ void Mesh2D::RemoveIntersected(const std::vector<int>& edgeMask,
         {
             for (UInt n = 0; n < GetNumFaceEdges(f); ++n)
             {
-                const auto edgeIndex = m_facesEdges[f][n];
+                const auto edgeIndex = FaceEdges(f)[n];
 
                 if (edgeIndex != constants::missing::uintValue)
                 {
@@ -2434,7 +2539,7 @@ meshkernel::UInt Mesh2D::FindOppositeEdge(const UInt faceId, const UInt edgeId)
     // Find the corresponding position of edge
     for (UInt i = 0; i < m_numFacesNodes[faceId]; ++i)
     {
-        if (m_facesEdges[faceId][i] == edgeId)
+        if (FaceEdges(faceId)[i] == edgeId)
         {
             position = i;
             break;
@@ -2463,7 +2568,7 @@ meshkernel::UInt Mesh2D::FindOppositeEdge(const UInt faceId, const UInt edgeId)
 
     if (opposite != constants::missing::uintValue)
     {
-        return m_facesEdges[faceId][opposite];
+        return FaceEdges(faceId)[opposite];
     }
 
     return constants::missing::uintValue;
@@ -2536,27 +2641,29 @@ std::unique_ptr<Mesh2D> Mesh2D::Merge(const Mesh2D& mesh1, const Mesh2D& mesh2)
 
     //--------------------------------
 
-    // Merge node-edge arrays
-    mergedMesh.m_nodesEdges.insert(mergedMesh.m_nodesEdges.end(), mesh2.m_nodesEdges.begin(), mesh2.m_nodesEdges.end());
-
-    for (UInt i = 0; i < mesh2.m_nodesEdges.size(); ++i)
+    // Merge node-edge arrays, mesh2 may store its connectivity in compressed format
+    for (UInt i = 0; i < mesh2.m_nodesNumEdges.size(); ++i)
     {
-        for (UInt j = 0; j < mesh2.m_nodesEdges[i].size(); ++j)
+        const auto nodeEdges = mesh2.NodeEdges(i);
+        auto& mergedNodeEdges = mergedMesh.m_nodesEdges.emplace_back(nodeEdges.begin(), nodeEdges.end());
+
+        for (auto& edge : mergedNodeEdges)
         {
-            IncrementValidValue(mergedMesh.m_nodesEdges[i + mesh1NodeOffset][j], mesh1EdgeOffset);
+            IncrementValidValue(edge, mesh1EdgeOffset);
         }
     }
 
     //--------------------------------
 
     // Merge face-node arrays
-    mergedMesh.m_facesNodes.insert(mergedMesh.m_facesNodes.end(), mesh2.m_facesNodes.begin(), mesh2.m_facesNodes.end());
-
-    for (UInt i = 0; i < mesh2.m_facesNodes.size(); ++i)
+    for (UInt i = 0; i < mesh2.GetNumFaces(); ++i)
     {
-        for (UInt j = 0; j < mesh2.m_facesNodes[i].size(); ++j)
+        const auto faceNodes = mesh2.FaceNodes(i);
+        auto& mergedFaceNodes = mergedMesh.m_facesNodes.emplace_back(faceNodes.begin(), faceNodes.end());
+
+        for (auto& node : mergedFaceNodes)
         {
-            IncrementValidValue(mergedMesh.m_facesNodes[i + mesh1FaceOffset][j], mesh1NodeOffset);
+            IncrementValidValue(node, mesh1NodeOffset);
         }
     }
 
@@ -2574,13 +2681,14 @@ std::unique_ptr<Mesh2D> Mesh2D::Merge(const Mesh2D& mesh1, const Mesh2D& mesh2)
     //--------------------------------
 
     // Merge face-edge arrays
-    mergedMesh.m_facesEdges.insert(mergedMesh.m_facesEdges.end(), mesh2.m_facesEdges.begin(), mesh2.m_facesEdges.end());
-
-    for (UInt i = 0; i < mesh2.m_facesEdges.size(); ++i)
+    for (UInt i = 0; i < mesh2.GetNumFaces(); ++i)
     {
-        for (UInt j = 0; j < mesh2.m_facesEdges[i].size(); ++j)
+        const auto faceEdges = mesh2.FaceEdges(i);
+        auto& mergedFaceEdges = mergedMesh.m_facesEdges.emplace_back(faceEdges.begin(), faceEdges.end());
+
+        for (auto& edge : mergedFaceEdges)
         {
-            IncrementValidValue(mergedMesh.m_facesEdges[i + mesh1FaceOffset][j], mesh1EdgeOffset);
+            IncrementValidValue(edge, mesh1EdgeOffset);
         }
     }
 
@@ -2698,7 +2806,7 @@ void Mesh2D::FindFacesConnectedToNode(UInt nodeIndex, std::vector<UInt>& sharedF
     UInt newFaceIndex = constants::missing::uintValue;
     for (UInt e = 0; e < m_nodesNumEdges[nodeIndex]; e++)
     {
-        const auto firstEdge = m_nodesEdges[nodeIndex][e];
+        const auto firstEdge = NodeEdges(nodeIndex)[e];
 
         UInt secondEdgeIndex = e + 1;
         if (secondEdgeIndex >= m_nodesNumEdges[nodeIndex])
@@ -2706,7 +2814,7 @@ void Mesh2D::FindFacesConnectedToNode(UInt nodeIndex, std::vector<UInt>& sharedF
             secondEdgeIndex = 0;
         }
 
-        const auto secondEdge = m_nodesEdges[nodeIndex][secondEdgeIndex];
+        const auto secondEdge = NodeEdges(nodeIndex)[secondEdgeIndex];
         if (m_edgesNumFaces[firstEdge] == 0 || m_edgesNumFaces[secondEdge] == 0)
         {
             continue;
@@ -2754,7 +2862,7 @@ void Mesh2D::GetConnectingNodes(UInt nodeIndex, std::vector<UInt>& connectedNode
     // edge connected nodes
     for (UInt e = 0; e < m_nodesNumEdges[nodeIndex]; e++)
     {
-        const auto edgeIndex = m_nodesEdges[nodeIndex][e];
+        const auto edgeIndex = NodeEdges(nodeIndex)[e];
         const auto node = OtherNodeOfEdge(m_edges[edgeIndex], nodeIndex);
         connectedNodes.emplace_back(node);
     }
@@ -2796,7 +2904,7 @@ void Mesh2D::FindNodesSharedByFaces(UInt nodeIndex, const std::vector<UInt>& sha
                 faceNodeIndex -= numFaceNodes;
             }
 
-            const auto node = m_facesNodes[faceIndex][faceNodeIndex];
+            const auto node = FaceNodes(faceIndex)[faceNodeIndex];
 
             bool isNewNode = true;
 
@@ -2846,9 +2954,9 @@ meshkernel::UInt Mesh2D::IsLeftOrRight(const UInt elementId, const UInt edgeId)
     UInt nextEdgeIndex = constants::missing::uintValue;
     UInt endNodeIndex = m_edges[edgeId].second;
 
-    for (UInt i = 0; i < m_facesEdges[elementId].size(); ++i)
+    for (UInt i = 0; i < FaceEdges(elementId).size(); ++i)
     {
-        UInt faceEdgeId = m_facesEdges[elementId][i];
+        UInt faceEdgeId = FaceEdges(elementId)[i];
 
         if (faceEdgeId == edgeId)
         {
@@ -57,7 +57,7 @@ void meshkernel::algo::Mesh2DFaceBounds::ComputeBoundsForFace(const Mesh& mesh,
 
         for (UInt i = 0; i < numNodes; ++i)
         {
-            faceBounds[i] = mesh.Node(mesh.m_facesNodes[faceId][i]);
+            faceBounds[i] = mesh.Node(mesh.FaceNodes(faceId)[i]);
         }
 
         for (UInt i = numNodes; i < constants::geometric::maximumNumberOfNodesPerFace; ++i)
@@ -212,9 +212,9 @@ void Mesh2DIntersections::IntersectFaceEdges(const std::vector<Point>& polyLine,
                                              std::vector<bool>& vistedFace,
                                              std::queue<std::array<UInt, 2>>& crossingEdges)
 {
-    for (UInt e = 0; e < m_mesh.m_facesEdges[currentFaceIndex].size(); ++e)
+    for (UInt e = 0; e < m_mesh.FaceEdges(currentFaceIndex).size(); ++e)
     {
-        const auto edgeIndex = m_mesh.m_facesEdges[currentFaceIndex][e];
+        const auto edgeIndex = m_mesh.FaceEdges(currentFaceIndex)[e];
         if (vistedEdges[edgeIndex] && vistedFace[currentFaceIndex])
         {
             continue;
@@ -0,0 +1,270 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include "MeshKernel/Mesh2DPointLocator.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "MeshKernel/Constants.hpp"
+#include "MeshKernel/Mesh2D.hpp"
+#include "MeshKernel/Operations.hpp"
+#include "MeshKernel/Utilities/NumericFunctions.hpp"
+
+meshkernel::Mesh2DPointLocator::Mesh2DPointLocator(const Mesh2D& mesh)
+    : m_mesh(mesh),
+      m_isSphericalAccurate(mesh.m_projection == Projection::sphericalAccurate)
+{
+    // the faces with less than three nodes keep an empty box, and are not indexed
+    const auto numFaces = mesh.GetNumFaces();
+    std::vector<BoundingBox> faceBoxes(numFaces, CreateNonOverlappingBoundingBox());
+
+#pragma omp parallel for
+    for (int f = 0; f < static_cast<int>(numFaces); ++f)
+    {
+        const auto faceNodes = mesh.FaceNodes(static_cast<UInt>(f));
+        if (faceNodes.size() < constants::geometric::numNodesInTriangle)
+        {
+            continue;
+        }
+
+        auto& faceBox = faceBoxes[f];
+        for (const auto n : faceNodes)
+        {
+            const auto& node = mesh.Node(n);
+            faceBox = Merge(faceBox, BoundingBox(node, node));
+        }
+    }
+
+    m_tree = PackedBoxTree(std::move(faceBoxes));
+}
+
+meshkernel::Mesh2DPointLocator::Containment meshkernel::Mesh2DPointLocator::Classify(const Point& point, UInt face) const
+{
+    if (!m_tree.ItemBox(face).Contains(point))
+    {
+        return Containment::Outside;
+    }
+
+    const auto faceNodes = m_mesh.FaceNodes(face);
+    const auto numNodes = static_cast<UInt>(faceNodes.size());
+
+    if (m_isSphericalAccurate)
+    {
+        std::vector<Point> polygonNodes;
+        polygonNodes.reserve(numNodes + 1);
+        for (const auto n : faceNodes)
+        {
+            polygonNodes.emplace_back(m_mesh.Node(n));
+        }
+        polygonNodes.emplace_back(polygonNodes.front());
+        return IsPointInPolygonNodes(point, polygonNodes, m_mesh.m_projection) ? Containment::Inside : Containment::Outside;
+    }
+
+    // winding number, as in IsPointInPolygonNodes, but only points on the edges themselves are on the boundary
+    int windingNumber = 0;
+    for (UInt i = 0; i < numNodes; ++i)
+    {
+        const auto& firstNode = m_mesh.Node(faceNodes[i]);
+        const auto& secondNode = m_mesh.Node(faceNodes[NextCircularForwardIndex(i, numNodes)]);
+
+        const auto crossProductValue = crossProduct(firstNode, secondNode, firstNode, point, Projection::cartesian);
+
+        if (IsEqual(crossProductValue, 0.0))
+        {
+            if (BoundingBox::CreateBoundingBox(firstNode, secondNode).Contains(point))
+            {
+                return Containment::OnBoundary;
+            }
+            continue;
+        }
+
+        if (firstNode.y <= point.y)
+        {
+            if (secondNode.y > point.y && crossProductValue > 0.0)
+            {
+                ++windingNumber;
+            }
+        }
+        else if (secondNode.y <= point.y && crossProductValue < 0.0)
+        {
+            --windingNumber;
+        }
+    }
+
+    return windingNumber != 0 ? Containment::Inside : Containment::Outside;
+}
+
+meshkernel::UInt meshkernel::Mesh2DPointLocator::Search(const Point& point) const
+{
+    UInt result = constants::missing::uintValue;
+
+    m_tree.Search(BoundingBox(point, point), [&](UInt face)
+                  {
+                      const auto containment = Classify(point, face);
+                      if (containment == Containment::Inside)
+                      {
+                          result = face;
+                          return false;
+                      }
+                      if (containment == Containment::OnBoundary && (result == constants::missing::uintValue || face < result))
+                      {
+                          result = face;
+                      }
+                      return true; });
+
+    return result;
+}
+
+bool meshkernel::Mesh2DPointLocator::IsWithinWalkExtent(const Point& point, UInt startFace) const
+{
+    if (m_isSphericalAccurate || startFace >= m_tree.NumberOfItems())
+    {
+        return false;
+    }
+
+    const auto& faceBox = m_tree.ItemBox(startFace);
+    const double deltaX = WalkExtent * faceBox.Width();
+    const double deltaY = WalkExtent * faceBox.Height();
+
+    // the box of an invalid face has a negative size
+    return deltaX >= 0.0 &&
+           point.x >= faceBox.lowerLeft().x - deltaX && point.x <= faceBox.upperRight().x + deltaX &&
+           point.y >= faceBox.lowerLeft().y - deltaY && point.y <= faceBox.upperRight().y + deltaY;
+}
+
+meshkernel::UInt meshkernel::Mesh2DPointLocator::Walk(const Point& point, UInt startFace) const
+{
+    auto face = startFace;
+    UInt previousFace = constants::missing::uintValue;
+
+    for (UInt step = 0; step < MaximumWalkSteps; ++step)
+    {
+        const auto containment = Classify(point, face);
+        if (containment == Containment::Inside)
+        {
+            return face;
+        }
+        if (containment == Containment::OnBoundary)
+        {
+            // the lowest face index is found by the hierarchy
+            return constants::missing::uintValue;
+        }
+
+        // cross the first edge, other than the one just crossed, with the point on its outer side
+        const auto faceNodes = m_mesh.FaceNodes(face);
+        const auto faceEdges = m_mesh.FaceEdges(face);
+        const auto numNodes = static_cast<UInt>(faceNodes.size());
+
+        UInt nextFace = constants::missing::uintValue;
+        for (UInt j = 0; j < numNodes; ++j)
+        {
+            // start from a different edge at each step, to avoid cycling
+            const auto i = (j + step) % numNodes;
+            const auto& firstNode = m_mesh.Node(faceNodes[i]);
+            const auto& secondNode = m_mesh.Node(faceNodes[NextCircularForwardIndex(i, numNodes)]);
+            if (crossProduct(firstNode, secondNode, firstNode, point, Projection::cartesian) >= 0.0)
+            {
+                continue;
+            }
+
+            const auto edge = faceEdges[i];
+            if (m_mesh.GetNumEdgesFaces(edge) < 2)
+            {
+                // the point is beyond the mesh boundary, or the boundary is not convex
+                return constants::missing::uintValue;
+            }
+
+            const auto otherFace = m_mesh.m_edgesFaces[edge][0] == face ? m_mesh.m_edgesFaces[edge][1] : m_mesh.m_edgesFaces[edge][0];
+            if (otherFace != previousFace)
+            {
+                nextFace = otherFace;
+                break;
+            }
+        }
+
+        if (nextFace == constants::missing::uintValue)
+        {
+            return constants::missing::uintValue;
+        }
+
+        previousFace = face;
+        face = nextFace;
+    }
+
+    return constants::missing::uintValue;
+}
+
+meshkernel::UInt meshkernel::Mesh2DPointLocator::FindFace(const Point& point) const
+{
+    return Search(point);
+}
+
+meshkernel::UInt meshkernel::Mesh2DPointLocator::FindFace(const Point& point, UInt startFace) const
+{
+    if (IsWithinWalkExtent(point, startFace))
+    {
+        if (const auto face = Walk(point, startFace); face != constants::missing::uintValue)
+        {
+            return face;
+        }
+    }
+
+    return Search(point);
+}
+
+std::vector<meshkernel::UInt> meshkernel::Mesh2DPointLocator::FindFaces(std::span<const Point> points) const
+{
+    const auto numPoints = static_cast<UInt>(points.size());
+    std::vector<UInt> result(numPoints, constants::missing::uintValue);
+
+    const auto numChunks = static_cast<int>((numPoints + ChunkSize - 1) / ChunkSize);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int c = 0; c < numChunks; ++c)
+    {
+        const auto begin = static_cast<UInt>(c) * ChunkSize;
+        const auto end = std::min(begin + ChunkSize, numPoints);
+
+        UInt previousFace = constants::missing::uintValue;
+        for (auto i = begin; i < end; ++i)
+        {
+            if (!points[i].IsValid())
+            {
+                continue;
+            }
+
+            result[i] = FindFace(points[i], previousFace);
+            if (result[i] != constants::missing::uintValue)
+            {
+                previousFace = result[i];
+            }
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,437 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include "MeshKernel/Exceptions.hpp"
+#include "MeshKernel/Mesh2D.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <span>
+#include <type_traits>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+using meshkernel::Mesh2D;
+
+namespace
+{
+    using meshkernel::UInt;
+
+    /// @brief The header of a snapshot file
+    struct SnapshotHeader
+    {
+        char magic[8];             ///< The characters identifying a snapshot file
+        std::uint32_t version;     ///< The version of the format
+        std::uint32_t byteOrder;   ///< ByteOrderMark, as written by the machine writing the file
+        std::int32_t projection;   ///< The projection
+        std::uint32_t reserved;    ///< Unused, zero
+        std::uint64_t numNodes;    ///< The number of nodes
+        std::uint64_t numEdges;    ///< The number of edges
+        std::uint64_t numFaces;    ///< The number of faces
+        std::uint64_t payloadSize; ///< The size in bytes of the arrays following the header
+        std::uint64_t checksum;    ///< The checksum of the arrays
+    };
+
+    static_assert(sizeof(SnapshotHeader) == 64, "The snapshot header must not be padded");
+
+    constexpr char SnapshotMagic[8] = {'M', 'K', 'M', 'E', 'S', 'H', '2', 'D'};
+    constexpr std::uint32_t ByteOrderMark = 0x01020304;
+    constexpr std::size_t Alignment = sizeof(std::uint64_t);
+
+    /// @brief Computes a 64 bit FNV-1a hash, by words of 8 bytes, of consecutive blocks of data
+    class Checksum
+    {
+    public:
+        /// @brief Adds a block of data, of a size multiple of 8 bytes
+        void Add(const char* data, std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; i += sizeof(std::uint64_t))
+            {
+                std::uint64_t word;
+                std::memcpy(&word, data + i, sizeof(word));
+                m_hash = (m_hash ^ word) * Prime;
+            }
+        }
+
+        /// @brief Gets the hash of the data added
+        [[nodiscard]] std::uint64_t Value() const { return m_hash; }
+
+    private:
+        static constexpr std::uint64_t Prime = 1099511628211ULL; ///< The FNV prime
+        std::uint64_t m_hash = 14695981039346656037ULL;          ///< The FNV offset basis, then the hash
+    };
+
+    /// @brief Gets the size of an array of bytes padded to the alignment
+    std::size_t PaddedSize(std::size_t size)
+    {
+        return (size + Alignment - 1) / Alignment * Alignment;
+    }
+
+    /// @brief Writes the arrays of a snapshot, each preceded by its size and padded to the alignment
+    class SnapshotWriter
+    {
+    public:
+        /// @brief Constructor
+        explicit SnapshotWriter(std::ofstream& file) : m_file(file) {}
+
+        /// @brief Writes an array
+        template <class T>
+        void Write(std::span<const T> values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            const std::uint64_t size = values.size();
+            Append(reinterpret_cast<const char*>(&size), sizeof(size));
+            Append(reinterpret_cast<const char*>(values.data()), values.size_bytes());
+        }
+
+        /// @brief Writes a table in compressed sparse row format
+        /// @param[in] numRows The number of rows
+        /// @param[in] row     The function returning the values of a row
+        template <class Row>
+        void Write(UInt numRows, Row row)
+        {
+            std::vector<UInt> offsets(numRows + 1, 0);
+            for (UInt r = 0; r < numRows; ++r)
+            {
+                offsets[r + 1] = offsets[r] + static_cast<UInt>(row(r).size());
+            }
+
+            std::vector<UInt> values;
+            values.reserve(offsets.back());
+            for (UInt r = 0; r < numRows; ++r)
+            {
+                const auto rowValues = row(r);
+                values.insert(values.end(), rowValues.begin(), rowValues.end());
+            }
+
+            Write(std::span<const UInt>(offsets));
+            Write(std::span<const UInt>(values));
+        }
+
+        /// @brief Gets the number of bytes written
+        [[nodiscard]] std::uint64_t Size() const { return m_size; }
+
+        /// @brief Gets the checksum of the bytes written
+        [[nodiscard]] std::uint64_t Checksum() const { return m_checksum.Value(); }
+
+    private:
+        /// @brief Appends bytes, padded to the alignment
+        void Append(const char* data, std::size_t size)
+        {
+            m_buffer.assign(data, data + size);
+            m_buffer.resize(PaddedSize(size), 0);
+            m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+            m_checksum.Add(m_buffer.data(), m_buffer.size());
+            m_size += m_buffer.size();
+        }
+
+        std::ofstream& m_file;      ///< The snapshot file
+        std::vector<char> m_buffer; ///< The padded bytes being written
+        ::Checksum m_checksum;      ///< The checksum of the bytes written
+        std::uint64_t m_size = 0;   ///< The number of bytes written
+    };
+
+    /// @brief Reads the arrays of a snapshot written by SnapshotWriter
+    class SnapshotReader
+    {
+    public:
+        /// @brief Constructor
+        SnapshotReader(const char* data, std::size_t size) : m_data(data), m_size(size) {}
+
+        /// @brief Reads an array
+        template <class T>
+        void Read(std::vector<T>& values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+
+            std::uint64_t size;
+            std::memcpy(&size, Advance(sizeof(size)), sizeof(size));
+
+            if (size > (m_size - m_position) / sizeof(T))
+            {
+                throw meshkernel::MeshKernelError("Mesh2D::ReadSnapshot: The snapshot is truncated.");
+            }
+
+            values.resize(size);
+            std::memcpy(values.data(), Advance(size * sizeof(T)), size * sizeof(T));
+        }
+
+        /// @brief Reads a nested vector written in compressed sparse row format
+        /// @param[out] rows     The nested vector
+        /// @param[in]  maxValue The values must be lower than maxValue
+        void Read(std::vector<std::vector<UInt>>& rows, std::uint64_t maxValue)
+        {
+            Read(m_offsets);
+            Read(m_values);
+
+            if (m_offsets.empty() || m_offsets.front() != 0 || m_offsets.back() != m_values.size() ||
+                !std::ranges::is_sorted(m_offsets))
+            {
+                throw meshkernel::MeshKernelError("Mesh2D::ReadSnapshot: The snapshot has inconsistent connectivity offsets.");
+            }
+            CheckIndices(m_values, maxValue);
+
+            rows.resize(m_offsets.size() - 1);
+            for (UInt r = 0; r < rows.size(); ++r)
+            {
+                rows[r].assign(m_values.begin() + m_offsets[r], m_values.begin() + m_offsets[r + 1]);
+            }
+        }
+
+        /// @brief Checks that all valid indices are lower than a maximum
+        static void CheckIndices(std::span<const UInt> indices, std::uint64_t maxValue)
+        {
+            if (std::ranges::any_of(indices, [maxValue](UInt index)
+                                    { return index != meshkernel::constants::missing::uintValue && index >= maxValue; }))
+            {
+                throw meshkernel::MeshKernelError("Mesh2D::ReadSnapshot: The snapshot has out of range connectivity indices.");
+            }
+        }
+
+        /// @brief Determines if all bytes have been read
+        [[nodiscard]] bool AtEnd() const { return m_position == m_size; }
+
+    private:
+        /// @brief Gets the current position and advances it by a padded number of bytes
+        const char* Advance(std::size_t size)
+        {
+            const auto paddedSize = PaddedSize(size);
+            if (paddedSize > m_size - m_position)
+            {
+                throw meshkernel::MeshKernelError("Mesh2D::ReadSnapshot: The snapshot is truncated.");
+            }
+
+            const char* data = m_data + m_position;
+            m_position += paddedSize;
+            return data;
+        }
+
+        const char* m_data;          ///< The arrays of the snapshot
+        std::size_t m_size;          ///< The size of the arrays in bytes
+        std::size_t m_position = 0;  ///< The position of the next array
+        std::vector<UInt> m_offsets; ///< The offsets of the nested vector being read
+        std::vector<UInt> m_values;  ///< The values of the nested vector being read
+    };
+
+    /// @brief Checks that the size of an array equals the expected size
+    void CheckSize(std::size_t size, std::uint64_t expectedSize, const char* name)
+    {
+        if (size != expectedSize)
+        {
+            throw meshkernel::MeshKernelError("Mesh2D::ReadSnapshot: The snapshot has {} {}, {} expected.", size, name, expectedSize);
+        }
+    }
+
+} // namespace
+
+void Mesh2D::WriteSnapshot(const std::string& fileName)
+{
+    Administrate();
+
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw MeshKernelError("Mesh2D::WriteSnapshot: Cannot open the snapshot file {}.", fileName);
+    }
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, SnapshotMagic, sizeof(SnapshotMagic));
+    header.version = SnapshotVersion;
+    header.byteOrder = ByteOrderMark;
+    header.projection = static_cast<std::int32_t>(m_projection);
+    header.numNodes = GetNumNodes();
+    header.numEdges = GetNumEdges();
+    header.numFaces = GetNumFaces();
+
+    // The header is written again at the end, with the size and the checksum of the arrays
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::vector<UInt> edges(2 * m_edges.size());
+    for (UInt e = 0; e < m_edges.size(); ++e)
+    {
+        edges[2 * e] = m_edges[e].first;
+        edges[2 * e + 1] = m_edges[e].second;
+    }
+
+    SnapshotWriter writer(file);
+    writer.Write(std::span<const Point>(m_nodes));
+    writer.Write(std::span<const UInt>(edges));
+    // the connectivity is read with the views, the nested vectors are released when it is compressed
+    writer.Write(static_cast<UInt>(m_nodesNumEdges.size()), [this](UInt n)
+                 { return NodeEdges(n); });
+    writer.Write(std::span<const std::uint8_t>(m_nodesNumEdges));
+    writer.Write(std::span<const std::array<UInt, 2>>(m_edgesFaces));
+    writer.Write(std::span<const std::uint8_t>(m_edgesNumFaces));
+    writer.Write(GetNumFaces(), [this](UInt f)
+                 { return FaceNodes(f); });
+    writer.Write(std::span<const std::uint8_t>(m_numFacesNodes));
+    writer.Write(GetNumFaces(), [this](UInt f)
+                 { return FaceEdges(f); });
+    writer.Write(std::span<const Point>(m_facesMassCenters));
+    writer.Write(std::span<const double>(m_faceArea));
+    writer.Write(std::span<const MeshNodeType>(m_nodesTypes));
+    writer.Write(std::span<const Point>(m_invalidCellPolygons));
+
+    header.payloadSize = writer.Size();
+    header.checksum = writer.Checksum();
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    if (!file)
+    {
+        throw MeshKernelError("Mesh2D::WriteSnapshot: Cannot write the snapshot file {}.", fileName);
+    }
+}
+
+std::unique_ptr<Mesh2D> Mesh2D::ReadSnapshot(const std::string& fileName)
+{
+    boost::interprocess::file_mapping file;
+    boost::interprocess::mapped_region region;
+
+    try
+    {
+        file = boost::interprocess::file_mapping(fileName.c_str(), boost::interprocess::read_only);
+        region = boost::interprocess::mapped_region(file, boost::interprocess::read_only);
+    }
+    catch (const boost::interprocess::interprocess_exception& exception)
+    {
+        throw MeshKernelError("Mesh2D::ReadSnapshot: Cannot map the snapshot file {}: {}", fileName, exception.what());
+    }
+
+    const auto* data = static_cast<const char*>(region.get_address());
+
+    SnapshotHeader header{};
+    if (region.get_size() < sizeof(header))
+    {
+        throw MeshKernelError("Mesh2D::ReadSnapshot: The file {} is not a mesh snapshot.", fileName);
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, SnapshotMagic, sizeof(SnapshotMagic)) != 0)
+    {
+        throw MeshKernelError("Mesh2D::ReadSnapshot: The file {} is not a mesh snapshot.", fileName);
+    }
+    if (header.version != SnapshotVersion)
+    {
+        throw MeshKernelError("Mesh2D::ReadSnapshot: The snapshot {} has version {}, only version {} is supported.", fileName, header.version, SnapshotVersion);
+    }
+    if (header.byteOrder != ByteOrderMark)
+    {
+        throw MeshKernelError("Mesh2D::ReadSnapshot: The snapshot {} was written with a different byte order.", fileName);
+    }
+    if (header.payloadSize != region.get_size() - sizeof(header))
+    {
+        throw MeshKernelError("Mesh2D::ReadSnapshot: The size of the snapshot {} does not match its header.", fileName);
+    }
+
+    const char* payload = data + sizeof(header);
+    ::Checksum checksum;
+    checksum.Add(payload, header.payloadSize);
+    if (checksum.Value() != header.checksum)
+    {
+        throw MeshKernelError("Mesh2D::ReadSnapshot: The checksum of the snapshot {} does not match, the file is corrupted.", fileName);
+    }
+
+    if (const auto& validProjections = meshkernel::GetValidProjections();
+        std::ranges::find(validProjections, header.projection) == validProjections.end())
+    {
+        throw MeshKernelError("Mesh2D::ReadSnapshot: The snapshot {} has an invalid projection {}.", fileName, header.projection);
+    }
+
+    auto mesh = std::make_unique<Mesh2D>(static_cast<Projection>(header.projection));
+
+    {
+        std::vector<UInt> edges;
+        SnapshotReader reader(payload, header.payloadSize);
+
+        reader.Read(mesh->m_nodes);
+        reader.Read(edges);
+        reader.Read(mesh->m_nodesEdges, header.numEdges);
+        reader.Read(mesh->m_nodesNumEdges);
+        reader.Read(mesh->m_edgesFaces);
+        reader.Read(mesh->m_edgesNumFaces);
+        reader.Read(mesh->m_facesNodes, header.numNodes);
+        reader.Read(mesh->m_numFacesNodes);
+        reader.Read(mesh->m_facesEdges, header.numEdges);
+        reader.Read(mesh->m_facesMassCenters);
+        reader.Read(mesh->m_faceArea);
+        reader.Read(mesh->m_nodesTypes);
+        reader.Read(mesh->m_invalidCellPolygons);
+
+        if (!reader.AtEnd())
+        {
+            throw MeshKernelError("Mesh2D::ReadSnapshot: The snapshot {} has unexpected trailing data.", fileName);
+        }
+
+        CheckSize(mesh->m_nodes.size(), header.numNodes, "nodes");
+        CheckSize(edges.size(), 2 * header.numEdges, "edge nodes");
+        CheckSize(mesh->m_nodesEdges.size(), header.numNodes, "node edges");
+        CheckSize(mesh->m_nodesNumEdges.size(), header.numNodes, "node edge counts");
+        CheckSize(mesh->m_edgesFaces.size(), header.numEdges, "edge faces");
+        CheckSize(mesh->m_edgesNumFaces.size(), header.numEdges, "edge face counts");
+        CheckSize(mesh->m_nodesTypes.size(), header.numNodes, "node types");
+        CheckSize(mesh->m_facesNodes.size(), header.numFaces, "faces");
+        CheckSize(mesh->m_numFacesNodes.size(), header.numFaces, "face node counts");
+        CheckSize(mesh->m_facesEdges.size(), header.numFaces, "face edges");
+        CheckSize(mesh->m_facesMassCenters.size(), header.numFaces, "face mass centers");
+        CheckSize(mesh->m_faceArea.size(), header.numFaces, "face areas");
+        SnapshotReader::CheckIndices(edges, header.numNodes);
+        for (const auto& edgeFaces : mesh->m_edgesFaces)
+        {
+            SnapshotReader::CheckIndices(edgeFaces, header.numFaces);
+        }
+        for (UInt n = 0; n < mesh->m_nodesEdges.size(); ++n)
+        {
+            if (mesh->m_nodesNumEdges[n] > mesh->m_nodesEdges[n].size())
+            {
+                throw MeshKernelError("Mesh2D::ReadSnapshot: The snapshot {} has inconsistent node edge counts.", fileName);
+            }
+        }
+        for (UInt f = 0; f < mesh->m_facesNodes.size(); ++f)
+        {
+            if (mesh->m_numFacesNodes[f] > mesh->m_facesNodes[f].size() || mesh->m_numFacesNodes[f] > mesh->m_facesEdges[f].size())
+            {
+                throw MeshKernelError("Mesh2D::ReadSnapshot: The snapshot {} has inconsistent face node counts.", fileName);
+            }
+        }
+
+        mesh->m_edges.resize(header.numEdges);
+        for (UInt e = 0; e < mesh->m_edges.size(); ++e)
+        {
+            mesh->m_edges[e] = {edges[2 * e], edges[2 * e + 1]};
+        }
+    }
+
+    mesh->CompressConnectivity();
+    mesh->SetAdministrationRequired(false);
+
+    return mesh;
+}
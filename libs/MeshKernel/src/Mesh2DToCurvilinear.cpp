@@ -71,10 +71,10 @@ std::unique_ptr<CurvilinearGrid> Mesh2DToCurvilinear::Compute(const Point& point
     std::vector<Point> polygonPoints;
     for (UInt n = 0; n < geometric::numNodesInQuadrilateral; ++n)
     {
-        const auto node = m_mesh.m_facesNodes[initialFaceIndex][n];
+        const auto node = m_mesh.FaceNodes(initialFaceIndex)[n];
         polygonPoints.emplace_back(m_mesh.Node(node));
     }
-    const auto node = m_mesh.m_facesNodes[initialFaceIndex][0];
+    const auto node = m_mesh.FaceNodes(initialFaceIndex)[0];
     polygonPoints.emplace_back(m_mesh.Node(node));
 
     Polygon polygon(polygonPoints, m_mesh.m_projection);
@@ -88,10 +88,10 @@ std::unique_ptr<CurvilinearGrid> Mesh2DToCurvilinear::Compute(const Point& point
     m_i = std::vector(numNodes, missing::intValue);
     m_j = std::vector(numNodes, missing::intValue);
 
-    const auto firstEdge = m_mesh.m_facesEdges[initialFaceIndex][0];
-    const auto secondEdge = m_mesh.m_facesEdges[initialFaceIndex][1];
-    const auto thirdEdge = m_mesh.m_facesEdges[initialFaceIndex][2];
-    const auto fourthEdge = m_mesh.m_facesEdges[initialFaceIndex][3];
+    const auto firstEdge = m_mesh.FaceEdges(initialFaceIndex)[0];
+    const auto secondEdge = m_mesh.FaceEdges(initialFaceIndex)[1];
+    const auto thirdEdge = m_mesh.FaceEdges(initialFaceIndex)[2];
+    const auto fourthEdge = m_mesh.FaceEdges(initialFaceIndex)[3];
 
     m_mapping.resize(-3, -3, 3, 3);
 
@@ -154,7 +154,7 @@ std::unique_ptr<CurvilinearGrid> Mesh2DToCurvilinear::Compute(const Point& point
 
 Eigen::Matrix<UInt, 2, 2> Mesh2DToCurvilinear::ComputeLocalNodeMapping(UInt face) const
 {
-    const auto& faceIndices = m_mesh.m_facesNodes[face];
+    const auto faceIndices = m_mesh.FaceNodes(face);
 
     const auto node0 = faceIndices[0];
     const auto node1 = faceIndices[1];
@@ -227,7 +227,7 @@ UInt Mesh2DToCurvilinear::ComputeNeighbouringFaceNodes(const UInt face,
     int edgeIndexInNewFace = 0;
     for (UInt e = 0u; e < geometric::numNodesInQuadrilateral; ++e)
     {
-        if (m_mesh.m_facesEdges[newFace][e] == edgeIndex)
+        if (m_mesh.FaceEdges(newFace)[e] == edgeIndex)
         {
             edgeIndexInNewFace = static_cast<int>(e);
             break;
@@ -235,7 +235,7 @@ UInt Mesh2DToCurvilinear::ComputeNeighbouringFaceNodes(const UInt face,
     }
     auto nextEdgeIndexInNewFace = edgeIndexInNewFace + 1;
     nextEdgeIndexInNewFace = nextEdgeIndexInNewFace == geometric::numNodesInQuadrilateral ? 0 : nextEdgeIndexInNewFace;
-    const auto nextEdgeInNewFace = m_mesh.m_facesEdges[newFace][nextEdgeIndexInNewFace];
+    const auto nextEdgeInNewFace = m_mesh.FaceEdges(newFace)[nextEdgeIndexInNewFace];
     const auto firstCommonNode = m_mesh.FindCommonNode(edgeIndex, nextEdgeInNewFace);
     const auto firstOtherNode = OtherNodeOfEdge(m_mesh.GetEdge(nextEdgeInNewFace), firstCommonNode);
     const auto iFirstOtherNode = m_i[firstCommonNode] + m_directionsDeltas[d][0];
@@ -243,7 +243,7 @@ UInt Mesh2DToCurvilinear::ComputeNeighbouringFaceNodes(const UInt face,
 
     auto previousEdgeIndexInNewFace = edgeIndexInNewFace - 1;
     previousEdgeIndexInNewFace = previousEdgeIndexInNewFace == -1 ? geometric::numNodesInQuadrilateral - 1 : previousEdgeIndexInNewFace;
-    const auto previousEdgeInNewFace = m_mesh.m_facesEdges[newFace][previousEdgeIndexInNewFace];
+    const auto previousEdgeInNewFace = m_mesh.FaceEdges(newFace)[previousEdgeIndexInNewFace];
     const auto secondCommonNode = m_mesh.FindCommonNode(edgeIndex, previousEdgeInNewFace);
     const auto secondOtherNode = OtherNodeOfEdge(m_mesh.GetEdge(previousEdgeInNewFace), secondCommonNode);
     const auto iSecondCommonNode = m_i[secondCommonNode] + m_directionsDeltas[d][0];
@@ -310,9 +310,9 @@ bool Mesh2DToCurvilinear::IsConnectionValid(const UInt candidateNode, const int
 bool Mesh2DToCurvilinear::CheckGridLine(const UInt validNode, const UInt candidateNode) const
 {
     bool valid = false;
-    for (auto e = 0u; e < m_mesh.m_nodesEdges[candidateNode].size(); ++e)
+    for (auto e = 0u; e < m_mesh.NodeEdges(candidateNode).size(); ++e)
     {
-        const auto edgeIndex = m_mesh.m_nodesEdges[candidateNode][e];
+        const auto edgeIndex = m_mesh.NodeEdges(candidateNode)[e];
         const auto otherNode = OtherNodeOfEdge(m_mesh.GetEdge(edgeIndex), candidateNode);
 
         bool doCheck = m_mesh.GetNumFaceEdges(m_mesh.m_edgesFaces[edgeIndex][0]) == geometric::numNodesInQuadrilateral;
@@ -366,7 +366,7 @@ lin_alg::Matrix<Point> Mesh2DToCurvilinear::ComputeCurvilinearMatrix()
         {
             continue;
         }
-        for (const auto edge : m_mesh.m_facesEdges[f])
+        for (const auto edge : m_mesh.FaceEdges(f))
         {
             edgesToDelete[edge] = false;
         }
@@ -97,7 +97,7 @@ double meshkernel::algo::MaxLengthSurroundingEdges(const Mesh& mesh,
 
     for (UInt e = 0; e < mesh.m_nodesNumEdges[nodeId]; ++e)
     {
-        const auto edge = mesh.m_nodesEdges[nodeId][e];
+        const auto edge = mesh.NodeEdges(nodeId)[e];
         maxEdgeLength = std::max(maxEdgeLength, edgeLengths[edge]);
     }
 
@@ -231,7 +231,7 @@ void meshkernel::algo::ComputeFaceCircumcenters(const Mesh& mesh, std::span<Poin
 
         for (UInt n = 0; n < numberOfFaceNodes; ++n)
         {
-            if (!mesh.IsEdgeOnBoundary(mesh.m_facesEdges[f][n]))
+            if (!mesh.IsEdgeOnBoundary(mesh.FaceEdges(f)[n]))
             {
                 numberOfInteriorEdges += 1;
             }
@@ -249,7 +249,7 @@ void meshkernel::algo::ComputeFaceCircumcenters(const Mesh& mesh, std::span<Poin
 
             for (UInt n = 0; n < numberOfFaceNodes; ++n)
             {
-                numEdgeFacesCache.emplace_back(mesh.m_edgesNumFaces[mesh.m_facesEdges[f][n]]);
+                numEdgeFacesCache.emplace_back(mesh.m_edgesNumFaces[mesh.FaceEdges(f)[n]]);
             }
 
             faceCenters[f] = algo::ComputeFaceCircumenter(polygonNodesCache, numEdgeFacesCache, mesh.m_projection, mesh.GetCircumcentreWeight(), mesh.GetCircumcentreMethod());
@@ -90,7 +90,7 @@ void MeshRefinement::UpdateFaceMask(const int level)
             bool activeNodeFound = false;
             for (UInt n = 0; n < m_mesh.GetNumFaceEdges(f); ++n)
             {
-                const auto nodeIndex = m_mesh.m_facesNodes[f][n];
+                const auto nodeIndex = m_mesh.FaceNodes(f)[n];
                 if (m_nodeMask[nodeIndex] != 0 && m_nodeMask[nodeIndex] != -2)
                 {
                     activeNodeFound = true;
@@ -111,7 +111,7 @@ void MeshRefinement::UpdateFaceMask(const int level)
         {
             for (UInt n = 0; n < m_mesh.GetNumFaceEdges(f); n++)
             {
-                const auto nodeIndex = m_mesh.m_facesNodes[f][n];
+                const auto nodeIndex = m_mesh.FaceNodes(f)[n];
                 if (m_nodeMask[nodeIndex] != 1)
                 {
                     m_faceMask[f] = 0;
@@ -225,7 +225,7 @@ void MeshRefinement::ComputeRefinementMaskFromEdgeSize()
     {
         for (UInt n = 0; n < m_mesh.GetNumFaceEdges(f); ++n)
         {
-            const auto e = m_mesh.m_facesEdges[f][n];
+            const auto e = m_mesh.FaceEdges(f)[n];
             if (!m_isEdgeBelowMinSizeAfterRefinement[e])
             {
                 m_edgeMask[e] = -1;
@@ -467,9 +467,9 @@ std::unique_ptr<meshkernel::UndoAction> MeshRefinement::ConnectHangingNodes()
             const auto e = NextCircularBackwardIndex(n, numEdges);
             const auto ee = NextCircularForwardIndex(n, numEdges);
 
-            const auto edgeIndex = m_mesh.m_facesEdges[f][n];
-            const auto firstEdgeIndex = m_mesh.m_facesEdges[f][e];
-            const auto secondEdgeIndex = m_mesh.m_facesEdges[f][ee];
+            const auto edgeIndex = m_mesh.FaceEdges(f)[n];
+            const auto firstEdgeIndex = m_mesh.FaceEdges(f)[e];
+            const auto secondEdgeIndex = m_mesh.FaceEdges(f)[ee];
             if (m_brotherEdges[edgeIndex] == secondEdgeIndex)
             {
                 continue;
@@ -593,7 +593,7 @@ bool MeshRefinement::DetermineIfParentIsCrossed(const UInt faceId, const UInt nu
     bool isParentCrossed = false;
     for (UInt e = 0; e < numEdges; ++e)
     {
-        const auto n = m_mesh.m_facesNodes[faceId][e];
+        const auto n = m_mesh.FaceNodes(faceId)[e];
         if (m_nodeMask[n] != 1)
         {
             isParentCrossed = true;
@@ -616,13 +616,13 @@ bool MeshRefinement::FindNonHangingNodeEdges(const UInt faceId,
         const auto secondEdge = NextCircularForwardIndex(e, numEdges);
 
         auto mappedEdge = m_localNodeIndicesCache[e];
-        const auto edgeIndex = m_mesh.m_facesEdges[faceId][mappedEdge];
+        const auto edgeIndex = m_mesh.FaceEdges(faceId)[mappedEdge];
 
         mappedEdge = m_localNodeIndicesCache[firstEdge];
-        const auto firstEdgeIndex = m_mesh.m_facesEdges[faceId][mappedEdge];
+        const auto firstEdgeIndex = m_mesh.FaceEdges(faceId)[mappedEdge];
 
         mappedEdge = m_localNodeIndicesCache[secondEdge];
-        const auto secondEdgeIndex = m_mesh.m_facesEdges[faceId][mappedEdge];
+        const auto secondEdgeIndex = m_mesh.FaceEdges(faceId)[mappedEdge];
 
         if (edgeIndex == constants::missing::uintValue)
         {
@@ -671,7 +671,7 @@ void MeshRefinement::FindFacePolygonWithoutHangingNodes(const UInt faceId,
         facePolygonWithoutHangingNodes.emplace_back(m_polygonNodesCache[edge]);
 
         const auto mappedEdge = m_localNodeIndicesCache[edge];
-        const auto edgeIndex = m_mesh.m_facesEdges[faceId][mappedEdge];
+        const auto edgeIndex = m_mesh.FaceEdges(faceId)[mappedEdge];
 
         if (edgeIndex != constants::missing::uintValue)
         {
@@ -873,7 +873,7 @@ void MeshRefinement::ComputeNodeMaskAtPolygonPerimeter()
         const auto numnodes = m_mesh.GetNumFaceEdges(f);
         for (UInt n = 0; n < numnodes; n++)
         {
-            const auto nodeIndex = m_mesh.m_facesNodes[f][n];
+            const auto nodeIndex = m_mesh.FaceNodes(f)[n];
             if (m_nodeMask[nodeIndex] == 0)
             {
                 crossing = true;
@@ -886,7 +886,7 @@ void MeshRefinement::ComputeNodeMaskAtPolygonPerimeter()
             m_faceMask[f] = 0;
             for (UInt n = 0; n < numnodes; n++)
             {
-                const auto nodeIndex = m_mesh.m_facesNodes[f][n];
+                const auto nodeIndex = m_mesh.FaceNodes(f)[n];
                 if (m_nodeMask[nodeIndex] == 1)
                 {
                     m_nodeMask[nodeIndex] = -2;
@@ -946,15 +946,15 @@ void MeshRefinement::FindHangingNodes(UInt face)
 
     for (UInt n = 0; n < numFaceNodes; n++)
     {
-        const auto edgeIndex = m_mesh.m_facesEdges[face][n];
+        const auto edgeIndex = m_mesh.FaceEdges(face)[n];
 
         // check if the parent edge is in the cell
         if (m_brotherEdges[edgeIndex] != constants::missing::uintValue)
         {
             const auto e = NextCircularBackwardIndex(n, numFaceNodes);
             const auto ee = NextCircularForwardIndex(n, numFaceNodes);
-            const auto firstEdgeIndex = m_mesh.m_facesEdges[face][e];
-            const auto secondEdgeIndex = m_mesh.m_facesEdges[face][ee];
+            const auto firstEdgeIndex = m_mesh.FaceEdges(face)[e];
+            const auto secondEdgeIndex = m_mesh.FaceEdges(face)[ee];
 
             UInt commonNode = constants::missing::uintValue;
             if (m_brotherEdges[edgeIndex] == firstEdgeIndex)
@@ -981,7 +981,7 @@ void MeshRefinement::FindHangingNodes(UInt face)
                 {
                     kknod = NextCircularForwardIndex(kknod, numFaceNodes);
 
-                    if (m_mesh.m_facesNodes[face][kknod] == commonNode && !m_isHangingNodeCache[kknod])
+                    if (m_mesh.FaceNodes(face)[kknod] == commonNode && !m_isHangingNodeCache[kknod])
                     {
                         m_isHangingNodeCache[kknod] = true;
                         break;
@@ -1026,7 +1026,7 @@ meshkernel::UInt MeshRefinement::CountEdgesToRefine(UInt face) const
 
     for (UInt n = 0; n < numFaceNodes; n++)
     {
-        const auto edgeIndex = m_mesh.m_facesEdges[face][n];
+        const auto edgeIndex = m_mesh.FaceEdges(face)[n];
         if (m_edgeMask[edgeIndex] != 0)
         {
             result += 1;
@@ -1122,7 +1122,7 @@ void MeshRefinement::ComputeRefinementMasksForWaveCourant(UInt face,
 {
     for (size_t e = 0; e < m_mesh.GetNumFaceEdges(face); ++e)
     {
-        const auto edge = m_mesh.m_facesEdges[face][e];
+        const auto edge = m_mesh.FaceEdges(face)[e];
         if (m_edgeLengths[edge] < m_mergingDistance)
         {
             numberOfEdgesToRefine++;
@@ -1163,7 +1163,7 @@ void MeshRefinement::ComputeRefinementMasksForRidgeDetection(UInt face,
 
     for (size_t i = 0; i < numEdges; ++i)
     {
-        const auto& edgeIndex = m_mesh.m_facesEdges[face][i];
+        const auto& edgeIndex = m_mesh.FaceEdges(face)[i];
         const auto& [firstNode, secondNode] = m_mesh.GetEdge(edgeIndex);
         const auto distance = ComputeDistance(m_mesh.Node(firstNode), m_mesh.Node(secondNode), m_mesh.m_projection);
         maxEdgeLength = std::max(maxEdgeLength, distance);
@@ -1192,9 +1192,9 @@ void MeshRefinement::ComputeRefinementMasksFromSamples(UInt face)
     bool refineFace = false;
 
     // If all nodes of the element are masked out then there is no need to check if refinement is necessary.
-    for (UInt n = 0; n < m_mesh.m_facesNodes[face].size(); ++n)
+    for (UInt n = 0; n < m_mesh.FaceNodes(face).size(); ++n)
     {
-        if (m_nodeMask[m_mesh.m_facesNodes[face][n]] > 0)
+        if (m_nodeMask[m_mesh.FaceNodes(face)[n]] > 0)
         {
             refineFace = true;
             break;
@@ -1236,7 +1236,7 @@ void MeshRefinement::ComputeRefinementMasksFromSamples(UInt face)
         {
             if (m_refineEdgeCache[n] == 1)
             {
-                const auto edgeIndex = m_mesh.m_facesEdges[face][n];
+                const auto edgeIndex = m_mesh.FaceEdges(face)[n];
 
                 if (edgeIndex != constants::missing::uintValue)
                 {
@@ -1257,7 +1257,7 @@ void MeshRefinement::ComputeFaceLocationTypes()
         double minVal = std::numeric_limits<double>::max();
         for (UInt e = 0; e < m_mesh.GetNumFaceEdges(face); ++e)
         {
-            const auto node = m_mesh.m_facesNodes[face][e];
+            const auto node = m_mesh.FaceNodes(face)[e];
             const auto val = m_interpolant->GetNodeResult(node);
             maxVal = std::max(maxVal, val);
             minVal = std::min(minVal, val);
@@ -1332,10 +1332,10 @@ void MeshRefinement::ComputeEdgesRefinementMask()
                     const auto e = NextCircularBackwardIndex(n, numFaceNodes);
                     const auto ee = NextCircularForwardIndex(n, numFaceNodes);
 
-                    const auto edgeIndex = m_mesh.m_facesEdges[f][n];
+                    const auto edgeIndex = m_mesh.FaceEdges(f)[n];
 
-                    const auto firstEdgeIndex = m_mesh.m_facesEdges[f][e];
-                    const auto secondEdgeIndex = m_mesh.m_facesEdges[f][ee];
+                    const auto firstEdgeIndex = m_mesh.FaceEdges(f)[e];
+                    const auto secondEdgeIndex = m_mesh.FaceEdges(f)[ee];
 
                     // do not refine edges with an hanging node
                     if (m_brotherEdges[edgeIndex] != firstEdgeIndex && m_brotherEdges[edgeIndex] != secondEdgeIndex)
@@ -1350,7 +1350,7 @@ void MeshRefinement::ComputeEdgesRefinementMask()
                 UInt num = 0;
                 for (UInt n = 0; n < numFaceNodes; n++)
                 {
-                    const auto edgeIndex = m_mesh.m_facesEdges[f][n];
+                    const auto edgeIndex = m_mesh.FaceEdges(f)[n];
                     numOfEdges[n] = num;
 
                     if (m_edgeMask[edgeIndex] != 0)
@@ -1360,7 +1360,7 @@ void MeshRefinement::ComputeEdgesRefinementMask()
 
                     const auto ee = NextCircularForwardIndex(n, numFaceNodes);
 
-                    const auto secondEdgeIndex = m_mesh.m_facesEdges[f][ee];
+                    const auto secondEdgeIndex = m_mesh.FaceEdges(f)[ee];
 
                     if (n != numFaceNodes - 1 && m_brotherEdges[edgeIndex] != secondEdgeIndex)
                     {
@@ -1406,7 +1406,7 @@ void MeshRefinement::ComputeEdgesRefinementMask()
 
                 for (UInt n = 0; n < numFaceNodes; n++)
                 {
-                    const auto edgeIndex = m_mesh.m_facesEdges[f][n];
+                    const auto edgeIndex = m_mesh.FaceEdges(f)[n];
                     if (m_edgeMask[edgeIndex] > 0)
                     {
                         continue;
@@ -1456,7 +1456,7 @@ bool MeshRefinement::IsSplittingIsRequiredForFace(const UInt faceId) const
 
     for (UInt n = 0; n < numFaceNodes; n++)
     {
-        const auto edgeIndex = m_mesh.m_facesEdges[faceId][n];
+        const auto edgeIndex = m_mesh.FaceEdges(faceId)[n];
 
         if (m_isHangingEdgeCache[n] && m_edgeMask[edgeIndex] > 0)
         {
@@ -1487,7 +1487,7 @@ meshkernel::UInt MeshRefinement::UpdateEdgeMaskForNonHangingEdge(const UInt face
 
     for (UInt n = 0; n < numFaceNodes; n++)
     {
-        const auto edgeIndex = m_mesh.m_facesEdges[faceId][n];
+        const auto edgeIndex = m_mesh.FaceEdges(faceId)[n];
 
         if (!m_isHangingEdgeCache[n] && m_edgeMask[edgeIndex] == 0)
         {
@@ -1576,14 +1576,14 @@ void MeshRefinement::FindBrotherEdges()
         for (UInt e = 0; e < numEdgesNodes; e++)
         {
 
-            const auto firstEdgeIndex = m_mesh.m_nodesEdges[n][e];
+            const auto firstEdgeIndex = m_mesh.NodeEdges(n)[e];
             if (m_mesh.GetNumEdgesFaces(firstEdgeIndex) < 1)
             {
                 continue;
             }
 
             const auto ee = NextCircularForwardIndex(e, numEdgesNodes);
-            const auto secondEdgeIndex = m_mesh.m_nodesEdges[n][ee];
+            const auto secondEdgeIndex = m_mesh.NodeEdges(n)[ee];
             if (m_mesh.GetNumEdgesFaces(secondEdgeIndex) < 1)
             {
                 continue;
@@ -1630,11 +1630,11 @@ void MeshRefinement::FindEdgesToSplit(const UInt faceId,
 {
     for (UInt e = 0; e < numEdges; ++e)
     {
-        const auto edgeIndex = m_mesh.m_facesEdges[faceId][e];
+        const auto edgeIndex = m_mesh.FaceEdges(faceId)[e];
         const auto nextEdgeIndex = NextCircularForwardIndex(e, numEdges);
         const auto previousEdgeIndex = NextCircularBackwardIndex(e, numEdges);
-        const auto split = m_brotherEdges[edgeIndex] != m_mesh.m_facesEdges[faceId][nextEdgeIndex] &&
-                           m_brotherEdges[edgeIndex] != m_mesh.m_facesEdges[faceId][previousEdgeIndex];
+        const auto split = m_brotherEdges[edgeIndex] != m_mesh.FaceEdges(faceId)[nextEdgeIndex] &&
+                           m_brotherEdges[edgeIndex] != m_mesh.FaceEdges(faceId)[previousEdgeIndex];
 
         if (split)
         {
@@ -1651,7 +1651,7 @@ void MeshRefinement::UpdateFaceRefinementMask(std::vector<bool>& splitEdge)
 
         for (UInt e = 0; e < numEdges; ++e)
         {
-            const auto edgeIndex = m_mesh.m_facesEdges[f][e];
+            const auto edgeIndex = m_mesh.FaceEdges(f)[e];
             if (splitEdge[edgeIndex])
             {
                 m_faceMask[f] = 1;
@@ -1674,11 +1674,11 @@ void MeshRefinement::UpdateEdgeRefinementMask()
 
         for (UInt e = 0; e < numEdges; ++e)
         {
-            const auto edgeIndex = m_mesh.m_facesEdges[f][e];
+            const auto edgeIndex = m_mesh.FaceEdges(f)[e];
             const auto nextEdgeIndex = NextCircularForwardIndex(e, numEdges);
             const auto previousEdgeIndex = NextCircularBackwardIndex(e, numEdges);
-            const auto split = m_brotherEdges[edgeIndex] != m_mesh.m_facesEdges[f][nextEdgeIndex] &&
-                               m_brotherEdges[edgeIndex] != m_mesh.m_facesEdges[f][previousEdgeIndex];
+            const auto split = m_brotherEdges[edgeIndex] != m_mesh.FaceEdges(f)[nextEdgeIndex] &&
+                               m_brotherEdges[edgeIndex] != m_mesh.FaceEdges(f)[previousEdgeIndex];
 
             if (split)
             {
@@ -193,9 +193,6 @@ void meshkernel::MeshTriangulation::Compute(const std::span<const double>& xNode
     {
         m_elementCentreRTree = RTreeFactory::Create(m_projection);
         m_elementCentreRTree->BuildTree(m_elementCentres);
-
-        m_nodeRTree = RTreeFactory::Create(m_projection);
-        m_nodeRTree->BuildTree(m_nodes);
     }
 
     m_edgesFaces.resize(m_numEdges, {constants::missing::uintValue, constants::missing::uintValue});
@@ -219,103 +216,89 @@ void meshkernel::MeshTriangulation::Compute(const std::span<const double>& xNode
             }
         }
     }
-
-    m_nodesEdges.resize(m_nodes.size());
-
-    for (UInt e = 0; e < m_numEdges; ++e)
-    {
-        auto [edgeFirst, edgeSecond] = GetEdge(e);
-
-        m_nodesEdges[edgeFirst].push_back(e);
-        m_nodesEdges[edgeSecond].push_back(e);
-    }
 }
 
 meshkernel::UInt meshkernel::MeshTriangulation::FindNearestFace(const Point& pnt) const
 {
-    m_elementCentreRTree->SearchNearestPoint(pnt);
-
-    if (!m_elementCentreRTree->HasQueryResults())
+    if (m_numFaces == 0 || !pnt.IsValid())
     {
         return constants::missing::uintValue;
     }
 
-    UInt faceId = m_elementCentreRTree->GetQueryResult(0);
+    std::vector<UInt> queryResult;
+    m_elementCentreRTree->SearchNearestPoint(pnt, queryResult);
 
-    if (PointIsInElement(pnt, faceId))
+    if (queryResult.empty())
     {
-        return faceId;
+        return constants::missing::uintValue;
     }
 
-    const auto edgeIds = GetEdgeIds(faceId);
-
-    BoundedStack<4 * MaximumNumberOfEdgesPerNode> elementsChecked;
-    elementsChecked.push_back(faceId);
+    return WalkToFace(pnt, queryResult[0]);
+}
 
-    for (UInt i = 0; i < edgeIds.size(); ++i)
+meshkernel::UInt meshkernel::MeshTriangulation::FindFace(const Point& pnt, const UInt startFaceId) const
+{
+    if (startFaceId == constants::missing::uintValue || startFaceId >= m_numFaces)
     {
-        const auto [neighbour1, neighbour2] = GetFaceIds(edgeIds[i]);
-
-        if (neighbour1 != faceId && neighbour1 != constants::missing::uintValue)
-        {
-            if (PointIsInElement(pnt, neighbour1))
-            {
-                return neighbour1;
-            }
-
-            elementsChecked.push_back(neighbour1);
-        }
-
-        if (neighbour2 != faceId && neighbour2 != constants::missing::uintValue)
-        {
-            if (PointIsInElement(pnt, neighbour2))
-            {
-                return neighbour2;
-            }
+        return FindNearestFace(pnt);
+    }
 
-            elementsChecked.push_back(neighbour2);
-        }
+    if (!pnt.IsValid())
+    {
+        return constants::missing::uintValue;
     }
 
-    // Point not in direct neighbours of the element
+    return WalkToFace(pnt, startFaceId);
+}
 
-    m_nodeRTree->SearchNearestPoint(pnt);
+meshkernel::UInt meshkernel::MeshTriangulation::WalkToFace(const Point& pnt, const UInt startFaceId) const
+{
+    UInt faceId = startFaceId;
+    UInt previousFaceId = constants::missing::uintValue;
 
-    if (m_nodeRTree->HasQueryResults())
+    // The walk through a Delaunay triangulation does not cycle, the limit only guards against degenerate triangulations
+    for (UInt step = 0; step < m_numFaces; ++step)
     {
-        UInt nodeId = m_nodeRTree->GetQueryResult(0);
+        const UInt faceIndexStart = 3 * faceId;
+        const UInt nodeIdSum = m_faceNodes[faceIndexStart] + m_faceNodes[faceIndexStart + 1] + m_faceNodes[faceIndexStart + 2];
 
-        if (nodeId == constants::missing::uintValue)
-        {
-            return constants::missing::uintValue;
-        }
+        UInt nextFaceId = faceId;
 
-        for (UInt n = 0; n < m_nodesEdges[nodeId].size(); ++n)
+        for (UInt i = 0; i < constants::geometric::numNodesInTriangle; ++i)
         {
-            const auto faces = GetFaceIds(m_nodesEdges[nodeId][n]);
+            const UInt edgeId = m_faceEdges[faceIndexStart + i];
+            const auto& [leftFace, rightFace] = m_edgesFaces[edgeId];
+            const UInt neighbourId = leftFace == faceId ? rightFace : leftFace;
 
-            if (faces[0] != constants::missing::uintValue && !elementsChecked.contains(faces[0]))
+            if (neighbourId == previousFaceId && neighbourId != constants::missing::uintValue)
             {
-
-                if (PointIsInElement(pnt, faces[0]))
-                {
-                    return faces[0];
-                }
-
-                elementsChecked.push_back(faces[0]);
+                // The point cannot be on the other side of the edge just crossed
+                continue;
             }
 
-            if (faces[1] != constants::missing::uintValue && !elementsChecked.contains(faces[1]))
-            {
+            const UInt firstNode = m_edgeNodes[2 * edgeId];
+            const UInt secondNode = m_edgeNodes[2 * edgeId + 1];
+            const UInt oppositeNode = nodeIdSum - firstNode - secondNode;
 
-                if (PointIsInElement(pnt, faces[1]))
-                {
-                    return faces[1];
-                }
+            const double pointSide = crossProduct(m_nodes[firstNode], m_nodes[secondNode], m_nodes[firstNode], pnt, Projection::cartesian);
+            const double oppositeSide = crossProduct(m_nodes[firstNode], m_nodes[secondNode], m_nodes[firstNode], m_nodes[oppositeNode], Projection::cartesian);
 
-                elementsChecked.push_back(faces[1]);
+            if ((pointSide < 0.0 && oppositeSide > 0.0) || (pointSide > 0.0 && oppositeSide < 0.0))
+            {
+                // The edge separates the point from the face
+                nextFaceId = neighbourId;
+                break;
             }
         }
+
+        if (nextFaceId == faceId || nextFaceId == constants::missing::uintValue)
+        {
+            // Either no edge separates the point from the face, or the point is outside the (convex) triangulation
+            return nextFaceId;
+        }
+
+        previousFaceId = faceId;
+        faceId = nextFaceId;
     }
 
     return constants::missing::uintValue;
@@ -30,6 +30,7 @@
 #include <MeshKernel/Exceptions.hpp>
 #include <MeshKernel/LandBoundaries.hpp>
 #include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/MeshOrthogonality.hpp>
 #include <MeshKernel/Operations.hpp>
 #include <MeshKernel/OrthogonalizationAndSmoothing.hpp>
 #include <MeshKernel/Orthogonalizer.hpp>
@@ -83,6 +84,15 @@ std::unique_ptr<meshkernel::UndoAction> OrthogonalizationAndSmoothing::Initializ
     }
 
     nodeIndices.resize(nodesMovedCount);
+
+    m_boundaryNodes.clear();
+    for (UInt n = 0; n < m_mesh.GetNumNodes(); ++n)
+    {
+        if (GetNodeType(n) == MeshNodeType::Boundary && m_mesh.GetNumNodesEdges(n) > 0)
+        {
+            m_boundaryNodes.emplace_back(n);
+        }
+    }
     std::unique_ptr<NodeTranslationAction> undoAction = NodeTranslationAction::Create(m_mesh, nodeIndices);
 
     // TODO: calculate volume weights for areal smoother
@@ -92,6 +102,8 @@ std::unique_ptr<meshkernel::UndoAction> OrthogonalizationAndSmoothing::Initializ
     // back-up original nodes, for projection on original mesh boundary
     m_originalNodes = m_mesh.Nodes();
     m_orthogonalCoordinates = m_mesh.Nodes();
+    m_residuals.clear();
+    m_orthogonalityResiduals.clear();
 
     // account for enclosing polygon
     m_landBoundaries->FindNearestMeshBoundary(m_projectToLandBoundaryOption);
@@ -119,21 +131,49 @@ std::unique_ptr<meshkernel::UndoAction> OrthogonalizationAndSmoothing::Initializ
 
 void OrthogonalizationAndSmoothing::Compute()
 {
+    const double displacementTolerance = m_orthogonalizationParameters.displacement_tolerance;
+    const double orthogonalityTolerance = m_orthogonalizationParameters.orthogonality_tolerance;
 
     for (auto outerIter = 0; outerIter < m_orthogonalizationParameters.outer_iterations; outerIter++)
     {
         PrepareOuterIteration();
-        for (auto boundaryIter = 0; boundaryIter < m_orthogonalizationParameters.boundary_iterations; boundaryIter++)
+
+        // the number of inner iterations performed in this outer iteration
+        int numIterations = 0;
+        bool converged = false;
+        for (auto boundaryIter = 0; boundaryIter < m_orthogonalizationParameters.boundary_iterations && !converged; boundaryIter++)
         {
             for (auto innerIter = 0; innerIter < m_orthogonalizationParameters.inner_iterations; innerIter++)
             {
-                Solve();
+                ++numIterations;
+                if (IsConverged(UpdateNodes(), displacementTolerance))
+                {
+                    converged = true;
+                    break;
+                }
             } // inner iteration
 
         } // boundary iter
 
+        m_mesh.InvalidateNodes();
+
         // update mu
         FinalizeOuterIteration();
+
+        // the nodes did not move with the new weights: further outer iterations will not move them either
+        if (converged && numIterations == 1)
+        {
+            break;
+        }
+
+        if (orthogonalityTolerance > 0.0)
+        {
+            m_orthogonalityResiduals.emplace_back(ComputeMaximumOrthogonality());
+            if (IsConverged(m_orthogonalityResiduals.back(), orthogonalityTolerance))
+            {
+                break;
+            }
+        }
     } // outer iter
 }
 
@@ -150,6 +190,113 @@ void OrthogonalizationAndSmoothing::PrepareOuterIteration()
 
     // compute linear system terms for smoother and orthogonalizer
     ComputeLinearSystemTerms();
+
+    // the node colours depend on the smoother connectivity, recomputed at each outer iteration
+    if (static_cast<InnerSolver>(m_orthogonalizationParameters.inner_solver) == InnerSolver::MulticolourGaussSeidel)
+    {
+        ComputeNodeColours();
+    }
+    else
+    {
+        m_colouredNodes.Clear();
+    }
+}
+
+bool OrthogonalizationAndSmoothing::IsNodeUpdated(UInt nodeIndex) const
+{
+    return (GetNodeType(nodeIndex) == MeshNodeType::Internal || GetNodeType(nodeIndex) == MeshNodeType::Boundary) &&
+           m_mesh.GetNumNodesEdges(nodeIndex) >= 2;
+}
+
+void OrthogonalizationAndSmoothing::ComputeNodeColours()
+{
+    const auto numNodes = m_mesh.GetNumNodes();
+
+    // the neighbours read by a node in ComputeLocalIncrements
+    const auto forEachNeighbour = [this](UInt n, auto&& function)
+    {
+        const auto numConnectedNodes = m_compressedStartNodeIndex[n] - m_compressedEndNodeIndex[n];
+        for (UInt nn = 1; nn < numConnectedNodes; ++nn)
+        {
+            const auto neighbour = m_compressedNodesNodes[m_compressedEndNodeIndex[n] + nn - 1];
+            if (neighbour != n && neighbour < m_mesh.GetNumNodes() && IsNodeUpdated(neighbour))
+            {
+                function(neighbour);
+            }
+        }
+    };
+
+    // symmetric conflict graph of the updated nodes: two nodes conflict if one of them reads the other
+    std::vector<UInt> numConflicts(numNodes, 0);
+    for (UInt n = 0; n < numNodes; ++n)
+    {
+        if (IsNodeUpdated(n))
+        {
+            forEachNeighbour(n, [&numConflicts, n](UInt neighbour)
+                             {
+                                 ++numConflicts[n];
+                                 ++numConflicts[neighbour]; });
+        }
+    }
+
+    CompressedSparseRow<UInt> conflicts;
+    conflicts.SetRowSizes(numConflicts);
+    std::ranges::fill(numConflicts, 0);
+    for (UInt n = 0; n < numNodes; ++n)
+    {
+        if (IsNodeUpdated(n))
+        {
+            forEachNeighbour(n, [&conflicts, &numConflicts, n](UInt neighbour)
+                             {
+                                 conflicts[n][numConflicts[n]++] = neighbour;
+                                 conflicts[neighbour][numConflicts[neighbour]++] = n; });
+        }
+    }
+
+    // greedy colouring, in node order
+    std::vector<UInt> nodeColours(numNodes, constants::missing::uintValue);
+    std::vector<UInt> colourLastUsedBy;
+    std::vector<UInt> numNodesPerColour;
+    for (UInt n = 0; n < numNodes; ++n)
+    {
+        if (!IsNodeUpdated(n))
+        {
+            continue;
+        }
+
+        for (const auto neighbour : conflicts[n])
+        {
+            if (nodeColours[neighbour] != constants::missing::uintValue)
+            {
+                colourLastUsedBy[nodeColours[neighbour]] = n;
+            }
+        }
+
+        UInt colour = 0;
+        while (colour < colourLastUsedBy.size() && colourLastUsedBy[colour] == n)
+        {
+            ++colour;
+        }
+
+        if (colour == colourLastUsedBy.size())
+        {
+            colourLastUsedBy.emplace_back(constants::missing::uintValue);
+            numNodesPerColour.emplace_back(0);
+        }
+
+        nodeColours[n] = colour;
+        ++numNodesPerColour[colour];
+    }
+
+    m_colouredNodes.SetRowSizes(numNodesPerColour);
+    std::ranges::fill(numNodesPerColour, 0);
+    for (UInt n = 0; n < numNodes; ++n)
+    {
+        if (const auto colour = nodeColours[n]; colour != constants::missing::uintValue)
+        {
+            m_colouredNodes[colour][numNodesPerColour[colour]++] = n;
+        }
+    }
 }
 
 void OrthogonalizationAndSmoothing::AllocateLinearSystem()
@@ -194,7 +341,7 @@ void OrthogonalizationAndSmoothing::ComputeLinearSystemTerms()
 #pragma omp parallel for
     for (int n = 0; n < static_cast<int>(m_mesh.GetNumNodes()); n++)
     {
-        if ((GetNodeType(n) != MeshNodeType::Internal && GetNodeType(n) != MeshNodeType::Boundary) || m_mesh.GetNumNodesEdges(n) < 2)
+        if (!IsNodeUpdated(n))
         {
             continue;
         }
@@ -241,24 +388,127 @@ void OrthogonalizationAndSmoothing::ComputeLinearSystemTerms()
 
 void OrthogonalizationAndSmoothing::Solve()
 {
+    UpdateNodes();
+    m_mesh.InvalidateNodes();
+}
 
-#pragma omp parallel for
-    for (int n = 0; n < static_cast<int>(m_mesh.GetNumNodes()); n++)
+double OrthogonalizationAndSmoothing::UpdateNodes()
+{
+    if (static_cast<InnerSolver>(m_orthogonalizationParameters.inner_solver) == InnerSolver::MulticolourGaussSeidel)
     {
-        UpdateNodeCoordinates(n);
-    }
+        // the nodes are updated in place, the nodes of the previous colours are already updated.
+        // The boundary nodes are projected on the original net boundary right away,
+        // the nodes of the next colours must not read unprojected boundary nodes
+        std::ranges::copy(m_mesh.Nodes(), m_orthogonalCoordinates.begin());
+        std::exception_ptr exception;
+        for (UInt colour = 0; colour < m_colouredNodes.NumRows() && !exception; ++colour)
+        {
+            const auto colouredNodes = m_colouredNodes[colour];
 
-    // update mesh node coordinates
-    m_mesh.SetNodes(m_orthogonalCoordinates);
+#pragma omp parallel for
+            for (int i = 0; i < static_cast<int>(colouredNodes.size()); i++)
+            {
+                try
+                {
+                    const auto n = colouredNodes[i];
+                    UpdateNodeCoordinates(n, m_orthogonalCoordinates);
+                    if (GetNodeType(n) == MeshNodeType::Boundary)
+                    {
+                        SnapNodeToOriginalMeshBoundary(n);
+                    }
+                }
+                catch (...)
+                {
+#pragma omp critical
+                    if (!exception)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+        }
 
-    // project on the original net boundary
-    SnapMeshToOriginalMeshBoundary();
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+    else
+    {
+#pragma omp parallel for
+        for (int n = 0; n < static_cast<int>(m_mesh.GetNumNodes()); n++)
+        {
+            UpdateNodeCoordinates(n, m_mesh.Nodes());
+        }
+
+        // project on the original net boundary
+        SnapMeshToOriginalMeshBoundary();
+    }
 
     // compute local coordinates
     // TODO: Not implemented yet ComputeCoordinates();
 
     // project on land boundary
-    [[maybe_unused]] auto action = m_landBoundaries->SnapMeshToLandBoundaries();
+    m_landBoundaries->SnapNodesToLandBoundaries(m_orthogonalCoordinates);
+
+    const double displacement = ComputeDisplacement();
+    m_residuals.emplace_back(displacement);
+
+    // update mesh node coordinates, the previous coordinates are overwritten at the next iteration
+    m_mesh.SwapNodes(m_orthogonalCoordinates);
+
+    return displacement;
+}
+
+double OrthogonalizationAndSmoothing::ComputeDisplacement()
+{
+    const auto& nodes = m_mesh.Nodes();
+    const auto numNodes = static_cast<int>(nodes.size());
+    const auto projection = m_mesh.m_projection;
+
+    // the squared distances are computed in parallel and reduced sequentially (no max reduction in OpenMP 2.0)
+    m_squaredDisplacements.resize(nodes.size());
+#pragma omp parallel for
+    for (int n = 0; n < numNodes; n++)
+    {
+        m_squaredDisplacements[n] = nodes[n].IsValid() && m_orthogonalCoordinates[n].IsValid()
+                                        ? ComputeSquaredDistance(nodes[n], m_orthogonalCoordinates[n], projection)
+                                        : constants::missing::doubleValue;
+    }
+
+    double maximumDistanceSquared = 0.0;
+    double sumDistanceSquared = 0.0;
+    UInt numValidNodes = 0;
+    for (const auto distanceSquared : m_squaredDisplacements)
+    {
+        if (distanceSquared == constants::missing::doubleValue)
+        {
+            continue;
+        }
+        maximumDistanceSquared = std::max(maximumDistanceSquared, distanceSquared);
+        sumDistanceSquared += distanceSquared;
+        ++numValidNodes;
+    }
+
+    if (m_orthogonalizationParameters.displacement_norm == 0)
+    {
+        return std::sqrt(maximumDistanceSquared);
+    }
+
+    return numValidNodes > 0 ? std::sqrt(sumDistanceSquared / static_cast<double>(numValidNodes)) : 0.0;
+}
+
+double OrthogonalizationAndSmoothing::ComputeMaximumOrthogonality() const
+{
+    double maximumOrthogonality = 0.0;
+    for (const auto value : MeshOrthogonality::Compute(m_mesh))
+    {
+        if (value != constants::missing::doubleValue)
+        {
+            maximumOrthogonality = std::max(maximumOrthogonality, value);
+        }
+    }
+    return maximumOrthogonality;
 }
 
 void OrthogonalizationAndSmoothing::FindNeighbouringBoundaryNodes(const UInt nodeId,
@@ -274,7 +524,7 @@ void OrthogonalizationAndSmoothing::FindNeighbouringBoundaryNodes(const UInt nod
 
     for (UInt nn = 0; nn < numEdges; nn++)
     {
-        const auto edgeIndex = m_mesh.m_nodesEdges[nearestPointIndex][nn];
+        const auto edgeIndex = m_mesh.NodeEdges(nearestPointIndex)[nn];
         if (edgeIndex != constants::missing::uintValue && m_mesh.IsEdgeOnBoundary(edgeIndex))
         {
             numNodes++;
@@ -303,74 +553,51 @@ void OrthogonalizationAndSmoothing::FindNeighbouringBoundaryNodes(const UInt nod
 
 void OrthogonalizationAndSmoothing::SnapMeshToOriginalMeshBoundary()
 {
-    // in this case the nearest point is the point itself
-    std::vector<UInt> nearestPoints(m_mesh.GetNumNodes(), 0);
-    std::iota(nearestPoints.begin(), nearestPoints.end(), 0);
-
-    for (UInt n = 0; n < m_mesh.GetNumNodes(); n++)
+    for (const auto n : m_boundaryNodes)
     {
-        const auto nearestPointIndex = nearestPoints[n];
-        if (GetNodeType(n) == MeshNodeType::Boundary && m_mesh.GetNumNodesEdges(n) > 0 && m_mesh.GetNumNodesEdges(nearestPointIndex) > 0)
-        {
-            Point firstPoint = m_mesh.Node(n);
-            if (!firstPoint.IsValid())
-            {
-                continue;
-            }
-
-            UInt leftNode = constants::missing::uintValue;
-            UInt rightNode = constants::missing::uintValue;
-            Point secondPoint{constants::missing::doubleValue, constants::missing::doubleValue};
-            Point thirdPoint{constants::missing::doubleValue, constants::missing::doubleValue};
+        SnapNodeToOriginalMeshBoundary(n);
+    }
+}
 
-            FindNeighbouringBoundaryNodes(n, nearestPointIndex, leftNode, rightNode);
+void OrthogonalizationAndSmoothing::SnapNodeToOriginalMeshBoundary(UInt n)
+{
+    Point firstPoint = m_orthogonalCoordinates[n];
+    if (!firstPoint.IsValid())
+    {
+        return;
+    }
 
-            if (leftNode != constants::missing::uintValue)
-            {
-                secondPoint = m_originalNodes[leftNode];
-            }
+    UInt leftNode = constants::missing::uintValue;
+    UInt rightNode = constants::missing::uintValue;
+    Point secondPoint{constants::missing::doubleValue, constants::missing::doubleValue};
+    Point thirdPoint{constants::missing::doubleValue, constants::missing::doubleValue};
 
-            if (rightNode != constants::missing::uintValue)
-            {
-                thirdPoint = m_originalNodes[rightNode];
-            }
+    FindNeighbouringBoundaryNodes(n, n, leftNode, rightNode);
 
-            if (!secondPoint.IsValid() || !thirdPoint.IsValid())
-            {
-                continue;
-            }
+    if (leftNode != constants::missing::uintValue)
+    {
+        secondPoint = m_originalNodes[leftNode];
+    }
 
-            // Project the moved boundary point back onto the closest original edge (either between 0 and 2 or 0 and 3)
+    if (rightNode != constants::missing::uintValue)
+    {
+        thirdPoint = m_originalNodes[rightNode];
+    }
 
-            const auto [distanceSecondPoint, normalSecondPoint, ratioSecondPoint] =
-                DistanceFromLine(firstPoint, m_originalNodes[nearestPointIndex], secondPoint, m_mesh.m_projection);
+    if (!secondPoint.IsValid() || !thirdPoint.IsValid())
+    {
+        return;
+    }
 
-            const auto [distanceThirdPoint, normalThirdPoint, ratioThirdPoint] =
-                DistanceFromLine(firstPoint, m_originalNodes[nearestPointIndex], thirdPoint, m_mesh.m_projection);
+    // Project the moved boundary point back onto the closest original edge (either between 0 and 2 or 0 and 3)
 
-            if (distanceSecondPoint < distanceThirdPoint)
-            {
-                // TODO may need to refactor this (undo action allocation), if performance becomes a problem
-                // Copy nodes at start, then set all nodes at once (SetNodes, this has no associated action yet).
-                [[maybe_unused]] auto action = m_mesh.ResetNode(n, normalSecondPoint);
+    const auto [distanceSecondPoint, normalSecondPoint, ratioSecondPoint] =
+        DistanceFromLine(firstPoint, m_originalNodes[n], secondPoint, m_mesh.m_projection);
 
-                if (ratioSecondPoint > 0.5 && GetNodeType(n) != MeshNodeType::Corner)
-                {
-                    nearestPoints[n] = leftNode;
-                }
-            }
-            else
-            {
-                // TODO may need to refactor this (undo action allocation), if performance becomes a problem
-                [[maybe_unused]] auto action = m_mesh.ResetNode(n, normalThirdPoint);
+    const auto [distanceThirdPoint, normalThirdPoint, ratioThirdPoint] =
+        DistanceFromLine(firstPoint, m_originalNodes[n], thirdPoint, m_mesh.m_projection);
 
-                if (ratioThirdPoint > 0.5 && GetNodeType(n) != MeshNodeType::Corner)
-                {
-                    nearestPoints[n] = rightNode;
-                }
-            }
-        }
-    }
+    m_orthogonalCoordinates[n] = distanceSecondPoint < distanceThirdPoint ? normalSecondPoint : normalThirdPoint;
 }
 
 void OrthogonalizationAndSmoothing::ComputeCoordinates() const
@@ -383,32 +610,36 @@ void OrthogonalizationAndSmoothing::ComputeCoordinates() const
     throw NotImplementedError("This functionality is not implemented yet.");
 }
 
-void OrthogonalizationAndSmoothing::UpdateNodeCoordinates(UInt nodeIndex)
+void OrthogonalizationAndSmoothing::UpdateNodeCoordinates(UInt nodeIndex, const std::vector<Point>& nodes)
 {
 
     double dx0 = 0.0;
     double dy0 = 0.0;
     std::array<double, 2> increments{0.0, 0.0};
-    ComputeLocalIncrements(nodeIndex, dx0, dy0, increments);
+    ComputeLocalIncrements(nodeIndex, nodes, dx0, dy0, increments);
 
+    // nodes may alias m_orthogonalCoordinates, copy the node before overwriting it
+    const Point node = nodes[nodeIndex];
     if (increments[0] <= 1e-8 || increments[1] <= 1e-8)
     {
+        m_orthogonalCoordinates[nodeIndex] = node;
         return;
     }
 
     const auto firstCacheIndex = nodeIndex * 2;
     dx0 = (dx0 + m_compressedRhs[firstCacheIndex]) / increments[0];
     dy0 = (dy0 + m_compressedRhs[firstCacheIndex + 1]) / increments[1];
-    constexpr double relaxationFactor = 0.75;
+    // the Jacobi iteration is damped, the Gauss-Seidel iteration is not
+    const double relaxationFactor = static_cast<InnerSolver>(m_orthogonalizationParameters.inner_solver) == InnerSolver::Jacobi ? 0.75 : 1.0;
 
     if (m_mesh.m_projection == Projection::cartesian || m_mesh.m_projection == Projection::spherical)
     {
-        const double x0 = m_mesh.Node(nodeIndex).x + dx0;
-        const double y0 = m_mesh.Node(nodeIndex).y + dy0;
-        static constexpr double relaxationFactorCoordinates = 1.0 - relaxationFactor;
+        const double x0 = node.x + dx0;
+        const double y0 = node.y + dy0;
+        const double relaxationFactorCoordinates = 1.0 - relaxationFactor;
 
-        m_orthogonalCoordinates[nodeIndex].x = relaxationFactor * x0 + relaxationFactorCoordinates * m_mesh.Node(nodeIndex).x;
-        m_orthogonalCoordinates[nodeIndex].y = relaxationFactor * y0 + relaxationFactorCoordinates * m_mesh.Node(nodeIndex).y;
+        m_orthogonalCoordinates[nodeIndex].x = relaxationFactor * x0 + relaxationFactorCoordinates * node.x;
+        m_orthogonalCoordinates[nodeIndex].y = relaxationFactor * y0 + relaxationFactorCoordinates * node.y;
     }
 
     if (m_mesh.m_projection == Projection::sphericalAccurate)
@@ -418,7 +649,7 @@ void OrthogonalizationAndSmoothing::UpdateNodeCoordinates(UInt nodeIndex)
         std::array<double, 3> exxp{0.0, 0.0, 0.0};
         std::array<double, 3> eyyp{0.0, 0.0, 0.0};
         std::array<double, 3> ezzp{0.0, 0.0, 0.0};
-        ComputeThreeBaseComponents(m_mesh.Node(nodeIndex), exxp, eyyp, ezzp);
+        ComputeThreeBaseComponents(node, exxp, eyyp, ezzp);
 
         // get 3D-coordinates in rotated frame
         const Cartesian3DPoint cartesianLocalPoint{SphericalToCartesian3D(localPoint)};
@@ -430,11 +661,11 @@ void OrthogonalizationAndSmoothing::UpdateNodeCoordinates(UInt nodeIndex)
         transformedCartesianLocalPoint.z = exxp[2] * cartesianLocalPoint.x + eyyp[2] * cartesianLocalPoint.y + ezzp[2] * cartesianLocalPoint.z;
 
         // transform to spherical coordinates
-        m_orthogonalCoordinates[nodeIndex] = Cartesian3DToSpherical(transformedCartesianLocalPoint, m_mesh.Node(nodeIndex).x);
+        m_orthogonalCoordinates[nodeIndex] = Cartesian3DToSpherical(transformedCartesianLocalPoint, node.x);
     }
 }
 
-void OrthogonalizationAndSmoothing::ComputeLocalIncrements(UInt nodeIndex, double& dx0, double& dy0, std::array<double, 2>& weightsSum)
+void OrthogonalizationAndSmoothing::ComputeLocalIncrements(UInt nodeIndex, const std::vector<Point>& nodes, double& dx0, double& dy0, std::array<double, 2>& weightsSum)
 {
     const auto numConnectedNodes = m_compressedStartNodeIndex[nodeIndex] - m_compressedEndNodeIndex[nodeIndex];
     auto cacheIndex = m_compressedEndNodeIndex[nodeIndex];
@@ -455,8 +686,8 @@ void OrthogonalizationAndSmoothing::ComputeLocalIncrements(UInt nodeIndex, doubl
         {
             const double wwxTransformed = wwx;
             const double wwyTransformed = wwy;
-            dx0 = dx0 + wwxTransformed * (m_mesh.Node(currentNode).x - m_mesh.Node(nodeIndex).x);
-            dy0 = dy0 + wwyTransformed * (m_mesh.Node(currentNode).y - m_mesh.Node(nodeIndex).y);
+            dx0 = dx0 + wwxTransformed * (nodes[currentNode].x - nodes[nodeIndex].x);
+            dy0 = dy0 + wwyTransformed * (nodes[currentNode].y - nodes[nodeIndex].y);
             weightsSum[0] += wwxTransformed;
             weightsSum[1] += wwyTransformed;
         }
@@ -464,11 +695,11 @@ void OrthogonalizationAndSmoothing::ComputeLocalIncrements(UInt nodeIndex, doubl
         if (m_mesh.m_projection == Projection::spherical)
         {
             const double wwxTransformed = wwx * constants::geometric::earth_radius * constants::conversion::degToRad *
-                                          std::cos(0.5 * (m_mesh.Node(nodeIndex).y + m_mesh.Node(currentNode).y) * constants::conversion::degToRad);
+                                          std::cos(0.5 * (nodes[nodeIndex].y + nodes[currentNode].y) * constants::conversion::degToRad);
             const double wwyTransformed = wwy * constants::geometric::earth_radius * constants::conversion::degToRad;
 
-            dx0 = dx0 + wwxTransformed * (m_mesh.Node(currentNode).x - m_mesh.Node(nodeIndex).x);
-            dy0 = dy0 + wwyTransformed * (m_mesh.Node(currentNode).y - m_mesh.Node(nodeIndex).y);
+            dx0 = dx0 + wwxTransformed * (nodes[currentNode].x - nodes[nodeIndex].x);
+            dy0 = dy0 + wwyTransformed * (nodes[currentNode].y - nodes[nodeIndex].y);
             weightsSum[0] += wwxTransformed;
             weightsSum[1] += wwyTransformed;
         }
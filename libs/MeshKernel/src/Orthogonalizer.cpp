@@ -42,10 +42,8 @@ Orthogonalizer::Orthogonalizer(const Mesh2D& mesh,
 
 void Orthogonalizer::Compute()
 {
-    UInt maxNumNeighbours = *(std::max_element(m_mesh.m_nodesNumEdges.begin(), m_mesh.m_nodesNumEdges.end())) + 1;
-
-    ResizeAndFill2DVector(m_weights, m_mesh.GetNumNodes(), maxNumNeighbours, true, 0.0);
-    ResizeAndFill2DVector(m_rhs, m_mesh.GetNumNodes(), 2, true, 0.0);
+    m_weights.SetRowSizes(m_mesh.m_nodesNumEdges, 0.0);
+    m_rhs.assign(m_mesh.GetNumNodes(), {0.0, 0.0});
 
     // Compute mesh aspect ratios
     m_mesh.ComputeAspectRatios(m_aspectRatios);
@@ -57,12 +55,15 @@ void Orthogonalizer::Compute()
             continue;
         }
 
-        for (UInt nn = 0; nn < m_mesh.GetNumNodesEdges(n); nn++)
+        const auto nodeEdges = m_mesh.NodeEdges(n);
+        const auto weights = m_weights[n];
+
+        for (UInt nn = 0; nn < nodeEdges.size(); nn++)
         {
 
-            const auto edgeIndex = m_mesh.m_nodesEdges[n][nn];
+            const auto edgeIndex = nodeEdges[nn];
             const auto aspectRatio = m_aspectRatios[edgeIndex];
-            m_weights[n][nn] = 0.0;
+            weights[nn] = 0.0;
 
             if (IsEqual(aspectRatio, constants::missing::doubleValue))
             {
@@ -70,7 +71,7 @@ void Orthogonalizer::Compute()
             }
 
             // internal nodes
-            m_weights[n][nn] = aspectRatio;
+            weights[nn] = aspectRatio;
 
             if (!m_mesh.IsEdgeOnBoundary(edgeIndex))
             {
@@ -78,7 +79,7 @@ void Orthogonalizer::Compute()
             }
 
             // boundary nodes
-            m_weights[n][nn] = 0.5 * aspectRatio;
+            weights[nn] = 0.5 * aspectRatio;
 
             // compute the edge length
             Point neighbouringNode = m_mesh.Node(m_nodesNodes[n][nn]);
@@ -99,11 +100,11 @@ void Orthogonalizer::Compute()
         }
 
         // normalize
-        double factor = std::accumulate(m_weights[n].begin(), m_weights[n].end(), 0.0);
+        double factor = std::accumulate(weights.begin(), weights.end(), 0.0);
         if (std::abs(factor) > 1e-14)
         {
             factor = 1.0 / factor;
-            for (auto& w : m_weights[n])
+            for (auto& w : weights)
                 w = w * factor;
             m_rhs[n][0] = factor * m_rhs[n][0];
             m_rhs[n][1] = factor * m_rhs[n][1];
@@ -73,6 +73,41 @@ void meshkernel::Polygon::Initialise()
     }
 
     m_boundingBox.Reset(m_nodes);
+    PrepareContainment();
+}
+
+void meshkernel::Polygon::PrepareContainment()
+{
+    m_slabIndex.Clear();
+    m_cartesian3DNodes.clear();
+
+    if (m_nodes.size() < constants::geometric::numNodesInTriangle)
+    {
+        return;
+    }
+
+    if (m_projection == Projection::sphericalAccurate)
+    {
+        // enlarge around polygon
+        const double enlargementFactor = 1.000001;
+
+        // TODO set to centre?
+        Point polygonCenter;
+        const Cartesian3DPoint polygonCenterCartesian3D{SphericalToCartesian3D(polygonCenter)};
+
+        m_cartesian3DNodes.reserve(m_nodes.size());
+        for (const auto& node : m_nodes)
+        {
+            const Cartesian3DPoint cartesian3DPoint{SphericalToCartesian3D(node)};
+            m_cartesian3DNodes.push_back({polygonCenterCartesian3D.x + enlargementFactor * (cartesian3DPoint.x - polygonCenterCartesian3D.x),
+                                          polygonCenterCartesian3D.y + enlargementFactor * (cartesian3DPoint.y - polygonCenterCartesian3D.y),
+                                          polygonCenterCartesian3D.z + enlargementFactor * (cartesian3DPoint.z - polygonCenterCartesian3D.z)});
+        }
+    }
+    else if (m_nodes.size() >= MinimumNumberOfIndexedNodes)
+    {
+        m_slabIndex.Build(m_nodes);
+    }
 }
 
 meshkernel::Polygon& meshkernel::Polygon::operator=(const Polygon& copy)
@@ -82,6 +117,8 @@ meshkernel::Polygon& meshkernel::Polygon::operator=(const Polygon& copy)
         m_nodes = copy.m_nodes;
         m_projection = copy.m_projection;
         m_boundingBox = copy.m_boundingBox;
+        m_slabIndex = copy.m_slabIndex;
+        m_cartesian3DNodes = copy.m_cartesian3DNodes;
     }
 
     return *this;
@@ -94,6 +131,8 @@ meshkernel::Polygon& meshkernel::Polygon::operator=(Polygon&& copy)
         m_nodes = std::move(copy.m_nodes);
         m_projection = copy.m_projection;
         m_boundingBox = copy.m_boundingBox;
+        m_slabIndex = std::move(copy.m_slabIndex);
+        m_cartesian3DNodes = std::move(copy.m_cartesian3DNodes);
     }
 
     return *this;
@@ -107,46 +146,73 @@ void meshkernel::Polygon::Reset(const std::vector<Point>& points,
     Initialise();
 }
 
-bool meshkernel::Polygon::ContainsCartesian(const Point& point) const
+bool meshkernel::Polygon::UpdateWindingNumber(UInt segment, const Point& point, int& windingNumber) const
 {
-    int windingNumber = 0;
+    const auto& firstNode = m_nodes[segment];
+    const auto& secondNode = m_nodes[segment + 1];
+
+    // TODO always Cartesian
+    // So Dx and Dy can be simplified (no branching)
+    // Then for 2 or more points, return multiple cross product values
+    const auto crossProductValue = crossProduct(firstNode, secondNode, firstNode, point, Projection::cartesian);
 
-    for (size_t n = 0; n < m_nodes.size() - 1; n++)
+    if (IsEqual(crossProductValue, 0.0))
     {
-        // TODO always Cartesian
-        // So Dx and Dy can be simplified (no branching)
-        // Then for 2 or more points, return multiple cross product values
-        const auto crossProductValue = crossProduct(m_nodes[n], m_nodes[n + 1], m_nodes[n], point, Projection::cartesian);
+        // check if is on the line or outside
+        const double deltaXSegment = GetDeltaXCartesian(firstNode, secondNode);
+        const double lambdaX = std::abs(deltaXSegment) > 0.0 ? GetDeltaXCartesian(firstNode, point) / deltaXSegment : 0.0;
 
-        if (IsEqual(crossProductValue, 0.0))
+        const double deltaYSegment = GetDeltaYCartesian(firstNode, secondNode);
+        const double lambdaY = std::abs(deltaYSegment) > 0.0 ? GetDeltaYCartesian(firstNode, point) / deltaYSegment : 0.0;
+
+        if (lambdaX >= 0.0 && lambdaX <= 1.0 && lambdaY >= 0.0 && lambdaY <= 1.0)
         {
-            // check if is on the line or outside
-            const double deltaXSegment = GetDeltaXCartesian(m_nodes[n], m_nodes[n + 1]);
-            const double lambdaX = std::abs(deltaXSegment) > 0.0 ? GetDeltaXCartesian(m_nodes[n], point) / deltaXSegment : 0.0;
+            return true;
+        }
+    }
 
-            const double deltaYSegment = GetDeltaYCartesian(m_nodes[n], m_nodes[n + 1]);
-            const double lambdaY = std::abs(deltaYSegment) > 0.0 ? GetDeltaYCartesian(m_nodes[n], point) / deltaYSegment : 0.0;
+    if (firstNode.y <= point.y) // an upward crossing
+    {
+        if (secondNode.y > point.y && crossProductValue > 0.0)
 
-            if (lambdaX >= 0.0 && lambdaX <= 1.0 && lambdaY >= 0.0 && lambdaY <= 1.0)
-            {
-                return true;
-            }
+        {
+            ++windingNumber; // have  a valid up intersect
         }
-
-        if (m_nodes[n].y <= point.y) // an upward crossing
+    }
+    else
+    {
+        if (secondNode.y <= point.y && crossProductValue < 0.0) // a downward crossing
         {
-            if (m_nodes[n + 1].y > point.y && crossProductValue > 0.0)
+            --windingNumber; // have  a valid down intersect
+        }
+    }
 
+    return false;
+}
+
+bool meshkernel::Polygon::ContainsCartesian(const Point& point) const
+{
+    int windingNumber = 0;
+
+    if (!m_slabIndex.Empty())
+    {
+        // only the segments whose y-range contains the point can cross its horizontal or contain it
+        for (const auto segment : m_slabIndex.Segments(point.y))
+        {
+            if (UpdateWindingNumber(segment, point, windingNumber))
             {
-                ++windingNumber; // have  a valid up intersect
+                return true;
             }
         }
-        else
+
+        return windingNumber != 0;
+    }
+
+    for (UInt n = 0; n + 1 < m_nodes.size(); n++)
+    {
+        if (UpdateWindingNumber(n, point, windingNumber))
         {
-            if (m_nodes[n + 1].y <= point.y && crossProductValue < 0.0) // a downward crossing
-            {
-                --windingNumber; // have  a valid down intersect
-            }
+            return true;
         }
     }
 
@@ -156,27 +222,8 @@ bool meshkernel::Polygon::ContainsCartesian(const Point& point) const
 
 bool meshkernel::Polygon::ContainsSphericalAccurate(const Point& point) const
 {
-    // get 3D polygon coordinates
-    std::vector<Cartesian3DPoint> cartesian3DPoints;
-    cartesian3DPoints.reserve(Size());
-
-    for (UInt i = 0; i < m_nodes.size(); ++i)
-    {
-        cartesian3DPoints.emplace_back(SphericalToCartesian3D(m_nodes[i]));
-    }
-
-    // enlarge around polygon
-    const double enlargementFactor = 1.000001;
-
-    // TODO set to centre?
-    Point polygonCenter;
-    const Cartesian3DPoint polygonCenterCartesian3D{SphericalToCartesian3D(polygonCenter)};
-    for (UInt i = 0; i < m_nodes.size(); ++i)
-    {
-        cartesian3DPoints[i].x = polygonCenterCartesian3D.x + enlargementFactor * (cartesian3DPoints[i].x - polygonCenterCartesian3D.x);
-        cartesian3DPoints[i].y = polygonCenterCartesian3D.y + enlargementFactor * (cartesian3DPoints[i].y - polygonCenterCartesian3D.y);
-        cartesian3DPoints[i].z = polygonCenterCartesian3D.z + enlargementFactor * (cartesian3DPoints[i].z - polygonCenterCartesian3D.z);
-    }
+    // the 3D polygon coordinates are prepared on construction
+    const auto& cartesian3DPoints = m_cartesian3DNodes;
 
     // convert point
     const Cartesian3DPoint pointCartesian3D{SphericalToCartesian3D(point)};
@@ -184,6 +231,7 @@ bool meshkernel::Polygon::ContainsSphericalAccurate(const Point& point) const
     // get test direction: e_lambda
     const double lambda = point.x * constants::conversion::degToRad;
     const Cartesian3DPoint ee{-std::sin(lambda), std::cos(lambda), 0.0};
+    const auto xpXe = VectorProduct(pointCartesian3D, ee);
     int inside = 0;
 
     // loop over the polygon nodes
@@ -191,7 +239,6 @@ bool meshkernel::Polygon::ContainsSphericalAccurate(const Point& point) const
     {
         const auto nextNode = NextCircularForwardIndex(i, static_cast<UInt>(m_nodes.size()));
         const auto xiXxip1 = VectorProduct(cartesian3DPoints[i], cartesian3DPoints[nextNode]);
-        const auto xpXe = VectorProduct(pointCartesian3D, ee);
 
         const double D = InnerProduct(xiXxip1, ee);
         double zeta = 0.0;
@@ -289,8 +336,9 @@ void meshkernel::Polygon::SnapToLandBoundary(const size_t startIndex, const size
         TranslateSphericalCoordinates(m_nodes);
     }
 
-    // Now update the bounding box
+    // Now update the bounding box and the containment data
     m_boundingBox.Reset(m_nodes);
+    PrepareContainment();
 }
 
 std::vector<double> meshkernel::Polygon::EdgeLengths() const
@@ -290,14 +290,14 @@ std::tuple<bool, meshkernel::UInt> Polygons::IsPointInPolygons(const Point& poin
 
     for (UInt i = 0; i < m_enclosures.size(); ++i)
     {
-        const PolygonalEnclosure& enclosure = m_enclosures[i];
+        const auto region = m_enclosures[i].ContainsRegion(point);
 
-        if (enclosure.ContainsRegion(point) == PolygonalEnclosure::Region::Exterior)
+        if (region == PolygonalEnclosure::Region::Exterior)
         {
             return {true, i};
         }
 
-        if (enclosure.ContainsRegion(point) == PolygonalEnclosure::Region::Interior)
+        if (region == PolygonalEnclosure::Region::Interior)
         {
             // Point can be found in an hole in the polygon
             break;
@@ -315,15 +315,17 @@ bool Polygons::IsPointInAnyPolygon(const Point& point) const
 
 std::vector<bool> Polygons::PointsInPolygons(const std::vector<Point>& points) const
 {
-    std::vector<bool> result(points.size(), false);
+    // the queries are independent, std::vector<bool> cannot be written concurrently
+    std::vector<Boolean> isInPolygons(points.size(), false);
 
-    for (UInt i = 0; i < points.size(); ++i)
+#pragma omp parallel for
+    for (int i = 0; i < static_cast<int>(points.size()); ++i)
     {
         const auto [isInPolygon, polygonIndex] = IsPointInPolygons(points[i]);
-        result[i] = isInPolygon;
+        isInPolygons[i] = isInPolygon;
     }
 
-    return result;
+    return {isInPolygons.begin(), isInPolygons.end()};
 }
 
 // TODO put in header.
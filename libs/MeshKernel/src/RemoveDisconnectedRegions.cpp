@@ -69,7 +69,7 @@ void meshkernel::RemoveDisconnectedRegions::LabelConnectedRegion(const Mesh2D& m
 
         // Get the neighbours of this node from the element-edge connectivity graph.
         // Only across faces
-        for (const UInt edge : mesh.m_facesEdges[currentElement])
+        for (const UInt edge : mesh.FaceEdges(currentElement))
         {
             const UInt neighbour = GetNeighbour(mesh.m_edgesFaces[edge], currentElement);
 
@@ -152,7 +152,7 @@ std::unique_ptr<meshkernel::UndoAction> meshkernel::RemoveDisconnectedRegions::R
         if (elementRegionId[i] != regionId)
         {
             ++numberOfElementsRemoved;
-            std::ranges::for_each(mesh.m_facesEdges[i], [&mesh, &removalAction](const UInt edge)
+            std::ranges::for_each(mesh.FaceEdges(i), [&mesh, &removalAction](const UInt edge)
                                   { removalAction->Add(mesh.DeleteEdge(edge)); });
             elementRegionId[i] = constants::missing::uintValue;
         }
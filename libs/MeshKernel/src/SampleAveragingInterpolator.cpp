@@ -29,6 +29,108 @@
 #include "MeshKernel/MeshEdgeCenters.hpp"
 #include "MeshKernel/Operations.hpp"
 
+#include <exception>
+
+namespace
+{
+    using meshkernel::Mesh2D;
+    using meshkernel::Point;
+    using meshkernel::UInt;
+
+    /// @brief Calls a function, in parallel, for the search polygon of each mesh node with a dual face
+    /// @param[in] mesh                 The mesh
+    /// @param[in] relativeSearchRadius The relative search radius scaling the dual faces
+    /// @param[in] function             The function called with the node index, the node, the polygon and the thread caches
+    template <class Caches, class Function>
+    void ForEachNodeSearchPolygon(const Mesh2D& mesh, const double relativeSearchRadius, Function&& function)
+    {
+        std::vector<Point> dualFacePolygon;
+        Caches caches;
+        std::exception_ptr exception;
+
+        const std::vector<Point> edgeCentres = meshkernel::algo::ComputeEdgeCentres(mesh);
+
+#pragma omp parallel for private(dualFacePolygon, caches)
+        for (int n = 0; n < static_cast<int>(mesh.GetNumNodes()); ++n)
+        {
+            try
+            {
+                mesh.MakeDualFace(edgeCentres, n, relativeSearchRadius, dualFacePolygon);
+
+                if (!dualFacePolygon.empty())
+                {
+                    function(static_cast<UInt>(n), mesh.Node(n), dualFacePolygon, caches);
+                }
+            }
+            catch (...)
+            {
+#pragma omp critical
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    /// @brief Calls a function, in parallel, for the search polygon of each mesh face
+    /// @param[in] mesh                 The mesh
+    /// @param[in] relativeSearchRadius The relative search radius scaling the faces around their mass centre
+    /// @param[in] function             The function called with the face index, the mass centre, the polygon and the thread caches
+    template <class Caches, class Function>
+    void ForEachFaceSearchPolygon(const Mesh2D& mesh, const double relativeSearchRadius, Function&& function)
+    {
+        std::vector<Point> polygonNodesCache;
+        Caches caches;
+        std::exception_ptr exception;
+
+#pragma omp parallel for private(polygonNodesCache, caches)
+        for (int f = 0; f < static_cast<int>(mesh.GetNumFaces()); ++f)
+        {
+            try
+            {
+                polygonNodesCache.clear();
+
+                for (UInt n = 0; n < mesh.GetNumFaceEdges(f); ++n)
+                {
+                    polygonNodesCache.emplace_back(mesh.m_facesMassCenters[f] + (mesh.Node(mesh.FaceNodes(f)[n]) - mesh.m_facesMassCenters[f]) * relativeSearchRadius);
+                }
+
+                // Close the polygon
+                polygonNodesCache.emplace_back(polygonNodesCache[0]);
+
+                function(static_cast<UInt>(f), mesh.m_facesMassCenters[f], polygonNodesCache, caches);
+            }
+            catch (...)
+            {
+#pragma omp critical
+                if (!exception)
+                {
+                    exception = std::current_exception();
+                }
+            }
+        }
+
+        if (exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    /// @brief The caches of a thread interpolating sample values
+    struct ValueCaches
+    {
+        std::vector<UInt> queryCache;                ///< The indices of the samples found
+        std::vector<meshkernel::Sample> sampleCache; ///< The samples averaged
+    };
+
+} // namespace
+
 std::vector<meshkernel::Point> meshkernel::SampleAveragingInterpolator::CombineCoordinates(const std::span<const double> xNodes,
                                                                                            const std::span<const double> yNodes)
 {
@@ -53,7 +155,7 @@ meshkernel::SampleAveragingInterpolator::SampleAveragingInterpolator(const std::
       m_strategy(averaging::AveragingStrategyFactory::GetAveragingStrategy(static_cast<AveragingInterpolation::Method>(interpolationParameters.method),
                                                                            interpolationParameters.minimum_number_of_samples,
                                                                            projection)),
-      m_nodeRTree(RTreeFactory::Create(projection))
+      m_nodeRTree(RTreeFactory::Create(projection, RTreeFactory::Type::Packed))
 {
     m_nodeRTree->BuildTree(m_samplePoints);
 }
@@ -67,7 +169,7 @@ meshkernel::SampleAveragingInterpolator::SampleAveragingInterpolator(const std::
       m_strategy(averaging::AveragingStrategyFactory::GetAveragingStrategy(static_cast<AveragingInterpolation::Method>(interpolationParameters.method),
                                                                            interpolationParameters.minimum_number_of_samples,
                                                                            projection)),
-      m_nodeRTree(RTreeFactory::Create(projection))
+      m_nodeRTree(RTreeFactory::Create(projection, RTreeFactory::Type::Packed))
 {
     m_nodeRTree->BuildTree(m_samplePoints);
 }
@@ -75,18 +177,19 @@ meshkernel::SampleAveragingInterpolator::SampleAveragingInterpolator(const std::
 void meshkernel::SampleAveragingInterpolator::Interpolate(const int propertyId, const std::span<const Point> interpolationNodes, std::span<double> result) const
 {
     const std::vector<double>& propertyValues = GetSampleData(propertyId);
+    std::vector<UInt> queryCache;
     std::vector<Sample> sampleCache;
-    sampleCache.reserve(100);
 
     double searchRadiusSquared = m_interpolationParameters.absolute_search_radius * m_interpolationParameters.absolute_search_radius;
 
-    for (size_t i = 0; i < interpolationNodes.size(); ++i)
+#pragma omp parallel for private(queryCache, sampleCache)
+    for (int i = 0; i < static_cast<int>(interpolationNodes.size()); ++i)
     {
-        m_nodeRTree->SearchPoints(interpolationNodes[i], searchRadiusSquared);
+        m_nodeRTree->SearchPoints(interpolationNodes[i], searchRadiusSquared, queryCache);
 
         double resultValue = constants::missing::doubleValue;
 
-        if (!m_nodeRTree->HasQueryResults())
+        if (queryCache.empty())
         {
             resultValue = constants::missing::doubleValue;
         }
@@ -94,9 +197,8 @@ void meshkernel::SampleAveragingInterpolator::Interpolate(const int propertyId,
         {
             sampleCache.clear();
 
-            for (UInt j = 0; j < m_nodeRTree->GetQueryResultSize(); ++j)
+            for (const auto sampleIndex : queryCache)
             {
-                auto const sampleIndex = m_nodeRTree->GetQueryResult(j);
                 auto const sampleValue = propertyValues[sampleIndex];
 
                 if (sampleValue == constants::missing::doubleValue)
@@ -165,124 +267,103 @@ void meshkernel::SampleAveragingInterpolator::GenerateSearchPolygon(const double
     }
 }
 
-double meshkernel::SampleAveragingInterpolator::GetSampleValueFromRTree(const int propertyId, const UInt index) const
-{
-    UInt sampleIndex = m_nodeRTree->GetQueryResult(index);
-    return GetSampleData(propertyId)[sampleIndex];
-}
-
-double meshkernel::SampleAveragingInterpolator::ComputeInterpolationResultFromNeighbors(const int propertyId,
-                                                                                        const Point& interpolationPoint,
-                                                                                        const std::vector<Point>& searchPolygon,
-                                                                                        const Projection projection,
-                                                                                        std::vector<Sample>& sampleCache) const
+bool meshkernel::SampleAveragingInterpolator::FindPolygonSamples(std::vector<Point>& polygon,
+                                                                 const Point& interpolationPoint,
+                                                                 const Projection projection,
+                                                                 std::vector<UInt>& sampleIndices) const
 {
-    sampleCache.clear();
+    if (!interpolationPoint.IsValid())
+    {
+        throw ConstraintError("Invalid interpolation point");
+    }
 
-    const std::vector<double>& propertyData(GetSampleData(propertyId));
+    GenerateSearchPolygon(m_interpolationParameters.relative_search_radius, interpolationPoint, polygon, projection);
 
-    Point polygonCentre{constants::missing::doubleValue, constants::missing::doubleValue};
+    const double searchRadiusSquared = GetSearchRadiusSquared(polygon, interpolationPoint, projection);
 
-    if (projection == Projection::sphericalAccurate)
+    if (searchRadiusSquared <= 0.0)
     {
-        polygonCentre = ComputeAverageCoordinate(searchPolygon, projection);
+        throw ConstraintError("Search radius: {} <= 0", searchRadiusSquared);
     }
 
-    BoundingBox boundingBox(searchPolygon);
+    m_nodeRTree->SearchPoints(interpolationPoint, searchRadiusSquared, sampleIndices);
 
-    for (UInt i = 0; i < m_nodeRTree->GetQueryResultSize(); ++i)
+    if (sampleIndices.empty() && m_interpolationParameters.use_closest_if_none_found)
     {
-        auto const sampleIndex = m_nodeRTree->GetQueryResult(i);
-        auto const sampleValue = propertyData[sampleIndex];
+        m_nodeRTree->SearchNearestPoint(interpolationPoint, sampleIndices);
+        return true;
+    }
 
-        if (sampleValue == constants::missing::doubleValue)
-        {
-            continue;
-        }
+    if (sampleIndices.empty())
+    {
+        return false;
+    }
 
-        const Point& samplePoint(m_samplePoints[sampleIndex]);
+    Point polygonCentre{constants::missing::doubleValue, constants::missing::doubleValue};
 
-        if (IsPointInPolygonNodes(samplePoint, searchPolygon, projection, boundingBox, polygonCentre))
-        {
-            sampleCache.emplace_back(samplePoint.x, samplePoint.y, sampleValue);
-        }
+    if (projection == Projection::sphericalAccurate)
+    {
+        polygonCentre = ComputeAverageCoordinate(polygon, projection);
     }
 
-    return m_strategy->Calculate(interpolationPoint, sampleCache);
+    BoundingBox boundingBox(polygon);
+
+    std::erase_if(sampleIndices, [&](const UInt sampleIndex)
+                  { return !IsPointInPolygonNodes(m_samplePoints[sampleIndex], polygon, projection, boundingBox, polygonCentre); });
+
+    return false;
 }
 
 double meshkernel::SampleAveragingInterpolator::ComputeOnPolygon(const int propertyId,
                                                                  std::vector<Point>& polygon,
                                                                  const Point& interpolationPoint,
                                                                  const Projection projection,
+                                                                 std::vector<UInt>& queryCache,
                                                                  std::vector<Sample>& sampleCache) const
 {
+    const std::vector<double>& propertyData(GetSampleData(propertyId));
 
-    if (!interpolationPoint.IsValid())
+    if (FindPolygonSamples(polygon, interpolationPoint, projection, queryCache))
     {
-        throw ConstraintError("Invalid interpolation point");
+        // the closest sample value is used as it is
+        return !queryCache.empty() ? propertyData[queryCache[0]] : constants::missing::doubleValue;
     }
 
-    GenerateSearchPolygon(m_interpolationParameters.relative_search_radius, interpolationPoint, polygon, projection);
-
-    const double searchRadiusSquared = GetSearchRadiusSquared(polygon, interpolationPoint, projection);
+    sampleCache.clear();
 
-    if (searchRadiusSquared <= 0.0)
+    for (const auto sampleIndex : queryCache)
     {
-        throw ConstraintError("Search radius: {} <= 0", searchRadiusSquared);
-    }
+        auto const sampleValue = propertyData[sampleIndex];
 
-    m_nodeRTree->SearchPoints(interpolationPoint, searchRadiusSquared);
+        if (sampleValue == constants::missing::doubleValue)
+        {
+            continue;
+        }
 
-    if (!m_nodeRTree->HasQueryResults() && m_interpolationParameters.use_closest_if_none_found)
-    {
-        m_nodeRTree->SearchNearestPoint(interpolationPoint);
-        return m_nodeRTree->HasQueryResults() ? GetSampleValueFromRTree(propertyId, 0) : constants::missing::doubleValue;
-    }
-    else if (m_nodeRTree->HasQueryResults())
-    {
-        return ComputeInterpolationResultFromNeighbors(propertyId, interpolationPoint, polygon, projection, sampleCache);
+        const Point& samplePoint(m_samplePoints[sampleIndex]);
+        sampleCache.emplace_back(samplePoint.x, samplePoint.y, sampleValue);
     }
 
-    return constants::missing::doubleValue;
+    return m_strategy->Calculate(interpolationPoint, sampleCache);
 }
 
 void meshkernel::SampleAveragingInterpolator::InterpolateAtNodes(const int propertyId, const Mesh2D& mesh,
                                                                  std::span<double>& result, std::span<double> xCoordinates, std::span<double> yCoordinates) const
 {
-    std::vector<Point> dualFacePolygon;
-    dualFacePolygon.reserve(MaximumNumberOfEdgesPerNode);
-    std::vector<Sample> sampleCache;
-    sampleCache.reserve(100);
+    std::ranges::fill(result, constants::missing::doubleValue);
     const bool saveInterpolationPoints = !xCoordinates.empty() && !yCoordinates.empty();
 
-    std::vector<Point> edgeCentres = algo::ComputeEdgeCentres(mesh);
-
-    for (UInt n = 0; n < mesh.GetNumNodes(); ++n)
-    {
-        mesh.MakeDualFace(edgeCentres, n, m_interpolationParameters.relative_search_radius, dualFacePolygon);
-
-        double resultValue = constants::missing::doubleValue;
-
-        if (!dualFacePolygon.empty())
-        {
-            const Point& node = mesh.Node(n);
-
-            if (saveInterpolationPoints)
-            {
-                xCoordinates[n] = node.x;
-                yCoordinates[n] = node.y;
-            }
-
-            resultValue = ComputeOnPolygon(propertyId,
-                                           dualFacePolygon,
-                                           node,
-                                           mesh.m_projection,
-                                           sampleCache);
-        }
-
-        result[n] = resultValue;
-    }
+    ForEachNodeSearchPolygon<ValueCaches>(mesh, m_interpolationParameters.relative_search_radius,
+                                          [&](const UInt n, const Point& node, std::vector<Point>& polygon, ValueCaches& caches)
+                                          {
+                                              if (saveInterpolationPoints)
+                                              {
+                                                  xCoordinates[n] = node.x;
+                                                  yCoordinates[n] = node.y;
+                                              }
+
+                                              result[n] = ComputeOnPolygon(propertyId, polygon, node, mesh.m_projection, caches.queryCache, caches.sampleCache);
+                                          });
 }
 
 void meshkernel::SampleAveragingInterpolator::InterpolateAtEdgeCentres(const Mesh2D& mesh,
@@ -321,37 +402,20 @@ void meshkernel::SampleAveragingInterpolator::InterpolateAtEdgeCentres(const Mes
 void meshkernel::SampleAveragingInterpolator::InterpolateAtFaces(const int propertyId, const Mesh2D& mesh,
                                                                  std::span<double>& result, std::span<double> xCoordinates, std::span<double> yCoordinates) const
 {
-    std::vector<Point> polygonNodesCache(MaximumNumberOfEdgesPerNode + 1);
     std::ranges::fill(result, constants::missing::doubleValue);
-    std::vector<Sample> sampleCache;
-    sampleCache.reserve(100);
     const bool saveInterpolationPoints = xCoordinates.size() != 0 && yCoordinates.size() != 0;
 
-    for (UInt f = 0; f < mesh.GetNumFaces(); ++f)
-    {
-        polygonNodesCache.clear();
-
-        for (UInt n = 0; n < mesh.GetNumFaceEdges(f); ++n)
-        {
-            polygonNodesCache.emplace_back(mesh.m_facesMassCenters[f] + (mesh.Node(mesh.m_facesNodes[f][n]) - mesh.m_facesMassCenters[f]) * m_interpolationParameters.relative_search_radius);
-        }
-
-        if (saveInterpolationPoints)
-        {
-            xCoordinates[f] = mesh.m_facesMassCenters[f].x;
-            yCoordinates[f] = mesh.m_facesMassCenters[f].y;
-        }
-
-        // Close the polygon
-        polygonNodesCache.emplace_back(polygonNodesCache[0]);
-
-        sampleCache.clear();
-        result[f] = ComputeOnPolygon(propertyId,
-                                     polygonNodesCache,
-                                     mesh.m_facesMassCenters[f],
-                                     mesh.m_projection,
-                                     sampleCache);
-    }
+    ForEachFaceSearchPolygon<ValueCaches>(mesh, m_interpolationParameters.relative_search_radius,
+                                          [&](const UInt f, const Point& massCentre, std::vector<Point>& polygon, ValueCaches& caches)
+                                          {
+                                              if (saveInterpolationPoints)
+                                              {
+                                                  xCoordinates[f] = massCentre.x;
+                                                  yCoordinates[f] = massCentre.y;
+                                              }
+
+                                              result[f] = ComputeOnPolygon(propertyId, polygon, massCentre, mesh.m_projection, caches.queryCache, caches.sampleCache);
+                                          });
 }
 
 void meshkernel::SampleAveragingInterpolator::Interpolate(const int propertyId, const Mesh2D& mesh, const Location location,
@@ -398,3 +462,132 @@ double meshkernel::SampleAveragingInterpolator::InterpolateValue(const int prope
 {
     return constants::missing::doubleValue;
 }
+
+bool meshkernel::SampleAveragingInterpolator::CanComputeOperator() const
+{
+    using enum AveragingInterpolation::Method;
+
+    const auto method = static_cast<AveragingInterpolation::Method>(m_interpolationParameters.method);
+    return method == SimpleAveraging || method == InverseWeightedDistance;
+}
+
+void meshkernel::SampleAveragingInterpolator::CheckOperatorMethod() const
+{
+    if (!CanComputeOperator())
+    {
+        throw ConstraintError("An interpolation operator can only be computed for the simple averaging and inverse weighted distance methods, method: {}",
+                              m_interpolationParameters.method);
+    }
+}
+
+meshkernel::SampleInterpolationOperator::Row meshkernel::SampleAveragingInterpolator::ComputeRow(const Point& interpolationPoint,
+                                                                                                 const std::vector<UInt>& sampleIndices) const
+{
+    const bool isInverseWeighted = static_cast<AveragingInterpolation::Method>(m_interpolationParameters.method) == AveragingInterpolation::Method::InverseWeightedDistance;
+
+    SampleInterpolationOperator::Row row;
+    row.sampleIndices = sampleIndices;
+    row.weights.resize(sampleIndices.size(), 1.0);
+    row.minimumWeightSum = static_cast<double>(m_interpolationParameters.minimum_number_of_samples);
+
+    if (isInverseWeighted)
+    {
+        for (UInt i = 0; i < sampleIndices.size(); ++i)
+        {
+            row.weights[i] = 1.0 / std::max(0.01, ComputeDistance(interpolationPoint, m_samplePoints[sampleIndices[i]], m_projection));
+        }
+    }
+
+    return row;
+}
+
+meshkernel::SampleInterpolationOperator::Row meshkernel::SampleAveragingInterpolator::ComputeRowOnPolygon(std::vector<Point>& polygon,
+                                                                                                          const Point& interpolationPoint,
+                                                                                                          const Projection projection,
+                                                                                                          std::vector<UInt>& queryCache) const
+{
+    if (FindPolygonSamples(polygon, interpolationPoint, projection, queryCache))
+    {
+        // the closest sample value is used as it is
+        return queryCache.empty() ? SampleInterpolationOperator::Row{} : SampleInterpolationOperator::Row{{queryCache[0]}, {1.0}, 0.0};
+    }
+
+    if (queryCache.empty())
+    {
+        return {};
+    }
+
+    return ComputeRow(interpolationPoint, queryCache);
+}
+
+std::vector<meshkernel::SampleInterpolationOperator::Row> meshkernel::SampleAveragingInterpolator::ComputeRowsAtNodes(const Mesh2D& mesh) const
+{
+    std::vector<SampleInterpolationOperator::Row> rows(mesh.GetNumNodes());
+
+    ForEachNodeSearchPolygon<std::vector<UInt>>(mesh, m_interpolationParameters.relative_search_radius,
+                                                [&](const UInt n, const Point& node, std::vector<Point>& polygon, std::vector<UInt>& queryCache)
+                                                { rows[n] = ComputeRowOnPolygon(polygon, node, mesh.m_projection, queryCache); });
+
+    return rows;
+}
+
+std::vector<meshkernel::SampleInterpolationOperator::Row> meshkernel::SampleAveragingInterpolator::ComputeRowsAtFaces(const Mesh2D& mesh) const
+{
+    std::vector<SampleInterpolationOperator::Row> rows(mesh.GetNumFaces());
+
+    ForEachFaceSearchPolygon<std::vector<UInt>>(mesh, m_interpolationParameters.relative_search_radius,
+                                                [&](const UInt f, const Point& massCentre, std::vector<Point>& polygon, std::vector<UInt>& queryCache)
+                                                { rows[f] = ComputeRowOnPolygon(polygon, massCentre, mesh.m_projection, queryCache); });
+
+    return rows;
+}
+
+meshkernel::SampleInterpolationOperator meshkernel::SampleAveragingInterpolator::ComputeOperator(const std::span<const Point> interpolationNodes) const
+{
+    CheckOperatorMethod();
+
+    std::vector<SampleInterpolationOperator::Row> rows(interpolationNodes.size());
+    std::vector<UInt> queryCache;
+
+    const double searchRadiusSquared = m_interpolationParameters.absolute_search_radius * m_interpolationParameters.absolute_search_radius;
+
+#pragma omp parallel for private(queryCache)
+    for (int i = 0; i < static_cast<int>(interpolationNodes.size()); ++i)
+    {
+        m_nodeRTree->SearchPoints(interpolationNodes[i], searchRadiusSquared, queryCache);
+
+        if (!queryCache.empty())
+        {
+            rows[i] = ComputeRow(interpolationNodes[i], queryCache);
+        }
+    }
+
+    return SampleInterpolationOperator(Size(), SampleInterpolationOperator::Normalisation::WeightSum, rows);
+}
+
+meshkernel::SampleInterpolationOperator meshkernel::SampleAveragingInterpolator::ComputeOperator(const Mesh2D& mesh, const Location location) const
+{
+    CheckOperatorMethod();
+
+    using enum Location;
+
+    if (location == Nodes)
+    {
+        return SampleInterpolationOperator(Size(), SampleInterpolationOperator::Normalisation::WeightSum, ComputeRowsAtNodes(mesh));
+    }
+
+    if (location == Edges)
+    {
+        // the values at the edge centres are the average of the values at the edge nodes
+        SampleInterpolationOperator interpolationOperator(Size(), SampleInterpolationOperator::Normalisation::WeightSum, ComputeRowsAtNodes(mesh));
+        interpolationOperator.SetRowPairs(mesh.Edges());
+        return interpolationOperator;
+    }
+
+    if (location == Faces)
+    {
+        return SampleInterpolationOperator(Size(), SampleInterpolationOperator::Normalisation::WeightSum, ComputeRowsAtFaces(mesh));
+    }
+
+    throw ConstraintError("Unknown location");
+}
@@ -0,0 +1,195 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include "MeshKernel/SampleInterpolationOperator.hpp"
+#include "MeshKernel/Constants.hpp"
+#include "MeshKernel/Exceptions.hpp"
+
+#include <utility>
+
+meshkernel::SampleInterpolationOperator::SampleInterpolationOperator(UInt numberOfSamples,
+                                                                     Normalisation normalisation,
+                                                                     const std::vector<Row>& rows)
+    : m_numberOfSamples(numberOfSamples),
+      m_normalisation(normalisation)
+{
+    m_offsets.resize(rows.size() + 1);
+    m_minimumWeightSums.resize(rows.size());
+
+    for (UInt r = 0; r < rows.size(); ++r)
+    {
+        if (rows[r].sampleIndices.size() != rows[r].weights.size())
+        {
+            throw ConstraintError("The number of sample indices and weights of row {} are different: {} /= {}",
+                                  r, rows[r].sampleIndices.size(), rows[r].weights.size());
+        }
+
+        m_offsets[r + 1] = m_offsets[r] + static_cast<UInt>(rows[r].sampleIndices.size());
+        m_minimumWeightSums[r] = rows[r].minimumWeightSum;
+    }
+
+    m_sampleIndices.reserve(m_offsets.back());
+    m_weights.reserve(m_offsets.back());
+
+    for (const auto& row : rows)
+    {
+        for (const auto sampleIndex : row.sampleIndices)
+        {
+            if (sampleIndex >= m_numberOfSamples)
+            {
+                throw ConstraintError("Sample index {} is out of range, number of samples: {}", sampleIndex, m_numberOfSamples);
+            }
+        }
+
+        m_sampleIndices.insert(m_sampleIndices.end(), row.sampleIndices.begin(), row.sampleIndices.end());
+        m_weights.insert(m_weights.end(), row.weights.begin(), row.weights.end());
+    }
+}
+
+void meshkernel::SampleInterpolationOperator::SetRowPairs(std::vector<Edge> rowPairs)
+{
+    for (const auto& [first, second] : rowPairs)
+    {
+        if ((first != constants::missing::uintValue && first >= NumberOfRows()) ||
+            (second != constants::missing::uintValue && second >= NumberOfRows()))
+        {
+            throw ConstraintError("Row pair ({}, {}) is out of range, number of rows: {}", first, second, NumberOfRows());
+        }
+    }
+
+    m_rowPairs = std::move(rowPairs);
+}
+
+std::span<const meshkernel::UInt> meshkernel::SampleInterpolationOperator::RowSampleIndices(UInt row) const
+{
+    return std::span<const UInt>(m_sampleIndices.data() + m_offsets[row], m_offsets[row + 1] - m_offsets[row]);
+}
+
+std::span<const double> meshkernel::SampleInterpolationOperator::RowWeights(UInt row) const
+{
+    return std::span<const double>(m_weights.data() + m_offsets[row], m_offsets[row + 1] - m_offsets[row]);
+}
+
+void meshkernel::SampleInterpolationOperator::Apply(std::span<const double> sampleValues, std::span<double> result) const
+{
+    if (sampleValues.size() != m_numberOfSamples)
+    {
+        throw ConstraintError("The sample data array does not have the same number of values as the operator: {} /= {}",
+                              sampleValues.size(), m_numberOfSamples);
+    }
+
+    if (result.size() != Size())
+    {
+        throw ConstraintError("The result array does not have the same number of values as the operator: {} /= {}",
+                              result.size(), Size());
+    }
+
+    if (m_rowPairs.empty())
+    {
+        ApplyRows(sampleValues, result);
+        return;
+    }
+
+    std::vector<double> rowValues(NumberOfRows());
+    ApplyRows(sampleValues, rowValues);
+
+#pragma omp parallel for
+    for (int i = 0; i < static_cast<int>(m_rowPairs.size()); ++i)
+    {
+        const auto& [first, second] = m_rowPairs[i];
+        result[i] = constants::missing::doubleValue;
+
+        if (first == constants::missing::uintValue || second == constants::missing::uintValue)
+        {
+            continue;
+        }
+
+        if (rowValues[first] != constants::missing::doubleValue && rowValues[second] != constants::missing::doubleValue)
+        {
+            result[i] = 0.5 * (rowValues[first] + rowValues[second]);
+        }
+    }
+}
+
+void meshkernel::SampleInterpolationOperator::ApplyRows(std::span<const double> sampleValues, std::span<double> rowValues) const
+{
+#pragma omp parallel for
+    for (int r = 0; r < static_cast<int>(NumberOfRows()); ++r)
+    {
+        const auto start = m_offsets[r];
+        const auto end = m_offsets[r + 1];
+
+        double value = constants::missing::doubleValue;
+
+        if (start != end && m_normalisation == Normalisation::None)
+        {
+            double sum = 0.0;
+            bool isValid = true;
+
+            for (UInt i = start; i < end; ++i)
+            {
+                const double sampleValue = sampleValues[m_sampleIndices[i]];
+
+                if (sampleValue == constants::missing::doubleValue)
+                {
+                    isValid = false;
+                    break;
+                }
+
+                sum += m_weights[i] * sampleValue;
+            }
+
+            value = isValid ? sum : constants::missing::doubleValue;
+        }
+        else if (start != end)
+        {
+            double sum = 0.0;
+            double weightSum = 0.0;
+
+            for (UInt i = start; i < end; ++i)
+            {
+                const double sampleValue = sampleValues[m_sampleIndices[i]];
+
+                if (sampleValue == constants::missing::doubleValue)
+                {
+                    continue;
+                }
+
+                sum += m_weights[i] * sampleValue;
+                weightSum += m_weights[i];
+            }
+
+            if (weightSum > 0.0 && weightSum >= m_minimumWeightSums[r])
+            {
+                value = sum / weightSum;
+            }
+        }
+
+        rowValues[r] = value;
+    }
+}
@@ -28,6 +28,8 @@
 #include "MeshKernel/SampleInterpolator.hpp"
 #include "MeshKernel/Exceptions.hpp"
 
+#include <utility>
+
 void meshkernel::SampleInterpolator::SetData(const int propertyId, const std::span<const double> sampleData)
 {
     if (Size() != sampleData.size())
@@ -39,6 +41,73 @@ void meshkernel::SampleInterpolator::SetData(const int propertyId, const std::sp
     m_sampleData[propertyId].assign(sampleData.begin(), sampleData.end());
 }
 
+void meshkernel::SampleInterpolator::RemoveData(const int propertyId)
+{
+    m_sampleData.erase(propertyId);
+}
+
+bool meshkernel::SampleInterpolator::HasSamePoints(const std::span<const double> xNodes, const std::span<const double> yNodes) const
+{
+    if (xNodes.size() != Size() || yNodes.size() != Size())
+    {
+        return false;
+    }
+
+    for (UInt i = 0; i < Size(); ++i)
+    {
+        const Point samplePoint = SamplePoint(i);
+
+        if (samplePoint.x != xNodes[i] || samplePoint.y != yNodes[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void meshkernel::SampleInterpolator::Interpolate(const std::span<const int> propertyIds, const Mesh2D& mesh, const Location location, std::span<double> result) const
+{
+    if (propertyIds.empty())
+    {
+        return;
+    }
+
+    if (result.size() % propertyIds.size() != 0)
+    {
+        throw ConstraintError("The result array size is not a multiple of the number of properties: {} /= {}",
+                              result.size(), propertyIds.size());
+    }
+
+    const size_t size = result.size() / propertyIds.size();
+
+    for (const int propertyId : propertyIds)
+    {
+        if (!Contains(propertyId))
+        {
+            throw ConstraintError("Sample interpolator does not contain the id: {}.", propertyId);
+        }
+    }
+
+    if (propertyIds.size() == 1 || !CanComputeOperator())
+    {
+        for (size_t i = 0; i < propertyIds.size(); ++i)
+        {
+            Interpolate(propertyIds[i], mesh, location, result.subspan(i * size, size));
+        }
+
+        return;
+    }
+
+    // Locate the interpolation points once, for all properties
+    const SampleInterpolationOperator interpolationOperator = ComputeOperator(mesh, location);
+
+    for (size_t i = 0; i < propertyIds.size(); ++i)
+    {
+        interpolationOperator.Apply(GetSampleData(propertyIds[i]), result.subspan(i * size, size));
+    }
+}
+
 const std::vector<double>& meshkernel::SampleInterpolator::GetSampleData(const int propertyId) const
 {
 
@@ -49,3 +118,24 @@ const std::vector<double>& meshkernel::SampleInterpolator::GetSampleData(const i
 
     return m_sampleData.at(propertyId);
 }
+
+void meshkernel::SampleInterpolator::SetOperator(const int operatorId, SampleInterpolationOperator interpolationOperator)
+{
+    if (Size() != interpolationOperator.NumberOfSamples())
+    {
+        throw ConstraintError("The interpolation operator does not have the same number of samples as the sample point set: {} /= {}",
+                              interpolationOperator.NumberOfSamples(), Size());
+    }
+
+    m_operators[operatorId] = std::move(interpolationOperator);
+}
+
+void meshkernel::SampleInterpolator::ApplyOperator(const int propertyId, const int operatorId, std::span<double> result) const
+{
+    if (!ContainsOperator(operatorId))
+    {
+        throw ConstraintError("The interpolation operator for id {}, has not been defined", operatorId);
+    }
+
+    m_operators.at(operatorId).Apply(GetSampleData(propertyId), result);
+}
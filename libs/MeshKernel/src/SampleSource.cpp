@@ -0,0 +1,126 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include "MeshKernel/SampleSource.hpp"
+#include "MeshKernel/Exceptions.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+using meshkernel::MappedSampleFile;
+using meshkernel::SampleVectorSource;
+
+void SampleVectorSource::Read(std::uint64_t first, UInt count, std::vector<Sample>& samples) const
+{
+    if (first + count > m_samples.size())
+    {
+        throw RangeError("SampleVectorSource::Read: The samples {} to {} are out of range, the source has {} samples.",
+                         first, first + count, m_samples.size());
+    }
+
+    samples.assign(m_samples.begin() + first, m_samples.begin() + first + count);
+}
+
+MappedSampleFile::MappedSampleFile(const std::string& fileName)
+{
+    try
+    {
+        m_file = boost::interprocess::file_mapping(fileName.c_str(), boost::interprocess::read_only);
+        m_region = boost::interprocess::mapped_region(m_file, boost::interprocess::read_only);
+    }
+    catch (const boost::interprocess::interprocess_exception& exception)
+    {
+        throw MeshKernelError("MappedSampleFile: Cannot map the sample file {}: {}", fileName, exception.what());
+    }
+
+    const auto* data = static_cast<const char*>(m_region.get_address());
+
+    if (m_region.get_size() < HeaderSize || std::memcmp(data, MagicNumber, sizeof(MagicNumber)) != 0)
+    {
+        throw MeshKernelError("MappedSampleFile: The file {} is not a sample file.", fileName);
+    }
+
+    std::memcpy(&m_size, data + sizeof(MagicNumber), sizeof(m_size));
+
+    // Compare the number of records with the header, HeaderSize + m_size * RecordSize can wrap around for a corrupt count
+    const std::uint64_t recordsSize = m_region.get_size() - HeaderSize;
+    if (recordsSize % RecordSize != 0 || m_size != recordsSize / RecordSize)
+    {
+        throw MeshKernelError("MappedSampleFile: The size of the sample file {}, {} bytes, does not match its {} samples.",
+                              fileName, m_region.get_size(), m_size);
+    }
+
+    // The samples are read sequentially
+    m_region.advise(boost::interprocess::mapped_region::advice_sequential);
+}
+
+void MappedSampleFile::Write(const std::string& fileName, std::span<const Sample> samples)
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+
+    if (!file)
+    {
+        throw MeshKernelError("MappedSampleFile::Write: Cannot open the sample file {}.", fileName);
+    }
+
+    const std::uint64_t size = samples.size();
+    file.write(MagicNumber, sizeof(MagicNumber));
+    file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+
+    for (const auto& sample : samples)
+    {
+        const double record[3] = {sample.x, sample.y, sample.value};
+        file.write(reinterpret_cast<const char*>(record), sizeof(record));
+    }
+
+    if (!file)
+    {
+        throw MeshKernelError("MappedSampleFile::Write: Cannot write the sample file {}.", fileName);
+    }
+}
+
+void MappedSampleFile::Read(std::uint64_t first, UInt count, std::vector<Sample>& samples) const
+{
+    if (first > m_size || count > m_size - first)
+    {
+        throw RangeError("MappedSampleFile::Read: The samples {} to {} are out of range, the file has {} samples.",
+                         first, first + count, m_size);
+    }
+
+    samples.resize(count);
+
+    const auto* records = static_cast<const char*>(m_region.get_address()) + HeaderSize + first * RecordSize;
+
+    for (UInt i = 0; i < count; ++i)
+    {
+        double record[3];
+        std::memcpy(record, records + i * RecordSize, RecordSize);
+        samples[i] = Sample(record[0], record[1], record[2]);
+    }
+}
@@ -36,27 +36,11 @@ void meshkernel::SampleTriangulationInterpolator::Interpolate(const int property
         throw ConstraintError("Sample interpolator does not contain the id: {}.", propertyId);
     }
 
-    std::vector<Point> meshPoints;
-    std::span<const Point> meshNodes;
-
     std::ranges::fill(xCoordinates, constants::missing::doubleValue);
     std::ranges::fill(yCoordinates, constants::missing::doubleValue);
 
-    switch (location)
-    {
-    case Location::Nodes:
-        meshNodes = std::span<const Point>(mesh.Nodes());
-        break;
-    case Location::Edges:
-        meshPoints = algo::ComputeEdgeCentres(mesh);
-        meshNodes = std::span<const Point>(meshPoints);
-        break;
-    case Location::Faces:
-        meshNodes = std::span<const Point>(mesh.m_facesMassCenters);
-        break;
-    default:
-        throw ConstraintError("Unknown location");
-    }
+    std::vector<Point> meshPoints;
+    const std::span<const Point> meshNodes = GetLocationPoints(mesh, location, meshPoints);
 
     if (!xCoordinates.empty() && !yCoordinates.empty())
     {
@@ -70,6 +54,22 @@ void meshkernel::SampleTriangulationInterpolator::Interpolate(const int property
     Interpolate(propertyId, meshNodes, result);
 }
 
+std::span<const meshkernel::Point> meshkernel::SampleTriangulationInterpolator::GetLocationPoints(const Mesh2D& mesh, const Location location, std::vector<Point>& meshPoints)
+{
+    switch (location)
+    {
+    case Location::Nodes:
+        return std::span<const Point>(mesh.Nodes());
+    case Location::Edges:
+        meshPoints = algo::ComputeEdgeCentres(mesh);
+        return std::span<const Point>(meshPoints);
+    case Location::Faces:
+        return std::span<const Point>(mesh.m_facesMassCenters);
+    default:
+        throw ConstraintError("Unknown location");
+    }
+}
+
 void meshkernel::SampleTriangulationInterpolator::Interpolate(const int propertyId, const std::span<const Point> interpolationNodes, std::span<double> result) const
 {
     if (!Contains(propertyId))
@@ -85,7 +85,11 @@ void meshkernel::SampleTriangulationInterpolator::Interpolate(const int property
 
     const std::vector<double>& propertyValues = GetSampleData(propertyId);
 
-    for (size_t i = 0; i < interpolationNodes.size(); ++i)
+    // The element of the previous point seeds the search, each thread interpolates a contiguous block of points
+    UInt elementId = constants::missing::uintValue;
+
+#pragma omp parallel for schedule(static) firstprivate(elementId)
+    for (int i = 0; i < static_cast<int>(interpolationNodes.size()); ++i)
     {
         result[i] = constants::missing::doubleValue;
 
@@ -94,7 +98,7 @@ void meshkernel::SampleTriangulationInterpolator::Interpolate(const int property
             continue;
         }
 
-        const UInt elementId = m_triangulation.FindNearestFace(interpolationNodes[i]);
+        elementId = m_triangulation.FindFace(interpolationNodes[i], elementId);
 
         if (elementId == constants::missing::uintValue)
         {
@@ -108,19 +112,8 @@ void meshkernel::SampleTriangulationInterpolator::Interpolate(const int property
     }
 }
 
-double meshkernel::SampleTriangulationInterpolator::InterpolateOnElement(const UInt elementId, const Point& interpolationPoint, const std::vector<double>& sampleValues) const
+std::optional<std::array<double, 3>> meshkernel::SampleTriangulationInterpolator::ComputeBarycentricWeights(const UInt elementId, const Point& interpolationPoint) const
 {
-    double result = constants::missing::doubleValue;
-
-    auto [id1, id2, id3] = m_triangulation.GetNodeIds(elementId);
-
-    if (sampleValues[id1] == constants::missing::doubleValue ||
-        sampleValues[id2] == constants::missing::doubleValue ||
-        sampleValues[id3] == constants::missing::doubleValue) [[unlikely]]
-    {
-        return result;
-    }
-
     auto [p1, p2, p3] = m_triangulation.GetNodes(elementId);
 
     const double a11 = GetDx(p1, p2, m_triangulation.GetProjection());
@@ -136,13 +129,36 @@ double meshkernel::SampleTriangulationInterpolator::InterpolateOnElement(const U
 
     if (std::abs(det) < 1e-12) [[unlikely]]
     {
-        return result;
+        return std::nullopt;
     }
 
     const double rlam = (a22 * b1 - a12 * b2) / det;
     const double rmhu = (a11 * b2 - a21 * b1) / det;
 
-    result = sampleValues[id1] + rlam * (sampleValues[id2] - sampleValues[id1]) + rmhu * (sampleValues[id3] - sampleValues[id1]);
+    return std::array<double, 3>{1.0 - rlam - rmhu, rlam, rmhu};
+}
+
+double meshkernel::SampleTriangulationInterpolator::InterpolateOnElement(const UInt elementId, const Point& interpolationPoint, const std::vector<double>& sampleValues) const
+{
+    double result = constants::missing::doubleValue;
+
+    auto [id1, id2, id3] = m_triangulation.GetNodeIds(elementId);
+
+    if (sampleValues[id1] == constants::missing::doubleValue ||
+        sampleValues[id2] == constants::missing::doubleValue ||
+        sampleValues[id3] == constants::missing::doubleValue) [[unlikely]]
+    {
+        return result;
+    }
+
+    const auto weights = ComputeBarycentricWeights(elementId, interpolationPoint);
+
+    if (!weights) [[unlikely]]
+    {
+        return result;
+    }
+
+    result = sampleValues[id1] + (*weights)[1] * (sampleValues[id2] - sampleValues[id1]) + (*weights)[2] * (sampleValues[id3] - sampleValues[id1]);
 
     return result;
 }
@@ -177,3 +193,57 @@ double meshkernel::SampleTriangulationInterpolator::InterpolateValue(const int p
 
     return result;
 }
+
+meshkernel::SampleInterpolationOperator meshkernel::SampleTriangulationInterpolator::ComputeOperator(const std::span<const Point> interpolationNodes) const
+{
+    std::vector<SampleInterpolationOperator::Row> rows(interpolationNodes.size());
+    UInt elementId = constants::missing::uintValue;
+
+#pragma omp parallel for schedule(static) firstprivate(elementId)
+    for (int i = 0; i < static_cast<int>(interpolationNodes.size()); ++i)
+    {
+        if (!interpolationNodes[i].IsValid())
+        {
+            continue;
+        }
+
+        elementId = m_triangulation.FindFace(interpolationNodes[i], elementId);
+
+        if (elementId == constants::missing::uintValue)
+        {
+            continue;
+        }
+
+        if (m_triangulation.PointIsInElement(interpolationNodes[i], elementId))
+        {
+            rows[i] = ComputeRowOnElement(elementId, interpolationNodes[i]);
+        }
+    }
+
+    return SampleInterpolationOperator(Size(), SampleInterpolationOperator::Normalisation::None, rows);
+}
+
+meshkernel::SampleInterpolationOperator meshkernel::SampleTriangulationInterpolator::ComputeOperator(const Mesh2D& mesh, const Location location) const
+{
+    std::vector<Point> meshPoints;
+    return ComputeOperator(GetLocationPoints(mesh, location, meshPoints));
+}
+
+meshkernel::SampleInterpolationOperator::Row meshkernel::SampleTriangulationInterpolator::ComputeRowOnElement(const UInt elementId, const Point& interpolationPoint) const
+{
+    SampleInterpolationOperator::Row row;
+
+    const auto weights = ComputeBarycentricWeights(elementId, interpolationPoint);
+
+    if (!weights) [[unlikely]]
+    {
+        return row;
+    }
+
+    auto [id1, id2, id3] = m_triangulation.GetNodeIds(elementId);
+
+    row.sampleIndices = {id1, id2, id3};
+    row.weights.assign(weights->begin(), weights->end());
+
+    return row;
+}
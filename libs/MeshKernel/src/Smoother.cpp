@@ -274,7 +274,7 @@ void Smoother::ComputeCellCircumcentreCoefficients(const UInt currentNode, const
         if (numFaceNodes == 3)
         {
             // for triangular faces
-            const auto nodeIndex = FindIndex(m_mesh.m_facesNodes[m_topologySharedFaces[currentTopology][f]], currentNode);
+            const auto nodeIndex = FindIndex(m_mesh.FaceNodes(m_topologySharedFaces[currentTopology][f]), currentNode);
             const auto nodeLeft = NextCircularBackwardIndex(nodeIndex, numFaceNodes);
             const auto nodeRight = NextCircularForwardIndex(nodeIndex, numFaceNodes);
 
@@ -316,7 +316,7 @@ void Smoother::ComputeNodeToNodeGradients(const UInt currentNode, const UInt cur
     for (UInt f = 0; f < m_topologySharedFaces[currentTopology].size(); f++)
     {
         // internal edge
-        if (!m_mesh.IsEdgeOnBoundary(m_mesh.m_nodesEdges[currentNode][f]))
+        if (!m_mesh.IsEdgeOnBoundary(m_mesh.NodeEdges(currentNode)[f]))
         {
             UInt rightNode;
             if (f == 0)
@@ -451,7 +451,7 @@ void Smoother::ComputeOperatorsNode(UInt currentNode, const MeshNodeType nodeTyp
     for (UInt f = 0; f < m_topologySharedFaces[currentTopology].size(); f++)
     {
 
-        const auto edgeIndex = m_mesh.m_nodesEdges[currentNode][f];
+        const auto edgeIndex = m_mesh.NodeEdges(currentNode)[f];
         const auto otherNode = OtherNodeOfEdge(m_mesh.GetEdge(edgeIndex), currentNode);
 
         const auto leftFace = m_mesh.m_edgesFaces[edgeIndex][0];
@@ -615,7 +615,7 @@ void Smoother::ComputeInternalAngle(const UInt currentNode,
                 nextNode = nextNode - numSharedFaces;
             }
 
-            phi = OptimalEdgeAngle(numFaceNodes, thetaSquare[f + 1], thetaSquare[nextNode], m_mesh.IsEdgeOnBoundary(m_mesh.m_nodesEdges[currentNode][f]));
+            phi = OptimalEdgeAngle(numFaceNodes, thetaSquare[f + 1], thetaSquare[nextNode], m_mesh.IsEdgeOnBoundary(m_mesh.NodeEdges(currentNode)[f]));
 
             if (numFaceNodes == 3)
             {
@@ -672,7 +672,7 @@ void Smoother::UpdateXiEtaForSharedFace(const UInt currentNode,
     double dTheta = 2.0 * M_PI / static_cast<double>(numFaceNodes);
 
     // determine the index of the current stencil node
-    const UInt nodeIndex = FindIndex(m_mesh.m_facesNodes[m_sharedFacesCache[currentFace]], currentNode);
+    const UInt nodeIndex = FindIndex(m_mesh.FaceNodes(m_sharedFacesCache[currentFace]), currentNode);
 
     // orientation of the face (necessary for folded cells)
     const auto previousNode = NextCircularForwardIndex(nodeIndex, numFaceNodes);
@@ -748,7 +748,7 @@ void Smoother::ComputeOptimalAngleForSharedFaces(const UInt currentNode,
                 nextNode = nextNode - numSharedFaces;
             }
 
-            dPhi0 = OptimalEdgeAngle(numFaceNodes, thetaSquare[f + 1], thetaSquare[nextNode], m_mesh.IsEdgeOnBoundary(m_mesh.m_nodesEdges[currentNode][f]));
+            dPhi0 = OptimalEdgeAngle(numFaceNodes, thetaSquare[f + 1], thetaSquare[nextNode], m_mesh.IsEdgeOnBoundary(m_mesh.NodeEdges(currentNode)[f]));
 
             if (numFaceNodes == 3)
             {
@@ -784,7 +784,7 @@ void Smoother::ComputeNodeXiEta(UInt currentNode)
     // loop over the connected edges
     for (UInt f = 0; f < numSharedFaces; f++)
     {
-        auto edgeIndex = m_mesh.m_nodesEdges[currentNode][f];
+        auto edgeIndex = m_mesh.NodeEdges(currentNode)[f];
         auto nextNode = m_connectedNodesCache[f + 1]; // the first entry is always the stencil node
         auto faceLeft = m_mesh.m_edgesFaces[edgeIndex][0];
         auto faceRight = faceLeft;
@@ -798,7 +798,7 @@ void Smoother::ComputeNodeXiEta(UInt currentNode)
         bool isSquare = true;
         for (UInt e = 0; e < m_mesh.GetNumNodesEdges(nextNode); e++)
         {
-            auto edge = m_mesh.m_nodesEdges[nextNode][e];
+            auto edge = m_mesh.NodeEdges(nextNode)[e];
             for (UInt ff = 0; ff < m_mesh.GetNumEdgesFaces(edge); ff++)
             {
                 auto face = m_mesh.m_edgesFaces[edge][ff];
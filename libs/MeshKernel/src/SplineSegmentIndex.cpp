@@ -0,0 +1,137 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include "MeshKernel/SplineSegmentIndex.hpp"
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+meshkernel::SplineSegmentIndex::SplineSegmentIndex(const std::vector<std::vector<Point>>& splineNodes, Projection projection)
+    : m_isIndexed(projection == Projection::cartesian)
+{
+    for (UInt s = 0; s < splineNodes.size(); ++s)
+    {
+        for (UInt n = 0; n + 1 < splineNodes[s].size(); ++n)
+        {
+            m_segments.push_back({s, n});
+        }
+    }
+
+    std::vector<BoundingBox> segmentBoxes(m_segments.size());
+
+#pragma omp parallel for
+    for (int i = 0; i < static_cast<int>(m_segments.size()); ++i)
+    {
+        const auto& [spline, segment] = m_segments[i];
+        segmentBoxes[i] = SegmentBoundingBox(splineNodes[spline][segment], splineNodes[spline][segment + 1]);
+    }
+
+    m_tree = PackedBoxTree(std::move(segmentBoxes));
+}
+
+meshkernel::BoundingBox meshkernel::SplineSegmentIndex::SegmentBoundingBox(const Point& first, const Point& second)
+{
+    auto box = BoundingBox::CreateBoundingBox(first, second);
+
+    // enlarge both directions by the largest extent, an axis aligned segment has a zero extent in the other direction
+    const double margin = RelativeMargin * std::max(box.Width(), box.Height());
+    return {{box.lowerLeft().x - margin, box.lowerLeft().y - margin},
+            {box.upperRight().x + margin, box.upperRight().y + margin}};
+}
+
+void meshkernel::SplineSegmentIndex::Search(const BoundingBox& box, std::vector<UInt>& segmentIndices) const
+{
+    if (m_isIndexed)
+    {
+        m_tree.Search(box, segmentIndices);
+        return;
+    }
+
+    segmentIndices.resize(m_segments.size());
+    for (UInt i = 0; i < segmentIndices.size(); ++i)
+    {
+        segmentIndices[i] = i;
+    }
+}
+
+void meshkernel::SplineSegmentIndex::FindSegments(const Point& first, const Point& second, std::vector<Segment>& segments) const
+{
+    std::vector<UInt> segmentIndices;
+    Search(SegmentBoundingBox(first, second), segmentIndices);
+
+    // the segments are stored in spline and segment order
+    std::ranges::sort(segmentIndices);
+
+    segments.clear();
+    segments.reserve(segmentIndices.size());
+    for (const auto i : segmentIndices)
+    {
+        segments.emplace_back(m_segments[i]);
+    }
+}
+
+std::vector<meshkernel::SplineSegmentIndex::SegmentPair> meshkernel::SplineSegmentIndex::FindSegmentPairs() const
+{
+    const auto size = static_cast<UInt>(m_segments.size());
+    std::vector<std::vector<SegmentPair>> segmentPairs(size);
+
+#pragma omp parallel
+    {
+        std::vector<UInt> segmentIndices;
+
+#pragma omp for schedule(dynamic, 64)
+        for (int i = 0; i < static_cast<int>(size); ++i)
+        {
+            const auto& segment = m_segments[i];
+            Search(m_tree.ItemBox(i), segmentIndices);
+
+            for (const auto j : segmentIndices)
+            {
+                const auto& other = m_segments[j];
+                if (other.spline > segment.spline)
+                {
+                    segmentPairs[i].push_back({segment.spline, other.spline, segment.segment, other.segment});
+                }
+            }
+        }
+    }
+
+    std::vector<SegmentPair> result;
+    for (auto& pairs : segmentPairs)
+    {
+        result.insert(result.end(), pairs.begin(), pairs.end());
+        pairs = std::vector<SegmentPair>();
+    }
+
+    std::ranges::sort(result, [](const SegmentPair& first, const SegmentPair& second)
+                      { return std::tie(first.firstSpline, first.secondSpline, first.firstSegment, first.secondSegment) <
+                               std::tie(second.firstSpline, second.secondSpline, second.firstSegment, second.secondSegment); });
+
+    return result;
+}
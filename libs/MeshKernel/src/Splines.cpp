@@ -26,6 +26,7 @@
 //------------------------------------------------------------------------------
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 
 #include <MeshKernel/CurvilinearGrid/CurvilinearGrid.hpp>
@@ -199,6 +200,7 @@ bool Splines::GetSplinesIntersection(UInt first,
                                   m_splineDerivatives[first],
                                   m_splineNodes[second],
                                   m_splineDerivatives[second],
+                                  std::nullopt,
                                   crossProductIntersection,
                                   intersectionAngle,
                                   intersectionPoint,
@@ -206,13 +208,93 @@ bool Splines::GetSplinesIntersection(UInt first,
                                   secondSplineRatio);
 }
 
+bool Splines::GetSplinesIntersection(UInt first,
+                                     UInt second,
+                                     std::span<const SegmentIndices> segmentPairs,
+                                     double& crossProductIntersection,
+                                     double& intersectionAngle,
+                                     Point& intersectionPoint,
+                                     double& firstSplineRatio,
+                                     double& secondSplineRatio) const
+{
+    return GetSplinesIntersection(m_splineNodes[first],
+                                  m_splineDerivatives[first],
+                                  m_splineNodes[second],
+                                  m_splineDerivatives[second],
+                                  segmentPairs,
+                                  crossProductIntersection,
+                                  intersectionAngle,
+                                  intersectionPoint,
+                                  firstSplineRatio,
+                                  secondSplineRatio);
+}
+
+void Splines::GetAllIntersections(const std::vector<Point>& spline,
+                                  std::vector<int>& splineIndices,
+                                  std::vector<double>& angles,
+                                  std::vector<double>& xCrossOver,
+                                  std::vector<double>& yCrossOver) const
+{
+    const SplineSegmentIndex segmentIndex(m_splineNodes, m_projection);
+    GetAllIntersections(spline, segmentIndex, splineIndices, angles, xCrossOver, yCrossOver);
+}
+
 void Splines::GetAllIntersections(const std::vector<Point>& spline,
+                                  const SplineSegmentIndex& segmentIndex,
                                   std::vector<int>& splineIndices,
                                   std::vector<double>& angles,
                                   std::vector<double>& xCrossOver,
                                   std::vector<double>& yCrossOver) const
 {
     std::vector<Point> splineDerivative(ComputeSplineDerivative(spline));
+    const auto numSplines = static_cast<UInt>(m_splineNodes.size());
+
+    // the candidate crossing segments of each spline, sorted by segment of the spline then segment of the other spline
+    std::vector<std::vector<SegmentIndices>> segmentPairs(numSplines);
+    if (segmentIndex.IsIndexed())
+    {
+        std::vector<SplineSegmentIndex::Segment> segments;
+        for (UInt n = 0; n + 1 < spline.size(); ++n)
+        {
+            segmentIndex.FindSegments(spline[n], spline[n + 1], segments);
+            for (const auto& [otherSpline, otherSegment] : segments)
+            {
+                segmentPairs[otherSpline].emplace_back(n, otherSegment);
+            }
+        }
+    }
+
+    std::vector<std::uint8_t> doesIntersect(numSplines, false);
+    std::vector<Point> intersectionPoints(numSplines);
+    std::vector<double> intersectionAngles(numSplines);
+
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < static_cast<int>(numSplines); ++i)
+    {
+        if (segmentIndex.IsIndexed() && segmentPairs[i].empty())
+        {
+            continue;
+        }
+
+        double intersectionCrossProduct;
+        double firstSplineLambda;
+        double secondSplineLambda;
+
+        std::optional<std::span<const SegmentIndices>> candidates;
+        if (segmentIndex.IsIndexed())
+        {
+            candidates = segmentPairs[i];
+        }
+
+        doesIntersect[i] = GetSplinesIntersection(spline, splineDerivative,
+                                                  m_splineNodes[i], m_splineDerivatives[i],
+                                                  candidates,
+                                                  intersectionCrossProduct,
+                                                  intersectionAngles[i],
+                                                  intersectionPoints[i],
+                                                  firstSplineLambda,
+                                                  secondSplineLambda);
+    }
 
     splineIndices.clear();
     splineIndices.reserve(m_splineNodes.size());
@@ -223,29 +305,14 @@ void Splines::GetAllIntersections(const std::vector<Point>& spline,
     yCrossOver.clear();
     yCrossOver.reserve(m_splineNodes.size());
 
-    for (size_t i = 0; i < m_splineNodes.size(); ++i)
+    for (UInt i = 0; i < numSplines; ++i)
     {
-
-        Point intersectionPoint;
-        double intersectionCrossProduct;
-        double intersectionAngle;
-        double firstSplineLambda;
-        double secondSplineLambda;
-
-        bool doesIntersect = GetSplinesIntersection(spline, splineDerivative,
-                                                    m_splineNodes[i], m_splineDerivatives[i],
-                                                    intersectionCrossProduct,
-                                                    intersectionAngle,
-                                                    intersectionPoint,
-                                                    firstSplineLambda,
-                                                    secondSplineLambda);
-
-        if (doesIntersect)
+        if (doesIntersect[i])
         {
             splineIndices.push_back(static_cast<int>(i));
-            xCrossOver.push_back(intersectionPoint.x);
-            yCrossOver.push_back(intersectionPoint.y);
-            angles.push_back(intersectionAngle);
+            xCrossOver.push_back(intersectionPoints[i].x);
+            yCrossOver.push_back(intersectionPoints[i].y);
+            angles.push_back(intersectionAngles[i]);
         }
     }
 }
@@ -254,6 +321,7 @@ bool Splines::GetSplinesIntersection(const std::vector<Point>& firstSpline,
                                      const std::vector<Point>& firstSplineDerivative,
                                      const std::vector<Point>& secondSpline,
                                      const std::vector<Point>& secondSplineDerivative,
+                                     std::optional<std::span<const SegmentIndices>> segmentPairs,
                                      double& crossProductIntersection,
                                      double& intersectionAngle,
                                      Point& intersectionPoint,
@@ -273,51 +341,78 @@ bool Splines::GetSplinesIntersection(const std::vector<Point>& firstSpline,
 
     intersectionAngle = constants::missing::doubleValue;
 
+    const auto checkSegments = [&](UInt n, UInt nn)
+    {
+        const auto [areCrossing,
+                    intersection,
+                    crossProduct,
+                    angle,
+                    firstRatio,
+                    secondRatio] = AreSegmentsCrossing(firstSpline[n],
+                                                       firstSpline[n + 1],
+                                                       secondSpline[nn],
+                                                       secondSpline[nn + 1],
+                                                       false,
+                                                       m_projection);
+
+        if (areCrossing)
+        {
+            intersectionAngle = angle;
+
+            if (numNodesFirstSpline == 2)
+            {
+                crossingDistance = std::min(minimumCrossingDistance, std::abs(firstRatio - 0.5));
+            }
+            else if (numNodesSecondSpline == 2)
+            {
+                crossingDistance = std::abs(secondRatio - 0.5);
+            }
+            else
+            {
+                crossingDistance = minimumCrossingDistance;
+            }
+
+            if (crossingDistance < minimumCrossingDistance || numCrossing == 0)
+            {
+                minimumCrossingDistance = crossingDistance;
+                numCrossing = 1;
+                firstCrossingIndex = n;            // TI0
+                secondCrossingIndex = nn;          // TJ0
+                firstCrossingRatio = firstRatio;   // SL
+                secondCrossingRatio = secondRatio; // SM
+            }
+        }
+        return intersection;
+    };
+
     // First find a valid crossing, the closest to spline central point
-    for (UInt n = 0; n < numNodesFirstSpline - 1; n++)
+    if (segmentPairs.has_value())
     {
-        for (UInt nn = 0; nn < numNodesSecondSpline - 1; nn++)
+        // the pairs that are not candidates do not cross, they are skipped keeping the order of the pairs
+        for (const auto& [n, nn] : *segmentPairs)
         {
-            const auto [areCrossing,
-                        intersection,
-                        crossProduct,
-                        angle,
-                        firstRatio,
-                        secondRatio] = AreSegmentsCrossing(firstSpline[n],
-                                                           firstSpline[n + 1],
-                                                           secondSpline[nn],
-                                                           secondSpline[nn + 1],
-                                                           false,
-                                                           m_projection);
+            checkSegments(n, nn);
+        }
 
-            if (areCrossing)
+        // the bisection starts from the intersection of the last pair of segments
+        if (numCrossing != 0)
+        {
+            closestIntersection = std::get<1>(AreSegmentsCrossing(firstSpline[numNodesFirstSpline - 2],
+                                                                  firstSpline[numNodesFirstSpline - 1],
+                                                                  secondSpline[numNodesSecondSpline - 2],
+                                                                  secondSpline[numNodesSecondSpline - 1],
+                                                                  false,
+                                                                  m_projection));
+        }
+    }
+    else
+    {
+        for (UInt n = 0; n < numNodesFirstSpline - 1; n++)
+        {
+            for (UInt nn = 0; nn < numNodesSecondSpline - 1; nn++)
             {
-                intersectionAngle = angle;
-
-                if (numNodesFirstSpline == 2)
-                {
-                    crossingDistance = std::min(minimumCrossingDistance, std::abs(firstRatio - 0.5));
-                }
-                else if (numNodesSecondSpline == 2)
-                {
-                    crossingDistance = std::abs(secondRatio - 0.5);
-                }
-                else
-                {
-                    crossingDistance = minimumCrossingDistance;
-                }
-
-                if (crossingDistance < minimumCrossingDistance || numCrossing == 0)
-                {
-                    minimumCrossingDistance = crossingDistance;
-                    numCrossing = 1;
-                    firstCrossingIndex = n;            // TI0
-                    secondCrossingIndex = nn;          // TJ0
-                    firstCrossingRatio = firstRatio;   // SL
-                    secondCrossingRatio = secondRatio; // SM
-                }
+                closestIntersection = checkSegments(n, nn);
             }
-            closestIntersection = intersection;
         }
     }
 
@@ -153,7 +153,7 @@ meshkernel::UInt meshkernel::SplitRowColumnOfMesh::OppositeEdgeId(const Mesh2D&
     }
 
     UInt oppositeEdgeIndex = (edgeIndex + 2) % constants::geometric::numNodesInQuadrilateral;
-    UInt oppositeEdgeId = mesh.m_facesEdges[elementId][oppositeEdgeIndex];
+    UInt oppositeEdgeId = mesh.FaceEdges(elementId)[oppositeEdgeIndex];
 
     return oppositeEdgeId;
 }
@@ -0,0 +1,180 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include "MeshKernel/TiledAveragingInterpolation.hpp"
+#include "MeshKernel/Exceptions.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using meshkernel::TiledAveragingInterpolation;
+
+TiledAveragingInterpolation::TiledAveragingInterpolation(Mesh2D& mesh,
+                                                         const SampleSource& samples,
+                                                         AveragingInterpolation::Method method,
+                                                         Location locationType,
+                                                         double relativeSearchRadius,
+                                                         UInt minNumSamples,
+                                                         UInt numTilesPerDirection,
+                                                         UInt chunkSize)
+    : m_mesh(mesh),
+      m_samples(samples),
+      m_method(method),
+      m_interpolationLocation(locationType),
+      m_relativeSearchRadius(relativeSearchRadius),
+      m_minNumSamples(minNumSamples),
+      m_numTilesPerDirection(numTilesPerDirection),
+      m_chunkSize(chunkSize)
+{
+    if (m_numTilesPerDirection == 0)
+    {
+        throw ConstraintError("TiledAveragingInterpolation: The number of tiles per direction must be positive.");
+    }
+
+    if (m_chunkSize == 0)
+    {
+        throw ConstraintError("TiledAveragingInterpolation: The chunk size must be positive.");
+    }
+}
+
+void TiledAveragingInterpolation::Compute()
+{
+    if (m_samples.Size() == 0)
+    {
+        throw AlgorithmError("TiledAveragingInterpolation::Compute: No samples available.");
+    }
+
+    const bool isFaceLocation = m_interpolationLocation == Location::Faces;
+
+    const std::vector<Point>& interpolationPoints = isFaceLocation ? m_mesh.m_facesMassCenters : m_mesh.Nodes();
+
+    for (const auto& point : interpolationPoints)
+    {
+        if (!point.IsValid())
+        {
+            throw std::invalid_argument("TiledAveragingInterpolation::Compute invalid interpolation point");
+        }
+    }
+
+    // The search areas only depend on the mesh, so they are computed without samples
+    std::vector<Sample> noSamples;
+    const AveragingInterpolation searchAreas(m_mesh, noSamples, m_method, m_interpolationLocation, m_relativeSearchRadius, false, false, m_minNumSamples);
+    const std::vector<BoundingBox> searchBoxes = searchAreas.ComputeSearchBoundingBoxes();
+
+    const std::vector<std::vector<UInt>> tileLocations = ComputeTileLocations(interpolationPoints);
+
+    std::vector<std::vector<double>> results(1, std::vector<double>(interpolationPoints.size(), constants::missing::doubleValue));
+    std::vector<Sample> tileSamples;
+    std::vector<std::vector<double>> tileValues(1);
+    m_maximumTileSize = 0;
+
+    for (const auto& locations : tileLocations)
+    {
+        if (locations.empty())
+        {
+            continue;
+        }
+
+        BoundingBox tileBox = CreateNonOverlappingBoundingBox();
+        for (const auto location : locations)
+        {
+            tileBox = Merge(tileBox, searchBoxes[location]);
+        }
+
+        ReadSamples(tileBox, tileSamples);
+        m_maximumTileSize = std::max(m_maximumTileSize, static_cast<UInt>(tileSamples.size()));
+
+        if (tileSamples.empty())
+        {
+            continue;
+        }
+
+        tileValues[0].resize(tileSamples.size());
+        std::ranges::transform(tileSamples, tileValues[0].begin(), [](const Sample& sample)
+                               { return sample.value; });
+
+        AveragingInterpolation tileInterpolation(m_mesh, tileSamples, m_method, m_interpolationLocation, m_relativeSearchRadius, false, false, m_minNumSamples);
+        tileInterpolation.ComputeProperties(tileValues, locations, results);
+    }
+
+    if (isFaceLocation)
+    {
+        m_faceResults = std::move(results[0]);
+        return;
+    }
+
+    m_nodeResults = std::move(results[0]);
+
+    if (m_interpolationLocation == Location::Edges)
+    {
+        m_edgeResults = searchAreas.ComputeEdgeResults(m_nodeResults);
+    }
+}
+
+std::vector<std::vector<meshkernel::UInt>> TiledAveragingInterpolation::ComputeTileLocations(const std::vector<Point>& interpolationPoints) const
+{
+    const BoundingBox boundingBox(interpolationPoints);
+    const double tileWidth = boundingBox.Width() / m_numTilesPerDirection;
+    const double tileHeight = boundingBox.Height() / m_numTilesPerDirection;
+
+    const auto tileIndex = [this](double coordinate, double origin, double tileSize)
+    {
+        if (tileSize <= 0.0)
+        {
+            return UInt{0};
+        }
+        const auto index = static_cast<UInt>(std::floor((coordinate - origin) / tileSize));
+        return std::min(index, m_numTilesPerDirection - 1);
+    };
+
+    std::vector<std::vector<UInt>> tileLocations(m_numTilesPerDirection * m_numTilesPerDirection);
+
+    for (UInt l = 0; l < interpolationPoints.size(); ++l)
+    {
+        const UInt column = tileIndex(interpolationPoints[l].x, boundingBox.lowerLeft().x, tileWidth);
+        const UInt row = tileIndex(interpolationPoints[l].y, boundingBox.lowerLeft().y, tileHeight);
+        tileLocations[row * m_numTilesPerDirection + column].emplace_back(l);
+    }
+
+    return tileLocations;
+}
+
+void TiledAveragingInterpolation::ReadSamples(const BoundingBox& boundingBox, std::vector<Sample>& samples) const
+{
+    samples.clear();
+
+    m_samples.ForEachChunk(m_chunkSize, [&boundingBox, &samples](std::uint64_t first [[maybe_unused]], std::span<const Sample> chunk)
+                           {
+                               for (const auto& sample : chunk)
+                               {
+                                   if (sample.IsValid() && boundingBox.Contains(sample))
+                                   {
+                                       samples.emplace_back(sample);
+                                   }
+                               } });
+}
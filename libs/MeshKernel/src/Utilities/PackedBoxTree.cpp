@@ -0,0 +1,115 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include "MeshKernel/Utilities/PackedBoxTree.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+meshkernel::PackedBoxTree::PackedBoxTree(std::vector<BoundingBox> itemBoxes)
+    : m_itemBoxes(std::move(itemBoxes))
+{
+    const auto numItems = static_cast<UInt>(m_itemBoxes.size());
+    m_items.reserve(numItems);
+    for (UInt i = 0; i < numItems; ++i)
+    {
+        if (m_itemBoxes[i].lowerLeft().x <= m_itemBoxes[i].upperRight().x)
+        {
+            m_items.emplace_back(i);
+        }
+    }
+
+    m_levelOffsets.emplace_back(0);
+    if (m_items.empty())
+    {
+        m_levelOffsets.emplace_back(0);
+        return;
+    }
+
+    // sort-tile-recursive: vertical slices sorted by x, each slice sorted by y
+    const auto centre = [this](UInt item)
+    { return m_itemBoxes[item].MassCentre(); };
+
+    std::ranges::sort(m_items, [&centre](UInt first, UInt second)
+                      { return centre(first).x < centre(second).x; });
+
+    const auto size = static_cast<UInt>(m_items.size());
+    const auto numLeaves = (size + NodeCapacity - 1) / NodeCapacity;
+    const auto numSlices = static_cast<UInt>(std::ceil(std::sqrt(static_cast<double>(numLeaves))));
+    const auto sliceSize = numSlices * NodeCapacity;
+
+#pragma omp parallel for
+    for (int s = 0; s < static_cast<int>(numSlices); ++s)
+    {
+        const auto begin = std::min(static_cast<UInt>(s) * sliceSize, size);
+        const auto end = std::min(begin + sliceSize, size);
+        std::sort(m_items.begin() + begin, m_items.begin() + end, [&centre](UInt first, UInt second)
+                  { return centre(first).y < centre(second).y; });
+    }
+
+    // the leaves bound runs of NodeCapacity items, the nodes of each level runs of NodeCapacity nodes of the level below
+    m_boxes.resize(numLeaves, CreateNonOverlappingBoundingBox());
+#pragma omp parallel for
+    for (int l = 0; l < static_cast<int>(numLeaves); ++l)
+    {
+        const auto begin = static_cast<UInt>(l) * NodeCapacity;
+        const auto end = std::min(begin + NodeCapacity, size);
+        for (auto i = begin; i < end; ++i)
+        {
+            m_boxes[l] = Merge(m_boxes[l], m_itemBoxes[m_items[i]]);
+        }
+    }
+    m_levelOffsets.emplace_back(numLeaves);
+
+    while (m_levelOffsets.back() - m_levelOffsets[m_levelOffsets.size() - 2] > 1)
+    {
+        const auto childrenBegin = m_levelOffsets[m_levelOffsets.size() - 2];
+        const auto childrenEnd = m_levelOffsets.back();
+        const auto numNodes = (childrenEnd - childrenBegin + NodeCapacity - 1) / NodeCapacity;
+
+        m_boxes.resize(childrenEnd + numNodes, CreateNonOverlappingBoundingBox());
+        for (UInt n = 0; n < numNodes; ++n)
+        {
+            const auto begin = childrenBegin + n * NodeCapacity;
+            const auto end = std::min(begin + NodeCapacity, childrenEnd);
+            for (auto c = begin; c < end; ++c)
+            {
+                m_boxes[childrenEnd + n] = Merge(m_boxes[childrenEnd + n], m_boxes[c]);
+            }
+        }
+        m_levelOffsets.emplace_back(childrenEnd + numNodes);
+    }
+}
+
+void meshkernel::PackedBoxTree::Search(const BoundingBox& box, std::vector<UInt>& items) const
+{
+    items.clear();
+    Search(box, [&items](UInt item)
+           {
+               items.emplace_back(item);
+               return true; });
+}
@@ -0,0 +1,584 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include "MeshKernel/Utilities/PackedRTree.hpp"
+
+#include "MeshKernel/Cartesian3DPoint.hpp"
+#include "MeshKernel/Constants.hpp"
+#include "MeshKernel/Exceptions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    /// @brief Sorts a range in parallel, the chunks are sorted concurrently and then merged pairwise
+    template <typename Iterator, typename Compare>
+    void ParallelSort(Iterator first, Iterator last, Compare compare)
+    {
+        constexpr std::ptrdiff_t minimumChunkSize = 1 << 15;
+        constexpr int maximumNumberOfChunks = 64;
+
+        const std::ptrdiff_t size = last - first;
+        int numChunks = 1;
+        while (numChunks < maximumNumberOfChunks && size / (2 * numChunks) >= minimumChunkSize)
+        {
+            numChunks *= 2;
+        }
+
+        std::vector<Iterator> bounds(numChunks + 1);
+        for (int c = 0; c <= numChunks; ++c)
+        {
+            bounds[c] = first + size * c / numChunks;
+        }
+
+#pragma omp parallel for
+        for (int c = 0; c < numChunks; ++c)
+        {
+            std::sort(bounds[c], bounds[c + 1], compare);
+        }
+
+        // the number of chunks is a power of two, so the chunks can always be merged pairwise
+        for (int width = 1; width < numChunks; width *= 2)
+        {
+#pragma omp parallel for
+            for (int c = 0; c < numChunks; c += 2 * width)
+            {
+                std::inplace_merge(bounds[c], bounds[c + width], bounds[c + 2 * width], compare);
+            }
+        }
+    }
+
+    /// @brief Sorts the entries with the sort-tile-recursive algorithm
+    ///
+    /// The entries are sorted along the first dimension and divided into slabs, each slab is then
+    /// sorted along the next dimension, recursively. The slabs of the first dimension are processed in parallel.
+    template <meshkernel::UInt Dimension, typename Entry>
+    void SortTileRecursive(std::span<Entry> entries, meshkernel::UInt dimension, meshkernel::UInt capacity)
+    {
+        using meshkernel::UInt;
+
+        const auto byCoordinate = [dimension](const Entry& first, const Entry& second)
+        { return first.coordinates[dimension] < second.coordinates[dimension]; };
+
+        if (dimension == 0)
+        {
+            ParallelSort(entries.begin(), entries.end(), byCoordinate);
+        }
+        else
+        {
+            std::sort(entries.begin(), entries.end(), byCoordinate);
+        }
+
+        if (dimension + 1 == Dimension || entries.size() <= capacity)
+        {
+            return;
+        }
+
+        const auto size = static_cast<UInt>(entries.size());
+        const UInt numLeaves = (size + capacity - 1) / capacity;
+        const auto numSlabs = static_cast<UInt>(std::ceil(std::pow(static_cast<double>(numLeaves), 1.0 / static_cast<double>(Dimension - dimension))));
+        const UInt slabSize = capacity * ((numLeaves + numSlabs - 1) / numSlabs);
+        const UInt numSlabsUsed = (size + slabSize - 1) / slabSize;
+
+#pragma omp parallel for if (dimension == 0)
+        for (int s = 0; s < static_cast<int>(numSlabsUsed); ++s)
+        {
+            const UInt start = static_cast<UInt>(s) * slabSize;
+            const UInt end = std::min(start + slabSize, size);
+            SortTileRecursive<Dimension>(entries.subspan(start, end - start), dimension + 1, capacity);
+        }
+    }
+} // namespace
+
+template <meshkernel::UInt Dimension>
+typename meshkernel::PackedRTree<Dimension>::Coordinates meshkernel::PackedRTree<Dimension>::Convert(const Point& point)
+{
+    if constexpr (Dimension == 2)
+    {
+        return {point.x, point.y};
+    }
+    else
+    {
+        const auto [x, y, z] = ComputeSphericalCoordinatesFromLatitudeAndLongitude(point);
+        return {x, y, z};
+    }
+}
+
+template <meshkernel::UInt Dimension>
+double meshkernel::PackedRTree<Dimension>::SquaredDistance(const Box& box, const Coordinates& point)
+{
+    double result = 0.0;
+    for (UInt d = 0; d < Dimension; ++d)
+    {
+        if (point[d] < box.lower[d])
+        {
+            const double delta = box.lower[d] - point[d];
+            result += delta * delta;
+        }
+        else if (point[d] > box.upper[d])
+        {
+            const double delta = point[d] - box.upper[d];
+            result += delta * delta;
+        }
+    }
+    return result;
+}
+
+template <meshkernel::UInt Dimension>
+bool meshkernel::PackedRTree<Dimension>::Overlaps(const Box& first, const Box& second)
+{
+    for (UInt d = 0; d < Dimension; ++d)
+    {
+        if (first.lower[d] > second.upper[d] || first.upper[d] < second.lower[d])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <meshkernel::UInt Dimension>
+double meshkernel::PackedRTree<Dimension>::SquaredDistance(const Coordinates& first, const Coordinates& second)
+{
+    double result = 0.0;
+    for (UInt d = 0; d < Dimension; ++d)
+    {
+        const double delta = first[d] - second[d];
+        result += delta * delta;
+    }
+    return result;
+}
+
+template <meshkernel::UInt Dimension>
+template <std::derived_from<meshkernel::Point> SourcePoint, typename Predicate>
+void meshkernel::PackedRTree<Dimension>::Build(const std::vector<SourcePoint>& sourcePoints, Predicate isIncluded)
+{
+    struct Entry
+    {
+        Coordinates coordinates; ///< The coordinates of the point
+        UInt index;              ///< The index of the point in the source vector
+    };
+
+    std::vector<UInt> included;
+    included.reserve(sourcePoints.size());
+    for (UInt n = 0; n < sourcePoints.size(); ++n)
+    {
+        if (sourcePoints[n].x != constants::missing::doubleValue &&
+            sourcePoints[n].y != constants::missing::doubleValue &&
+            isIncluded(sourcePoints[n]))
+        {
+            included.emplace_back(n);
+        }
+    }
+
+    const auto size = static_cast<UInt>(included.size());
+    std::vector<Entry> entries(size);
+
+#pragma omp parallel for
+    for (int i = 0; i < static_cast<int>(size); ++i)
+    {
+        entries[i] = {Convert(sourcePoints[included[i]]), included[i]};
+    }
+    included = std::vector<UInt>();
+
+    SortTileRecursive<Dimension>(std::span<Entry>(entries), 0, NodeCapacity);
+
+    m_size = size;
+    m_coordinates.resize(size);
+    m_indices.resize(size);
+
+#pragma omp parallel for
+    for (int i = 0; i < static_cast<int>(size); ++i)
+    {
+        m_coordinates[i] = entries[i].coordinates;
+        m_indices[i] = entries[i].index;
+    }
+    entries = std::vector<Entry>();
+
+    // the number of nodes of each level, from the leaves up to the root
+    m_levelOffsets.assign(1, 0);
+    UInt numChildren = size;
+    while (numChildren > 0)
+    {
+        const UInt numNodes = (numChildren + NodeCapacity - 1) / NodeCapacity;
+        m_levelOffsets.emplace_back(m_levelOffsets.back() + numNodes);
+        if (numNodes == 1)
+        {
+            break;
+        }
+        numChildren = numNodes;
+    }
+    m_boxes.resize(m_levelOffsets.back());
+
+    for (UInt level = 0; level + 1 < m_levelOffsets.size(); ++level)
+    {
+        const auto offset = m_levelOffsets[level];
+
+#pragma omp parallel for
+        for (int node = 0; node < static_cast<int>(NumberOfNodes(level)); ++node)
+        {
+            const auto [start, end] = Children(level, node);
+            Box box;
+            box.lower.fill(std::numeric_limits<double>::max());
+            box.upper.fill(std::numeric_limits<double>::lowest());
+
+            for (UInt c = start; c < end; ++c)
+            {
+                for (UInt d = 0; d < Dimension; ++d)
+                {
+                    const double lower = level == 0 ? m_coordinates[c][d] : m_boxes[m_levelOffsets[level - 1] + c].lower[d];
+                    const double upper = level == 0 ? m_coordinates[c][d] : m_boxes[m_levelOffsets[level - 1] + c].upper[d];
+                    box.lower[d] = std::min(box.lower[d], lower);
+                    box.upper[d] = std::max(box.upper[d], upper);
+                }
+            }
+            m_boxes[offset + node] = box;
+        }
+    }
+
+    m_positions.clear();
+    m_queryIndices.clear();
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::BuildTree(const std::vector<Point>& nodes)
+{
+    Build(nodes, [](const Point&)
+          { return true; });
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::BuildTree(const std::vector<Sample>& samples)
+{
+    Build(samples, [](const Sample&)
+          { return true; });
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::BuildTree(const std::vector<Point>& nodes, const BoundingBox& boundingBox)
+{
+    Build(nodes, [&boundingBox](const Point& p)
+          { return boundingBox.Contains(p); });
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::BuildTree(const std::vector<Sample>& samples, const BoundingBox& boundingBox)
+{
+    Build(samples, [&boundingBox](const Sample& p)
+          { return boundingBox.Contains(p); });
+}
+
+template <meshkernel::UInt Dimension>
+std::pair<meshkernel::UInt, meshkernel::UInt> meshkernel::PackedRTree<Dimension>::Children(UInt level, UInt node) const
+{
+    const auto numChildren = level == 0 ? static_cast<UInt>(m_indices.size()) : NumberOfNodes(level - 1);
+    const UInt start = node * NodeCapacity;
+    return {start, std::min(start + NodeCapacity, numChildren)};
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchRadius(UInt level,
+                                                      UInt node,
+                                                      const Coordinates& point,
+                                                      const Box& searchBox,
+                                                      double searchRadiusSquared,
+                                                      std::vector<UInt>& queryResult) const
+{
+    const auto [start, end] = Children(level, node);
+
+    if (level == 0)
+    {
+        for (UInt p = start; p < end; ++p)
+        {
+            if (SquaredDistance(m_coordinates[p], point) <= searchRadiusSquared &&
+                m_indices[p] != constants::missing::uintValue)
+            {
+                queryResult.emplace_back(m_indices[p]);
+            }
+        }
+        return;
+    }
+
+    // the overlap of the boxes is cheaper to evaluate than the distance between the point and the box
+    const auto childOffset = m_levelOffsets[level - 1];
+    for (UInt c = start; c < end; ++c)
+    {
+        if (Overlaps(m_boxes[childOffset + c], searchBox))
+        {
+            SearchRadius(level - 1, c, point, searchBox, searchRadiusSquared, queryResult);
+        }
+    }
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchNearest(UInt level,
+                                                       UInt node,
+                                                       const Coordinates& point,
+                                                       UInt numberOfNeighbours,
+                                                       double maximumDistanceSquared,
+                                                       NearestPoints& nearestPoints) const
+{
+    // the squared distance a point or a node must not exceed to be considered
+    const auto bound = [&]()
+    {
+        return nearestPoints.size() < numberOfNeighbours ? maximumDistanceSquared : nearestPoints.back().first;
+    };
+
+    const auto [start, end] = Children(level, node);
+
+    if (level == 0)
+    {
+        for (UInt p = start; p < end; ++p)
+        {
+            const auto distance = SquaredDistance(m_coordinates[p], point);
+            if (distance > bound() || m_indices[p] == constants::missing::uintValue)
+            {
+                continue;
+            }
+
+            const std::pair<double, UInt> nearestPoint{distance, m_indices[p]};
+            nearestPoints.insert(std::ranges::upper_bound(nearestPoints, nearestPoint), nearestPoint);
+            if (nearestPoints.size() > numberOfNeighbours)
+            {
+                nearestPoints.pop_back();
+            }
+        }
+        return;
+    }
+
+    // the children are visited by increasing distance, to tighten the bound as early as possible
+    std::array<std::pair<double, UInt>, NodeCapacity> children;
+    UInt numChildren = 0;
+    const auto childOffset = m_levelOffsets[level - 1];
+    for (UInt c = start; c < end; ++c)
+    {
+        const auto distance = SquaredDistance(m_boxes[childOffset + c], point);
+        if (distance > bound())
+        {
+            continue;
+        }
+
+        // insertion sort, the number of children is small
+        UInt position = numChildren;
+        while (position > 0 && children[position - 1].first > distance)
+        {
+            children[position] = children[position - 1];
+            --position;
+        }
+        children[position] = {distance, c};
+        ++numChildren;
+    }
+
+    for (UInt c = 0; c < numChildren; ++c)
+    {
+        if (children[c].first > bound())
+        {
+            break;
+        }
+        SearchNearest(level - 1, children[c].second, point, numberOfNeighbours, maximumDistanceSquared, nearestPoints);
+    }
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchNearest(const Coordinates& point,
+                                                       UInt numberOfNeighbours,
+                                                       double maximumDistanceSquared,
+                                                       std::vector<UInt>& queryResult) const
+{
+    queryResult.clear();
+    if (numberOfNeighbours == 0)
+    {
+        return;
+    }
+
+    NearestPoints nearestPoints;
+    const UInt rootLevel = static_cast<UInt>(m_levelOffsets.size()) - 2;
+    if (SquaredDistance(m_boxes[m_levelOffsets[rootLevel]], point) <= maximumDistanceSquared)
+    {
+        SearchNearest(rootLevel, 0, point, numberOfNeighbours, maximumDistanceSquared, nearestPoints);
+    }
+
+    for (const auto& [distance, index] : nearestPoints)
+    {
+        queryResult.emplace_back(index);
+    }
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchPoints(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const
+{
+    if (Empty())
+    {
+        throw AlgorithmError("RTree is empty, search cannot be performed");
+    }
+
+    queryResult.clear();
+    const auto point = Convert(node);
+    const auto searchRadius = std::sqrt(searchRadiusSquared);
+    Box searchBox;
+    for (UInt d = 0; d < Dimension; ++d)
+    {
+        searchBox.lower[d] = point[d] - searchRadius;
+        searchBox.upper[d] = point[d] + searchRadius;
+    }
+
+    const UInt rootLevel = static_cast<UInt>(m_levelOffsets.size()) - 2;
+    if (Overlaps(m_boxes[m_levelOffsets[rootLevel]], searchBox))
+    {
+        SearchRadius(rootLevel, 0, point, searchBox, searchRadiusSquared, queryResult);
+    }
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchNearestPoint(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const
+{
+    if (Empty())
+    {
+        throw AlgorithmError("RTree is empty, search cannot be performed");
+    }
+
+    SearchNearest(Convert(node), 1, searchRadiusSquared, queryResult);
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchNearestPoint(Point const& node, std::vector<UInt>& queryResult) const
+{
+    SearchNearestPoint(node, std::numeric_limits<double>::max(), queryResult);
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchPoints(Point const& node, double searchRadiusSquared)
+{
+    m_queryIndices.reserve(m_queryVectorCapacity);
+    SearchPoints(node, searchRadiusSquared, m_queryIndices);
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchNearestPoint(Point const& node, double searchRadiusSquared)
+{
+    m_queryIndices.reserve(m_queryVectorCapacity);
+    SearchNearestPoint(node, searchRadiusSquared, m_queryIndices);
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchNearestPoint(Point const& node)
+{
+    m_queryIndices.reserve(m_queryVectorCapacity);
+    SearchNearestPoint(node, m_queryIndices);
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchPoints(std::span<const Point> nodes, double searchRadiusSquared, RTreeQueryResults& queryResults) const
+{
+    SearchBatch(
+        static_cast<UInt>(nodes.size()),
+        [&](UInt n, std::vector<UInt>& queryResult)
+        { SearchPoints(nodes[n], searchRadiusSquared, queryResult); },
+        queryResults);
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchPoints(std::span<const Point> nodes, std::span<const double> searchRadiiSquared, RTreeQueryResults& queryResults) const
+{
+    if (nodes.size() != searchRadiiSquared.size())
+    {
+        throw ConstraintError("The number of nodes ({}) and the number of search radii ({}) are not equal", nodes.size(), searchRadiiSquared.size());
+    }
+
+    SearchBatch(
+        static_cast<UInt>(nodes.size()),
+        [&](UInt n, std::vector<UInt>& queryResult)
+        { SearchPoints(nodes[n], searchRadiiSquared[n], queryResult); },
+        queryResults);
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::SearchNearestPoints(std::span<const Point> nodes, UInt numberOfNeighbours, RTreeQueryResults& queryResults) const
+{
+    if (Empty() && !nodes.empty())
+    {
+        throw AlgorithmError("RTree is empty, search cannot be performed");
+    }
+
+    SearchBatch(
+        static_cast<UInt>(nodes.size()),
+        [&](UInt n, std::vector<UInt>& queryResult)
+        { SearchNearest(Convert(nodes[n]), numberOfNeighbours, std::numeric_limits<double>::max(), queryResult); },
+        queryResults);
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::DeleteNode(UInt position)
+{
+    if (Empty())
+    {
+        throw AlgorithmError("RTree is empty, deletion cannot performed");
+    }
+
+    // the positions in the tree are only needed for deletion, they are computed on the first one
+    if (m_positions.empty())
+    {
+        UInt maximumIndex = 0;
+        for (const auto index : m_indices)
+        {
+            if (index != constants::missing::uintValue)
+            {
+                maximumIndex = std::max(maximumIndex, index);
+            }
+        }
+
+        m_positions.assign(maximumIndex + 1, constants::missing::uintValue);
+        for (UInt p = 0; p < m_indices.size(); ++p)
+        {
+            if (m_indices[p] != constants::missing::uintValue)
+            {
+                m_positions[m_indices[p]] = p;
+            }
+        }
+    }
+
+    if (position >= m_positions.size() || m_positions[position] == constants::missing::uintValue)
+    {
+        return;
+    }
+
+    // the bounding boxes are not shrunk, they remain valid bounds of the remaining points
+    m_indices[m_positions[position]] = constants::missing::uintValue;
+    m_positions[position] = constants::missing::uintValue;
+    --m_size;
+}
+
+template <meshkernel::UInt Dimension>
+void meshkernel::PackedRTree<Dimension>::UpdateNode(UInt position, [[maybe_unused]] Point const& node)
+{
+    throw ConstraintError("The packed RTree does not support updating the node {}, the tree must be rebuilt", position);
+}
+
+template class meshkernel::PackedRTree<2>;
+template class meshkernel::PackedRTree<3>;
@@ -0,0 +1,126 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+#include "MeshKernel/Utilities/PolygonSlabIndex.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+meshkernel::PolygonSlabIndex::PolygonSlabIndex(std::span<const Point> nodes)
+{
+    Build(nodes);
+}
+
+void meshkernel::PolygonSlabIndex::Clear()
+{
+    m_slabSegments.Clear();
+    m_lowerY = 0.0;
+    m_upperY = 0.0;
+    m_inverseSlabHeight = 0.0;
+}
+
+void meshkernel::PolygonSlabIndex::Build(std::span<const Point> nodes)
+{
+    Clear();
+
+    if (nodes.size() < 2)
+    {
+        return;
+    }
+
+    const auto numSegments = static_cast<UInt>(nodes.size() - 1);
+
+    const auto [lowest, highest] = std::ranges::minmax_element(nodes, [](const Point& first, const Point& second)
+                                                               { return first.y < second.y; });
+    m_lowerY = lowest->y;
+    m_upperY = highest->y;
+    const double height = m_upperY - m_lowerY;
+
+    // the sum of the segment heights, relative to the polyline height, is the average number of segments crossed by a horizontal line
+    UInt numSlabs = 1;
+    if (height > 0.0)
+    {
+        double crossings = 0.0;
+        for (UInt s = 0; s < numSegments; ++s)
+        {
+            crossings += std::abs(nodes[s + 1].y - nodes[s].y) / height;
+        }
+        numSlabs = static_cast<UInt>(std::clamp(static_cast<double>(numSegments) / std::max(1.0, crossings), 1.0, static_cast<double>(numSegments)));
+        m_inverseSlabHeight = static_cast<double>(numSlabs) / height;
+    }
+
+    const auto isDegenerate = [&nodes](UInt s)
+    { return nodes[s].x == nodes[s + 1].x && nodes[s].y == nodes[s + 1].y; };
+
+    const auto slabRange = [this, &nodes, &isDegenerate, numSlabs](UInt s) -> std::pair<UInt, UInt>
+    {
+        if (isDegenerate(s))
+        {
+            return {0, numSlabs - 1};
+        }
+        const auto [lower, upper] = std::minmax(nodes[s].y, nodes[s + 1].y);
+        return {Slab(lower, numSlabs), Slab(upper, numSlabs)};
+    };
+
+    std::vector<UInt> numSlabSegments(numSlabs, 0);
+    for (UInt s = 0; s < numSegments; ++s)
+    {
+        const auto [first, last] = slabRange(s);
+        for (UInt slab = first; slab <= last; ++slab)
+        {
+            ++numSlabSegments[slab];
+        }
+    }
+
+    m_slabSegments.SetRowSizes(numSlabSegments);
+    std::ranges::fill(numSlabSegments, 0);
+    for (UInt s = 0; s < numSegments; ++s)
+    {
+        const auto [first, last] = slabRange(s);
+        for (UInt slab = first; slab <= last; ++slab)
+        {
+            m_slabSegments[slab][numSlabSegments[slab]++] = s;
+        }
+    }
+}
+
+meshkernel::UInt meshkernel::PolygonSlabIndex::Slab(double y, UInt numSlabs) const
+{
+    // rounding is monotonic, a segment is stored in the slab of any y in its y-range
+    const auto slab = static_cast<UInt>(std::max(0.0, std::floor((y - m_lowerY) * m_inverseSlabHeight)));
+    return std::min(slab, numSlabs - 1);
+}
+
+std::span<const meshkernel::UInt> meshkernel::PolygonSlabIndex::Segments(double y) const
+{
+    if (Empty() || y < m_lowerY || y > m_upperY)
+    {
+        return {};
+    }
+
+    return m_slabSegments[Slab(y, NumberOfSlabs())];
+}
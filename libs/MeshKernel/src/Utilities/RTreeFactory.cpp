@@ -1,16 +1,25 @@
 #include "MeshKernel/Utilities/RTreeFactory.hpp"
+#include "MeshKernel/Utilities/PackedRTree.hpp"
 #include "MeshKernel/Utilities/RTree.hpp"
 #include "MeshKernel/Utilities/RTreeSphericalToCartesian.hpp"
 
-std::unique_ptr<meshkernel::RTreeBase> meshkernel::RTreeFactory::Create(Projection projection)
+std::unique_ptr<meshkernel::RTreeBase> meshkernel::RTreeFactory::Create(Projection projection, Type type)
 {
     switch (projection)
     {
         using enum Projection;
     case cartesian:
+        if (type == Type::Packed)
+        {
+            return std::make_unique<PackedRTree<2>>();
+        }
         return std::make_unique<RTree<bg::cs::cartesian>>();
     case spherical:
     case sphericalAccurate:
+        if (type == Type::Packed)
+        {
+            return std::make_unique<PackedRTree<3>>();
+        }
         return std::make_unique<RTreeSphericalToCartesian>();
     default:
         throw MeshKernelError("Invalid projection '{}'", ProjectionToString(projection));
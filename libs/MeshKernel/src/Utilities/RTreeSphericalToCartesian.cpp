@@ -1,6 +1,7 @@
 #include "MeshKernel/Utilities/RTreeSphericalToCartesian.hpp"
 
 #include "MeshKernel/Cartesian3DPoint.hpp"
+#include "MeshKernel/Exceptions.hpp"
 
 #include <cmath>
 
@@ -10,78 +11,124 @@ meshkernel::RTreeSphericalToCartesian::Point3D meshkernel::RTreeSphericalToCarte
     return {x, y, z};
 }
 
-void meshkernel::RTreeSphericalToCartesian::Search(Point const& node, double searchRadiusSquared, bool findNearest)
+void meshkernel::RTreeSphericalToCartesian::Search(Point const& node, double searchRadiusSquared, double searchRadius, bool findNearest, std::vector<UInt>& queryResult) const
 {
     if (Empty())
     {
         throw AlgorithmError("RTree is empty, search cannot be performed");
     }
 
-    m_queryCache.reserve(m_queryVectorCapacity);
-    m_queryCache.clear();
+    queryResult.clear();
 
     const Point3D nodeSought = convert(node);
-    const auto searchRadius = std::sqrt(searchRadiusSquared);
     Box3D const box(Point3D(bg::get<0>(nodeSought) - searchRadius, bg::get<1>(nodeSought) - searchRadius, bg::get<2>(nodeSought) - searchRadius),
                     Point3D(bg::get<0>(nodeSought) + searchRadius, bg::get<1>(nodeSought) + searchRadius, bg::get<2>(nodeSought) + searchRadius));
 
     auto pointIsNearby = [&nodeSought, &searchRadiusSquared](Value3D const& v)
     { return bg::comparable_distance(v.first, nodeSought) <= searchRadiusSquared; };
 
-    if (findNearest)
-    {
-        m_rtree3D.query(bgi::within(box) && bgi::satisfies(pointIsNearby) && bgi::nearest(nodeSought, 1),
-                        std::back_inserter(m_queryCache));
-    }
-    else
-    {
-        m_rtree3D.query(bgi::within(box) && bgi::satisfies(pointIsNearby),
-                        std::back_inserter(m_queryCache));
-    }
-
-    m_queryIndices.clear();
+    // Only the indices are stored, the values are not copied into an intermediate vector
+    auto storeIndex = boost::make_function_output_iterator([&queryResult](Value3D const& v)
+                                                           { queryResult.emplace_back(v.second); });
 
-    if (findNearest && !m_queryCache.empty())
+    if (findNearest)
     {
-        m_queryIndices.emplace_back(m_queryCache[0].second);
+        m_rtree3D.query(bgi::within(box) && bgi::satisfies(pointIsNearby) && bgi::nearest(nodeSought, 1), storeIndex);
     }
     else
     {
-        for (const auto& entry : m_queryCache)
-        {
-            m_queryIndices.emplace_back(entry.second);
-        }
+        m_rtree3D.query(bgi::within(box) && bgi::satisfies(pointIsNearby), storeIndex);
     }
 }
 
 void meshkernel::RTreeSphericalToCartesian::SearchPoints(Point const& node, double searchRadiusSquared)
 {
-    Search(node, searchRadiusSquared, false);
+    m_queryIndices.reserve(m_queryVectorCapacity);
+    Search(node, searchRadiusSquared, std::sqrt(searchRadiusSquared), false, m_queryIndices);
 }
 
 void meshkernel::RTreeSphericalToCartesian::SearchNearestPoint(Point const& node, double searchRadiusSquared)
 {
-    Search(node, searchRadiusSquared, true);
+    m_queryIndices.reserve(m_queryVectorCapacity);
+    Search(node, searchRadiusSquared, std::sqrt(searchRadiusSquared), true, m_queryIndices);
 }
 
 void meshkernel::RTreeSphericalToCartesian::SearchNearestPoint(Point const& node)
+{
+    m_queryIndices.reserve(m_queryVectorCapacity);
+    SearchNearestPoint(node, m_queryIndices);
+}
+
+void meshkernel::RTreeSphericalToCartesian::SearchPoints(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const
+{
+    Search(node, searchRadiusSquared, std::sqrt(searchRadiusSquared), false, queryResult);
+}
+
+void meshkernel::RTreeSphericalToCartesian::SearchNearestPoint(Point const& node, double searchRadiusSquared, std::vector<UInt>& queryResult) const
+{
+    Search(node, searchRadiusSquared, std::sqrt(searchRadiusSquared), true, queryResult);
+}
+
+void meshkernel::RTreeSphericalToCartesian::SearchNearestPoint(Point const& node, std::vector<UInt>& queryResult) const
 {
     if (Empty())
     {
         throw AlgorithmError("RTree is empty, search cannot be performed");
     }
 
-    m_queryCache.reserve(m_queryVectorCapacity);
-    m_queryCache.clear();
+    queryResult.clear();
 
     const Point3D nodeSought = convert(node);
-    m_rtree3D.query(bgi::nearest(nodeSought, 1), std::back_inserter(m_queryCache));
+    m_rtree3D.query(bgi::nearest(nodeSought, 1),
+                    boost::make_function_output_iterator([&queryResult](Value3D const& v)
+                                                         { queryResult.emplace_back(v.second); }));
+}
+
+void meshkernel::RTreeSphericalToCartesian::SearchPoints(std::span<const Point> nodes, double searchRadiusSquared, RTreeQueryResults& queryResults) const
+{
+    // the square root is computed once for all nodes
+    const auto searchRadius = std::sqrt(searchRadiusSquared);
+    SearchBatch(
+        static_cast<UInt>(nodes.size()),
+        [&](UInt n, std::vector<UInt>& queryResult)
+        { Search(nodes[n], searchRadiusSquared, searchRadius, false, queryResult); },
+        queryResults);
+}
+
+void meshkernel::RTreeSphericalToCartesian::SearchPoints(std::span<const Point> nodes, std::span<const double> searchRadiiSquared, RTreeQueryResults& queryResults) const
+{
+    if (nodes.size() != searchRadiiSquared.size())
+    {
+        throw ConstraintError("The number of nodes ({}) and the number of search radii ({}) are not equal", nodes.size(), searchRadiiSquared.size());
+    }
+
+    SearchBatch(
+        static_cast<UInt>(nodes.size()),
+        [&](UInt n, std::vector<UInt>& queryResult)
+        { Search(nodes[n], searchRadiiSquared[n], std::sqrt(searchRadiiSquared[n]), false, queryResult); },
+        queryResults);
+}
 
-    if (!m_queryCache.empty())
+void meshkernel::RTreeSphericalToCartesian::SearchNearestPoints(std::span<const Point> nodes, UInt numberOfNeighbours, RTreeQueryResults& queryResults) const
+{
+    if (Empty() && !nodes.empty())
     {
-        m_queryIndices.clear();
-        m_queryIndices.emplace_back(m_queryCache[0].second);
+        throw AlgorithmError("RTree is empty, search cannot be performed");
     }
+
+    // the query iterators return the nearest values ordered by increasing distance
+    SearchBatch(
+        static_cast<UInt>(nodes.size()),
+        [&](UInt n, std::vector<UInt>& queryResult)
+        {
+            queryResult.clear();
+            const Point3D nodeSought = convert(nodes[n]);
+            for (auto it = m_rtree3D.qbegin(bgi::nearest(nodeSought, numberOfNeighbours)); it != m_rtree3D.qend(); ++it)
+            {
+                queryResult.emplace_back(it->second);
+            }
+        },
+        queryResults);
 }
 
 void meshkernel::RTreeSphericalToCartesian::DeleteNode(UInt position)
@@ -91,9 +138,48 @@ void meshkernel::RTreeSphericalToCartesian::DeleteNode(UInt position)
         throw AlgorithmError("RTree is empty, deletion cannot performed");
     }
 
-    if (const auto numberRemoved = m_rtree3D.remove(m_points3D[position]); numberRemoved != 1)
+    if (position >= m_positions.size() || m_positions[position] == constants::missing::uintValue)
     {
         return;
     }
-    m_points3D[position] = {Point3D{constants::missing::doubleValue, constants::missing::doubleValue, constants::missing::doubleValue}, std::numeric_limits<UInt>::max()};
+
+    auto& value = m_points3D[m_positions[position]];
+    if (const auto numberRemoved = m_rtree3D.remove(value); numberRemoved != 1)
+    {
+        return;
+    }
+    value = {Point3D{constants::missing::doubleValue, constants::missing::doubleValue, constants::missing::doubleValue}, std::numeric_limits<UInt>::max()};
+}
+
+void meshkernel::RTreeSphericalToCartesian::UpdateNode(UInt position, Point const& node)
+{
+    if (position >= m_positions.size())
+    {
+        m_positions.resize(position + 1, constants::missing::uintValue);
+    }
+
+    if (m_positions[position] == constants::missing::uintValue)
+    {
+        if (!node.IsValid())
+        {
+            return;
+        }
+
+        m_positions[position] = static_cast<UInt>(m_points3D.size());
+        m_points3D.emplace_back(Point3D{constants::missing::doubleValue, constants::missing::doubleValue, constants::missing::doubleValue}, std::numeric_limits<UInt>::max());
+    }
+
+    // the slot of the node is reused, the values of the tree are copies of the slots
+    auto& value = m_points3D[m_positions[position]];
+    if (value.second != std::numeric_limits<UInt>::max())
+    {
+        m_rtree3D.remove(value);
+        value = {Point3D{constants::missing::doubleValue, constants::missing::doubleValue, constants::missing::doubleValue}, std::numeric_limits<UInt>::max()};
+    }
+
+    if (node.IsValid())
+    {
+        value = {convert(node), position};
+        m_rtree3D.insert(value);
+    }
 }
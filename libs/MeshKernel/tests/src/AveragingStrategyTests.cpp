@@ -27,9 +27,11 @@
 
 #include <gtest/gtest.h>
 #include <memory>
+#include <type_traits>
 #include <utility>
 
 #include <MeshKernel/AveragingInterpolation.hpp>
+#include <MeshKernel/AveragingStrategies/AveragingKernels.hpp>
 #include <MeshKernel/AveragingStrategies/AveragingStrategyFactory.hpp>
 #include <MeshKernel/AveragingStrategies/ClosestAveragingStrategy.hpp>
 
@@ -147,4 +149,95 @@ namespace meshkernel::averaging
                              CalculateWithAddedValuesTest,
                              ::testing::ValuesIn(CalculateWithAddedValuesTest::GetData()));
 
+    class KernelAndStrategyGiveTheSameResultsTest : public ::testing::TestWithParam<AveragingInterpolation::Method>
+    {
+    public:
+        [[nodiscard]] static std::vector<AveragingInterpolation::Method> GetData()
+        {
+            return {
+                AveragingInterpolation::Method::SimpleAveraging,
+                AveragingInterpolation::Method::Closest,
+                AveragingInterpolation::Method::Max,
+                AveragingInterpolation::Method::Min,
+                AveragingInterpolation::Method::InverseWeightedDistance,
+                AveragingInterpolation::Method::MinAbsValue,
+            };
+        }
+
+        /// @brief Computes the average by adding the samples to the kernel of the method one at the time
+        [[nodiscard]] static double ComputeWithKernel(AveragingInterpolation::Method method,
+                                                      const Point& interpolationPoint,
+                                                      const std::vector<Sample>& samples,
+                                                      size_t minNumSamples)
+        {
+            double result = 0.0;
+            VisitAveragingKernel(method, [&]<class Kernel>(std::type_identity<Kernel>)
+                                 {
+                                     Kernel kernel(interpolationPoint, minNumSamples, Projection::cartesian);
+                                     for (const auto& sample : samples)
+                                     {
+                                         kernel.Add(sample, sample.value);
+                                     }
+                                     result = kernel.Result(); });
+            return result;
+        }
+    };
+
+    TEST_P(KernelAndStrategyGiveTheSameResultsTest, expected_results)
+    {
+        const auto method = GetParam();
+        const Point interpolationPoint(0.5, -0.25);
+        constexpr size_t minNumSamples = 3;
+
+        const std::vector<Sample> allSamples{{4.0, 2.0, 5.0},
+                                             {-3.0, 1.0, -3.0},
+                                             {2.0, -3.0, 2.0},
+                                             {0.5, -0.25, -7.5},
+                                             {-1.0, -2.0, -1.0},
+                                             {0.5, -0.2, 0.25}};
+
+        const auto strategy = AveragingStrategyFactory::GetAveragingStrategy(method, minNumSamples, Projection::cartesian);
+
+        // From no samples, below and at the minimum number of samples, up to all samples
+        for (size_t numSamples = 0; numSamples <= allSamples.size(); ++numSamples)
+        {
+            const std::vector samples(allSamples.begin(), allSamples.begin() + static_cast<std::ptrdiff_t>(numSamples));
+
+            const double kernelResult = ComputeWithKernel(method, interpolationPoint, samples, minNumSamples);
+            const double strategyResult = strategy->Calculate(interpolationPoint, samples);
+
+            EXPECT_EQ(kernelResult, strategyResult) << "number of samples: " << numSamples;
+
+            if (numSamples == 0)
+            {
+                EXPECT_EQ(constants::missing::doubleValue, kernelResult);
+            }
+        }
+
+        // Only the simple averaging and the inverse weighted distance use the minimum number of samples,
+        // the latter compares it with the sum of the weights, which is small for the first samples
+        const std::vector belowMinimum(allSamples.begin(), allSamples.begin() + minNumSamples - 1);
+        const double belowMinimumResult = ComputeWithKernel(method, interpolationPoint, belowMinimum, minNumSamples);
+
+        if (method == AveragingInterpolation::Method::SimpleAveraging ||
+            method == AveragingInterpolation::Method::InverseWeightedDistance)
+        {
+            EXPECT_EQ(constants::missing::doubleValue, belowMinimumResult);
+        }
+        else
+        {
+            EXPECT_NE(constants::missing::doubleValue, belowMinimumResult);
+        }
+
+        const std::vector atMinimum(allSamples.begin(), allSamples.begin() + minNumSamples);
+        if (method != AveragingInterpolation::Method::InverseWeightedDistance)
+        {
+            EXPECT_NE(constants::missing::doubleValue, ComputeWithKernel(method, interpolationPoint, atMinimum, minNumSamples));
+        }
+    }
+
+    INSTANTIATE_TEST_SUITE_P(AveragingStrategyTest,
+                             KernelAndStrategyGiveTheSameResultsTest,
+                             ::testing::ValuesIn(KernelAndStrategyGiveTheSameResultsTest::GetData()));
+
 } // namespace meshkernel::averaging
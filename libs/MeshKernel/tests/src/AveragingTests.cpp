@@ -28,7 +28,17 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+
 #include <MeshKernel/AveragingInterpolation.hpp>
+#include <MeshKernel/Exceptions.hpp>
+#include <MeshKernel/SampleSource.hpp>
+#include <MeshKernel/TiledAveragingInterpolation.hpp>
 #include <TestUtils/Definitions.hpp>
 #include <TestUtils/MakeMeshes.hpp>
 #include <TestUtils/SampleFileReader.hpp>
@@ -840,3 +850,238 @@ TEST(Averaging, Interpolate_WithSamplesOnNodes_ShouldNotExtendSampleCoverage)
 
     ASSERT_THAT(interpolationResults, ::testing::ContainerEq(expectedInterpolationResults));
 }
+
+TEST(Averaging, ComputeProperties_WithSeveralProperties_ShouldEqualSeparateInterpolations)
+{
+    // Setup
+    auto mesh = MakeRectangularMeshForTesting(11, 11, 1.0, meshkernel::Projection::cartesian);
+
+    const meshkernel::UInt numberOfProperties = 3;
+    std::vector<meshkernel::Sample> samples;
+    std::vector<std::vector<double>> sampleValues(numberOfProperties);
+
+    for (meshkernel::UInt i = 0; i < 40; ++i)
+    {
+        for (meshkernel::UInt j = 0; j < 40; ++j)
+        {
+            const double x = 0.25 * i + 0.01 * static_cast<double>((7 * j) % 5);
+            const double y = 0.25 * j + 0.01 * static_cast<double>((3 * i) % 5);
+            samples.emplace_back(x, y, 0.0);
+
+            sampleValues[0].emplace_back(x + y);
+            sampleValues[1].emplace_back(std::sin(x) * std::cos(y));
+            // The third property has missing values
+            sampleValues[2].emplace_back((i + j) % 7 == 0 ? meshkernel::constants::missing::doubleValue : x - 2.0 * y);
+        }
+    }
+
+    const std::vector methods{meshkernel::AveragingInterpolation::Method::SimpleAveraging,
+                              meshkernel::AveragingInterpolation::Method::Closest,
+                              meshkernel::AveragingInterpolation::Method::Max,
+                              meshkernel::AveragingInterpolation::Method::Min,
+                              meshkernel::AveragingInterpolation::Method::InverseWeightedDistance,
+                              meshkernel::AveragingInterpolation::Method::MinAbsValue};
+
+    const std::vector locations{meshkernel::Location::Nodes, meshkernel::Location::Edges, meshkernel::Location::Faces};
+
+    for (const auto method : methods)
+    {
+        for (const auto location : locations)
+        {
+            // Execute
+            meshkernel::AveragingInterpolation averaging(*mesh, samples, method, location, 1.5, false, false, 1);
+            const auto results = averaging.ComputeProperties(sampleValues);
+
+            // Assert: each property equals the interpolation of that property alone
+            ASSERT_EQ(results.size(), numberOfProperties);
+
+            for (meshkernel::UInt p = 0; p < numberOfProperties; ++p)
+            {
+                std::vector<meshkernel::Sample> propertySamples(samples);
+                for (meshkernel::UInt s = 0; s < samples.size(); ++s)
+                {
+                    propertySamples[s].value = sampleValues[p][s];
+                }
+
+                meshkernel::AveragingInterpolation propertyAveraging(*mesh, propertySamples, method, location, 1.5, false, false, 1);
+                propertyAveraging.Compute();
+
+                const auto& expected = location == meshkernel::Location::Nodes   ? propertyAveraging.GetNodeResults()
+                                       : location == meshkernel::Location::Edges ? propertyAveraging.GetEdgeResults()
+                                                                                 : propertyAveraging.GetFaceResults();
+                EXPECT_THAT(results[p], ::testing::ContainerEq(expected));
+            }
+        }
+    }
+}
+
+TEST(Averaging, ComputeProperties_WithWrongNumberOfValues_ShouldThrow)
+{
+    auto mesh = MakeRectangularMeshForTesting(5, 5, 1.0, meshkernel::Projection::cartesian);
+    std::vector<meshkernel::Sample> samples{{1.5, 1.5, 2.0}, {2.5, 1.5, 2.0}};
+
+    meshkernel::AveragingInterpolation averaging(*mesh,
+                                                 samples,
+                                                 meshkernel::AveragingInterpolation::Method::SimpleAveraging,
+                                                 meshkernel::Location::Faces,
+                                                 1.01,
+                                                 false,
+                                                 false,
+                                                 1);
+
+    EXPECT_THROW([[maybe_unused]] auto results = averaging.ComputeProperties({{1.0, 2.0}, {1.0}}), meshkernel::ConstraintError);
+}
+
+namespace
+{
+    /// @brief Makes a perturbed grid of samples covering a 10 by 10 square
+    std::vector<meshkernel::Sample> MakeSamplesForTiling()
+    {
+        std::vector<meshkernel::Sample> samples;
+
+        for (meshkernel::UInt i = 0; i < 40; ++i)
+        {
+            for (meshkernel::UInt j = 0; j < 40; ++j)
+            {
+                const double x = 0.25 * i + 0.01 * static_cast<double>((7 * j) % 5);
+                const double y = 0.25 * j + 0.01 * static_cast<double>((3 * i) % 5);
+                samples.emplace_back(x, y, (i + j) % 7 == 0 ? meshkernel::constants::missing::doubleValue : std::sin(x) * std::cos(y));
+            }
+        }
+
+        return samples;
+    }
+} // namespace
+
+TEST(Averaging, TiledAveragingInterpolation_ShouldEqualAveragingInterpolation)
+{
+    // Setup
+    std::vector<meshkernel::Sample> samples = MakeSamplesForTiling();
+    const meshkernel::SampleVectorSource sampleSource(samples);
+
+    const std::vector methods{meshkernel::AveragingInterpolation::Method::SimpleAveraging,
+                              meshkernel::AveragingInterpolation::Method::Closest,
+                              meshkernel::AveragingInterpolation::Method::Max,
+                              meshkernel::AveragingInterpolation::Method::Min,
+                              meshkernel::AveragingInterpolation::Method::InverseWeightedDistance,
+                              meshkernel::AveragingInterpolation::Method::MinAbsValue};
+
+    const std::vector locations{meshkernel::Location::Nodes, meshkernel::Location::Edges, meshkernel::Location::Faces};
+
+    for (const auto projection : {meshkernel::Projection::cartesian, meshkernel::Projection::spherical})
+    {
+        auto mesh = MakeRectangularMeshForTesting(11, 11, 1.0, projection);
+
+        for (const auto method : methods)
+        {
+            for (const auto location : locations)
+            {
+                meshkernel::AveragingInterpolation averaging(*mesh, samples, method, location, 1.5, false, false, 1);
+                averaging.Compute();
+
+                for (const meshkernel::UInt numTiles : {1, 3, 4})
+                {
+                    // Execute
+                    meshkernel::TiledAveragingInterpolation tiledAveraging(*mesh, sampleSource, method, location, 1.5, 1, numTiles, 100);
+                    tiledAveraging.Compute();
+
+                    // Assert
+                    EXPECT_THAT(tiledAveraging.GetNodeResults(), ::testing::ContainerEq(averaging.GetNodeResults()));
+                    EXPECT_THAT(tiledAveraging.GetEdgeResults(), ::testing::ContainerEq(averaging.GetEdgeResults()));
+                    EXPECT_THAT(tiledAveraging.GetFaceResults(), ::testing::ContainerEq(averaging.GetFaceResults()));
+
+                    if (projection == meshkernel::Projection::cartesian && numTiles == 4)
+                    {
+                        EXPECT_LT(tiledAveraging.GetMaximumTileSize(), samples.size() / 2);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(Averaging, MappedSampleFile_ShouldReadTheWrittenSamples)
+{
+    // Setup
+    std::vector<meshkernel::Sample> samples = MakeSamplesForTiling();
+    const auto fileName = (std::filesystem::temp_directory_path() / "MappedSampleFile_ShouldReadTheWrittenSamples.bin").string();
+
+    // Execute
+    meshkernel::MappedSampleFile::Write(fileName, samples);
+
+    {
+        const meshkernel::MappedSampleFile sampleFile(fileName);
+
+        // Assert
+        ASSERT_EQ(sampleFile.Size(), samples.size());
+
+        std::vector<meshkernel::Sample> chunk;
+        sampleFile.Read(17, 100, chunk);
+        ASSERT_EQ(chunk.size(), 100);
+        for (meshkernel::UInt i = 0; i < chunk.size(); ++i)
+        {
+            EXPECT_EQ(chunk[i].x, samples[17 + i].x);
+            EXPECT_EQ(chunk[i].y, samples[17 + i].y);
+            EXPECT_EQ(chunk[i].value, samples[17 + i].value);
+        }
+
+        EXPECT_THROW(sampleFile.Read(samples.size() - 10, 11, chunk), meshkernel::RangeError);
+
+        // The interpolation of the streamed samples equals the interpolation of the samples in memory
+        auto mesh = MakeRectangularMeshForTesting(11, 11, 1.0, meshkernel::Projection::cartesian);
+        meshkernel::AveragingInterpolation averaging(*mesh, samples, meshkernel::AveragingInterpolation::Method::InverseWeightedDistance, meshkernel::Location::Faces, 1.0, false, false, 1);
+        averaging.Compute();
+
+        meshkernel::TiledAveragingInterpolation tiledAveraging(*mesh, sampleFile, meshkernel::AveragingInterpolation::Method::InverseWeightedDistance, meshkernel::Location::Faces, 1.0, 1, 2, 256);
+        tiledAveraging.Compute();
+
+        EXPECT_THAT(tiledAveraging.GetFaceResults(), ::testing::ContainerEq(averaging.GetFaceResults()));
+    }
+
+    std::filesystem::remove(fileName);
+}
+
+TEST(Averaging, MappedSampleFile_WithInvalidFile_ShouldThrow)
+{
+    const auto fileName = (std::filesystem::temp_directory_path() / "MappedSampleFile_WithInvalidFile_ShouldThrow.bin").string();
+    std::ofstream(fileName) << "not a sample file";
+
+    EXPECT_THROW(meshkernel::MappedSampleFile{fileName}, meshkernel::MeshKernelError);
+    EXPECT_THROW(meshkernel::MappedSampleFile{fileName + ".missing"}, meshkernel::MeshKernelError);
+
+    std::filesystem::remove(fileName);
+}
+
+TEST(Averaging, MappedSampleFile_WithCorruptSampleCount_ShouldThrow)
+{
+    const auto fileName = (std::filesystem::temp_directory_path() / "MappedSampleFile_WithCorruptSampleCount_ShouldThrow.bin").string();
+
+    const auto writeFile = [&fileName](std::uint64_t sampleCount, std::size_t numRecordBytes)
+    {
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+        file.write(meshkernel::MappedSampleFile::MagicNumber, sizeof(meshkernel::MappedSampleFile::MagicNumber));
+        file.write(reinterpret_cast<const char*>(&sampleCount), sizeof(sampleCount));
+        file << std::string(numRecordBytes, '\0');
+    };
+
+    // HeaderSize + count * RecordSize wraps around to HeaderSize for this count
+    constexpr std::uint64_t wrappingCount = std::uint64_t{1} << 61;
+    writeFile(wrappingCount, 0);
+    EXPECT_THROW(meshkernel::MappedSampleFile{fileName}, meshkernel::MeshKernelError);
+
+    // A record is incomplete
+    writeFile(1, meshkernel::MappedSampleFile::RecordSize + 5);
+    EXPECT_THROW(meshkernel::MappedSampleFile{fileName}, meshkernel::MeshKernelError);
+
+    // Two complete records for the two samples of the header
+    writeFile(2, 2 * meshkernel::MappedSampleFile::RecordSize);
+    {
+        const meshkernel::MappedSampleFile sampleFile(fileName);
+        EXPECT_EQ(2u, sampleFile.Size());
+
+        std::vector<meshkernel::Sample> samples;
+        EXPECT_THROW(sampleFile.Read(std::numeric_limits<std::uint64_t>::max(), 2, samples), meshkernel::RangeError);
+    }
+
+    std::filesystem::remove(fileName);
+}
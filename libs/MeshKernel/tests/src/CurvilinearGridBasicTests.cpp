@@ -32,6 +32,7 @@
 #include <gtest/gtest.h>
 
 #include "MeshKernel/CurvilinearGrid/CurvilinearGrid.hpp"
+#include "MeshKernel/CurvilinearGrid/CurvilinearGridCoordinates.hpp"
 #include "MeshKernel/CurvilinearGrid/CurvilinearGridCurvature.hpp"
 #include "MeshKernel/CurvilinearGrid/CurvilinearGridDeRefinement.hpp"
 #include "MeshKernel/CurvilinearGrid/CurvilinearGridDeleteExterior.hpp"
@@ -1256,3 +1257,114 @@ TEST(CurvilinearBasicTests, DeleteTwoBlocksTopLeftRegion)
     undoStack.Undo();
     CheckMeshAfterUndoRedo(*grid, expectedNodes);
 }
+
+TEST(CurvilinearBasicTests, CurvilinearGridCoordinates_ShouldStoreTheGridNodesAndTheirValidity)
+{
+    // Prepare
+    const auto curvilinearGrid = MakeSmallCurvilinearGridWithMissingFaces();
+
+    // Execute
+    meshkernel::CurvilinearGridCoordinates coordinates(*curvilinearGrid);
+
+    // Assert
+    ASSERT_EQ(coordinates.NumN(), curvilinearGrid->NumN());
+    ASSERT_EQ(coordinates.NumM(), curvilinearGrid->NumM());
+    meshkernel::UInt numInvalidNodes = 0;
+    for (meshkernel::UInt n = 0; n < curvilinearGrid->NumN(); ++n)
+    {
+        for (meshkernel::UInt m = 0; m < curvilinearGrid->NumM(); ++m)
+        {
+            const auto& node = curvilinearGrid->GetNode(n, m);
+            EXPECT_EQ(coordinates.X(n)[m], node.x);
+            EXPECT_EQ(coordinates.Y(n)[m], node.y);
+            EXPECT_EQ(coordinates.IsValid(n, m), node.IsValid());
+            numInvalidNodes += node.IsValid() ? 0 : 1;
+        }
+    }
+    EXPECT_GT(numInvalidNodes, 0);
+
+    // a modified block is stored back to the grid, the other nodes are kept
+    coordinates.Set(1, 2, {-1.0, -2.0});
+    coordinates.Set(2, 2, {meshkernel::constants::missing::doubleValue, meshkernel::constants::missing::doubleValue});
+    coordinates.Set(3, 3, {-3.0, -4.0});
+    EXPECT_FALSE(coordinates.IsValid(2, 2));
+    EXPECT_TRUE(coordinates.IsValid(3, 3));
+
+    auto modifiedGrid = *curvilinearGrid;
+    coordinates.Store(modifiedGrid, {1, 1}, {2, 2});
+    EXPECT_EQ(modifiedGrid.GetNode(1, 2), meshkernel::Point(-1.0, -2.0));
+    EXPECT_FALSE(modifiedGrid.GetNode(2, 2).IsValid());
+    EXPECT_EQ(modifiedGrid.GetNode(3, 3), curvilinearGrid->GetNode(3, 3));
+}
+
+TEST(CurvilinearBasicTests, ComputeLocationCenters_ShouldAverageTheNodesOfEachLocation)
+{
+    // Prepare
+    const auto curvilinearGrid = MakeSmallCurvilinearGrid();
+
+    // Execute
+    const auto edgeCenters = curvilinearGrid->ComputeEdgesCenters();
+    const auto faceCenters = curvilinearGrid->ComputeFaceCenters();
+
+    // Assert
+    // the edges along n first, then the edges along m
+    std::vector<meshkernel::Point> expectedEdgeCenters;
+    for (meshkernel::UInt n = 0; n + 1 < curvilinearGrid->NumN(); ++n)
+    {
+        for (meshkernel::UInt m = 0; m < curvilinearGrid->NumM(); ++m)
+        {
+            expectedEdgeCenters.push_back((curvilinearGrid->GetNode(n, m) + curvilinearGrid->GetNode(n + 1, m)) * 0.5);
+        }
+    }
+    for (meshkernel::UInt n = 0; n < curvilinearGrid->NumN(); ++n)
+    {
+        for (meshkernel::UInt m = 0; m + 1 < curvilinearGrid->NumM(); ++m)
+        {
+            expectedEdgeCenters.push_back((curvilinearGrid->GetNode(n, m) + curvilinearGrid->GetNode(n, m + 1)) * 0.5);
+        }
+    }
+    ASSERT_EQ(edgeCenters.size(), expectedEdgeCenters.size());
+    for (size_t e = 0; e < edgeCenters.size(); ++e)
+    {
+        EXPECT_EQ(edgeCenters[e].x, expectedEdgeCenters[e].x);
+        EXPECT_EQ(edgeCenters[e].y, expectedEdgeCenters[e].y);
+    }
+
+    ASSERT_EQ(faceCenters.size(), (curvilinearGrid->NumN() - 1) * (curvilinearGrid->NumM() - 1));
+    size_t f = 0;
+    for (meshkernel::UInt n = 0; n + 1 < curvilinearGrid->NumN(); ++n)
+    {
+        for (meshkernel::UInt m = 0; m + 1 < curvilinearGrid->NumM(); ++m)
+        {
+            const auto expected = (curvilinearGrid->GetNode(n, m) + curvilinearGrid->GetNode(n, m + 1) +
+                                   curvilinearGrid->GetNode(n + 1, m + 1) + curvilinearGrid->GetNode(n + 1, m)) *
+                                  0.25;
+            EXPECT_NEAR(faceCenters[f].x, expected.x, 1e-12);
+            EXPECT_NEAR(faceCenters[f].y, expected.y, 1e-12);
+            ++f;
+        }
+    }
+}
+
+TEST(CurvilinearBasicTests, Generations_ShouldChangeWhenTheGridIsEdited)
+{
+    // Prepare
+    const auto curvilinearGrid = MakeSmallCurvilinearGrid();
+    const auto geometryGeneration = curvilinearGrid->GeometryGeneration();
+    const auto topologyGeneration = curvilinearGrid->TopologyGeneration();
+
+    // Assert, reading the grid does not change the generations
+    const mk::CurvilinearGrid& constGrid = *curvilinearGrid;
+    [[maybe_unused]] const auto node = constGrid.GetNode(1, 1);
+    [[maybe_unused]] const auto edgeCenters = curvilinearGrid->ComputeEdgesCenters();
+    EXPECT_EQ(geometryGeneration, curvilinearGrid->GeometryGeneration());
+    EXPECT_EQ(topologyGeneration, curvilinearGrid->TopologyGeneration());
+
+    // moving a node changes the geometry generation
+    [[maybe_unused]] auto moveAction = curvilinearGrid->MoveNode(mk::CurvilinearGridNodeIndices(1, 1), node + mk::Point(0.1, 0.1));
+    EXPECT_GT(curvilinearGrid->GeometryGeneration(), geometryGeneration);
+
+    // deleting a node changes the topology generation
+    [[maybe_unused]] auto deleteAction = curvilinearGrid->DeleteNode(curvilinearGrid->GetNode(0, 0));
+    EXPECT_GT(curvilinearGrid->TopologyGeneration(), topologyGeneration);
+}
@@ -613,3 +613,51 @@ TEST(CurvilinearGridOrthogonalization, Compute_OnNonOrthogonalCurvilinearGridWit
     ASSERT_NEAR(20.000000000000000, curvilinearGrid.GetNode(2, 3).y, tolerance); // stays in place
     ASSERT_NEAR(30.000000000000000, curvilinearGrid.GetNode(2, 4).y, tolerance);
 }
+
+TEST(CurvilinearGridOrthogonalization, Compute_OnBlockOfPerturbedCurvilinearGrid_ShouldOnlyMoveNodesInsideTheBlock)
+{
+    // Set-up, a grid with a smooth perturbation of the internal nodes
+    constexpr UInt numN = 30;
+    constexpr UInt numM = 40;
+    lin_alg::Matrix<Point> nodes(numN, numM);
+    for (UInt n = 0; n < numN; ++n)
+    {
+        for (UInt m = 0; m < numM; ++m)
+        {
+            const bool isBoundary = n == 0 || m == 0 || n == numN - 1 || m == numM - 1;
+            const double perturbation = isBoundary ? 0.0 : 0.3 * std::sin(0.5 * n) * std::cos(0.7 * m);
+            nodes(n, m) = Point(m + perturbation, n - perturbation);
+        }
+    }
+    CurvilinearGrid curvilinearGrid(nodes, Projection::cartesian);
+
+    OrthogonalizationParameters orthogonalizationParameters;
+    orthogonalizationParameters.outer_iterations = 2;
+    orthogonalizationParameters.boundary_iterations = 5;
+    orthogonalizationParameters.inner_iterations = 5;
+    orthogonalizationParameters.orthogonalization_to_smoothing_factor = 0.975;
+    CurvilinearGridOrthogonalization curvilinearGridOrthogonalization(curvilinearGrid, orthogonalizationParameters);
+    const CurvilinearGridNodeIndices lowerLeft(5, 7);
+    const CurvilinearGridNodeIndices upperRight(20, 25);
+    curvilinearGridOrthogonalization.SetBlock(lowerLeft, upperRight);
+
+    // Execute
+    [[maybe_unused]] auto undoAction = curvilinearGridOrthogonalization.Compute();
+
+    // Assert, the nodes outside the block are not moved, the internal nodes of the block are
+    UInt numMovedNodes = 0;
+    for (UInt n = 0; n < numN; ++n)
+    {
+        for (UInt m = 0; m < numM; ++m)
+        {
+            const bool isInBlock = n >= lowerLeft.m_n && n <= upperRight.m_n && m >= lowerLeft.m_m && m <= upperRight.m_m;
+            const bool isMoved = curvilinearGrid.GetNode(n, m) != nodes(n, m);
+            if (!isInBlock)
+            {
+                EXPECT_FALSE(isMoved) << "node " << n << " " << m;
+            }
+            numMovedNodes += isMoved ? 1 : 0;
+        }
+    }
+    EXPECT_GT(numMovedNodes, (upperRight.m_n - lowerLeft.m_n - 1) * (upperRight.m_m - lowerLeft.m_m - 1) / 2);
+}
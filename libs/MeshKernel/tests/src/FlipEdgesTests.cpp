@@ -310,3 +310,38 @@ TEST(FlipEdges, FlipEdgesInPolygonMediumTriangularMesh)
         }
     }
 }
+
+TEST(FlipEdges, FlipEdgesWithCompressedConnectivity_ShouldGiveTheSameMesh)
+{
+    // 1 Setup
+    auto mesh = MakeRectangularMeshForTestingRand(10, 10, 10.0, meshkernel::Projection::cartesian, {0.0, 0.0}, 0.3);
+    auto expected = std::make_unique<meshkernel::Mesh2D>(mesh->Edges(), mesh->Nodes(), meshkernel::Projection::cartesian);
+    mesh->SetCompressedConnectivity(true);
+
+    meshkernel::Polygons polygon;
+    std::vector<meshkernel::Point> landBoundary;
+    auto landBoundaries = meshkernel::LandBoundaries(landBoundary, *mesh, polygon);
+    auto expectedLandBoundaries = meshkernel::LandBoundaries(landBoundary, *expected, polygon);
+
+    // 2 Execution
+    meshkernel::FlipEdges flipEdges(*mesh, landBoundaries, true, false);
+    meshkernel::FlipEdges expectedFlipEdges(*expected, expectedLandBoundaries, true, false);
+    [[maybe_unused]] auto undoAction = flipEdges.Compute();
+    [[maybe_unused]] auto expectedUndoAction = expectedFlipEdges.Compute();
+
+    // 3 Assert
+    ASSERT_TRUE(mesh->m_nodesEdges.empty());
+    ASSERT_EQ(expected->GetNumEdges(), mesh->GetNumEdges());
+    ASSERT_EQ(expected->GetNumFaces(), mesh->GetNumFaces());
+
+    for (meshkernel::UInt e = 0; e < expected->GetNumEdges(); ++e)
+    {
+        EXPECT_EQ(expected->GetEdge(e), mesh->GetEdge(e));
+    }
+
+    for (meshkernel::UInt f = 0; f < expected->GetNumFaces(); ++f)
+    {
+        EXPECT_TRUE(std::ranges::equal(expected->FaceNodes(f), mesh->FaceNodes(f)));
+        EXPECT_TRUE(std::ranges::equal(expected->FaceEdges(f), mesh->FaceEdges(f)));
+    }
+}
@@ -171,6 +171,90 @@ TEST(MeshPropertyTests, SimpleSampleInterpolationTest)
     }
 }
 
+TEST(MeshPropertyTests, TriangulationWalkFindsContainingFaceTest)
+{
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<double> sampleDistribution(0.0, 100.0);
+    std::uniform_real_distribution<double> pointDistribution(-10.0, 110.0);
+
+    const mk::UInt numberOfSamples = 400;
+    const mk::UInt numberOfPoints = 2000;
+
+    std::vector<double> xValues(numberOfSamples);
+    std::vector<double> yValues(numberOfSamples);
+    std::vector<double> sampleValues(numberOfSamples);
+
+    for (mk::UInt i = 0; i < numberOfSamples; ++i)
+    {
+        xValues[i] = sampleDistribution(generator);
+        yValues[i] = sampleDistribution(generator);
+        sampleValues[i] = 2.0 * xValues[i] - 3.0 * yValues[i];
+    }
+
+    std::vector<mk::Point> points(numberOfPoints);
+
+    for (mk::UInt i = 0; i < numberOfPoints; ++i)
+    {
+        points[i] = mk::Point(pointDistribution(generator), pointDistribution(generator));
+    }
+
+    mk::MeshTriangulation triangulation(xValues, yValues, mk::Projection::cartesian);
+
+    // Determine if the point is inside the face using barycentric coordinates
+    auto isInFace = [&triangulation](const mk::Point& point, const mk::UInt faceId)
+    {
+        const auto [p1, p2, p3] = triangulation.GetNodes(faceId);
+        const double det = (p2.x - p1.x) * (p3.y - p1.y) - (p3.x - p1.x) * (p2.y - p1.y);
+        const double lambda = ((point.x - p1.x) * (p3.y - p1.y) - (p3.x - p1.x) * (point.y - p1.y)) / det;
+        const double mu = ((p2.x - p1.x) * (point.y - p1.y) - (point.x - p1.x) * (p2.y - p1.y)) / det;
+        return lambda >= -1.0e-12 && mu >= -1.0e-12 && lambda + mu <= 1.0 + 1.0e-12;
+    };
+
+    mk::UInt previousFaceId = mk::constants::missing::uintValue;
+
+    for (const auto& point : points)
+    {
+        bool isInTriangulation = false;
+
+        for (mk::UInt f = 0; f < triangulation.NumberOfFaces(); ++f)
+        {
+            isInTriangulation = isInTriangulation || isInFace(point, f);
+        }
+
+        const mk::UInt nearestFaceId = triangulation.FindNearestFace(point);
+        const mk::UInt faceId = triangulation.FindFace(point, previousFaceId);
+
+        ASSERT_EQ(isInTriangulation, nearestFaceId != mk::constants::missing::uintValue);
+        ASSERT_EQ(isInTriangulation, faceId != mk::constants::missing::uintValue);
+
+        if (isInTriangulation)
+        {
+            EXPECT_TRUE(isInFace(point, nearestFaceId));
+            EXPECT_TRUE(isInFace(point, faceId));
+            previousFaceId = faceId;
+        }
+    }
+
+    // The parallel interpolation reproduces the linear function inside the triangulation
+    mk::SampleTriangulationInterpolator interpolator(xValues, yValues, mk::Projection::cartesian);
+    interpolator.SetData(1, sampleValues);
+
+    std::vector<double> interpolated(numberOfPoints);
+    interpolator.Interpolate(1, points, interpolated);
+
+    for (mk::UInt i = 0; i < numberOfPoints; ++i)
+    {
+        if (interpolated[i] != mk::constants::missing::doubleValue)
+        {
+            EXPECT_NEAR(interpolated[i], 2.0 * points[i].x - 3.0 * points[i].y, 1.0e-9);
+        }
+        else
+        {
+            EXPECT_EQ(triangulation.FindNearestFace(points[i]), mk::constants::missing::uintValue);
+        }
+    }
+}
+
 TEST(MeshPropertyTests, AveragePointTest)
 {
     const double tolerance = 1.0e-13;
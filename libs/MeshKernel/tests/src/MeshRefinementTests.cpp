@@ -45,8 +45,10 @@
 #include "MeshKernel/Polygons.hpp"
 #include "MeshKernel/RemoveDisconnectedRegions.hpp"
 #include "MeshKernel/SampleAveragingInterpolator.hpp"
+#include "MeshKernel/SampleSource.hpp"
 #include "MeshKernel/SamplesHessianCalculator.hpp"
 #include "MeshKernel/SplitRowColumnOfMesh.hpp"
+#include "MeshKernel/TiledAveragingInterpolation.hpp"
 #include "MeshKernel/UndoActions/UndoActionStack.hpp"
 #include "MeshKernel/Utilities/Utilities.hpp"
 
@@ -761,6 +763,49 @@ TEST(MeshRefinement, WindowOfRefinementFile)
     }
 }
 
+TEST(MeshRefinement, WindowOfRefinementFile_WithTiledInterpolation_ShouldRefineAsWithAllSamples)
+{
+    // Prepare
+    const std::vector<Sample> samples = ReadSampleFile(TEST_FOLDER + "/data/MeshRefinementTests/WindowOfRefinementFile.xyz");
+    const SampleVectorSource sampleSource(samples);
+
+    MeshRefinementParameters meshRefinementParameters;
+    meshRefinementParameters.max_num_refinement_iterations = 4;
+    meshRefinementParameters.refine_intersected = 0;
+    meshRefinementParameters.use_mass_center_when_refining = 0;
+    meshRefinementParameters.min_edge_size = 3.0;
+    meshRefinementParameters.account_for_samples_outside = 0;
+    meshRefinementParameters.connect_hanging_nodes = 1;
+    meshRefinementParameters.refinement_type = 1;
+    meshRefinementParameters.smoothing_iterations = 0;
+
+    meshkernel::Polygons polygon({}, Projection::cartesian);
+
+    auto mesh = MakeRectangularMeshForTesting(4, 4, 40.0, Projection::cartesian, {197253.0, 442281.0});
+    auto interpolator = std::make_unique<TiledAveragingInterpolation>(*mesh,
+                                                                      sampleSource,
+                                                                      AveragingInterpolation::Method::MinAbsValue,
+                                                                      Location::Faces,
+                                                                      1.0,
+                                                                      1,
+                                                                      3,
+                                                                      100);
+
+    // Execute
+    MeshRefinement meshRefinement(*mesh, polygon, std::move(interpolator), meshRefinementParameters);
+    [[maybe_unused]] auto undoAction = meshRefinement.Compute();
+
+    // Assert, the refined mesh is the same as in WindowOfRefinementFile
+    ASSERT_EQ(461, mesh->GetNumNodes());
+    ASSERT_EQ(918, mesh->GetNumEdges());
+
+    ASSERT_EQ(233, mesh->GetEdge(906).first);
+    ASSERT_EQ(206, mesh->GetEdge(906).second);
+
+    ASSERT_EQ(327, mesh->GetEdge(915).first);
+    ASSERT_EQ(326, mesh->GetEdge(915).second);
+}
+
 TEST(MeshRefinement, MeshRefinementRefinementLevels_OnWindowOfRefinementFile_ShouldRefinemesh)
 {
     // Prepare
@@ -2013,6 +2058,40 @@ TEST(MeshRefinement, CasulliDeRefinement)
     TestDerefinedMesh(22, 22, prefix + "casulli_deref_22_22.nc");
 }
 
+TEST(MeshRefinement, CasulliDeRefinementWithCompressedConnectivity_ShouldGiveTheSameMesh)
+{
+    auto curviMesh = MakeRectangularMeshForTesting(21, 22, 10.0, Projection::cartesian, {0.0, 0.0},
+                                                   true /*ewIndexIncreasing*/,
+                                                   true /*nsIndexIncreasing*/);
+    Mesh2D mesh(curviMesh->Edges(), curviMesh->Nodes(), Projection::cartesian);
+    Mesh2D expected(curviMesh->Edges(), curviMesh->Nodes(), Projection::cartesian);
+    mesh.SetCompressedConnectivity(true);
+
+    [[maybe_unused]] auto undoAction = meshkernel::CasulliDeRefinement::Compute(mesh);
+    [[maybe_unused]] auto expectedUndoAction = meshkernel::CasulliDeRefinement::Compute(expected);
+
+    ASSERT_TRUE(mesh.m_nodesEdges.empty());
+    ASSERT_EQ(expected.GetNumNodes(), mesh.GetNumNodes());
+    ASSERT_EQ(expected.GetNumEdges(), mesh.GetNumEdges());
+    ASSERT_EQ(expected.GetNumFaces(), mesh.GetNumFaces());
+
+    for (UInt i = 0u; i < expected.GetNumNodes(); ++i)
+    {
+        EXPECT_EQ(expected.Node(i).x, mesh.Node(i).x);
+        EXPECT_EQ(expected.Node(i).y, mesh.Node(i).y);
+    }
+
+    for (UInt i = 0u; i < expected.GetNumEdges(); ++i)
+    {
+        EXPECT_EQ(expected.GetEdge(i), mesh.GetEdge(i));
+    }
+
+    for (UInt i = 0u; i < expected.GetNumFaces(); ++i)
+    {
+        EXPECT_TRUE(std::ranges::equal(expected.FaceNodes(i), mesh.FaceNodes(i)));
+    }
+}
+
 TEST(MeshRefinement, CasulliDeRefinementPolygon)
 {
     // de-refine the mesh inside a polygon then compare results with precomputed data.
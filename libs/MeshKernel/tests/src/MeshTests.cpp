@@ -28,13 +28,18 @@
 #include <algorithm>
 #include <chrono>
 #include <execution>
+#include <filesystem>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <random>
 
 #include <MeshKernel/Constants.hpp>
 #include <MeshKernel/Entities.hpp>
 #include <MeshKernel/Mesh2D.hpp>
+#include <MeshKernel/Mesh2DPointLocator.hpp>
+#include <MeshKernel/MeshEdgeCenters.hpp>
 #include <MeshKernel/MeshRefinement.hpp>
+#include <MeshKernel/Operations.hpp>
 #include <MeshKernel/Parameters.hpp>
 #include <MeshKernel/Polygons.hpp>
 #include <MeshKernel/TriangulationGenerator.hpp>
@@ -469,6 +474,71 @@ TEST(Mesh, DeleteNodeInMeshWithExistingNodesRtreeTriggersRTreeReBuild)
     ASSERT_EQ(3, rtree.Size());
 }
 
+TEST(Mesh, BuildTree_WithDifferentBoundingBoxesPerLocation_ShouldNotRebuildTheOtherTrees)
+{
+    // Setup
+    auto mesh = MakeRectangularMeshForTesting(4, 4, 1.0, meshkernel::Projection::cartesian);
+    const meshkernel::BoundingBox lowerLeft({-0.5, -0.5}, {1.5, 1.5});
+    const meshkernel::BoundingBox upperRight({1.5, 1.5}, {3.5, 3.5});
+
+    // Execute, the nodes, edges and faces trees are built with different bounding boxes
+    mesh->BuildTree(meshkernel::Location::Nodes, lowerLeft);
+    mesh->BuildTree(meshkernel::Location::Edges, upperRight);
+    mesh->BuildTree(meshkernel::Location::Faces);
+    mesh->BuildTree(meshkernel::Location::Nodes, lowerLeft);
+    mesh->BuildTree(meshkernel::Location::Edges, upperRight);
+    mesh->BuildTree(meshkernel::Location::Faces);
+
+    // Assert, each tree is built once
+    for (const auto location : {meshkernel::Location::Nodes, meshkernel::Location::Edges, meshkernel::Location::Faces})
+    {
+        const auto& statistics = mesh->GetRTreeCacheStatistics(location);
+        EXPECT_EQ(statistics.misses, 1);
+        EXPECT_EQ(statistics.hits, 1);
+        EXPECT_EQ(statistics.updates, 0);
+    }
+    EXPECT_EQ(mesh->GetRTree(meshkernel::Location::Nodes).Size(), 4);
+    EXPECT_EQ(mesh->GetRTree(meshkernel::Location::Faces).Size(), 9);
+
+    // a change of bounding box rebuilds the tree, a node change updates it
+    mesh->BuildTree(meshkernel::Location::Edges, lowerLeft);
+    mesh->SetNode(0, {-0.25, -0.25});
+    mesh->BuildTree(meshkernel::Location::Edges, lowerLeft);
+
+    const auto& edgesStatistics = mesh->GetRTreeCacheStatistics(meshkernel::Location::Edges);
+    EXPECT_EQ(edgesStatistics.misses, 2);
+    EXPECT_EQ(edgesStatistics.updates, 1);
+
+    mesh->ResetRTreeCacheStatistics();
+    EXPECT_EQ(mesh->GetRTreeCacheStatistics(meshkernel::Location::Edges).misses, 0);
+}
+
+TEST(Mesh, BuildTree_AfterMovingNodes_ShouldNotUseCachedEdgeCentres)
+{
+    // Setup
+    auto mesh = MakeRectangularMeshForTesting(3, 3, 1.0, meshkernel::Projection::cartesian);
+    const meshkernel::BoundingBox boundingBox({-1.0, -1.0}, {10.0, 10.0});
+    mesh->BuildTree(meshkernel::Location::Edges);
+
+    // Execute, all nodes are translated, then the tree is rebuilt for another bounding box
+    auto nodes = mesh->Nodes();
+    for (auto& node : nodes)
+    {
+        node += meshkernel::Vector(5.0, 5.0);
+    }
+    mesh->SetNodes(nodes);
+    mesh->Administrate();
+    mesh->BuildTree(meshkernel::Location::Edges, boundingBox);
+
+    // Assert, the edge centres are those of the translated mesh
+    const auto edgeIndex = mesh->FindLocationIndex({5.5, 5.0}, meshkernel::Location::Edges, {}, boundingBox);
+    ASSERT_NE(edgeIndex, meshkernel::constants::missing::uintValue);
+    const auto& edge = mesh->GetEdge(edgeIndex);
+    const auto edgeCentre = (mesh->Node(edge.first) + mesh->Node(edge.second)) * 0.5;
+    EXPECT_NEAR(edgeCentre.x, 5.5, 1e-12);
+    EXPECT_NEAR(edgeCentre.y, 5.0, 1e-12);
+}
+
 TEST(Mesh, ConnectNodesInMeshWithExistingEdgesRtreeTriggersRTreeReBuild)
 {
     // 1 Setup
@@ -629,6 +699,223 @@ TEST(Mesh, FindEdgeCloseToAPointShouldTriggerEdgesRTreeBuild)
     ASSERT_EQ(4, edgesRTree.Size());
 }
 
+TEST(Mesh, MoveNodeAndUndoShouldUpdateRTreesIncrementally)
+{
+    // 1 Setup
+    auto mesh = MakeRectangularMeshForTesting(20, 20, 1.0, meshkernel::Projection::cartesian);
+    mesh->Administrate();
+    mesh->BuildTree(meshkernel::Location::Nodes);
+    mesh->BuildTree(meshkernel::Location::Edges);
+
+    const auto& nodesRTree = mesh->GetRTree(meshkernel::Location::Nodes);
+    const auto& edgesRTree = mesh->GetRTree(meshkernel::Location::Edges);
+    const auto numNodes = nodesRTree.Size();
+    const auto numEdges = edgesRTree.Size();
+    mesh->ResetRTreeCacheStatistics();
+    meshkernel::UInt expectedUpdates = 0;
+
+    const auto checkRTrees = [&]()
+    {
+        mesh->BuildTree(meshkernel::Location::Nodes);
+        mesh->BuildTree(meshkernel::Location::Edges);
+        ASSERT_EQ(numNodes, nodesRTree.Size());
+        ASSERT_EQ(numEdges, edgesRTree.Size());
+
+        // the trees are updated, not rebuilt
+        ++expectedUpdates;
+        EXPECT_EQ(mesh->GetRTreeCacheStatistics(meshkernel::Location::Nodes).misses, 0);
+        EXPECT_EQ(mesh->GetRTreeCacheStatistics(meshkernel::Location::Edges).misses, 0);
+        EXPECT_EQ(mesh->GetRTreeCacheStatistics(meshkernel::Location::Edges).updates, expectedUpdates);
+
+        for (meshkernel::UInt n = 0; n < mesh->GetNumNodes(); ++n)
+        {
+            EXPECT_EQ(n, mesh->FindLocationIndex(mesh->Node(n), meshkernel::Location::Nodes));
+        }
+
+        const auto edgeCentres = meshkernel::algo::ComputeEdgeCentres(*mesh);
+        for (meshkernel::UInt e = 0; e < mesh->GetNumEdges(); ++e)
+        {
+            EXPECT_EQ(e, mesh->FindLocationIndex(edgeCentres[e], meshkernel::Location::Edges));
+        }
+    };
+
+    // 2 Execution: the moved node and its neighbours are updated in the existing trees
+    auto moveAction = mesh->MoveNode({5.25, 7.75}, 6 * 20 + 6);
+    checkRTrees();
+
+    // 3 Execution: restoring the node positions updates the trees as well
+    moveAction->Restore();
+    checkRTrees();
+
+    // 4 Execution: resetting the connectivity of an edge
+    const auto edge = mesh->GetEdge(0);
+    auto resetAction = mesh->ResetEdge(0, {edge.first, mesh->GetNumNodes() - 1});
+    checkRTrees();
+
+    resetAction->Restore();
+    checkRTrees();
+}
+
+TEST(Mesh, ResetNode_ShouldUpdateOnlyTheEdgesOfTheNode)
+{
+    // 1 Setup
+    auto mesh = MakeRectangularMeshForTesting(20, 20, 1.0, meshkernel::Projection::cartesian);
+    mesh->Administrate();
+    mesh->BuildTree(meshkernel::Location::Edges);
+    mesh->ResetRTreeCacheStatistics();
+
+    const meshkernel::UInt node = 6 * 20 + 6;
+    const auto numNodeEdges = mesh->NodeEdges(node).size();
+    ASSERT_EQ(numNodeEdges, 4);
+
+    // 2 Execution: the node is moved without changing the topology
+    [[maybe_unused]] auto resetNodeAction = mesh->ResetNode(node, mesh->Node(node) + meshkernel::Vector(0.25, 0.25));
+    mesh->BuildTree(meshkernel::Location::Edges);
+
+    // 3 Assert: only the edges of the node are visited to update the tree
+    const auto& statistics = mesh->GetRTreeCacheStatistics(meshkernel::Location::Edges);
+    EXPECT_EQ(statistics.misses, 0);
+    EXPECT_EQ(statistics.updates, 1);
+    EXPECT_EQ(statistics.visited, numNodeEdges);
+
+    const auto edgeCentres = meshkernel::algo::ComputeEdgeCentres(*mesh);
+    for (meshkernel::UInt e = 0; e < mesh->GetNumEdges(); ++e)
+    {
+        EXPECT_EQ(e, mesh->FindLocationIndex(edgeCentres[e], meshkernel::Location::Edges));
+    }
+
+    // 4 Execution: after a topology change the edges of the node are found by a scan of all edges
+    const auto edge = mesh->GetEdge(0);
+    [[maybe_unused]] auto resetEdgeAction = mesh->ResetEdge(0, {edge.second, edge.first});
+    mesh->ResetRTreeCacheStatistics();
+    [[maybe_unused]] auto secondResetNodeAction = mesh->ResetNode(node, mesh->Node(node) + meshkernel::Vector(0.25, 0.25));
+    mesh->BuildTree(meshkernel::Location::Edges);
+
+    EXPECT_EQ(statistics.misses, 0);
+    EXPECT_EQ(statistics.visited, 1 + mesh->GetNumEdges());
+}
+
+namespace
+{
+    void ExpectSameMesh(const meshkernel::Mesh2D& actual, const meshkernel::Mesh2D& expected)
+    {
+        ASSERT_EQ(actual.GetNumNodes(), expected.GetNumNodes());
+        ASSERT_EQ(actual.GetNumEdges(), expected.GetNumEdges());
+        ASSERT_EQ(actual.GetNumFaces(), expected.GetNumFaces());
+        EXPECT_EQ(actual.m_projection, expected.m_projection);
+
+        for (meshkernel::UInt n = 0; n < expected.GetNumNodes(); ++n)
+        {
+            EXPECT_EQ(actual.Node(n).x, expected.Node(n).x);
+            EXPECT_EQ(actual.Node(n).y, expected.Node(n).y);
+            EXPECT_EQ(actual.GetNumNodesEdges(n), expected.GetNumNodesEdges(n));
+            EXPECT_EQ(actual.GetNodeType(n), expected.GetNodeType(n));
+            EXPECT_TRUE(std::ranges::equal(actual.NodeEdges(n), expected.NodeEdges(n)));
+        }
+
+        for (meshkernel::UInt e = 0; e < expected.GetNumEdges(); ++e)
+        {
+            EXPECT_EQ(actual.GetEdge(e), expected.GetEdge(e));
+            EXPECT_EQ(actual.GetNumEdgesFaces(e), expected.GetNumEdgesFaces(e));
+            EXPECT_EQ(actual.m_edgesFaces[e], expected.m_edgesFaces[e]);
+        }
+
+        for (meshkernel::UInt f = 0; f < expected.GetNumFaces(); ++f)
+        {
+            EXPECT_TRUE(std::ranges::equal(actual.FaceNodes(f), expected.FaceNodes(f)));
+            EXPECT_TRUE(std::ranges::equal(actual.FaceEdges(f), expected.FaceEdges(f)));
+            EXPECT_EQ(actual.m_facesMassCenters[f].x, expected.m_facesMassCenters[f].x);
+            EXPECT_EQ(actual.m_facesMassCenters[f].y, expected.m_facesMassCenters[f].y);
+            EXPECT_EQ(actual.m_faceArea[f], expected.m_faceArea[f]);
+        }
+    }
+} // namespace
+
+TEST(Mesh, CompressedConnectivityShouldReplaceTheNestedConnectivity)
+{
+    // 1 Setup
+    auto mesh = MakeRectangularMeshForTesting(10, 12, 1.0, meshkernel::Projection::cartesian);
+    auto expected = MakeRectangularMeshForTesting(10, 12, 1.0, meshkernel::Projection::cartesian);
+    mesh->Administrate();
+    expected->Administrate();
+    const auto nestedMemoryUsage = mesh->ConnectivityMemoryUsage();
+
+    // 2 Execution
+    mesh->SetCompressedConnectivity(true);
+
+    // 3 Assert: the nested vectors are released, the views read the compressed tables
+    ASSERT_TRUE(mesh->CompressedConnectivity());
+    EXPECT_TRUE(mesh->m_nodesEdges.empty());
+    EXPECT_TRUE(mesh->m_facesNodes.empty());
+    EXPECT_TRUE(mesh->m_facesEdges.empty());
+    EXPECT_LT(2 * mesh->ConnectivityMemoryUsage(), nestedMemoryUsage);
+    ExpectSameMesh(*mesh, *expected);
+
+    // 4 Execution: an edit restores the nested vectors, the administration compresses them again
+    [[maybe_unused]] auto deleteAction = mesh->DeleteNode(0);
+    [[maybe_unused]] auto expectedDeleteAction = expected->DeleteNode(0);
+    EXPECT_FALSE(mesh->m_nodesEdges.empty());
+    mesh->Administrate();
+    expected->Administrate();
+    ASSERT_EQ(98, mesh->GetNumFaces());
+    EXPECT_TRUE(mesh->m_nodesEdges.empty());
+    ExpectSameMesh(*mesh, *expected);
+
+    // 5 Execution: an algorithm changing the topology gives the same mesh
+    meshkernel::MeshRefinementParameters meshRefinementParameters;
+    meshRefinementParameters.max_num_refinement_iterations = 1;
+    meshRefinementParameters.refine_intersected = 0;
+    meshRefinementParameters.use_mass_center_when_refining = 0;
+
+    meshkernel::MeshRefinement meshRefinement(*mesh, meshkernel::Polygons(), meshRefinementParameters);
+    meshkernel::MeshRefinement expectedMeshRefinement(*expected, meshkernel::Polygons(), meshRefinementParameters);
+    [[maybe_unused]] auto refinementAction = meshRefinement.Compute();
+    [[maybe_unused]] auto expectedRefinementAction = expectedMeshRefinement.Compute();
+    mesh->Administrate();
+    expected->Administrate();
+    EXPECT_TRUE(mesh->m_nodesEdges.empty());
+    ExpectSameMesh(*mesh, *expected);
+
+    // 6 Execution: disabling the compressed tables restores the nested vectors
+    mesh->SetCompressedConnectivity(false);
+    ASSERT_FALSE(mesh->CompressedConnectivity());
+    EXPECT_EQ(mesh->GetNumNodes(), mesh->m_nodesEdges.size());
+    EXPECT_EQ(mesh->GetNumFaces(), mesh->m_facesNodes.size());
+    ExpectSameMesh(*mesh, *expected);
+}
+
+TEST(Mesh, SwapNodesShouldExchangeNodesWithoutCopy)
+{
+    // 1 Setup
+    auto mesh = MakeRectangularMeshForTesting(3, 3, 1.0, meshkernel::Projection::cartesian);
+    mesh->Administrate();
+
+    const auto originalNodes = mesh->Nodes();
+    std::vector<meshkernel::Point> newNodes(originalNodes);
+    for (auto& node : newNodes)
+    {
+        node.x += 0.5;
+    }
+    const auto expectedNodes = newNodes;
+    const auto* newNodesData = newNodes.data();
+
+    // 2 Execution
+    mesh->SwapNodes(newNodes);
+    mesh->InvalidateNodes();
+
+    // 3 Assert
+    EXPECT_EQ(newNodesData, mesh->Nodes().data());
+    for (meshkernel::UInt n = 0; n < mesh->GetNumNodes(); ++n)
+    {
+        EXPECT_EQ(expectedNodes[n], mesh->Node(n));
+        EXPECT_EQ(originalNodes[n], newNodes[n]);
+        EXPECT_EQ(n, mesh->FindLocationIndex(expectedNodes[n], meshkernel::Location::Nodes));
+    }
+
+    std::vector<meshkernel::Point> tooFewNodes(2);
+    EXPECT_THROW(mesh->SwapNodes(tooFewNodes), meshkernel::ConstraintError);
+}
+
 TEST(Mesh, GetObtuseTriangles)
 {
     // Setup a mesh with two triangles, one obtuse
@@ -1021,3 +1308,227 @@ TEST(Mesh, ManageMeshHoles)
     ASSERT_EQ(mesh->GetNumValidEdges(), 24);
     ASSERT_EQ(mesh->GetNumFaces(), 9);
 }
+
+TEST(Mesh, PointFaceIndices_OnPerturbedMesh_ShouldFindTheFacesContainingThePoints)
+{
+    // Prepare
+    const auto mesh = MakeRectangularMeshForTestingRand(30, 20, 1.0, meshkernel::Projection::cartesian, {0.0, 0.0}, 0.6);
+
+    std::vector<meshkernel::Point> points;
+    std::vector<meshkernel::Point> polygonNodes;
+    std::uniform_real_distribution<double> distribution(-2.0, 32.0);
+    std::default_random_engine engine;
+    for (int i = 0; i < 5000; ++i)
+    {
+        points.emplace_back(distribution(engine), distribution(engine) * 0.7);
+    }
+
+    // Execute
+    const auto faceIndices = mesh->PointFaceIndices(points);
+
+    // Assert
+    ASSERT_EQ(faceIndices.size(), points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        meshkernel::UInt expectedFace = meshkernel::constants::missing::uintValue;
+        for (meshkernel::UInt f = 0; f < mesh->GetNumFaces(); ++f)
+        {
+            mesh->ComputeFaceClosedPolygon(f, polygonNodes);
+            if (meshkernel::IsPointInPolygonNodes(points[i], polygonNodes, mesh->m_projection))
+            {
+                expectedFace = f;
+                break;
+            }
+        }
+
+        EXPECT_EQ(faceIndices[i], expectedFace) << "point " << i;
+    }
+}
+
+TEST(Mesh, PointFaceIndices_AlongPolyline_ShouldMatchSingleQueries)
+{
+    // Prepare
+    const auto mesh = MakeRectangularMeshForTestingRand(40, 40, 1.0, meshkernel::Projection::cartesian, {0.0, 0.0}, 0.3);
+    const meshkernel::Mesh2DPointLocator pointLocator(*mesh);
+
+    // a spiral, with consecutive points in the same or in neighbouring faces
+    std::vector<meshkernel::Point> points;
+    for (int i = 0; i < 3000; ++i)
+    {
+        const double angle = 0.01 * static_cast<double>(i);
+        const double radius = 1.0 + 0.006 * static_cast<double>(i);
+        points.emplace_back(20.0 + radius * std::cos(angle), 20.0 + radius * std::sin(angle));
+    }
+    points.emplace_back(-10.0, -10.0);
+    points.emplace_back(20.5, 20.5);
+
+    // Execute
+    const auto faceIndices = pointLocator.FindFaces(points);
+
+    // Assert
+    ASSERT_EQ(faceIndices.size(), points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        EXPECT_EQ(faceIndices[i], pointLocator.FindFace(points[i])) << "point " << i;
+    }
+    EXPECT_EQ(faceIndices[faceIndices.size() - 2], meshkernel::constants::missing::uintValue);
+    EXPECT_NE(faceIndices.back(), meshkernel::constants::missing::uintValue);
+}
+
+TEST(Mesh, PointFaceIndices_OnSharedNode_ShouldReturnTheLowestFaceIndex)
+{
+    // Prepare
+    const auto mesh = MakeRectangularMeshForTesting(4, 4, 1.0, meshkernel::Projection::cartesian);
+    const meshkernel::Mesh2DPointLocator pointLocator(*mesh);
+
+    for (meshkernel::UInt n = 0; n < mesh->GetNumNodes(); ++n)
+    {
+        const auto& node = mesh->Node(n);
+
+        meshkernel::UInt expectedFace = meshkernel::constants::missing::uintValue;
+        for (meshkernel::UInt f = 0; f < mesh->GetNumFaces(); ++f)
+        {
+            const auto faceNodes = mesh->FaceNodes(f);
+            if (std::ranges::find(faceNodes, n) != faceNodes.end())
+            {
+                expectedFace = std::min(expectedFace, f);
+            }
+        }
+
+        // Execute and assert, the result does not depend on the start of the walk
+        EXPECT_EQ(pointLocator.FindFace(node), expectedFace);
+        for (meshkernel::UInt f = 0; f < mesh->GetNumFaces(); ++f)
+        {
+            EXPECT_EQ(pointLocator.FindFace(node, f), expectedFace);
+        }
+    }
+}
+
+TEST(Mesh, Snapshot_WhenReadBack_ShouldEqualTheAdministratedMesh)
+{
+    // Prepare, a mesh with a hole and an invalid node
+    auto mesh = MakeRectangularMeshForTestingRand(20, 30, 1.0, meshkernel::Projection::cartesian, {0.0, 0.0}, 0.2);
+    [[maybe_unused]] auto undoAction = mesh->DeleteNode(meshkernel::UInt{45});
+    mesh->Administrate();
+    const auto fileName = (std::filesystem::temp_directory_path() / "Snapshot_WhenReadBack_ShouldEqualTheAdministratedMesh.bin").string();
+
+    // Execute
+    mesh->WriteSnapshot(fileName);
+    const auto snapshot = meshkernel::Mesh2D::ReadSnapshot(fileName);
+
+    // Assert
+    ExpectSameMesh(*snapshot, *mesh);
+
+    // the mesh read can be edited and administrated as the original one
+    [[maybe_unused]] auto snapshotUndoAction = snapshot->DeleteNode(meshkernel::UInt{100});
+    undoAction = mesh->DeleteNode(meshkernel::UInt{100});
+    snapshot->Administrate();
+    mesh->Administrate();
+    ExpectSameMesh(*snapshot, *mesh);
+
+    std::filesystem::remove(fileName);
+}
+
+TEST(Mesh, Snapshot_OfACompressedMesh_ShouldEqualTheAdministratedMesh)
+{
+    // Prepare
+    auto mesh = MakeRectangularMeshForTestingRand(20, 30, 1.0, meshkernel::Projection::cartesian, {0.0, 0.0}, 0.2);
+    [[maybe_unused]] auto undoAction = mesh->DeleteNode(meshkernel::UInt{45});
+    mesh->Administrate();
+    const auto fileName = (std::filesystem::temp_directory_path() / "Snapshot_OfACompressedMesh_ShouldEqualTheAdministratedMesh.bin").string();
+    mesh->SetCompressedConnectivity(true);
+
+    // Execute
+    mesh->WriteSnapshot(fileName);
+    const auto snapshot = meshkernel::Mesh2D::ReadSnapshot(fileName);
+
+    // Assert
+    ExpectSameMesh(*snapshot, *mesh);
+
+    std::filesystem::remove(fileName);
+}
+
+TEST(Mesh, Snapshot_WithSphericalProjection_ShouldKeepTheProjection)
+{
+    // Prepare
+    const auto mesh = MakeRectangularMeshForTesting(5, 4, 0.5, meshkernel::Projection::spherical, {10.0, 40.0});
+    const auto fileName = (std::filesystem::temp_directory_path() / "Snapshot_WithSphericalProjection_ShouldKeepTheProjection.bin").string();
+
+    // Execute
+    mesh->WriteSnapshot(fileName);
+    const auto snapshot = meshkernel::Mesh2D::ReadSnapshot(fileName);
+
+    // Assert
+    ExpectSameMesh(*snapshot, *mesh);
+
+    std::filesystem::remove(fileName);
+}
+
+TEST(Mesh, Snapshot_WhenCorrupted_ShouldThrow)
+{
+    // Prepare
+    const auto mesh = MakeRectangularMeshForTesting(5, 5, 1.0, meshkernel::Projection::cartesian);
+    const auto fileName = (std::filesystem::temp_directory_path() / "Snapshot_WhenCorrupted_ShouldThrow.bin").string();
+    mesh->WriteSnapshot(fileName);
+
+    const auto overwrite = [&fileName](std::streamoff position, char value)
+    {
+        std::fstream file(fileName, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(position);
+        file.put(value);
+    };
+
+    // Assert, a changed byte in the arrays
+    overwrite(200, 0x7f);
+    EXPECT_THROW([[maybe_unused]] auto snapshot = meshkernel::Mesh2D::ReadSnapshot(fileName), meshkernel::MeshKernelError);
+
+    // a different version
+    mesh->WriteSnapshot(fileName);
+    overwrite(8, 2);
+    EXPECT_THROW([[maybe_unused]] auto snapshot = meshkernel::Mesh2D::ReadSnapshot(fileName), meshkernel::MeshKernelError);
+
+    // an invalid projection, the header is not part of the checksum
+    mesh->WriteSnapshot(fileName);
+    overwrite(16, 42);
+    EXPECT_THROW([[maybe_unused]] auto snapshot = meshkernel::Mesh2D::ReadSnapshot(fileName), meshkernel::MeshKernelError);
+
+    // a truncated file
+    mesh->WriteSnapshot(fileName);
+    std::filesystem::resize_file(fileName, std::filesystem::file_size(fileName) - 8);
+    EXPECT_THROW([[maybe_unused]] auto snapshot = meshkernel::Mesh2D::ReadSnapshot(fileName), meshkernel::MeshKernelError);
+
+    // not a snapshot, or no file
+    overwrite(0, 'X');
+    EXPECT_THROW([[maybe_unused]] auto snapshot = meshkernel::Mesh2D::ReadSnapshot(fileName), meshkernel::MeshKernelError);
+    std::filesystem::remove(fileName);
+    EXPECT_THROW([[maybe_unused]] auto snapshot = meshkernel::Mesh2D::ReadSnapshot(fileName), meshkernel::MeshKernelError);
+}
+
+TEST(Mesh, Generations_ShouldChangeOnlyWhenTheMeshIsEdited)
+{
+    // Prepare
+    auto mesh = MakeRectangularMeshForTesting(4, 4, 1.0, meshkernel::Projection::cartesian);
+    mesh->Administrate();
+    const auto geometryGeneration = mesh->GeometryGeneration();
+    const auto topologyGeneration = mesh->TopologyGeneration();
+
+    // Assert, administrating again or reading the mesh does not change the generations
+    mesh->Administrate();
+    [[maybe_unused]] const auto nodes = mesh->Nodes();
+    EXPECT_EQ(geometryGeneration, mesh->GeometryGeneration());
+    EXPECT_EQ(topologyGeneration, mesh->TopologyGeneration());
+
+    // moving a node changes the geometry generation
+    [[maybe_unused]] auto moveAction = mesh->ResetNode(5, {1.1, 1.2});
+    EXPECT_GT(mesh->GeometryGeneration(), geometryGeneration);
+
+    // deleting an edge changes the topology generation
+    const auto previousTopologyGeneration = mesh->TopologyGeneration();
+    [[maybe_unused]] auto deleteAction = mesh->DeleteEdge(0);
+    EXPECT_GT(mesh->TopologyGeneration(), previousTopologyGeneration);
+
+    // undoing an edit changes the generations again
+    const auto previousGeometryGeneration = mesh->GeometryGeneration();
+    moveAction->Restore();
+    EXPECT_GT(mesh->GeometryGeneration(), previousGeometryGeneration);
+}
@@ -32,6 +32,7 @@
 #include "MeshKernel/FlipEdges.hpp"
 #include "MeshKernel/LandBoundaries.hpp"
 #include "MeshKernel/Mesh2D.hpp"
+#include "MeshKernel/MeshOrthogonality.hpp"
 #include "MeshKernel/MeshRefinement.hpp"
 #include "MeshKernel/Operations.hpp"
 #include "MeshKernel/OrthogonalizationAndSmoothing.hpp"
@@ -152,6 +153,180 @@ TEST(OrthogonalizationAndSmoothing, OrthogonalizationSmallTriangularGrid)
     ASSERT_NEAR(327.102805172725, mesh->Node(9).y, tolerance);
 }
 
+TEST(OrthogonalizationAndSmoothing, OrthogonalizationSmallTriangularGridWithDisplacementTolerance_ShouldStopEarly)
+{
+    auto mesh = ReadLegacyMesh2DFromFile(TEST_FOLDER + "/data/SmallTriangularGrid_net.nc");
+    const auto projectToLandBoundaryOption = LandBoundaries::ProjectToLandBoundaryOption::DoNotProjectToLandBoundary;
+    OrthogonalizationParameters orthogonalizationParameters;
+    orthogonalizationParameters.outer_iterations = 2;
+    orthogonalizationParameters.boundary_iterations = 25;
+    orthogonalizationParameters.inner_iterations = 25;
+    orthogonalizationParameters.orthogonalization_to_smoothing_factor = 0.975;
+    orthogonalizationParameters.orthogonalization_to_smoothing_factor_at_boundary = 1.0;
+    orthogonalizationParameters.areal_to_angle_smoothing_factor = 1.0;
+    orthogonalizationParameters.displacement_tolerance = 1.0e-3;
+    orthogonalizationParameters.displacement_norm = 0;
+
+    auto polygon = std::make_unique<Polygons>();
+
+    std::vector<Point> landBoundary;
+    auto landboundaries = std::make_unique<LandBoundaries>(landBoundary, *mesh, *polygon);
+
+    OrthogonalizationAndSmoothing orthogonalization(*mesh,
+                                                    std::move(polygon),
+                                                    std::move(landboundaries),
+                                                    projectToLandBoundaryOption,
+                                                    orthogonalizationParameters);
+
+    [[maybe_unused]] auto undoAction = orthogonalization.Initialize();
+    orthogonalization.Compute();
+
+    // the inner iterations of each outer iteration stop once the nodes move less than the tolerance
+    const auto& residuals = orthogonalization.Residuals();
+    const auto maximumIterations = static_cast<size_t>(orthogonalizationParameters.outer_iterations *
+                                                       orthogonalizationParameters.boundary_iterations *
+                                                       orthogonalizationParameters.inner_iterations);
+    ASSERT_FALSE(residuals.empty());
+    EXPECT_LT(residuals.size(), maximumIterations);
+    EXPECT_LE(residuals.back(), orthogonalizationParameters.displacement_tolerance);
+
+    // the result is close to the one of the full iteration budget
+    constexpr double tolerance = 0.05;
+    EXPECT_NEAR(325.590101919525, mesh->Node(0).x, tolerance);
+    EXPECT_NEAR(354.048340705929, mesh->Node(6).x, tolerance);
+    EXPECT_NEAR(424.314957449766, mesh->Node(9).x, tolerance);
+    EXPECT_NEAR(455.319334078551, mesh->Node(0).y, tolerance);
+    EXPECT_NEAR(458.064836627594, mesh->Node(6).y, tolerance);
+    EXPECT_NEAR(327.102805172725, mesh->Node(9).y, tolerance);
+}
+
+TEST(OrthogonalizationAndSmoothing, OrthogonalizationWithOrthogonalityTolerance_ShouldStopOnceTheToleranceIsReached)
+{
+    constexpr int outerIterations = 10;
+    constexpr int innerIterations = 25;
+    constexpr int boundaryIterations = 25;
+
+    const auto computeMaximumOrthogonality = [](const Mesh2D& mesh)
+    {
+        double maximumOrthogonality = 0.0;
+        for (const auto value : MeshOrthogonality::Compute(mesh))
+        {
+            if (value != constants::missing::doubleValue)
+            {
+                maximumOrthogonality = std::max(maximumOrthogonality, value);
+            }
+        }
+        return maximumOrthogonality;
+    };
+
+    struct Result
+    {
+        size_t numInnerIterations;                 ///< The number of inner iterations performed
+        std::vector<double> orthogonalityResidual; ///< The orthogonality after each outer iteration
+        double maximumOrthogonality;               ///< The orthogonality of the final mesh
+    };
+
+    const auto orthogonalize = [&](const double orthogonalityTolerance)
+    {
+        auto mesh = MakeRectangularMeshForTestingRand(10, 10, 1.0, Projection::cartesian, {0.0, 0.0}, 0.3);
+        OrthogonalizationParameters orthogonalizationParameters;
+        orthogonalizationParameters.outer_iterations = outerIterations;
+        orthogonalizationParameters.boundary_iterations = boundaryIterations;
+        orthogonalizationParameters.inner_iterations = innerIterations;
+        orthogonalizationParameters.orthogonality_tolerance = orthogonalityTolerance;
+
+        auto polygon = std::make_unique<Polygons>();
+        std::vector<Point> landBoundary;
+        auto landboundaries = std::make_unique<LandBoundaries>(landBoundary, *mesh, *polygon);
+
+        OrthogonalizationAndSmoothing orthogonalization(*mesh,
+                                                        std::move(polygon),
+                                                        std::move(landboundaries),
+                                                        LandBoundaries::ProjectToLandBoundaryOption::DoNotProjectToLandBoundary,
+                                                        orthogonalizationParameters);
+
+        [[maybe_unused]] auto undoAction = orthogonalization.Initialize();
+        orthogonalization.Compute();
+
+        return Result{orthogonalization.Residuals().size(), orthogonalization.OrthogonalityResiduals(), computeMaximumOrthogonality(*mesh)};
+    };
+
+    // Reference, all outer iterations without tolerance
+    const auto initialMesh = MakeRectangularMeshForTestingRand(10, 10, 1.0, Projection::cartesian, {0.0, 0.0}, 0.3);
+    const double initialOrthogonality = computeMaximumOrthogonality(*initialMesh);
+    const Result reference = orthogonalize(0.0);
+
+    ASSERT_EQ(static_cast<size_t>(outerIterations * boundaryIterations * innerIterations), reference.numInnerIterations);
+    EXPECT_TRUE(reference.orthogonalityResidual.empty());
+    ASSERT_LT(reference.maximumOrthogonality, initialOrthogonality);
+
+    // Execute, with a tolerance between the initial and the converged orthogonality
+    const double orthogonalityTolerance = 0.5 * (initialOrthogonality + reference.maximumOrthogonality);
+    const Result result = orthogonalize(orthogonalityTolerance);
+
+    // Assert, the outer iterations stop once the orthogonality is within the tolerance
+    ASSERT_FALSE(result.orthogonalityResidual.empty());
+    EXPECT_LT(result.orthogonalityResidual.size(), static_cast<size_t>(outerIterations));
+    EXPECT_LT(result.numInnerIterations, reference.numInnerIterations);
+    EXPECT_EQ(result.orthogonalityResidual.size() * boundaryIterations * innerIterations, result.numInnerIterations);
+    EXPECT_LE(result.orthogonalityResidual.back(), orthogonalityTolerance);
+    EXPECT_LE(result.maximumOrthogonality, orthogonalityTolerance);
+    EXPECT_DOUBLE_EQ(result.orthogonalityResidual.back(), result.maximumOrthogonality);
+
+    for (size_t i = 0; i + 1 < result.orthogonalityResidual.size(); ++i)
+    {
+        EXPECT_GT(result.orthogonalityResidual[i], orthogonalityTolerance);
+    }
+}
+
+TEST(OrthogonalizationAndSmoothing, OrthogonalizationSmallTriangularGridWithMulticolourGaussSeidel_ShouldConvergeFaster)
+{
+    const auto computeResiduals = [](const OrthogonalizationAndSmoothing::InnerSolver innerSolver, UInt& numColours)
+    {
+        auto mesh = ReadLegacyMesh2DFromFile(TEST_FOLDER + "/data/SmallTriangularGrid_net.nc");
+        OrthogonalizationParameters orthogonalizationParameters;
+        orthogonalizationParameters.outer_iterations = 2;
+        orthogonalizationParameters.boundary_iterations = 25;
+        orthogonalizationParameters.inner_iterations = 25;
+        orthogonalizationParameters.displacement_tolerance = 1.0e-4;
+        orthogonalizationParameters.inner_solver = static_cast<int>(innerSolver);
+
+        auto polygon = std::make_unique<Polygons>();
+        std::vector<Point> landBoundary;
+        auto landboundaries = std::make_unique<LandBoundaries>(landBoundary, *mesh, *polygon);
+
+        OrthogonalizationAndSmoothing orthogonalization(*mesh,
+                                                        std::move(polygon),
+                                                        std::move(landboundaries),
+                                                        LandBoundaries::ProjectToLandBoundaryOption::DoNotProjectToLandBoundary,
+                                                        orthogonalizationParameters);
+
+        [[maybe_unused]] auto undoAction = orthogonalization.Initialize();
+        orthogonalization.Compute();
+
+        numColours = orthogonalization.NumColours();
+        return std::make_pair(orthogonalization.Residuals(), mesh->Nodes());
+    };
+
+    UInt jacobiColours = 0;
+    UInt gaussSeidelColours = 0;
+    const auto [jacobiResiduals, jacobiNodes] = computeResiduals(OrthogonalizationAndSmoothing::InnerSolver::Jacobi, jacobiColours);
+    const auto [gaussSeidelResiduals, gaussSeidelNodes] = computeResiduals(OrthogonalizationAndSmoothing::InnerSolver::MulticolourGaussSeidel, gaussSeidelColours);
+
+    EXPECT_EQ(0, jacobiColours);
+    EXPECT_GT(gaussSeidelColours, 1);
+    EXPECT_LT(gaussSeidelResiduals.size(), jacobiResiduals.size());
+
+    // both solvers converge to the same nodes
+    ASSERT_EQ(jacobiNodes.size(), gaussSeidelNodes.size());
+    constexpr double tolerance = 1.0e-2;
+    for (UInt n = 0; n < jacobiNodes.size(); ++n)
+    {
+        EXPECT_NEAR(jacobiNodes[n].x, gaussSeidelNodes[n].x, tolerance);
+        EXPECT_NEAR(jacobiNodes[n].y, gaussSeidelNodes[n].y, tolerance);
+    }
+}
+
 TEST(OrthogonalizationAndSmoothing, OrthogonalizationSmallTriangularGridAsNcFile)
 {
 
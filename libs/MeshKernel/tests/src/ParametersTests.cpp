@@ -224,4 +224,20 @@ TEST(ParametersTests, OrthogonalizationParameters)
     parameters = OrthogonalizationParameters();
     parameters.areal_to_angle_smoothing_factor = 1.000001;
     EXPECT_THROW(CheckOrthogonalizationParameters(parameters), RangeError);
+
+    parameters = OrthogonalizationParameters();
+    parameters.displacement_tolerance = -1.0e-6;
+    EXPECT_THROW(CheckOrthogonalizationParameters(parameters), RangeError);
+
+    parameters = OrthogonalizationParameters();
+    parameters.displacement_norm = 2;
+    EXPECT_THROW(CheckOrthogonalizationParameters(parameters), RangeError);
+
+    parameters = OrthogonalizationParameters();
+    parameters.orthogonality_tolerance = -0.1;
+    EXPECT_THROW(CheckOrthogonalizationParameters(parameters), RangeError);
+
+    parameters = OrthogonalizationParameters();
+    parameters.inner_solver = 2;
+    EXPECT_THROW(CheckOrthogonalizationParameters(parameters), RangeError);
 }
@@ -35,6 +35,7 @@
 #include "MeshKernel/Mesh2D.hpp"
 #include "MeshKernel/Point.hpp"
 #include "MeshKernel/Polygon.hpp"
+#include "MeshKernel/Utilities/PolygonSlabIndex.hpp"
 
 #include "TestUtils/MakeMeshes.hpp"
 
@@ -170,6 +171,91 @@ TEST(PolygonTests, ContainsTest)
     EXPECT_THROW(polygon.Contains(invalidPoint), mk::ConstraintError);
 }
 
+TEST(PolygonTests, ContainsLargePolygonTest)
+{
+    // a regular polygon with many nodes, its segments are indexed in slabs
+    constexpr mk::UInt numberOfNodes = 2000;
+    constexpr double radius = 100.0;
+
+    std::vector<mk::Point> polygonPoints(numberOfNodes + 1);
+    for (mk::UInt i = 0; i < numberOfNodes; ++i)
+    {
+        const double angle = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(numberOfNodes);
+        polygonPoints[i] = {radius * std::cos(angle), radius * std::sin(angle)};
+    }
+    polygonPoints.back() = polygonPoints.front();
+
+    const mk::Polygon polygon(polygonPoints, mk::Projection::cartesian);
+
+    // the inscribed circle of the polygon
+    const double innerRadius = radius * std::cos(M_PI / static_cast<double>(numberOfNodes));
+
+    constexpr int numberOfSteps = 201;
+    const double delta = 2.4 * radius / static_cast<double>(numberOfSteps - 1);
+    for (int i = 0; i < numberOfSteps; ++i)
+    {
+        for (int j = 0; j < numberOfSteps; ++j)
+        {
+            const mk::Point p(-1.2 * radius + delta * j, -1.2 * radius + delta * i);
+            const double distance = std::hypot(p.x, p.y);
+
+            if (distance < innerRadius)
+            {
+                EXPECT_TRUE(polygon.Contains(p));
+            }
+            else if (distance > radius)
+            {
+                EXPECT_FALSE(polygon.Contains(p));
+            }
+        }
+    }
+
+    // the nodes lie on the polygon
+    for (const auto& node : polygonPoints)
+    {
+        EXPECT_TRUE(polygon.Contains(node));
+    }
+}
+
+TEST(PolygonTests, PolygonSlabIndex_ShouldContainAllSegmentsCrossingY)
+{
+    // a zig-zag polyline, with a horizontal and a zero length segment
+    std::vector<mk::Point> nodes;
+    for (int i = 0; i < 200; ++i)
+    {
+        nodes.emplace_back(static_cast<double>(i), (i % 2 == 0 ? 0.0 : 1.0) * static_cast<double>(i % 7));
+    }
+    nodes.emplace_back(nodes.back().x + 1.0, nodes.back().y);
+    nodes.emplace_back(nodes.back());
+    nodes.emplace_back(nodes.front());
+
+    const mk::PolygonSlabIndex index(nodes);
+    ASSERT_FALSE(index.Empty());
+    EXPECT_GT(index.NumberOfSlabs(), 1);
+
+    const auto numSegments = static_cast<mk::UInt>(nodes.size() - 1);
+    for (int step = -10; step <= 70; ++step)
+    {
+        const double y = 0.1 * static_cast<double>(step);
+        const auto segments = index.Segments(y);
+
+        for (mk::UInt s = 0; s < numSegments; ++s)
+        {
+            const auto [lower, upper] = std::minmax(nodes[s].y, nodes[s + 1].y);
+            const bool isDegenerate = nodes[s] == nodes[s + 1];
+            if ((lower <= y && y <= upper) || (isDegenerate && 0.0 <= y && y <= 6.0))
+            {
+                EXPECT_NE(std::ranges::find(segments, s), segments.end()) << "segment " << s << " at y " << y;
+            }
+        }
+
+        if (y < 0.0 || y > 6.0)
+        {
+            EXPECT_TRUE(segments.empty());
+        }
+    }
+}
+
 TEST(PolygonTests, AreaCentreAndDirectionTest)
 {
     std::vector<mk::Point> polygonPointsLargerSquare{{-10.0, -5.0}, {20.0, -5.0}, {20.0, 10.0}, {-10.0, 10.0}, {-10.0, -5.0}};
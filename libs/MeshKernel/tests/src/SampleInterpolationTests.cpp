@@ -28,6 +28,8 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "MeshKernel/SampleAveragingInterpolator.hpp"
@@ -280,3 +282,176 @@ TEST(SampleInterpolationTests, TriangulationInterpolationWithPoints)
         EXPECT_NEAR(mesh->Node(i).y, yCoords[i], tolerance);
     }
 }
+
+namespace
+{
+    /// @brief Generate scattered sample points and two data sets, the second one with missing values
+    void MakeOperatorTestSamples(std::vector<mk::Point>& samplePoints, std::vector<double>& firstData, std::vector<double>& secondData)
+    {
+        const mk::UInt numberOfPointsX = 31;
+        const mk::UInt numberOfPointsY = 27;
+        const double delta = 100.0;
+
+        for (mk::UInt i = 0; i < numberOfPointsY; ++i)
+        {
+            for (mk::UInt j = 0; j < numberOfPointsX; ++j)
+            {
+                const double x = static_cast<double>(j) * delta + 17.0 * std::sin(static_cast<double>(3 * i + j));
+                const double y = static_cast<double>(i) * delta + 13.0 * std::cos(static_cast<double>(i + 5 * j));
+                const auto index = static_cast<mk::UInt>(samplePoints.size());
+
+                samplePoints.emplace_back(x, y);
+                firstData.emplace_back(0.01 * x * x - 0.5 * y);
+                secondData.emplace_back(index % 7 == 0 ? mk::constants::missing::doubleValue : std::sin(0.01 * x) * y);
+            }
+        }
+    }
+
+    /// @brief Check that the stored interpolation operator gives the same values as the interpolation, for all data sets
+    void ExpectSameInterpolation(mk::SampleInterpolator& interpolator, const mk::Mesh2D& mesh, const mk::Location location)
+    {
+        const int operatorId = 10;
+        interpolator.SetOperator(operatorId, interpolator.ComputeOperator(mesh, location));
+
+        const mk::UInt size = location == mk::Location::Nodes   ? mesh.GetNumNodes()
+                              : location == mk::Location::Edges ? mesh.GetNumEdges()
+                                                                : mesh.GetNumFaces();
+
+        for (const int propertyId : {1, 2})
+        {
+            std::vector<double> expected(size);
+            std::vector<double> result(size);
+
+            interpolator.Interpolate(propertyId, mesh, location, expected);
+            interpolator.ApplyOperator(propertyId, operatorId, result);
+
+            for (size_t i = 0; i < result.size(); ++i)
+            {
+                EXPECT_NEAR(expected[i], result[i], 1.0e-9 * std::max(1.0, std::abs(expected[i])));
+            }
+        }
+    }
+} // namespace
+
+TEST(SampleInterpolationTests, AveragingInterpolationOperator_ShouldGiveTheSameValuesAsInterpolate)
+{
+    std::vector<mk::Point> samplePoints;
+    std::vector<double> firstData;
+    std::vector<double> secondData;
+    MakeOperatorTestSamples(samplePoints, firstData, secondData);
+
+    const auto mesh = MakeRectangularMeshForTesting(12, 10, 2600.0, 2300.0, mk::Projection::cartesian, {150.0, 120.0});
+
+    for (const int method : {static_cast<int>(mk::AveragingInterpolation::Method::SimpleAveraging),
+                             static_cast<int>(mk::AveragingInterpolation::Method::InverseWeightedDistance)})
+    {
+        mk::InterpolationParameters params{.interpolation_type = 1,
+                                           .method = method,
+                                           .absolute_search_radius = 250.0,
+                                           .relative_search_radius = 1.01,
+                                           .use_closest_if_none_found = true,
+                                           .minimum_number_of_samples = 2};
+        mk::SampleAveragingInterpolator interpolator(samplePoints, mk::Projection::cartesian, params);
+        interpolator.SetData(1, firstData);
+        interpolator.SetData(2, secondData);
+
+        ExpectSameInterpolation(interpolator, *mesh, mk::Location::Nodes);
+        ExpectSameInterpolation(interpolator, *mesh, mk::Location::Edges);
+        ExpectSameInterpolation(interpolator, *mesh, mk::Location::Faces);
+
+        // Interpolation at points
+        const auto interpolationOperator = interpolator.ComputeOperator(mesh->Nodes());
+        interpolator.SetOperator(20, interpolationOperator);
+
+        std::vector<double> expected(mesh->GetNumNodes());
+        std::vector<double> result(mesh->GetNumNodes());
+        interpolator.Interpolate(2, mesh->Nodes(), expected);
+        interpolator.ApplyOperator(2, 20, result);
+
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            EXPECT_NEAR(expected[i], result[i], 1.0e-9 * std::max(1.0, std::abs(expected[i])));
+        }
+    }
+
+    // The non linear averaging methods cannot be expressed as an operator
+    mk::InterpolationParameters params{.interpolation_type = 1,
+                                       .method = static_cast<int>(mk::AveragingInterpolation::Method::Max)};
+    mk::SampleAveragingInterpolator interpolator(samplePoints, mk::Projection::cartesian, params);
+    EXPECT_THROW([[maybe_unused]] auto result = interpolator.ComputeOperator(*mesh, mk::Location::Nodes), mk::ConstraintError);
+}
+
+TEST(SampleInterpolationTests, TriangulationInterpolationOperator_ShouldGiveTheSameValuesAsInterpolate)
+{
+    std::vector<mk::Point> samplePoints;
+    std::vector<double> firstData;
+    std::vector<double> secondData;
+    MakeOperatorTestSamples(samplePoints, firstData, secondData);
+
+    const auto mesh = MakeRectangularMeshForTesting(12, 10, 2600.0, 2300.0, mk::Projection::cartesian, {150.0, 120.0});
+
+    mk::SampleTriangulationInterpolator interpolator(samplePoints, mk::Projection::cartesian);
+    interpolator.SetData(1, firstData);
+    interpolator.SetData(2, secondData);
+
+    ExpectSameInterpolation(interpolator, *mesh, mk::Location::Nodes);
+    ExpectSameInterpolation(interpolator, *mesh, mk::Location::Edges);
+    ExpectSameInterpolation(interpolator, *mesh, mk::Location::Faces);
+
+    // The operator is checked against the number of samples
+    std::vector<double> result(mesh->GetNumNodes());
+    EXPECT_THROW(interpolator.ComputeOperator(*mesh, mk::Location::Nodes).Apply(std::vector<double>(3, 0.0), result), mk::ConstraintError);
+}
+
+TEST(SampleInterpolationTests, InterpolateSeveralProperties_ShouldGiveTheSameValuesAsSeparateInterpolations)
+{
+    std::vector<mk::Point> samplePoints;
+    std::vector<double> firstData;
+    std::vector<double> secondData;
+    MakeOperatorTestSamples(samplePoints, firstData, secondData);
+
+    const auto mesh = MakeRectangularMeshForTesting(12, 10, 2600.0, 2300.0, mk::Projection::cartesian, {150.0, 120.0});
+
+    // Inverse weighted distance is computed with an interpolation operator, the maximum is not
+    for (const int method : {static_cast<int>(mk::AveragingInterpolation::Method::InverseWeightedDistance),
+                             static_cast<int>(mk::AveragingInterpolation::Method::Max)})
+    {
+        mk::InterpolationParameters params{.interpolation_type = 1,
+                                           .method = method,
+                                           .absolute_search_radius = 250.0,
+                                           .relative_search_radius = 1.01,
+                                           .use_closest_if_none_found = true,
+                                           .minimum_number_of_samples = 2};
+        mk::SampleAveragingInterpolator interpolator(samplePoints, mk::Projection::cartesian, params);
+        interpolator.SetData(1, firstData);
+        interpolator.SetData(2, secondData);
+
+        std::vector<double> xSamples(samplePoints.size());
+        std::vector<double> ySamples(samplePoints.size());
+        std::ranges::transform(samplePoints, xSamples.begin(), [](const mk::Point& p)
+                               { return p.x; });
+        std::ranges::transform(samplePoints, ySamples.begin(), [](const mk::Point& p)
+                               { return p.y; });
+
+        EXPECT_TRUE(interpolator.HasSamePoints(xSamples, ySamples));
+        ySamples.back() += 1.0;
+        EXPECT_FALSE(interpolator.HasSamePoints(xSamples, ySamples));
+
+        const std::vector<int> propertyIds{2, 1};
+        const mk::UInt size = mesh->GetNumFaces();
+        std::vector<double> result(propertyIds.size() * size);
+
+        interpolator.Interpolate(propertyIds, *mesh, mk::Location::Faces, result);
+
+        for (size_t p = 0; p < propertyIds.size(); ++p)
+        {
+            std::vector<double> expected(size);
+            interpolator.Interpolate(propertyIds[p], *mesh, mk::Location::Faces, expected);
+
+            for (mk::UInt i = 0; i < size; ++i)
+            {
+                EXPECT_NEAR(expected[i], result[p * size + i], 1.0e-9 * std::max(1.0, std::abs(expected[i])));
+            }
+        }
+    }
+}
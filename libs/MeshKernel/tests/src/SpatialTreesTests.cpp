@@ -25,11 +25,14 @@
 //
 //------------------------------------------------------------------------------
 
+#include <algorithm>
 #include <chrono>
 #include <gtest/gtest.h>
 #include <random>
 
 #include <MeshKernel/Entities.hpp>
+#include <MeshKernel/Exceptions.hpp>
+#include <MeshKernel/Utilities/PackedBoxTree.hpp>
 #include <MeshKernel/Utilities/RTreeFactory.hpp>
 
 TEST(RTree, RTreeRemovePoint)
@@ -262,3 +265,291 @@ TEST(RTree, SphericalRTreeBoundedBoxBasicTests)
     EXPECT_NEAR(nearestPoint.x, centre.x, tolerance);
     EXPECT_NEAR(nearestPoint.y, centre.y, tolerance);
 }
+
+TEST(RTree, SearchPoints_WithCallerOwnedResult_MustMatchQueryCacheResults)
+{
+    const int n = 50; // x
+    const int m = 50; // y
+
+    std::vector<meshkernel::Point> nodes(n * m);
+    std::size_t nodeIndex = 0;
+    for (auto j = 0; j < m; ++j)
+    {
+        for (auto i = 0; i < n; ++i)
+        {
+            nodes[nodeIndex] = {static_cast<double>(i), static_cast<double>(j)};
+            nodeIndex++;
+        }
+    }
+
+    const auto rtree = meshkernel::RTreeFactory::Create(meshkernel::Projection::cartesian);
+    rtree->BuildTree(nodes);
+
+    const double squaredDistance = 1.5 * 1.5;
+    std::vector<std::vector<meshkernel::UInt>> parallelResults(nodes.size());
+    std::vector<meshkernel::UInt> queryResult;
+
+    // The const query can be performed concurrently on the same tree
+#pragma omp parallel for private(queryResult)
+    for (int i = 0; i < static_cast<int>(nodes.size()); ++i)
+    {
+        rtree->SearchPoints(nodes[i], squaredDistance, queryResult);
+        parallelResults[i] = queryResult;
+    }
+
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        rtree->SearchPoints(nodes[i], squaredDistance);
+        ASSERT_EQ(rtree->GetQueryResultSize(), parallelResults[i].size());
+
+        for (meshkernel::UInt j = 0; j < rtree->GetQueryResultSize(); ++j)
+        {
+            EXPECT_EQ(rtree->GetQueryResult(j), parallelResults[i][j]);
+        }
+    }
+
+    // Nearest point queries
+    rtree->SearchNearestPoint({10.1, 20.2}, queryResult);
+    ASSERT_EQ(queryResult.size(), 1);
+    EXPECT_EQ(queryResult[0], 20 * n + 10);
+
+    rtree->SearchNearestPoint({10.1, 20.2}, 0.01, queryResult);
+    EXPECT_TRUE(queryResult.empty());
+}
+
+TEST(RTree, SearchPoints_BatchQueries_MustMatchSingleQueries)
+{
+    const int n = 40; // x
+    const int m = 30; // y
+
+    std::vector<meshkernel::Point> nodes(n * m);
+    std::size_t nodeIndex = 0;
+    for (auto j = 0; j < m; ++j)
+    {
+        for (auto i = 0; i < n; ++i)
+        {
+            nodes[nodeIndex] = {static_cast<double>(i), static_cast<double>(j)};
+            nodeIndex++;
+        }
+    }
+
+    std::vector<meshkernel::Point> queryNodes;
+    std::vector<double> searchRadiiSquared;
+    for (std::size_t q = 0; q < nodes.size(); q += 7)
+    {
+        queryNodes.push_back({nodes[q].x + 0.25, nodes[q].y + 0.4});
+        searchRadiiSquared.push_back(static_cast<double>(q % 4) * 0.75);
+    }
+
+    for (const auto projection : {meshkernel::Projection::cartesian, meshkernel::Projection::spherical})
+    {
+        const auto rtree = meshkernel::RTreeFactory::Create(projection);
+        rtree->BuildTree(nodes);
+
+        // In spherical coordinates the distances are in meters, one degree is about 111 km
+        const double scale = projection == meshkernel::Projection::cartesian ? 1.0 : 1.0e5;
+        const double squaredDistance = 2.0 * 2.0 * scale * scale;
+        std::vector<double> scaledRadiiSquared(searchRadiiSquared.size());
+        std::ranges::transform(searchRadiiSquared, scaledRadiiSquared.begin(), [scale](double r)
+                               { return r * scale * scale; });
+        meshkernel::RTreeQueryResults batchResults;
+        std::vector<meshkernel::UInt> queryResult;
+
+        // Same search radius for all nodes
+        rtree->SearchPoints(queryNodes, squaredDistance, batchResults);
+        ASSERT_EQ(batchResults.Size(), queryNodes.size());
+        for (meshkernel::UInt q = 0; q < queryNodes.size(); ++q)
+        {
+            rtree->SearchPoints(queryNodes[q], squaredDistance, queryResult);
+            const auto batchResult = batchResults[q];
+            EXPECT_EQ(std::vector<meshkernel::UInt>(batchResult.begin(), batchResult.end()), queryResult);
+        }
+
+        // A search radius for each node
+        rtree->SearchPoints(queryNodes, scaledRadiiSquared, batchResults);
+        ASSERT_EQ(batchResults.Size(), queryNodes.size());
+        for (meshkernel::UInt q = 0; q < queryNodes.size(); ++q)
+        {
+            rtree->SearchPoints(queryNodes[q], scaledRadiiSquared[q], queryResult);
+            const auto batchResult = batchResults[q];
+            EXPECT_EQ(std::vector<meshkernel::UInt>(batchResult.begin(), batchResult.end()), queryResult);
+        }
+
+        // The k nearest nodes, the first one being the nearest node
+        const meshkernel::UInt numberOfNeighbours = 4;
+        rtree->SearchNearestPoints(queryNodes, numberOfNeighbours, batchResults);
+        ASSERT_EQ(batchResults.Size(), queryNodes.size());
+        for (meshkernel::UInt q = 0; q < queryNodes.size(); ++q)
+        {
+            ASSERT_EQ(batchResults.Size(q), numberOfNeighbours);
+            rtree->SearchNearestPoint(queryNodes[q], queryResult);
+            EXPECT_EQ(batchResults[q][0], queryResult[0]);
+        }
+    }
+
+    // The number of nodes and the number of radii must be equal
+    const auto rtree = meshkernel::RTreeFactory::Create(meshkernel::Projection::cartesian);
+    rtree->BuildTree(nodes);
+    meshkernel::RTreeQueryResults batchResults;
+    searchRadiiSquared.pop_back();
+    EXPECT_THROW(rtree->SearchPoints(queryNodes, searchRadiiSquared, batchResults), meshkernel::ConstraintError);
+}
+
+TEST(RTree, PackedRTree_MustFindTheSamePointsAsTheDynamicRTree)
+{
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<double> xDistribution(-10.0, 30.0);
+    std::uniform_real_distribution<double> yDistribution(-20.0, 40.0);
+
+    std::vector<meshkernel::Sample> samples(5000);
+    for (auto& sample : samples)
+    {
+        sample = {xDistribution(generator), yDistribution(generator), 1.0};
+    }
+    samples[17] = {meshkernel::constants::missing::doubleValue, meshkernel::constants::missing::doubleValue, 1.0};
+
+    std::vector<meshkernel::Point> queryNodes(200);
+    for (auto& node : queryNodes)
+    {
+        node = {xDistribution(generator), yDistribution(generator)};
+    }
+
+    for (const auto projection : {meshkernel::Projection::cartesian, meshkernel::Projection::spherical})
+    {
+        const auto dynamicRTree = meshkernel::RTreeFactory::Create(projection);
+        const auto packedRTree = meshkernel::RTreeFactory::Create(projection, meshkernel::RTreeFactory::Type::Packed);
+        dynamicRTree->BuildTree(samples);
+        packedRTree->BuildTree(samples);
+        ASSERT_EQ(packedRTree->Size(), dynamicRTree->Size());
+
+        const double searchRadius = projection == meshkernel::Projection::cartesian ? 1.5 : 1.5e5;
+        const double searchRadiusSquared = searchRadius * searchRadius;
+
+        for (const auto& node : queryNodes)
+        {
+            dynamicRTree->SearchPoints(node, searchRadiusSquared);
+            packedRTree->SearchPoints(node, searchRadiusSquared);
+            std::vector<meshkernel::UInt> expected;
+            std::vector<meshkernel::UInt> actual;
+            for (meshkernel::UInt i = 0; i < dynamicRTree->GetQueryResultSize(); ++i)
+            {
+                expected.push_back(dynamicRTree->GetQueryResult(i));
+            }
+            for (meshkernel::UInt i = 0; i < packedRTree->GetQueryResultSize(); ++i)
+            {
+                actual.push_back(packedRTree->GetQueryResult(i));
+            }
+            std::ranges::sort(expected);
+            std::ranges::sort(actual);
+            EXPECT_EQ(actual, expected);
+
+            dynamicRTree->SearchNearestPoint(node);
+            packedRTree->SearchNearestPoint(node);
+            ASSERT_TRUE(packedRTree->HasQueryResults());
+            EXPECT_EQ(packedRTree->GetQueryResult(0), dynamicRTree->GetQueryResult(0));
+
+            dynamicRTree->SearchNearestPoint(node, searchRadiusSquared);
+            packedRTree->SearchNearestPoint(node, searchRadiusSquared);
+            ASSERT_EQ(packedRTree->GetQueryResultSize(), dynamicRTree->GetQueryResultSize());
+            if (dynamicRTree->HasQueryResults())
+            {
+                EXPECT_EQ(packedRTree->GetQueryResult(0), dynamicRTree->GetQueryResult(0));
+            }
+        }
+
+        meshkernel::RTreeQueryResults expectedResults;
+        meshkernel::RTreeQueryResults actualResults;
+        dynamicRTree->SearchNearestPoints(queryNodes, 5, expectedResults);
+        packedRTree->SearchNearestPoints(queryNodes, 5, actualResults);
+        EXPECT_EQ(actualResults.offsets, expectedResults.offsets);
+        EXPECT_EQ(actualResults.indices, expectedResults.indices);
+    }
+}
+
+TEST(RTree, PackedRTree_DeleteNodeAndBoundingBox)
+{
+    const int n = 20; // x
+    const int m = 20; // y
+
+    std::vector<meshkernel::Point> nodes(n * m);
+    std::size_t nodeIndex = 0;
+    for (auto j = 0; j < m; ++j)
+    {
+        for (auto i = 0; i < n; ++i)
+        {
+            nodes[nodeIndex] = {static_cast<double>(i), static_cast<double>(j)};
+            nodeIndex++;
+        }
+    }
+
+    const auto rtree = meshkernel::RTreeFactory::Create(meshkernel::Projection::cartesian, meshkernel::RTreeFactory::Type::Packed);
+    EXPECT_THROW(rtree->SearchNearestPoint(nodes[0]), meshkernel::AlgorithmError);
+
+    rtree->BuildTree(nodes);
+    ASSERT_EQ(rtree->Size(), n * m);
+
+    // deleted nodes are not found anymore
+    rtree->DeleteNode(5 * n + 5);
+    EXPECT_EQ(rtree->Size(), n * m - 1);
+    rtree->SearchPoints(nodes[5 * n + 5], 0.01);
+    EXPECT_FALSE(rtree->HasQueryResults());
+    rtree->SearchPoints(nodes[5 * n + 5], 1.01);
+    EXPECT_EQ(rtree->GetQueryResultSize(), 4);
+
+    // only the nodes in the bounding box are included
+    const meshkernel::BoundingBox boundingBox({2.5, 2.5}, {6.5, 4.5});
+    rtree->BuildTree(nodes, boundingBox);
+    EXPECT_EQ(rtree->Size(), 4 * 2);
+    rtree->SearchNearestPoint({0.0, 0.0});
+    ASSERT_TRUE(rtree->HasQueryResults());
+    EXPECT_EQ(rtree->GetQueryResult(0), 3 * n + 3);
+}
+
+TEST(RTree, PackedBoxTree_MustFindTheOverlappingBoxes)
+{
+    // random boxes, the items with an empty box are not indexed
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> position(0.0, 100.0);
+    std::uniform_real_distribution<double> extent(0.0, 5.0);
+
+    std::vector<meshkernel::BoundingBox> boxes(1000);
+    for (auto& box : boxes)
+    {
+        const meshkernel::Point lowerLeft(position(generator), position(generator));
+        box = meshkernel::BoundingBox(lowerLeft, lowerLeft + meshkernel::Vector(extent(generator), extent(generator)));
+    }
+    boxes[10] = meshkernel::CreateNonOverlappingBoundingBox();
+
+    const meshkernel::PackedBoxTree tree(boxes);
+    ASSERT_EQ(tree.NumberOfItems(), boxes.size());
+
+    std::vector<meshkernel::UInt> items;
+    for (int q = 0; q < 100; ++q)
+    {
+        const meshkernel::Point lowerLeft(position(generator), position(generator));
+        const meshkernel::BoundingBox searchBox(lowerLeft, lowerLeft + meshkernel::Vector(extent(generator), extent(generator)));
+
+        std::vector<meshkernel::UInt> expected;
+        for (meshkernel::UInt i = 0; i < boxes.size(); ++i)
+        {
+            if (i != 10 && boxes[i].Overlaps(searchBox))
+            {
+                expected.emplace_back(i);
+            }
+        }
+
+        tree.Search(searchBox, items);
+        std::ranges::sort(items);
+        EXPECT_EQ(items, expected);
+    }
+
+    // the search stops when the function returns false
+    meshkernel::UInt numVisited = 0;
+    tree.Search(meshkernel::BoundingBox({0.0, 0.0}, {100.0, 100.0}), [&numVisited](meshkernel::UInt)
+                { return ++numVisited < 3; });
+    EXPECT_EQ(numVisited, 3);
+
+    const meshkernel::PackedBoxTree emptyTree;
+    emptyTree.Search(meshkernel::BoundingBox({0.0, 0.0}, {100.0, 100.0}), items);
+    EXPECT_TRUE(items.empty());
+}
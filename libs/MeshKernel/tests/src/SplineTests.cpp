@@ -33,6 +33,7 @@
 #include <MeshKernel/LandBoundary.hpp>
 #include <MeshKernel/Operations.hpp>
 #include <MeshKernel/SplineAlgorithms.hpp>
+#include <MeshKernel/SplineSegmentIndex.hpp>
 #include <MeshKernel/Splines.hpp>
 
 #include <TestUtils/Definitions.hpp>
@@ -418,3 +419,68 @@ TEST(Splines, MultiSplineIntersectionAngle)
         EXPECT_NEAR(yCrossOver[i], expectedIntersectedCoordY[i], tolerance);
     }
 }
+
+TEST(Splines, SplineSegmentIndex_ShouldGiveTheSameIntersectionsAsAllSegmentPairs)
+{
+    namespace mk = meshkernel;
+    const auto splines = LoadSplines(TEST_FOLDER + "/data/CurvilinearGrids/seventy_splines.spl");
+
+    const mk::SplineSegmentIndex segmentIndex(splines.m_splineNodes, splines.m_projection);
+    ASSERT_TRUE(segmentIndex.IsIndexed());
+
+    const auto segmentPairs = segmentIndex.FindSegmentPairs();
+
+    mk::UInt numSegments = 0;
+    for (const auto& nodes : splines.m_splineNodes)
+    {
+        numSegments += static_cast<mk::UInt>(nodes.size()) - 1;
+    }
+    EXPECT_LT(segmentPairs.size(), numSegments * (numSegments - 1) / 2);
+
+    mk::UInt numIntersections = 0;
+    std::vector<mk::Splines::SegmentIndices> candidates;
+
+    for (mk::UInt i = 0; i < splines.GetNumSplines(); ++i)
+    {
+        for (mk::UInt j = i + 1; j < splines.GetNumSplines(); ++j)
+        {
+            candidates.clear();
+            for (const auto& pair : segmentPairs)
+            {
+                if (pair.firstSpline == i && pair.secondSpline == j)
+                {
+                    candidates.emplace_back(pair.firstSegment, pair.secondSegment);
+                }
+            }
+
+            double crossProduct = 0.0;
+            double angle = 0.0;
+            mk::Point point;
+            double firstRatio = 0.0;
+            double secondRatio = 0.0;
+            const bool isCrossing = splines.GetSplinesIntersection(i, j, crossProduct, angle, point, firstRatio, secondRatio);
+
+            double indexedCrossProduct = 0.0;
+            double indexedAngle = 0.0;
+            mk::Point indexedPoint;
+            double indexedFirstRatio = 0.0;
+            double indexedSecondRatio = 0.0;
+            const bool isIndexedCrossing = !candidates.empty() &&
+                                           splines.GetSplinesIntersection(i, j, candidates, indexedCrossProduct, indexedAngle, indexedPoint, indexedFirstRatio, indexedSecondRatio);
+
+            ASSERT_EQ(isCrossing, isIndexedCrossing);
+            if (isCrossing)
+            {
+                ++numIntersections;
+                EXPECT_EQ(crossProduct, indexedCrossProduct);
+                EXPECT_EQ(angle, indexedAngle);
+                EXPECT_EQ(point.x, indexedPoint.x);
+                EXPECT_EQ(point.y, indexedPoint.y);
+                EXPECT_EQ(firstRatio, indexedFirstRatio);
+                EXPECT_EQ(secondRatio, indexedSecondRatio);
+            }
+        }
+    }
+
+    EXPECT_GT(numIntersections, 0);
+}
@@ -29,15 +29,28 @@
 
 #include <vector>
 
+#include "MeshKernel/SplineSegmentIndex.hpp"
+#include "MeshKernel/Splines.hpp"
+
 #include "MeshKernelApi/SplineIntersections.hpp"
 
 namespace meshkernelapi
 {
 
     /// @brief Cache spline intersection data
+    ///
+    /// The segments of the cached splines are indexed once, so each intersection check only tests the segments
+    /// close to the spline checked.
     class SplineIntersectionCache
     {
     public:
+        /// @brief Constructor, indexes the segments of the splines
+        /// @param[in] splines The cached splines
+        explicit SplineIntersectionCache(const meshkernel::Splines& splines);
+
+        /// @brief Get the index of the segments of the cached splines
+        const meshkernel::SplineSegmentIndex& SegmentIndex() const { return m_segmentIndex; }
+
         /// @brief Get the number of spline intersections found
         int NumberOfIntersections() const;
 
@@ -51,6 +64,7 @@ namespace meshkernelapi
         void Copy(SplineIntersections& intersections) const;
 
     private:
+        meshkernel::SplineSegmentIndex m_segmentIndex; ///< The index of the segments of the cached splines
         std::vector<int> m_splineIndices;              ///< The indices of the spline intersected
         std::vector<double> m_intersectionAngles;      ///< The angles of the intersections
         std::vector<double> m_intersectionCoordinateX; ///< The x-coordinate of the intersection point
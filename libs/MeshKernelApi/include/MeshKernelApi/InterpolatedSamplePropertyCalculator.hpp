@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "MeshKernel/Definitions.hpp"
 #include "MeshKernel/Parameters.hpp"
 #include "MeshKernel/SampleInterpolator.hpp"
@@ -38,6 +40,9 @@ namespace meshkernelapi
 {
 
     /// @brief Interpolate the depths at the mesh node points.
+    ///
+    /// Several calculators can share the same sample interpolator, each interpolating its own sample data set,
+    /// so that the triangulation or the sample tree is built only once for sample data sets at the same points.
     class InterpolatedSamplePropertyCalculator : public PropertyCalculator
     {
     public:
@@ -47,6 +52,14 @@ namespace meshkernelapi
                                              const meshkernel::InterpolationParameters& interpolationParameters,
                                              const int propertyId);
 
+        /// @brief Constructor, the sample data is interpolated with the sample interpolator of another calculator
+        InterpolatedSamplePropertyCalculator(const InterpolatedSamplePropertyCalculator& sharedCalculator,
+                                             const GeometryList& sampleData,
+                                             const int propertyId);
+
+        /// @brief Destructor, removes the sample data from the sample interpolator
+        ~InterpolatedSamplePropertyCalculator() override;
+
         /// @brief Determine is the calculator can interpolate depth values correctly
         bool IsValid(const MeshKernelState& state, const meshkernel::Location location) const override;
 
@@ -58,15 +71,41 @@ namespace meshkernelapi
         /// @brief Determine the size of the edge-length vector required
         int Size(const MeshKernelState& state, const meshkernel::Location location) const override;
 
+        /// @brief Determine if sample data can be interpolated with the sample interpolator of this calculator
+        ///
+        /// The sample points, the projection and the interpolation parameters must be the same.
+        bool CanShareSamples(const GeometryList& sampleData,
+                             const meshkernel::Projection projection,
+                             const meshkernel::InterpolationParameters& interpolationParameters) const;
+
+        /// @brief Get the sample interpolator
+        const meshkernel::SampleInterpolator& GetSampleInterpolator() const;
+
+        /// @brief Get the property id
+        int GetPropertyId() const;
+
     private:
-        /// @brief Interpolator for the samples
-        std::unique_ptr<meshkernel::SampleInterpolator> m_sampleInterpolator;
+        /// @brief Interpolator for the samples, may be shared with other calculators
+        std::shared_ptr<meshkernel::SampleInterpolator> m_sampleInterpolator;
 
         /// @brief Projection sued for sample data.
         meshkernel::Projection m_projection;
 
+        /// @brief The interpolation parameters used to create the sample interpolator
+        meshkernel::InterpolationParameters m_interpolationParameters;
+
         /// @brief Property id.
         int m_propertyId = -1;
     };
 
 } // namespace meshkernelapi
+
+inline const meshkernel::SampleInterpolator& meshkernelapi::InterpolatedSamplePropertyCalculator::GetSampleInterpolator() const
+{
+    return *m_sampleInterpolator;
+}
+
+inline int meshkernelapi::InterpolatedSamplePropertyCalculator::GetPropertyId() const
+{
+    return m_propertyId;
+}
@@ -47,6 +47,9 @@
 
 /// \namespace meshkernelapi
 /// @brief Contains all structs and functions exposed at the API level
+///
+/// The functions can be called from several threads. Calls on different mesh states run concurrently,
+/// calls on the same mesh state are serialised. The error functions report the last error of the calling thread.
 namespace meshkernelapi
 {
     struct BoundingBox;
@@ -760,7 +763,7 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_get_edges_smoothness_type(int& type);
 
         /// @brief Gets pointer to error message.
-        /// @param[out] errorMessage The pointer to the latest error message
+        /// @param[out] errorMessage The pointer to the latest error message of the calling thread
         /// @returns Error code
         MKERNEL_API int mkernel_get_error(char* errorMessage);
 
@@ -952,6 +955,9 @@ namespace meshkernelapi
         MKERNEL_API int mkernel_mesh2d_rotate(int meshKernelId, double centreX, double centreY, double theta);
 
         /// @brief Sets the property data for the mesh, the sample data points do not have to match the mesh2d nodes.
+        ///
+        /// If the sample data points, the interpolation parameters and the projection are the same as those of an existing property,
+        /// the triangulation or the sample search tree of that property is shared by the new property.
         /// @param[in] meshKernelId The id of the mesh state
         /// @param[in] interpolationParameters The parameters required for the interpolation
         /// @param[in] sampleData   The sample data and associated sample data points.
@@ -1438,6 +1444,22 @@ namespace meshkernelapi
         /// @returns Error code
         MKERNEL_API int mkernel_mesh2d_get_orthogonality(int meshKernelId, GeometryList& geometryList);
 
+        /// @brief Gets the residuals of the last mesh2d orthogonalization, the node displacement of each inner iteration.
+        ///
+        /// The residuals are recorded by `mkernel_mesh2d_compute_orthogonalization` and by each
+        /// `mkernel_mesh2d_compute_inner_ortogonalization_iteration` call (interactive mode).
+        /// The norm of the displacement is selected by \ref meshkernel::OrthogonalizationParameters::displacement_norm
+        /// @param[in]  meshKernelId The id of the mesh state
+        /// @param[out] residuals    The residuals, an array of dimension `mkernel_mesh2d_get_orthogonalization_residuals_dimension`
+        /// @returns Error code
+        MKERNEL_API int mkernel_mesh2d_get_orthogonalization_residuals(int meshKernelId, double* residuals);
+
+        /// @brief Gets the number of residuals of the last mesh2d orthogonalization
+        /// @param[in]  meshKernelId The id of the mesh state
+        /// @param[out] numResiduals The number of residuals
+        /// @returns Error code
+        MKERNEL_API int mkernel_mesh2d_get_orthogonalization_residuals_dimension(int meshKernelId, int& numResiduals);
+
         /// @brief Retrieves a specified property of a 2D mesh.
         ///
         /// @param[in] meshKernelId The id of the mesh state
@@ -1447,6 +1469,18 @@ namespace meshkernelapi
         /// @returns Error code
         MKERNEL_API int mkernel_mesh2d_get_property(int meshKernelId, int propertyValue, int locationId, const GeometryList& geometrylist);
 
+        /// @brief Retrieves several properties of a 2D mesh, interpolated from sample data set with \ref mkernel_mesh2d_set_property.
+        ///
+        /// The interpolation points are located once for all properties sharing the same sample data points.
+        /// The values of the i-th property are stored from index i * dimension, the dimension is given by \ref mkernel_mesh2d_get_property_dimension.
+        /// @param[in] meshKernelId The id of the mesh state
+        /// @param[in] propertyIds The ids of the properties
+        /// @param[in] numberOfProperties The number of properties
+        /// @param[in] locationId The location (nodes, edge centres or face centres) at which the properties should be computed
+        /// @param[in,out] geometrylist A reference to a GeometryList object, the values will be populated with the values of the requested properties
+        /// @returns Error code
+        MKERNEL_API int mkernel_mesh2d_get_interpolated_properties(int meshKernelId, const int* propertyIds, int numberOfProperties, int locationId, const GeometryList& geometrylist);
+
         /// @brief The dimension of a specified property of a 2D mesh.
         ///
         /// @param[in] meshKernelId The id of the mesh state
@@ -1633,6 +1667,15 @@ namespace meshkernelapi
         /// @returns Error code
         MKERNEL_API int mkernel_mesh2d_prepare_outer_iteration_orthogonalization(int meshKernelId);
 
+        /// @brief Sets the meshkernel::Mesh2D state from a snapshot written by mkernel_mesh2d_write_snapshot
+        ///
+        /// The connectivity stored in the snapshot is used as is, the faces are not searched again.
+        /// The projection of the snapshot must be the projection of the mesh state.
+        /// @param[in] meshKernelId The id of the mesh state
+        /// @param[in] fileName     The name of the snapshot file
+        /// @returns Error code
+        MKERNEL_API int mkernel_mesh2d_read_snapshot(int meshKernelId, const char* fileName);
+
         /// @brief Refine based on gridded samples
         ///
         /// The number of successive splits is indicated on the sample value.
@@ -1750,6 +1793,12 @@ namespace meshkernelapi
                                                                    int locationType,
                                                                    GeometryList& results);
 
+        /// @brief Writes the meshkernel::Mesh2D state, administrated, to a binary snapshot file
+        /// @param[in] meshKernelId The id of the mesh state
+        /// @param[in] fileName     The name of the snapshot file
+        /// @returns Error code
+        MKERNEL_API int mkernel_mesh2d_write_snapshot(int meshKernelId, const char* fileName);
+
         /// @brief Compute the network chainages from fixed point locations
         /// @param[in] meshKernelId The id of the mesh state
         /// @param[in] fixedChainages The fixed chainages for each polyline. Chunks are separated by the separator, each chunk corresponds to a polyline
@@ -28,11 +28,16 @@
 #pragma once
 
 #include "MeshKernel/Definitions.hpp"
+#include "MeshKernel/Mesh2D.hpp"
 #include "MeshKernel/Parameters.hpp"
 #include "MeshKernel/SampleInterpolator.hpp"
 
 #include "MeshKernelApi/GeometryList.hpp"
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 namespace meshkernelapi
 {
 
@@ -40,6 +45,9 @@ namespace meshkernelapi
     struct MeshKernelState;
 
     /// @brief Base class for calculating properties for a mesh
+    ///
+    /// Calculators depending on the mesh2d only can cache their results, these remain valid
+    /// until the mesh2d is replaced or its geometry or topology generation changes.
     class PropertyCalculator
     {
     public:
@@ -54,6 +62,29 @@ namespace meshkernelapi
 
         /// @brief Determine the size of the vector required to store the calculated properties
         virtual int Size(const MeshKernelState& state, const meshkernel::Location location) const = 0;
+
+    protected:
+        /// @brief The results of a calculation, computed for a mesh2d at a location
+        struct CachedResults
+        {
+            std::vector<double> m_values;                 ///< The computed values, empty if the property has coordinates only
+            std::vector<meshkernel::Point> m_coordinates; ///< The computed coordinates, empty if the property has values only
+        };
+
+        /// @brief Gets the results of the previous calculation
+        /// @returns The cached results, or nullptr if the mesh2d was replaced or edited or the location differs since they were stored
+        const CachedResults* FindCachedResults(const MeshKernelState& state, const meshkernel::Location location) const;
+
+        /// @brief Stores the results of a calculation, keyed on the mesh2d of the state, its generations and the location
+        /// @returns The stored results
+        const CachedResults& StoreCachedResults(const MeshKernelState& state, const meshkernel::Location location, CachedResults&& results) const;
+
+    private:
+        mutable CachedResults m_cachedResults;                                         ///< The results of the previous calculation
+        mutable std::weak_ptr<const meshkernel::Mesh2D> m_cachedMesh;                  ///< The mesh2d used for the cached results
+        mutable meshkernel::Location m_cachedLocation = meshkernel::Location::Unknown; ///< The location of the cached results
+        mutable std::uint64_t m_cachedGeometryGeneration = 0;                          ///< The mesh2d geometry generation of the cached results
+        mutable std::uint64_t m_cachedTopologyGeneration = 0;                          ///< The mesh2d topology generation of the cached results
     };
 
 } // namespace meshkernelapi
@@ -89,6 +89,7 @@ namespace meshkernelapi
         std::map<int, std::shared_ptr<PropertyCalculator>> m_propertyCalculators;                            ///< Property calculators for the mesh2d
         std::unordered_map<meshkernel::UInt, std::pair<meshkernel::Point, meshkernel::Point>> m_frozenLines; ///< Map for string the frozen lines
         meshkernel::UInt m_frozenLinesCounter = 0;                                                           ///< An increasing counter for returning the id of frozen lines to the client
+        std::vector<double> m_orthogonalizationResiduals;                                                    ///< The node displacement of each inner iteration of the last mesh2d orthogonalization
 
         // Exclusively owned state
         meshkernel::Projection m_projection{meshkernel::Projection::cartesian}; ///< Projection used by the meshes
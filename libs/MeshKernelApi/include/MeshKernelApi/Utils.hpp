@@ -331,9 +331,9 @@ namespace meshkernelapi
     static void SetMesh2dApiDimensions(const meshkernel::Mesh& mesh2d, Mesh2D& mesh2dApi)
     {
         size_t num_face_nodes = 0;
-        for (size_t f = 0; f < mesh2d.GetNumFaces(); f++)
+        for (meshkernel::UInt f = 0; f < mesh2d.GetNumFaces(); f++)
         {
-            num_face_nodes += mesh2d.m_facesNodes[f].size();
+            num_face_nodes += mesh2d.FaceNodes(f).size();
         }
 
         mesh2dApi.num_face_nodes = static_cast<int>(num_face_nodes);
@@ -402,15 +402,17 @@ namespace meshkernelapi
         }
 
         int faceIndex = 0;
-        for (size_t f = 0; f < mesh2d.GetNumFaces(); f++)
+        for (meshkernel::UInt f = 0; f < mesh2d.GetNumFaces(); f++)
         {
+            const auto faceNodes = mesh2d.FaceNodes(f);
+            const auto faceEdges = mesh2d.FaceEdges(f);
             mesh2dApi.face_x[f] = mesh2d.m_facesMassCenters[f].x;
             mesh2dApi.face_y[f] = mesh2d.m_facesMassCenters[f].y;
-            mesh2dApi.nodes_per_face[f] = static_cast<int>(mesh2d.m_facesNodes[f].size());
-            for (size_t n = 0; n < mesh2d.m_facesNodes[f].size(); ++n)
+            mesh2dApi.nodes_per_face[f] = static_cast<int>(faceNodes.size());
+            for (size_t n = 0; n < faceNodes.size(); ++n)
             {
-                mesh2dApi.face_nodes[faceIndex] = static_cast<int>(mesh2d.m_facesNodes[f][n]);
-                mesh2dApi.face_edges[faceIndex] = static_cast<int>(mesh2d.m_facesEdges[f][n]);
+                mesh2dApi.face_nodes[faceIndex] = static_cast<int>(faceNodes[n]);
+                mesh2dApi.face_edges[faceIndex] = static_cast<int>(faceEdges[n]);
                 faceIndex++;
             }
         }
@@ -599,7 +601,7 @@ namespace meshkernelapi
                 continue;
             }
 
-            const auto& faceNodes = mesh2d.m_facesNodes[f];
+            const auto faceNodes = mesh2d.FaceNodes(f);
             if (count != 0)
             {
                 facePolygons.coordinates_x[count] = meshkernel::constants::missing::doubleValue;
@@ -27,6 +27,11 @@
 
 #include "MeshKernelApi/ApiCache/SplineIntersectionCache.hpp"
 
+meshkernelapi::SplineIntersectionCache::SplineIntersectionCache(const meshkernel::Splines& splines)
+    : m_segmentIndex(splines.m_splineNodes, splines.m_projection)
+{
+}
+
 int meshkernelapi::SplineIntersectionCache::NumberOfIntersections() const
 {
     return static_cast<int>(m_splineIndices.size());
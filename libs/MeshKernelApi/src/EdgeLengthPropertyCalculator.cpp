@@ -49,8 +49,16 @@ void meshkernelapi::EdgeLengthPropertyCalculator::Calculate(const MeshKernelStat
                                           geometryList.num_coordinates, Size(state, location));
     }
 
-    std::span<double> edgeLengths(geometryList.values, state.m_mesh2d->GetNumEdges());
-    meshkernel::algo::ComputeMeshEdgeLength(*state.m_mesh2d, edgeLengths);
+    const CachedResults* cachedResults = FindCachedResults(state, location);
+
+    if (cachedResults == nullptr)
+    {
+        CachedResults results;
+        results.m_values = meshkernel::algo::ComputeMeshEdgeLength(*state.m_mesh2d);
+        cachedResults = &StoreCachedResults(state, location, std::move(results));
+    }
+
+    std::ranges::copy(cachedResults->m_values, geometryList.values);
 
     if (geometryList.coordinates_x != nullptr && geometryList.coordinates_y != nullptr)
     {
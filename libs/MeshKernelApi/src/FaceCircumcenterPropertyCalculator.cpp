@@ -48,13 +48,20 @@ void meshkernelapi::FaceCircumcenterPropertyCalculator::Calculate(const MeshKern
                                           geometryList.num_coordinates, Size(state, location));
     }
 
-    std::vector<meshkernel::Point> faceCircumcentres(state.m_mesh2d->GetNumFaces());
+    const CachedResults* cachedResults = FindCachedResults(state, location);
+
+    if (cachedResults == nullptr)
+    {
+        CachedResults results;
+        results.m_coordinates = meshkernel::algo::ComputeFaceCircumcenters(*state.m_mesh2d);
+        cachedResults = &StoreCachedResults(state, location, std::move(results));
+    }
+
+    const std::vector<meshkernel::Point>& faceCircumcentres = cachedResults->m_coordinates;
 
     std::span<double> xCoord(geometryList.coordinates_x, state.m_mesh2d->GetNumFaces());
     std::span<double> yCoord(geometryList.coordinates_y, state.m_mesh2d->GetNumFaces());
 
-    meshkernel::algo::ComputeFaceCircumcenters(*state.m_mesh2d, faceCircumcentres);
-
     for (size_t i = 0; i < faceCircumcentres.size(); ++i)
     {
         xCoord[i] = faceCircumcentres[i].x;
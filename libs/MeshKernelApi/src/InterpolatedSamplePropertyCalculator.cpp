@@ -40,6 +40,7 @@ meshkernelapi::InterpolatedSamplePropertyCalculator::InterpolatedSamplePropertyC
                                                                                           const meshkernel::InterpolationParameters& interpolationParameters,
                                                                                           const int propertyId)
     : m_projection(projection),
+      m_interpolationParameters(interpolationParameters),
       m_propertyId(propertyId)
 {
     std::span<const double> xNodes(sampleData.coordinates_x, sampleData.num_coordinates);
@@ -47,18 +48,69 @@ meshkernelapi::InterpolatedSamplePropertyCalculator::InterpolatedSamplePropertyC
 
     if (interpolationParameters.interpolation_type == 0)
     {
-        m_sampleInterpolator = std::make_unique<meshkernel::SampleTriangulationInterpolator>(xNodes, yNodes, m_projection);
+        m_sampleInterpolator = std::make_shared<meshkernel::SampleTriangulationInterpolator>(xNodes, yNodes, m_projection);
     }
     else if (interpolationParameters.interpolation_type == 1)
     {
         // Need to pass from api.
-        m_sampleInterpolator = std::make_unique<meshkernel::SampleAveragingInterpolator>(xNodes, yNodes, m_projection, interpolationParameters);
+        m_sampleInterpolator = std::make_shared<meshkernel::SampleAveragingInterpolator>(xNodes, yNodes, m_projection, interpolationParameters);
     }
 
     std::span<const double> dataSamples(sampleData.values, sampleData.num_coordinates);
     m_sampleInterpolator->SetData(m_propertyId, dataSamples);
 }
 
+meshkernelapi::InterpolatedSamplePropertyCalculator::InterpolatedSamplePropertyCalculator(const InterpolatedSamplePropertyCalculator& sharedCalculator,
+                                                                                          const GeometryList& sampleData,
+                                                                                          const int propertyId)
+    : m_sampleInterpolator(sharedCalculator.m_sampleInterpolator),
+      m_projection(sharedCalculator.m_projection),
+      m_interpolationParameters(sharedCalculator.m_interpolationParameters),
+      m_propertyId(propertyId)
+{
+    if (m_sampleInterpolator->Contains(m_propertyId))
+    {
+        throw meshkernel::ConstraintError("The property id already exists: id = {}.", m_propertyId);
+    }
+
+    std::span<const double> dataSamples(sampleData.values, sampleData.num_coordinates);
+    m_sampleInterpolator->SetData(m_propertyId, dataSamples);
+}
+
+meshkernelapi::InterpolatedSamplePropertyCalculator::~InterpolatedSamplePropertyCalculator()
+{
+    if (m_sampleInterpolator != nullptr)
+    {
+        m_sampleInterpolator->RemoveData(m_propertyId);
+    }
+}
+
+bool meshkernelapi::InterpolatedSamplePropertyCalculator::CanShareSamples(const GeometryList& sampleData,
+                                                                          const meshkernel::Projection projection,
+                                                                          const meshkernel::InterpolationParameters& interpolationParameters) const
+{
+    if (projection != m_projection || interpolationParameters.interpolation_type != m_interpolationParameters.interpolation_type)
+    {
+        return false;
+    }
+
+    // The averaging parameters are part of the averaging interpolator
+    if (interpolationParameters.interpolation_type == 1 &&
+        (interpolationParameters.method != m_interpolationParameters.method ||
+         interpolationParameters.absolute_search_radius != m_interpolationParameters.absolute_search_radius ||
+         interpolationParameters.relative_search_radius != m_interpolationParameters.relative_search_radius ||
+         interpolationParameters.use_closest_if_none_found != m_interpolationParameters.use_closest_if_none_found ||
+         interpolationParameters.minimum_number_of_samples != m_interpolationParameters.minimum_number_of_samples))
+    {
+        return false;
+    }
+
+    std::span<const double> xNodes(sampleData.coordinates_x, sampleData.num_coordinates);
+    std::span<const double> yNodes(sampleData.coordinates_y, sampleData.num_coordinates);
+
+    return m_sampleInterpolator->HasSamePoints(xNodes, yNodes);
+}
+
 bool meshkernelapi::InterpolatedSamplePropertyCalculator::IsValid(const MeshKernelState& state, const meshkernel::Location location [[maybe_unused]]) const
 {
     return state.m_mesh2d != nullptr &&
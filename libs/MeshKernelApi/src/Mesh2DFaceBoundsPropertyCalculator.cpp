@@ -44,7 +44,16 @@ void meshkernelapi::Mesh2DFaceBoundsPropertyCalculator::Calculate(const MeshKern
                                           geometryList.num_coordinates, Size(state, location));
     }
 
-    std::vector<meshkernel::Point> faceBounds(meshkernel::algo::Mesh2DFaceBounds::Compute(*state.m_mesh2d));
+    const CachedResults* cachedResults = FindCachedResults(state, location);
+
+    if (cachedResults == nullptr)
+    {
+        CachedResults results;
+        results.m_coordinates = meshkernel::algo::Mesh2DFaceBounds::Compute(*state.m_mesh2d);
+        cachedResults = &StoreCachedResults(state, location, std::move(results));
+    }
+
+    const std::vector<meshkernel::Point>& faceBounds = cachedResults->m_coordinates;
 
     size_t size = static_cast<size_t>(Size(state, location));
     std::span<double> xCoord(geometryList.coordinates_x, size);
@@ -118,7 +118,12 @@
 
 #include "Version/Version.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
 #include <span>
 #include <unordered_map>
 #include <vector>
@@ -127,27 +132,103 @@ namespace meshkernelapi
 {
     std::map<int, std::shared_ptr<PropertyCalculator>> allocateDefaultPropertyCalculators();
 
+    // Concurrency model
+    //
+    // The API can be called from several threads. The registry of states (meshKernelState, the mutexes of the
+    // states and meshKernelStateCounter) is guarded by a reader-writer mutex:
+    // - calls on a meshKernelId lock the registry for reading and lock the mutex of that state, so calls for
+    //   different ids run concurrently while calls for the same id are serialised;
+    // - calls adding or removing states, and the undo and redo of actions (which can be of any state), lock
+    //   the registry for writing and wait for the calls in progress to complete.
+    // The undo stack is shared by all states and guarded by its own mutex, locked after the registry and the
+    // state. The exit code, the error message and the geometry error are thread local: the error functions
+    // report the last error of the calling thread.
+
     // The state held by MeshKernel
     static std::unordered_map<int, MeshKernelState> meshKernelState;
     /// @brief Map of property calculators, from an property identifier to the calculator.
     static std::map<int, std::shared_ptr<PropertyCalculator>> propertyCalculators = allocateDefaultPropertyCalculators();
     static int meshKernelStateCounter = 0;
 
+    /// @brief Guards the registry of states, locked for writing only when states are added or removed
+    static std::shared_mutex meshKernelStateRegistryMutex;
+    /// @brief The mutex of each state, serialising the calls for the same meshKernelId
+    static std::unordered_map<int, std::unique_ptr<std::mutex>> meshKernelStateMutexes;
+
     // Error state
     static size_t constexpr bufferSize = 512;
     static size_t constexpr maxCharsToCopy = bufferSize - 1; // make sure destination string is null-terminated when strncpy is used
-    static char exceptionMessage[bufferSize] = "";
-    static meshkernel::ExitCode lastExitCode = meshkernel::ExitCode::Success;
-    static meshkernel::UInt invalidMeshIndex{0};
-    static meshkernel::Location invalidMeshLocation{meshkernel::Location::Unknown};
+    static thread_local char exceptionMessage[bufferSize] = "";
+    static thread_local meshkernel::ExitCode lastExitCode = meshkernel::ExitCode::Success;
+    static thread_local meshkernel::UInt invalidMeshIndex{0};
+    static thread_local meshkernel::Location invalidMeshLocation{meshkernel::Location::Unknown};
 
     /// @brief Stack of undo actions
     static meshkernel::UndoActionStack meshKernelUndoStack;
+    /// @brief Guards the undo stack
+    static std::mutex meshKernelUndoStackMutex;
+
+    /// @brief Locks the registry of states for the duration of an API call.
+    ///
+    /// Nested API calls on the same thread do not lock again, the locks of the outer call are kept.
+    class RegistryLock
+    {
+    public:
+        /// @brief Locks the registry for writing, to add or remove states
+        RegistryLock()
+        {
+            if (lockDepth == 0)
+            {
+                m_exclusiveLock = std::unique_lock(meshKernelStateRegistryMutex);
+            }
+
+            ++lockDepth;
+        }
+
+        /// @brief Locks the registry for reading and the state of \p meshKernelId, if it exists
+        explicit RegistryLock(int meshKernelId)
+        {
+            if (lockDepth == 0)
+            {
+                m_sharedLock = std::shared_lock(meshKernelStateRegistryMutex);
+
+                if (const auto stateMutex = meshKernelStateMutexes.find(meshKernelId); stateMutex != meshKernelStateMutexes.end())
+                {
+                    m_stateLock = std::unique_lock(*stateMutex->second);
+                }
+            }
+
+            ++lockDepth;
+        }
+
+        RegistryLock(const RegistryLock&) = delete;
+        RegistryLock& operator=(const RegistryLock&) = delete;
+
+        /// @brief Releases the locks, the state first
+        ~RegistryLock()
+        {
+            --lockDepth;
+        }
+
+    private:
+        inline static thread_local int lockDepth = 0; ///< The number of API calls in progress on this thread
+
+        std::unique_lock<std::shared_mutex> m_exclusiveLock; ///< The registry lock for writing
+        std::shared_lock<std::shared_mutex> m_sharedLock;    ///< The registry lock for reading
+        std::unique_lock<std::mutex> m_stateLock;            ///< The lock of the state, released before the registry lock
+    };
+
+    /// @brief Adds an undo action to the undo stack shared by all states
+    static void AddUndoAction(meshkernel::UndoActionPtr&& undoAction, const int meshKernelId = meshkernel::constants::missing::intValue)
+    {
+        const std::scoped_lock undoStackLock(meshKernelUndoStackMutex);
+        meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+    }
 
     int GeneratePropertyId()
     {
         // The current property id, initialised with a value equal to the last enum in Mesh2D:::Property enum values
-        static int currentPropertyId = static_cast<int>(meshkernel::Property::Count);
+        static std::atomic<int> currentPropertyId = static_cast<int>(meshkernel::Property::Count);
 
         // Increment and return the current property id value.
         return ++currentPropertyId;
@@ -213,11 +294,14 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock;
+
             meshKernelId = meshKernelStateCounter++;
             meshkernel::range_check::CheckOneOf<int>(projectionType, meshkernel::GetValidProjections(), "Projection");
             auto const projection = static_cast<meshkernel::Projection>(projectionType);
             meshKernelState.insert({meshKernelId, MeshKernelState(projection)});
             meshKernelState[meshKernelId].m_propertyCalculators = allocateDefaultPropertyCalculators();
+            meshKernelStateMutexes.emplace(meshKernelId, std::make_unique<std::mutex>());
         }
         catch (...)
         {
@@ -233,6 +317,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             isValid = meshKernelState.contains(meshKernelId);
         }
         catch (...)
@@ -247,6 +333,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -263,12 +351,13 @@ namespace meshkernelapi
             mkState.m_curvilinearGrid = std::make_shared<meshkernel::CurvilinearGrid>(mkState.m_projection);
 
             mkState.m_meshOrthogonalization.reset();
+            mkState.m_orthogonalizationResiduals.clear();
             mkState.m_curvilinearGridFromSplines.reset();
             mkState.m_curvilinearGridLineShift.reset();
             mkState.m_frozenLines.clear();
             mkState.m_frozenLinesCounter = 0;
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -282,13 +371,17 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock;
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
             }
 
-            meshKernelState.erase(meshKernelId);
+            const std::scoped_lock undoStackLock(meshKernelUndoStackMutex);
             meshKernelUndoStack.Remove(meshKernelId);
+            meshKernelState.erase(meshKernelId);
+            meshKernelStateMutexes.erase(meshKernelId);
         }
         catch (...)
         {
@@ -308,6 +401,7 @@ namespace meshkernelapi
                 throw meshkernel::MeshKernelError("Incorrect undo stack size: {}", undoStackSize);
             }
 
+            const std::scoped_lock undoStackLock(meshKernelUndoStackMutex);
             meshKernelUndoStack.SetMaximumSize(static_cast<meshkernel::UInt>(undoStackSize));
         }
         catch (...)
@@ -325,6 +419,10 @@ namespace meshkernelapi
 
         try
         {
+            // The undo action can be of any state
+            const RegistryLock registryLock;
+            const std::scoped_lock undoStackLock(meshKernelUndoStackMutex);
+
             if (auto undoOption = meshKernelUndoStack.Undo())
             {
                 undone = true;
@@ -346,6 +444,7 @@ namespace meshkernelapi
 
         try
         {
+            const std::scoped_lock undoStackLock(meshKernelUndoStackMutex);
             committedCount = static_cast<int>(meshKernelUndoStack.CommittedSize());
             restoredCount = static_cast<int>(meshKernelUndoStack.RestoredSize());
         }
@@ -364,8 +463,11 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (meshKernelState.contains(meshKernelId))
             {
+                const std::scoped_lock undoStackLock(meshKernelUndoStackMutex);
                 committedCount = static_cast<int>(meshKernelUndoStack.CommittedSize(meshKernelId));
                 restoredCount = static_cast<int>(meshKernelUndoStack.RestoredSize(meshKernelId));
             }
@@ -390,6 +492,10 @@ namespace meshkernelapi
 
         try
         {
+            // The redo action can be of any state
+            const RegistryLock registryLock;
+            const std::scoped_lock undoStackLock(meshKernelUndoStackMutex);
+
             if (auto redoOption = meshKernelUndoStack.Commit())
             {
                 redone = true;
@@ -409,8 +515,12 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock;
+            const std::scoped_lock undoStackLock(meshKernelUndoStackMutex);
+
             meshKernelUndoStack.Clear();
             meshKernelState.clear();
+            meshKernelStateMutexes.clear();
             meshKernelStateCounter = 0;
         }
         catch (...)
@@ -426,6 +536,7 @@ namespace meshkernelapi
 
         try
         {
+            const std::scoped_lock undoStackLock(meshKernelUndoStackMutex);
             meshKernelUndoStack.Clear();
         }
         catch (...)
@@ -441,6 +552,9 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+            const std::scoped_lock undoStackLock(meshKernelUndoStackMutex);
+
             meshKernelUndoStack.Remove(meshKernelId);
         }
         catch (...)
@@ -455,6 +569,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -472,7 +588,7 @@ namespace meshkernelapi
             const meshkernel::Polygons meshKernelPolygon(polygonPoints, meshKernelState[meshKernelId].m_mesh2d->m_projection);
             const auto deletionOptionEnum = static_cast<meshkernel::Mesh2D::DeleteMeshOptions>(deletionOption);
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->DeleteMesh(meshKernelPolygon, deletionOptionEnum, invertDeletionBool), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->DeleteMesh(meshKernelPolygon, deletionOptionEnum, invertDeletionBool), meshKernelId);
         }
 
         catch (...)
@@ -487,6 +603,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -531,7 +649,70 @@ namespace meshkernelapi
                                                                                               meshKernelState[meshKernelId].m_projection);
             }
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
+        }
+        catch (...)
+        {
+            lastExitCode = HandleException();
+        }
+        return lastExitCode;
+    }
+
+    MKERNEL_API int mkernel_mesh2d_read_snapshot(int meshKernelId, const char* fileName)
+    {
+        lastExitCode = meshkernel::ExitCode::Success;
+        try
+        {
+            const RegistryLock registryLock(meshKernelId);
+
+            if (!meshKernelState.contains(meshKernelId))
+            {
+                throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
+            }
+
+            if (fileName == nullptr)
+            {
+                throw meshkernel::MeshKernelError("The snapshot file name is null.");
+            }
+
+            auto mesh2d = meshkernel::Mesh2D::ReadSnapshot(fileName);
+
+            if (mesh2d->m_projection != meshKernelState[meshKernelId].m_projection)
+            {
+                throw meshkernel::MeshKernelError("The projection of the snapshot does not match the projection of the mesh state.");
+            }
+
+            auto undoAction = MKStateUndoAction::Create(meshKernelState[meshKernelId]);
+
+            meshKernelState[meshKernelId].m_mesh2d = std::move(mesh2d);
+
+            AddUndoAction(std::move(undoAction), meshKernelId);
+        }
+        catch (...)
+        {
+            lastExitCode = HandleException();
+        }
+        return lastExitCode;
+    }
+
+    MKERNEL_API int mkernel_mesh2d_write_snapshot(int meshKernelId, const char* fileName)
+    {
+        lastExitCode = meshkernel::ExitCode::Success;
+        try
+        {
+            const RegistryLock registryLock(meshKernelId);
+
+            if (!meshKernelState.contains(meshKernelId))
+            {
+                throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
+            }
+
+            if (fileName == nullptr)
+            {
+                throw meshkernel::MeshKernelError("The snapshot file name is null.");
+            }
+
+            meshKernelState[meshKernelId].m_mesh2d->WriteSnapshot(fileName);
         }
         catch (...)
         {
@@ -545,6 +726,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -571,6 +754,8 @@ namespace meshkernelapi
         propertyIsAvailable = false;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             const meshkernel::Location location = static_cast<meshkernel::Location>(locationId);
             propertyIsAvailable = meshKernelState.contains(meshKernelId) &&
                                   meshKernelState.at(meshKernelId).m_propertyCalculators.contains(propertyId) &&
@@ -591,6 +776,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -610,11 +797,36 @@ namespace meshkernelapi
                 throw meshkernel::ConstraintError("The property id already exists: id = {}.", localPropertyId);
             }
 
-            meshKernelState[meshKernelId].m_propertyCalculators.try_emplace(localPropertyId,
-                                                                            std::make_unique<InterpolatedSamplePropertyCalculator>(sampleData,
-                                                                                                                                   meshKernelState[meshKernelId].m_projection,
-                                                                                                                                   interpolationParameters,
-                                                                                                                                   localPropertyId));
+            // Sample data at the same points as an existing property share its triangulation or sample tree
+            std::shared_ptr<InterpolatedSamplePropertyCalculator> sharedCalculator;
+
+            for (const auto& [id, calculator] : meshKernelState[meshKernelId].m_propertyCalculators)
+            {
+                auto sampleCalculator = std::dynamic_pointer_cast<InterpolatedSamplePropertyCalculator>(calculator);
+
+                if (sampleCalculator != nullptr && sampleCalculator->CanShareSamples(sampleData, meshKernelState[meshKernelId].m_projection, interpolationParameters))
+                {
+                    sharedCalculator = sampleCalculator;
+                    break;
+                }
+            }
+
+            if (sharedCalculator != nullptr)
+            {
+                meshKernelState[meshKernelId].m_propertyCalculators.try_emplace(localPropertyId,
+                                                                                std::make_shared<InterpolatedSamplePropertyCalculator>(*sharedCalculator,
+                                                                                                                                       sampleData,
+                                                                                                                                       localPropertyId));
+            }
+            else
+            {
+                meshKernelState[meshKernelId].m_propertyCalculators.try_emplace(localPropertyId,
+                                                                                std::make_shared<InterpolatedSamplePropertyCalculator>(sampleData,
+                                                                                                                                       meshKernelState[meshKernelId].m_projection,
+                                                                                                                                       interpolationParameters,
+                                                                                                                                       localPropertyId));
+            }
+
             propertyId = localPropertyId;
         }
         catch (...)
@@ -629,6 +841,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -648,7 +862,7 @@ namespace meshkernelapi
             landBoundary.FindNearestMeshBoundary(meshkernel::LandBoundaries::ProjectToLandBoundaryOption::InnerAndOuterMeshBoundaryToLandBoundary);
 
             // Execute algorithm
-            meshKernelUndoStack.Add(landBoundary.SnapMeshToLandBoundaries());
+            AddUndoAction(landBoundary.SnapMeshToLandBoundaries());
         }
         catch (...)
         {
@@ -664,6 +878,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -678,7 +894,7 @@ namespace meshkernelapi
                                                                                        static_cast<meshkernel::UInt>(secondNode));
 
             meshkernel::SplitRowColumnOfMesh splitAlongRow;
-            meshKernelUndoStack.Add(splitAlongRow.Compute(*meshKernelState[meshKernelId].m_mesh2d, edgeId), meshKernelId);
+            AddUndoAction(splitAlongRow.Compute(*meshKernelState[meshKernelId].m_mesh2d, edgeId), meshKernelId);
         }
         catch (...)
         {
@@ -692,6 +908,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -728,7 +946,7 @@ namespace meshkernelapi
                 undoAction = meshKernelState[meshKernelId].m_mesh2d->Join(meshkernel::Mesh2D(edges2d, nodes2d, meshKernelState[meshKernelId].m_projection));
             }
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -743,6 +961,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -760,7 +980,7 @@ namespace meshkernelapi
             // Do not change the pointer, just the object it is pointing to
             meshKernelState[meshKernelId].m_mesh1d = std::make_unique<meshkernel::Mesh1D>(edges1d, nodes1d, meshKernelState[meshKernelId].m_projection);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -775,6 +995,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -786,7 +1008,7 @@ namespace meshkernelapi
                                                                   mesh1d.node_x,
                                                                   mesh1d.node_y);
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh1d->Join(meshkernel::Mesh1D(edges1d, nodes1d, meshKernelState[meshKernelId].m_projection)),
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh1d->Join(meshkernel::Mesh1D(edges1d, nodes1d, meshKernelState[meshKernelId].m_projection)),
                                     meshKernelId);
         }
         catch (...)
@@ -801,6 +1023,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -813,7 +1037,7 @@ namespace meshkernelapi
             // Do not change the pointer, just the object it is pointing to
             *meshKernelState[meshKernelId].m_network1d = meshkernel::Network1D(localPolylines, meshKernelState[meshKernelId].m_projection);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -827,6 +1051,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -853,6 +1079,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -872,12 +1100,14 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
             }
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh1d->Join(meshkernel::Mesh1D(*meshKernelState[meshKernelId].m_network1d, minFaceSize)),
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh1d->Join(meshkernel::Mesh1D(*meshKernelState[meshKernelId].m_network1d, minFaceSize)),
                                     meshKernelId);
         }
         catch (...)
@@ -892,6 +1122,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -913,6 +1145,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -937,6 +1171,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -956,6 +1192,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -992,6 +1230,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1053,6 +1293,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1073,6 +1315,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1092,6 +1336,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1122,6 +1368,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1152,6 +1400,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1170,6 +1420,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1222,6 +1474,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1265,6 +1519,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1284,6 +1540,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1309,6 +1567,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1337,6 +1597,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1351,13 +1613,13 @@ namespace meshkernelapi
                 if (sourceProjection == meshkernel::Projection::cartesian)
                 {
                     meshkernel::ConvertCartesianToSpherical conversion(zoneString);
-                    meshKernelUndoStack.Add(meshkernel::MeshConversion::Compute(*meshKernelState[meshKernelId].m_mesh2d, conversion), meshKernelId);
+                    AddUndoAction(meshkernel::MeshConversion::Compute(*meshKernelState[meshKernelId].m_mesh2d, conversion), meshKernelId);
                     meshKernelState[meshKernelId].m_projection = conversion.TargetProjection();
                 }
                 else if (sourceProjection == meshkernel::Projection::spherical)
                 {
                     meshkernel::ConvertSphericalToCartesian conversion(zoneString);
-                    meshKernelUndoStack.Add(meshkernel::MeshConversion::Compute(*meshKernelState[meshKernelId].m_mesh2d, conversion), meshKernelId);
+                    AddUndoAction(meshkernel::MeshConversion::Compute(*meshKernelState[meshKernelId].m_mesh2d, conversion), meshKernelId);
                     meshKernelState[meshKernelId].m_projection = conversion.TargetProjection();
                 }
                 else
@@ -1383,6 +1645,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1393,7 +1657,7 @@ namespace meshkernelapi
 
             meshKernelState[meshKernelId].m_curvilinearGrid = mesh2DToCurvilinear.Compute({xPointCoordinate, yPointCoordinate});
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -1407,6 +1671,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1436,6 +1702,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1461,12 +1729,14 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
             }
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->DeleteHangingEdges(), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->DeleteHangingEdges(), meshKernelId);
         }
         catch (...)
         {
@@ -1480,6 +1750,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1488,7 +1760,7 @@ namespace meshkernelapi
             const std::vector<meshkernel::Point> polygonPoints = ConvertGeometryListToPointVector(polygon);
             const meshkernel::Polygons invalidCellsPolygon(polygonPoints, meshKernelState[meshKernelId].m_mesh2d->m_projection);
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->DeleteMeshFacesInPolygon(invalidCellsPolygon), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->DeleteMeshFacesInPolygon(invalidCellsPolygon), meshKernelId);
         }
         catch (...)
         {
@@ -1506,6 +1778,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1530,8 +1804,9 @@ namespace meshkernelapi
                                                                        std::move(landBoundary),
                                                                        static_cast<meshkernel::LandBoundaries::ProjectToLandBoundaryOption>(projectToLandBoundaryOption),
                                                                        orthogonalizationParameters);
-            meshKernelUndoStack.Add(ortogonalization.Initialize(), meshKernelId);
+            AddUndoAction(ortogonalization.Initialize(), meshKernelId);
             ortogonalization.Compute();
+            meshKernelState[meshKernelId].m_orthogonalizationResiduals = ortogonalization.Residuals();
         }
         catch (...)
         {
@@ -1549,6 +1824,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1574,7 +1851,8 @@ namespace meshkernelapi
                                                                                                                                 std::move(landBoundary),
                                                                                                                                 static_cast<meshkernel::LandBoundaries::ProjectToLandBoundaryOption>(projectToLandBoundaryOption),
                                                                                                                                 orthogonalizationParameters);
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_meshOrthogonalization->Initialize(), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_meshOrthogonalization->Initialize(), meshKernelId);
+            meshKernelState[meshKernelId].m_orthogonalizationResiduals.clear();
         }
         catch (...)
         {
@@ -1588,6 +1866,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1612,6 +1892,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1623,6 +1905,7 @@ namespace meshkernelapi
             }
 
             meshKernelState[meshKernelId].m_meshOrthogonalization->Solve();
+            meshKernelState[meshKernelId].m_orthogonalizationResiduals = meshKernelState[meshKernelId].m_meshOrthogonalization->Residuals();
         }
         catch (...)
         {
@@ -1641,6 +1924,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1670,6 +1955,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1694,6 +1981,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1718,6 +2007,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1743,12 +2034,68 @@ namespace meshkernelapi
         return lastExitCode;
     }
 
+    MKERNEL_API int mkernel_mesh2d_get_orthogonalization_residuals_dimension(int meshKernelId, int& numResiduals)
+    {
+        lastExitCode = meshkernel::ExitCode::Success;
+        numResiduals = 0;
+        try
+        {
+            const RegistryLock registryLock(meshKernelId);
+
+            if (!meshKernelState.contains(meshKernelId))
+            {
+                throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
+            }
+
+            numResiduals = static_cast<int>(meshKernelState[meshKernelId].m_orthogonalizationResiduals.size());
+        }
+        catch (...)
+        {
+            lastExitCode = HandleException();
+        }
+        return lastExitCode;
+    }
+
+    MKERNEL_API int mkernel_mesh2d_get_orthogonalization_residuals(int meshKernelId, double* residuals)
+    {
+        lastExitCode = meshkernel::ExitCode::Success;
+        try
+        {
+            const RegistryLock registryLock(meshKernelId);
+
+            if (!meshKernelState.contains(meshKernelId))
+            {
+                throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
+            }
+
+            const auto& orthogonalizationResiduals = meshKernelState[meshKernelId].m_orthogonalizationResiduals;
+            if (orthogonalizationResiduals.empty())
+            {
+                return lastExitCode;
+            }
+
+            if (residuals == nullptr)
+            {
+                throw meshkernel::MeshKernelError("The residuals array is null.");
+            }
+
+            std::ranges::copy(orthogonalizationResiduals, residuals);
+        }
+        catch (...)
+        {
+            lastExitCode = HandleException();
+        }
+        return lastExitCode;
+    }
+
     MKERNEL_API int mkernel_mesh2d_get_property(int meshKernelId, int propertyValue, int locationId, const GeometryList& geometryList)
     {
         lastExitCode = meshkernel::ExitCode::Success;
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1790,6 +2137,90 @@ namespace meshkernelapi
         return lastExitCode;
     }
 
+    MKERNEL_API int mkernel_mesh2d_get_interpolated_properties(int meshKernelId, const int* propertyIds, int numberOfProperties, int locationId, const GeometryList& geometryList)
+    {
+        lastExitCode = meshkernel::ExitCode::Success;
+
+        try
+        {
+            const RegistryLock registryLock(meshKernelId);
+
+            if (!meshKernelState.contains(meshKernelId))
+            {
+                throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
+            }
+
+            if (const auto& mesh2d = meshKernelState.at(meshKernelId).m_mesh2d; mesh2d == nullptr || mesh2d->GetNumNodes() <= 0)
+            {
+                return lastExitCode;
+            }
+
+            if (numberOfProperties <= 0)
+            {
+                return lastExitCode;
+            }
+
+            const meshkernel::Location location = static_cast<meshkernel::Location>(locationId);
+            const std::span<const int> ids(propertyIds, numberOfProperties);
+
+            // The positions of the properties in the property id array, grouped by their sample interpolator
+            std::map<const meshkernel::SampleInterpolator*, std::vector<int>> propertyGroups;
+            int size = -1;
+
+            for (int i = 0; i < numberOfProperties; ++i)
+            {
+                const auto& calculator = meshKernelState[meshKernelId].m_propertyCalculators.contains(ids[i]) ? meshKernelState[meshKernelId].m_propertyCalculators[ids[i]] : nullptr;
+                const auto sampleCalculator = std::dynamic_pointer_cast<InterpolatedSamplePropertyCalculator>(calculator);
+
+                if (sampleCalculator == nullptr)
+                {
+                    throw meshkernel::MeshKernelError("The property is not interpolated from samples: {}.", ids[i]);
+                }
+
+                if (!sampleCalculator->IsValid(meshKernelState[meshKernelId], location))
+                {
+                    throw meshkernel::MeshKernelError("Property not supported at this location");
+                }
+
+                size = sampleCalculator->Size(meshKernelState[meshKernelId], location);
+                propertyGroups[&sampleCalculator->GetSampleInterpolator()].push_back(i);
+            }
+
+            if (geometryList.num_coordinates < numberOfProperties * size)
+            {
+                throw meshkernel::ConstraintError("Array size too small to store property values {} < {}.",
+                                                  geometryList.num_coordinates,
+                                                  numberOfProperties * size);
+            }
+
+            std::vector<int> groupIds;
+            std::vector<double> groupResult;
+
+            for (const auto& [sampleInterpolator, positions] : propertyGroups)
+            {
+                groupIds.clear();
+
+                for (const int position : positions)
+                {
+                    groupIds.push_back(ids[position]);
+                }
+
+                groupResult.resize(positions.size() * size);
+                sampleInterpolator->Interpolate(groupIds, *meshKernelState[meshKernelId].m_mesh2d, location, groupResult);
+
+                for (size_t i = 0; i < positions.size(); ++i)
+                {
+                    std::copy_n(groupResult.begin() + i * size, size, geometryList.values + positions[i] * size);
+                }
+            }
+        }
+        catch (...)
+        {
+            lastExitCode = HandleException();
+        }
+        return lastExitCode;
+    }
+
     MKERNEL_API int mkernel_mesh2d_get_property_dimension(int meshKernelId, int propertyValue, int locationId, int& dimension)
     {
         lastExitCode = meshkernel::ExitCode::Success;
@@ -1797,6 +2228,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1835,6 +2268,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1933,6 +2368,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1944,7 +2381,7 @@ namespace meshkernelapi
             }
 
             const auto mesh = meshkernel::Mesh2DGenerateGlobal::Compute(numLongitudeNodes, meshKernelState[meshKernelId].m_projection);
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->Join(*mesh), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->Join(*mesh), meshKernelId);
         }
         catch (...)
         {
@@ -1958,6 +2395,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1972,7 +2411,7 @@ namespace meshkernelapi
             // to provide the triangulation method.
             meshkernel::SepranTriangulationGenerator generator;
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->Join(*generator.Generate(polygon)), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->Join(*generator.Generate(polygon)), meshKernelId);
         }
         catch (...)
         {
@@ -1986,6 +2425,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -1994,7 +2435,7 @@ namespace meshkernelapi
 
             meshkernel::Polygons polygon;
             const meshkernel::Mesh2D mesh(sampleVector, polygon, meshKernelState[meshKernelId].m_mesh2d->m_projection);
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->Join(mesh), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->Join(mesh), meshKernelId);
         }
         catch (...)
         {
@@ -2009,6 +2450,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2019,7 +2462,7 @@ namespace meshkernelapi
 
             auto const nodes = curvilinearGrid->ComputeNodes();
             auto const edges = curvilinearGrid->ComputeEdges();
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->Join(meshkernel::Mesh2D(edges, nodes, projection)), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->Join(meshkernel::Mesh2D(edges, nodes, projection)), meshKernelId);
         }
         catch (...)
         {
@@ -2035,6 +2478,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2046,7 +2491,7 @@ namespace meshkernelapi
             const auto edges = curvilinearGrid->ComputeEdges();
             const auto nodes = curvilinearGrid->ComputeNodes();
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->Join(meshkernel::Mesh2D(edges, nodes, projection)), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->Join(meshkernel::Mesh2D(edges, nodes, projection)), meshKernelId);
         }
         catch (...)
         {
@@ -2061,6 +2506,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2072,7 +2519,7 @@ namespace meshkernelapi
             const auto edges = curvilinearGrid->ComputeEdges();
             const auto nodes = curvilinearGrid->ComputeNodes();
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->Join(meshkernel::Mesh2D(edges, nodes, meshKernelState[meshKernelId].m_curvilinearGrid->projection())),
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->Join(meshkernel::Mesh2D(edges, nodes, meshKernelState[meshKernelId].m_curvilinearGrid->projection())),
                                     meshKernelId);
         }
         catch (...)
@@ -2087,6 +2534,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2122,6 +2571,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2155,6 +2606,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2219,6 +2672,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2256,6 +2711,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2296,6 +2753,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2330,6 +2789,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2366,6 +2827,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2378,7 +2841,7 @@ namespace meshkernelapi
 
             const auto minEdgeLength = meshkernel::algo::MinEdgeLength(*meshKernelState[meshKernelId].m_mesh2d, polygon, edgeLengths);
             const auto searchRadius = std::max(1e-6, minEdgeLength * 0.1);
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->MergeNodesInPolygon(polygon, searchRadius), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->MergeNodesInPolygon(polygon, searchRadius), meshKernelId);
         }
         catch (...)
         {
@@ -2392,6 +2855,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2401,7 +2866,7 @@ namespace meshkernelapi
 
             const meshkernel::Polygons polygon(polygonVector, meshKernelState[meshKernelId].m_mesh2d->m_projection);
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->MergeNodesInPolygon(polygon, mergingDistance), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->MergeNodesInPolygon(polygon, mergingDistance), meshKernelId);
         }
         catch (...)
         {
@@ -2415,12 +2880,14 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
             }
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->MergeTwoNodes(firstNode, secondNode), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->MergeTwoNodes(firstNode, secondNode), meshKernelId);
         }
         catch (...)
         {
@@ -2437,6 +2904,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2479,6 +2948,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2512,13 +2983,15 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
             }
 
             auto [edgeId, undoAction] = meshKernelState[meshKernelId].m_mesh2d->ConnectNodes(startNode, endNode);
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
 
             new_edge_index = static_cast<int>(edgeId);
         }
@@ -2541,6 +3014,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2592,7 +3067,7 @@ namespace meshkernelapi
             if (edgeId != meshkernel::constants::missing::uintValue)
             {
                 compoundUndoAction->Add(std::move(action));
-                meshKernelUndoStack.Add(std::move(compoundUndoAction), meshKernelId);
+                AddUndoAction(std::move(compoundUndoAction), meshKernelId);
             }
             edgeIndex = static_cast<int>(edgeId);
         }
@@ -2608,6 +3083,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2616,7 +3093,7 @@ namespace meshkernelapi
             meshkernel::Point const nodeCoordinateVector{xCoordinate, yCoordinate};
 
             auto [nodeId, undoAction] = meshKernelState[meshKernelId].m_mesh2d->InsertNode(nodeCoordinateVector);
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
 
             nodeIndex = static_cast<int>(nodeId);
         }
@@ -2632,12 +3109,14 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
             }
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->DeleteNode(nodeIndex), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->DeleteNode(nodeIndex), meshKernelId);
         }
         catch (...)
         {
@@ -2651,6 +3130,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2658,7 +3139,7 @@ namespace meshkernelapi
 
             meshkernel::Point newPosition{xCoordinate, yCoordinate};
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->MoveNode(newPosition, nodeIndex), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->MoveNode(newPosition, nodeIndex), meshKernelId);
         }
         catch (...)
         {
@@ -2678,6 +3159,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2688,7 +3171,7 @@ namespace meshkernelapi
             meshkernel::BoundingBox boundingBox{{xLowerLeftBoundingBox, yLowerLeftBoundingBox}, {xUpperRightBoundingBox, yUpperRightBoundingBox}};
 
             const auto edgeIndex = meshKernelState[meshKernelId].m_mesh2d->FindLocationIndex(point, meshkernel::Location::Edges, {}, boundingBox);
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->DeleteEdge(edgeIndex), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->DeleteEdge(edgeIndex), meshKernelId);
         }
         catch (...)
         {
@@ -2702,12 +3185,14 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
             }
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_mesh2d->DeleteEdge(edgeIndex), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_mesh2d->DeleteEdge(edgeIndex), meshKernelId);
         }
         catch (...)
         {
@@ -2728,6 +3213,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2751,6 +3238,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2762,7 +3251,7 @@ namespace meshkernelapi
             std::vector<bool> validFace(numFaces, false);
             for (meshkernel::UInt f = 0; f < numFaces; ++f)
             {
-                const auto& faceNodes = meshKernelState[meshKernelId].m_mesh2d->m_facesNodes[f];
+                const auto faceNodes = meshKernelState[meshKernelId].m_mesh2d->FaceNodes(f);
                 const auto faceNumEdges = static_cast<int>(faceNodes.size());
                 if (faceNumEdges == numEdges)
                 {
@@ -2783,6 +3272,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2794,7 +3285,7 @@ namespace meshkernelapi
             int numMatchingFaces = 0;
             for (meshkernel::UInt f = 0; f < numFaces; ++f)
             {
-                const auto faceNumEdges = static_cast<int>(meshKernelState[meshKernelId].m_mesh2d->m_facesNodes[f].size());
+                const auto faceNumEdges = static_cast<int>(meshKernelState[meshKernelId].m_mesh2d->FaceNodes(f).size());
                 if (faceNumEdges != numEdges)
                 {
                     continue;
@@ -2822,6 +3313,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2855,7 +3348,7 @@ namespace meshkernelapi
                     continue;
                 }
 
-                const auto faceNumEdges = static_cast<int>(meshKernelState[meshKernelId].m_mesh2d->m_facesNodes[f].size());
+                const auto faceNumEdges = static_cast<int>(meshKernelState[meshKernelId].m_mesh2d->FaceNodes(f).size());
                 geometryListDimension += faceNumEdges + 2;
                 num_masked_faces++;
             }
@@ -2882,6 +3375,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2919,6 +3414,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2945,6 +3442,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -2974,6 +3473,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3022,7 +3523,7 @@ namespace meshkernelapi
                                                       refinementPolygon,
                                                       std::move(averaging),
                                                       meshRefinementParameters);
-            meshKernelUndoStack.Add(meshRefinement.Compute(), meshKernelId);
+            AddUndoAction(meshRefinement.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -3042,6 +3543,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3080,7 +3583,7 @@ namespace meshkernelapi
                                                       refinementPolygon,
                                                       std::move(averaging),
                                                       meshRefinementParameters);
-            meshKernelUndoStack.Add(meshRefinement.Compute(), meshKernelId);
+            AddUndoAction(meshRefinement.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -3098,6 +3601,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3118,7 +3623,7 @@ namespace meshkernelapi
                                                       std::move(interpolant),
                                                       meshRefinementParameters,
                                                       useNodalRefinement);
-            meshKernelUndoStack.Add(meshRefinement.Compute(), meshKernelId);
+            AddUndoAction(meshRefinement.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -3134,6 +3639,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3148,7 +3655,7 @@ namespace meshkernelapi
             const auto polygon = meshkernel::Polygons(points, meshKernelState[meshKernelId].m_mesh2d->m_projection);
 
             meshkernel::MeshRefinement meshRefinement(*meshKernelState[meshKernelId].m_mesh2d, polygon, meshRefinementParameters);
-            meshKernelUndoStack.Add(meshRefinement.Compute(), meshKernelId);
+            AddUndoAction(meshRefinement.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -3162,6 +3669,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3172,7 +3681,7 @@ namespace meshkernelapi
             }
 
             meshkernel::RemoveDisconnectedRegions removeDisconnectedRegions;
-            meshKernelUndoStack.Add(removeDisconnectedRegions.Compute(*meshKernelState[meshKernelId].m_mesh2d), meshKernelId);
+            AddUndoAction(removeDisconnectedRegions.Compute(*meshKernelState[meshKernelId].m_mesh2d), meshKernelId);
         }
         catch (...)
         {
@@ -3194,6 +3703,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3231,7 +3742,14 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
-            int nodeIndex;
+            const RegistryLock registryLock(meshKernelId);
+
+            if (!meshKernelState.contains(meshKernelId))
+            {
+                throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
+            }
+
+            int nodeIndex = meshkernel::constants::missing::intValue;
             lastExitCode = static_cast<meshkernel::ExitCode>(mkernel_mesh2d_get_node_index(meshKernelId,
                                                                                            xCoordinateIn,
                                                                                            yCoordinateIn,
@@ -3242,6 +3760,11 @@ namespace meshkernelapi
                                                                                            yUpperRightBoundingBox,
                                                                                            nodeIndex));
 
+            if (lastExitCode != meshkernel::ExitCode::Success)
+            {
+                throw meshkernel::MeshKernelError("The closest node could not be found: {}", std::string(exceptionMessage));
+            }
+
             // Set the node coordinate
             const auto foundNode = meshKernelState[meshKernelId].m_mesh2d->Node(nodeIndex);
             xCoordinateOut = foundNode.x;
@@ -3259,6 +3782,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3287,6 +3812,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3302,7 +3829,7 @@ namespace meshkernelapi
             // Translate origin back to centre of rotation
             transformation.compose(meshkernel::Translation(meshkernel::Vector(centreX, centreY)));
 
-            meshKernelUndoStack.Add(meshkernel::MeshTransformation::Compute(*meshKernelState[meshKernelId].m_mesh2d, transformation), meshKernelId);
+            AddUndoAction(meshkernel::MeshTransformation::Compute(*meshKernelState[meshKernelId].m_mesh2d, transformation), meshKernelId);
         }
         catch (...)
         {
@@ -3317,13 +3844,15 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
             }
 
             meshkernel::Translation translation(meshkernel::Vector(translationX, translationY));
-            meshKernelUndoStack.Add(meshkernel::MeshTransformation::Compute(*meshKernelState[meshKernelId].m_mesh2d, translation), meshKernelId);
+            AddUndoAction(meshkernel::MeshTransformation::Compute(*meshKernelState[meshKernelId].m_mesh2d, translation), meshKernelId);
         }
         catch (...)
         {
@@ -3338,12 +3867,14 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
             }
 
-            meshKernelUndoStack.Add(meshkernel::CasulliRefinement::Compute(*meshKernelState[meshKernelId].m_mesh2d), meshKernelId);
+            AddUndoAction(meshkernel::CasulliRefinement::Compute(*meshKernelState[meshKernelId].m_mesh2d), meshKernelId);
         }
         catch (...)
         {
@@ -3358,6 +3889,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3368,7 +3901,7 @@ namespace meshkernelapi
             const meshkernel::Polygons meshKernelPolygons(polygonPoints,
                                                           meshKernelState[meshKernelId].m_mesh2d->m_projection);
 
-            meshKernelUndoStack.Add(meshkernel::CasulliRefinement::Compute(*meshKernelState[meshKernelId].m_mesh2d,
+            AddUndoAction(meshkernel::CasulliRefinement::Compute(*meshKernelState[meshKernelId].m_mesh2d,
                                                                            meshKernelPolygons),
                                     meshKernelId);
         }
@@ -3389,6 +3922,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3417,7 +3952,7 @@ namespace meshkernelapi
                                                                          meshRefinementParameters,
                                                                          minimumRefinementDepth);
 
-                meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+                AddUndoAction(std::move(undoAction), meshKernelId);
             }
         }
         catch (...)
@@ -3433,6 +3968,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3468,6 +4005,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3506,12 +4045,14 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
             }
 
-            meshKernelUndoStack.Add(meshkernel::CasulliDeRefinement::Compute(*meshKernelState[meshKernelId].m_mesh2d), meshKernelId);
+            AddUndoAction(meshkernel::CasulliDeRefinement::Compute(*meshKernelState[meshKernelId].m_mesh2d), meshKernelId);
         }
         catch (...)
         {
@@ -3526,6 +4067,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3535,7 +4078,7 @@ namespace meshkernelapi
             auto polygonPoints = ConvertGeometryListToPointVector(polygons);
             const meshkernel::Polygons meshKernelPolygons(polygonPoints,
                                                           meshKernelState[meshKernelId].m_mesh2d->m_projection);
-            meshKernelUndoStack.Add(meshkernel::CasulliDeRefinement::Compute(*meshKernelState[meshKernelId].m_mesh2d,
+            AddUndoAction(meshkernel::CasulliDeRefinement::Compute(*meshKernelState[meshKernelId].m_mesh2d,
                                                                              meshKernelPolygons),
                                     meshKernelId);
         }
@@ -3556,6 +4099,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3650,6 +4195,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3743,6 +4290,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3762,7 +4311,7 @@ namespace meshkernelapi
 
             const meshkernel::FlipEdges flipEdges(*meshKernelState[meshKernelId].m_mesh2d, landBoundary, triangulateFaces, projectToLandBoundary);
 
-            meshKernelUndoStack.Add(flipEdges.Compute(polygon), meshKernelId);
+            AddUndoAction(flipEdges.Compute(polygon), meshKernelId);
         }
         catch (...)
         {
@@ -3776,6 +4325,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3806,6 +4357,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3929,6 +4482,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3957,6 +4512,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3982,6 +4539,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -3990,7 +4549,7 @@ namespace meshkernelapi
             std::unique_ptr<meshkernel::CompoundUndoAction> undoSmallFlowEdges = meshkernel::CompoundUndoAction::Create();
             undoSmallFlowEdges->Add(meshKernelState[meshKernelId].m_mesh2d->DeleteSmallFlowEdges(smallFlowEdgesThreshold));
             undoSmallFlowEdges->Add(meshKernelState[meshKernelId].m_mesh2d->DeleteSmallTrianglesAtBoundaries(minFractionalAreaTriangles));
-            meshKernelUndoStack.Add(std::move(undoSmallFlowEdges), meshKernelId);
+            AddUndoAction(std::move(undoSmallFlowEdges), meshKernelId);
         }
         catch (...)
         {
@@ -4007,6 +4566,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4028,7 +4589,7 @@ namespace meshkernelapi
             meshKernelState[meshKernelId].m_contacts = std::make_unique<meshkernel::Contacts>(*meshKernelState[meshKernelId].m_mesh1d, *meshKernelState[meshKernelId].m_mesh2d);
             meshKernelState[meshKernelId].m_contacts->ComputeSingleContacts(meshKernel1DNodeMask, meshKernelPolygons, projectionFactor);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4043,6 +4604,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4059,7 +4622,7 @@ namespace meshkernelapi
             meshKernelState[meshKernelId].m_contacts = std::make_unique<meshkernel::Contacts>(*meshKernelState[meshKernelId].m_mesh1d, *meshKernelState[meshKernelId].m_mesh2d);
             meshKernelState[meshKernelId].m_contacts->ComputeMultipleContacts(meshKernel1DNodeMask);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4075,6 +4638,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4097,7 +4662,7 @@ namespace meshkernelapi
             meshKernelState[meshKernelId].m_contacts->ComputeContactsWithPolygons(meshKernel1DNodeMask,
                                                                                   meshKernelPolygons);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4112,6 +4677,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4131,7 +4698,7 @@ namespace meshkernelapi
             meshKernelState[meshKernelId].m_contacts = std::make_unique<meshkernel::Contacts>(*meshKernelState[meshKernelId].m_mesh1d, *meshKernelState[meshKernelId].m_mesh2d);
             meshKernelState[meshKernelId].m_contacts->ComputeContactsWithPoints(meshKernel1DNodeMask, meshKernelPoints);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4145,6 +4712,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4178,7 +4747,7 @@ namespace meshkernelapi
             meshKernelState[meshKernelId].m_mesh2d->SetEdges(mergedMeshes->Edges());
             meshKernelState[meshKernelId].m_mesh2d->Administrate();
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4195,6 +4764,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4214,7 +4785,7 @@ namespace meshkernelapi
             meshKernelState[meshKernelId].m_contacts = std::make_unique<meshkernel::Contacts>(*meshKernelState[meshKernelId].m_mesh1d, *meshKernelState[meshKernelId].m_mesh2d);
             meshKernelState[meshKernelId].m_contacts->ComputeBoundaryContacts(meshKernel1DNodeMask, meshKernelPolygons, searchRadius);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4233,6 +4804,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4246,14 +4819,14 @@ namespace meshkernelapi
                 // Refinement
                 meshkernel::CurvilinearGridRefinement curvilinearGridRefinement(*meshKernelState[meshKernelId].m_curvilinearGrid, refinement);
                 curvilinearGridRefinement.SetBlock(firstPoint, secondPoint);
-                meshKernelUndoStack.Add(curvilinearGridRefinement.Compute(), meshKernelId);
+                AddUndoAction(curvilinearGridRefinement.Compute(), meshKernelId);
             }
             else if (refinement < -1)
             {
                 // De-refinement
                 meshkernel::CurvilinearGridDeRefinement curvilinearGridDeRefinement(*meshKernelState[meshKernelId].m_curvilinearGrid, -refinement);
                 curvilinearGridDeRefinement.SetBlock(firstPoint, secondPoint);
-                meshKernelUndoStack.Add(curvilinearGridDeRefinement.Compute(), meshKernelId);
+                AddUndoAction(curvilinearGridDeRefinement.Compute(), meshKernelId);
             }
         }
         catch (...)
@@ -4271,6 +4844,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4282,7 +4857,7 @@ namespace meshkernelapi
             }
 
             meshkernel::CurvilinearGridFullRefinement gridRefinement;
-            meshKernelUndoStack.Add(gridRefinement.Compute(*meshKernelState[meshKernelId].m_curvilinearGrid, mRefinement, nRefinement),
+            AddUndoAction(gridRefinement.Compute(*meshKernelState[meshKernelId].m_curvilinearGrid, mRefinement, nRefinement),
                                     meshKernelId);
         }
         catch (...)
@@ -4300,6 +4875,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4317,7 +4894,7 @@ namespace meshkernelapi
             // Set the state
             meshKernelState[meshKernelId].m_curvilinearGrid = curvilinearGridFromSplinesTransfinite.Compute();
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4336,6 +4913,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4354,7 +4933,7 @@ namespace meshkernelapi
             // set the curvilinear state
             meshKernelState[meshKernelId].m_curvilinearGrid = curvilinearGridFromPolygon.Compute(firstNode, secondNode, thirdNode, useFourthSideBool);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4372,6 +4951,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4388,7 +4969,7 @@ namespace meshkernelapi
             // set the curvilinear state
             meshKernelState[meshKernelId].m_curvilinearGrid = curvilinearGridFromPolygon.Compute(firstNode, secondNode, thirdNode);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4405,6 +4986,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4421,7 +5004,7 @@ namespace meshkernelapi
             // set the curvilinear state
             meshKernelState[meshKernelId].m_curvilinearGrid = curvilinearGridFromSplines.Compute();
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4437,6 +5020,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4452,7 +5037,7 @@ namespace meshkernelapi
             //  the curvilinear grid
             meshKernelState[meshKernelId].m_curvilinearGrid = std::make_unique<meshkernel::CurvilinearGrid>(splineToGrid.Compute(splines, curvilinearParameters));
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4466,6 +5051,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (curvature == nullptr)
             {
                 throw meshkernel::ConstraintError("The curvautre array is null");
@@ -4500,6 +5087,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (smoothness == nullptr)
             {
                 throw meshkernel::ConstraintError("The smoothness array is null");
@@ -4537,6 +5126,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4561,6 +5152,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4584,6 +5177,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4598,7 +5193,7 @@ namespace meshkernelapi
 
             meshKernelState[meshKernelId].m_curvilinearGrid = meshKernelState[meshKernelId].m_curvilinearGridFromSplines->ComputeCurvilinearGridFromGridPoints();
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4612,6 +5207,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4637,6 +5234,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4646,7 +5245,7 @@ namespace meshkernelapi
 
             meshKernelState[meshKernelId].m_curvilinearGrid = CreateRectangularCurvilinearGrid(makeGridParameters, meshKernelState[meshKernelId].m_projection);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4662,6 +5261,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4673,7 +5274,7 @@ namespace meshkernelapi
                                                                                                            geometryList,
                                                                                                            meshKernelState[meshKernelId].m_projection);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4688,6 +5289,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4698,7 +5301,7 @@ namespace meshkernelapi
             meshKernelState[meshKernelId].m_curvilinearGrid = CreateRectangularCurvilinearGridOnExtension(makeGridParameters,
                                                                                                           meshKernelState[meshKernelId].m_projection);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4713,6 +5316,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4727,7 +5332,7 @@ namespace meshkernelapi
             *meshKernelState[meshKernelId].m_curvilinearGrid = meshkernel::CurvilinearGridGenerateCircularGrid::Compute(parameters,
                                                                                                                         meshKernelState[meshKernelId].m_projection);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -4746,6 +5351,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -4765,7 +5372,7 @@ namespace meshkernelapi
             curvilinearOrthogonalization.SetBlock(firstPoint, secondPoint);
 
             // Compute
-            meshKernelUndoStack.Add(curvilinearOrthogonalization.Compute(), meshKernelId);
+            AddUndoAction(curvilinearOrthogonalization.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -4779,6 +5386,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -4807,6 +5416,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -4821,7 +5432,7 @@ namespace meshkernelapi
 
             meshKernelState[meshKernelId].m_frozenLines.erase(frozenLineId);
 
-            meshKernelUndoStack.Add(std::make_unique<CurvilinearFrozenLinesDeleteUndoAction>(meshKernelState[meshKernelId],
+            AddUndoAction(std::make_unique<CurvilinearFrozenLinesDeleteUndoAction>(meshKernelState[meshKernelId],
                                                                                              frozenLineId,
                                                                                              frozenLinePoints),
                                     meshKernelId);
@@ -4844,6 +5455,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -4857,7 +5470,7 @@ namespace meshkernelapi
             meshKernelState[meshKernelId].m_frozenLines[frozenLineId] = frozenLinePoints;
             meshKernelState[meshKernelId].m_frozenLinesCounter++;
 
-            meshKernelUndoStack.Add(std::make_unique<CurvilinearFrozenLinesAddUndoAction>(meshKernelState[meshKernelId],
+            AddUndoAction(std::make_unique<CurvilinearFrozenLinesAddUndoAction>(meshKernelState[meshKernelId],
                                                                                           frozenLineId,
                                                                                           frozenLinePoints),
                                     meshKernelId);
@@ -4879,6 +5492,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -4908,6 +5523,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -4927,6 +5544,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -4958,6 +5577,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -4986,7 +5607,7 @@ namespace meshkernelapi
             curvilinearGridSmoothing.SetBlock(firstPoint, secondPoint);
 
             // Execute
-            meshKernelUndoStack.Add(curvilinearGridSmoothing.Compute(), meshKernelId);
+            AddUndoAction(curvilinearGridSmoothing.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -5009,6 +5630,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -5037,7 +5660,7 @@ namespace meshkernelapi
 
             meshKernelState[meshKernelId].m_curvilinearGrid = curvilinearGridSmoothing.ComputeDirectional(firstNode, secondNode);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -5052,6 +5675,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -5085,6 +5710,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -5107,6 +5734,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -5129,7 +5758,7 @@ namespace meshkernelapi
             const auto& projection = meshKernelState[meshKernelId].m_projection;
             meshKernelState[meshKernelId].m_curvilinearGrid = std::make_unique<meshkernel::CurvilinearGrid>(curviGridPoints, projection);
 
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -5147,6 +5776,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -5173,13 +5804,15 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
             }
             meshkernel::Point const fromPoint{xFromCoordinate, yFromCoordinate};
             meshkernel::Point const toPoint{xToCoordinate, yToCoordinate};
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_curvilinearGridLineShift->MoveNode(fromPoint, toPoint), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_curvilinearGridLineShift->MoveNode(fromPoint, toPoint), meshKernelId);
         }
         catch (...)
         {
@@ -5193,6 +5826,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -5203,7 +5838,7 @@ namespace meshkernelapi
                 throw meshkernel::MeshKernelError("Curvilinear grid line shift algorithm instance is null.");
             }
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_curvilinearGridLineShift->Compute(), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_curvilinearGridLineShift->Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -5217,6 +5852,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -5236,6 +5873,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -5253,7 +5892,7 @@ namespace meshkernelapi
 
             meshkernel::Point const point{xCoordinate, yCoordinate};
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_curvilinearGrid->InsertFace(point), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_curvilinearGrid->InsertFace(point), meshKernelId);
         }
         catch (...)
         {
@@ -5267,6 +5906,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5297,7 +5938,7 @@ namespace meshkernelapi
 
             // curvilinear grid must be reset to an empty curvilinear grid
             meshKernelState[meshKernelId].m_curvilinearGrid = std::make_unique<meshkernel::CurvilinearGrid>();
-            meshKernelUndoStack.Add(std::move(undoAction), meshKernelId);
+            AddUndoAction(std::move(undoAction), meshKernelId);
         }
         catch (...)
         {
@@ -5311,6 +5952,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5330,7 +5973,7 @@ namespace meshkernelapi
             curvilinearDeleteExterior.SetBlock(meshkernel::Point{boundingBox.xLowerLeft, boundingBox.yLowerLeft},
                                                meshkernel::Point{boundingBox.xUpperRight, boundingBox.yUpperRight});
 
-            meshKernelUndoStack.Add(curvilinearDeleteExterior.Compute(), meshKernelId);
+            AddUndoAction(curvilinearDeleteExterior.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -5345,6 +5988,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5364,7 +6009,7 @@ namespace meshkernelapi
             curvilinearDeleteInterior.SetBlock(meshkernel::Point{boundingBox.xLowerLeft, boundingBox.yLowerLeft},
                                                meshkernel::Point{boundingBox.xUpperRight, boundingBox.yUpperRight});
 
-            meshKernelUndoStack.Add(curvilinearDeleteInterior.Compute(), meshKernelId);
+            AddUndoAction(curvilinearDeleteInterior.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -5387,6 +6032,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel state does not exist.");
@@ -5402,7 +6049,7 @@ namespace meshkernelapi
             meshkernel::Point const upperRight{xUpperRightCorner, yUpperRightCorner};
             curvilinearLineAttractionRepulsion.SetBlock(lowerLeft, upperRight);
 
-            meshKernelUndoStack.Add(curvilinearLineAttractionRepulsion.Compute(), meshKernelId);
+            AddUndoAction(curvilinearLineAttractionRepulsion.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -5422,6 +6069,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5443,7 +6092,7 @@ namespace meshkernelapi
 
             curvilinearGridLineMirror.SetLine({xFirstGridLineNode, yFirstGridLineNode}, {xSecondGridLineNode, ySecondGridLineNode});
 
-            meshKernelUndoStack.Add(curvilinearGridLineMirror.Compute(), meshKernelId);
+            AddUndoAction(curvilinearGridLineMirror.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -5459,6 +6108,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5474,7 +6125,7 @@ namespace meshkernelapi
                 throw meshkernel::MeshKernelError("Not valid curvilinear grid.");
             }
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_curvilinearGrid->DeleteNode({xPointCoordinate, yPointCoordinate}), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_curvilinearGrid->DeleteNode({xPointCoordinate, yPointCoordinate}), meshKernelId);
         }
         catch (...)
         {
@@ -5492,6 +6143,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5505,7 +6158,7 @@ namespace meshkernelapi
             meshkernel::Point const fromPoint{xFromPoint, yFromPoint};
             meshkernel::Point const toPoint{xToPoint, yToPoint};
 
-            meshKernelUndoStack.Add(meshKernelState[meshKernelId].m_curvilinearGrid->MoveNode(fromPoint, toPoint), meshKernelId);
+            AddUndoAction(meshKernelState[meshKernelId].m_curvilinearGrid->MoveNode(fromPoint, toPoint), meshKernelId);
         }
         catch (...)
         {
@@ -5527,6 +6180,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5558,7 +6213,7 @@ namespace meshkernelapi
             //--------------------------------
             // Snap curvilinear grid to the land boundary
             meshkernel::CurvilinearGridSnapGridToLandBoundary gridSnapping(*meshKernelState[meshKernelId].m_curvilinearGrid, landBoundary, controlPoints);
-            meshKernelUndoStack.Add(gridSnapping.Compute(), meshKernelId);
+            AddUndoAction(gridSnapping.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -5580,6 +6235,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5614,7 +6271,7 @@ namespace meshkernelapi
             // Snap curvilinear grid to the spline
 
             meshkernel::CurvilinearGridSnapGridToSpline gridSnapping(*meshKernelState[meshKernelId].m_curvilinearGrid, mkSpline, controlPoints);
-            meshKernelUndoStack.Add(gridSnapping.Compute(), meshKernelId);
+            AddUndoAction(gridSnapping.Compute(), meshKernelId);
         }
         catch (...)
         {
@@ -5644,6 +6301,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5702,6 +6361,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5817,7 +6478,11 @@ namespace meshkernelapi
     MKERNEL_API int mkernel_get_projection(int meshKernelId, int& projection)
     {
         lastExitCode = meshkernel::ExitCode::Success;
-        projection = static_cast<int>(meshKernelState[meshKernelId].m_projection);
+        const RegistryLock registryLock(meshKernelId);
+
+        // An unknown id is not added to the registry, its projection is the default one
+        const auto state = meshKernelState.find(meshKernelId);
+        projection = static_cast<int>(state != meshKernelState.end() ? state->second.m_projection : MeshKernelState().m_projection);
         return lastExitCode;
     }
 
@@ -5855,6 +6520,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5870,7 +6537,7 @@ namespace meshkernelapi
             meshkernel::Splines splineValues(meshKernelState[meshKernelId].m_mesh2d->m_projection);
 
             meshKernelState[meshKernelId].m_splines = std::make_shared<meshkernel::Splines>(splinePoints, meshKernelState[meshKernelId].m_projection);
-            meshKernelState[meshKernelId].m_splineIntersectionCache = std::make_shared<meshkernelapi::SplineIntersectionCache>();
+            meshKernelState[meshKernelId].m_splineIntersectionCache = std::make_shared<meshkernelapi::SplineIntersectionCache>(*meshKernelState[meshKernelId].m_splines);
         }
         catch (...)
         {
@@ -5888,6 +6555,8 @@ namespace meshkernelapi
 
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5911,7 +6580,9 @@ namespace meshkernelapi
             std::vector<double> xCrossOver;
             std::vector<double> yCrossOver;
 
-            meshKernelState[meshKernelId].m_splines->GetAllIntersections(splinePoints, splineIndices, angles, xCrossOver, yCrossOver);
+            meshKernelState[meshKernelId].m_splines->GetAllIntersections(splinePoints,
+                                                                         meshKernelState[meshKernelId].m_splineIntersectionCache->SegmentIndex(),
+                                                                         splineIndices, angles, xCrossOver, yCrossOver);
             meshKernelState[meshKernelId].m_splineIntersectionCache->Set(splineIndices, angles, xCrossOver, yCrossOver);
             numberOfIntersections = meshKernelState[meshKernelId].m_splineIntersectionCache->NumberOfIntersections();
         }
@@ -5928,6 +6599,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -5952,6 +6625,8 @@ namespace meshkernelapi
         lastExitCode = meshkernel::ExitCode::Success;
         try
         {
+            const RegistryLock registryLock(meshKernelId);
+
             if (!meshKernelState.contains(meshKernelId))
             {
                 throw meshkernel::MeshKernelError("The selected mesh kernel id does not exist.");
@@ -48,8 +48,16 @@ void meshkernelapi::MeshSmoothnessPropertyCalculator::Calculate(const MeshKernel
                                           geometryList.num_coordinates, Size(state, location));
     }
 
-    std::span<double> smoothness(geometryList.values, state.m_mesh2d->GetNumEdges());
-    meshkernel::MeshSmoothness::Compute(*state.m_mesh2d, smoothness);
+    const CachedResults* cachedResults = FindCachedResults(state, location);
+
+    if (cachedResults == nullptr)
+    {
+        CachedResults results;
+        results.m_values = meshkernel::MeshSmoothness::Compute(*state.m_mesh2d);
+        cachedResults = &StoreCachedResults(state, location, std::move(results));
+    }
+
+    std::ranges::copy(cachedResults->m_values, geometryList.values);
 
     if (static_cast<meshkernel::UInt>(geometryList.num_coordinates) > state.m_mesh2d->GetNumEdges())
     {
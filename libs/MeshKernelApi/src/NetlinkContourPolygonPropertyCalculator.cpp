@@ -45,7 +45,16 @@ void meshkernelapi::NetlinkContourPolygonPropertyCalculator::Calculate(const Mes
                                           geometryList.num_coordinates, Size(state, location));
     }
 
-    std::vector<meshkernel::Point> netlinkContourPolygons(meshkernel::algo::NetlinkContourPolygons::Compute(*state.m_mesh2d));
+    const CachedResults* cachedResults = FindCachedResults(state, location);
+
+    if (cachedResults == nullptr)
+    {
+        CachedResults results;
+        results.m_coordinates = meshkernel::algo::NetlinkContourPolygons::Compute(*state.m_mesh2d);
+        cachedResults = &StoreCachedResults(state, location, std::move(results));
+    }
+
+    const std::vector<meshkernel::Point>& netlinkContourPolygons = cachedResults->m_coordinates;
 
     size_t size = static_cast<size_t>(Size(state, location));
     std::span<double> xCoord(geometryList.coordinates_x, size);
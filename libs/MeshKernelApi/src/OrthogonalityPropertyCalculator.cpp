@@ -48,8 +48,16 @@ void meshkernelapi::OrthogonalityPropertyCalculator::Calculate(const MeshKernelS
                                           geometryList.num_coordinates, Size(state, location));
     }
 
-    std::span<double> orthogonality(geometryList.values, geometryList.num_coordinates);
-    meshkernel::MeshOrthogonality::Compute(*state.m_mesh2d, orthogonality);
+    const CachedResults* cachedResults = FindCachedResults(state, location);
+
+    if (cachedResults == nullptr)
+    {
+        CachedResults results;
+        results.m_values = meshkernel::MeshOrthogonality::Compute(*state.m_mesh2d);
+        cachedResults = &StoreCachedResults(state, location, std::move(results));
+    }
+
+    std::ranges::copy(cachedResults->m_values, geometryList.values);
 
     if (geometryList.coordinates_x != nullptr && geometryList.coordinates_y != nullptr)
     {
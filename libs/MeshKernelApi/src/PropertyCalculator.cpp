@@ -36,3 +36,28 @@
 
 #include <algorithm>
 #include <functional>
+
+const meshkernelapi::PropertyCalculator::CachedResults* meshkernelapi::PropertyCalculator::FindCachedResults(const MeshKernelState& state, const meshkernel::Location location) const
+{
+    // An expired pointer never compares equal to the current mesh, even if the new mesh was allocated at the same address
+    if (state.m_mesh2d == nullptr ||
+        m_cachedMesh.lock() != state.m_mesh2d ||
+        m_cachedLocation != location ||
+        m_cachedGeometryGeneration != state.m_mesh2d->GeometryGeneration() ||
+        m_cachedTopologyGeneration != state.m_mesh2d->TopologyGeneration())
+    {
+        return nullptr;
+    }
+
+    return &m_cachedResults;
+}
+
+const meshkernelapi::PropertyCalculator::CachedResults& meshkernelapi::PropertyCalculator::StoreCachedResults(const MeshKernelState& state, const meshkernel::Location location, CachedResults&& results) const
+{
+    m_cachedResults = std::move(results);
+    m_cachedMesh = state.m_mesh2d;
+    m_cachedLocation = location;
+    m_cachedGeometryGeneration = state.m_mesh2d->GeometryGeneration();
+    m_cachedTopologyGeneration = state.m_mesh2d->TopologyGeneration();
+    return m_cachedResults;
+}
@@ -0,0 +1,259 @@
+//---- GPL ---------------------------------------------------------------------
+//
+// Copyright (C)  Stichting Deltares, 2011-2025.
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation version 3.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+//
+// contact: delft3d.support@deltares.nl
+// Stichting Deltares
+// P.O. Box 177
+// 2600 MH Delft, The Netherlands
+//
+// All indications and logos of, and references to, "Delft3D" and "Deltares"
+// are registered trademarks of Stichting Deltares, and remain the property of
+// Stichting Deltares. All rights reserved.
+//
+//------------------------------------------------------------------------------
+
+
+#include <atomic>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "MeshKernel/Parameters.hpp"
+
+#include "MeshKernelApi/GeometryList.hpp"
+#include "MeshKernelApi/Mesh2D.hpp"
+#include "MeshKernelApi/MeshKernel.hpp"
+
+namespace mk = meshkernel;
+namespace mkapi = meshkernelapi;
+
+namespace
+{
+    /// @brief The number of threads calling the api concurrently
+    constexpr int numberOfThreads = 8;
+
+    /// @brief Runs \p task on numberOfThreads threads, passing the index of the thread
+    template <typename Task>
+    void RunConcurrently(const Task& task)
+    {
+        std::atomic<bool> start{false};
+        std::vector<std::thread> threads;
+        threads.reserve(numberOfThreads);
+
+        for (int threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex)
+        {
+            threads.emplace_back([&start, &task, threadIndex]()
+                                 {
+                                     while (!start)
+                                     {
+                                         std::this_thread::yield();
+                                     }
+                                     task(threadIndex); });
+        }
+
+        start = true;
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    /// @brief Gets the node coordinates of the mesh2d of a state
+    void GetNodeCoordinates(int meshKernelId, std::vector<double>& nodeX, std::vector<double>& nodeY)
+    {
+        mkapi::Mesh2D mesh2d{};
+        ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_mesh2d_get_dimensions(meshKernelId, mesh2d));
+
+        std::vector<int> edgeNodes(mesh2d.num_edges * 2);
+        nodeX.resize(mesh2d.num_nodes);
+        nodeY.resize(mesh2d.num_nodes);
+        mesh2d.edge_nodes = edgeNodes.data();
+        mesh2d.node_x = nodeX.data();
+        mesh2d.node_y = nodeY.data();
+        ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_mesh2d_get_node_edge_data(meshKernelId, mesh2d));
+    }
+} // namespace
+
+TEST(ConcurrencyTests, DistinctStates_ShouldBeEditedConcurrently)
+{
+    constexpr int numberOfIterations = 10;
+
+    int edgeLengthId = -1;
+    ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_mesh2d_get_edge_length_property_type(edgeLengthId));
+    const int locationId = static_cast<int>(mk::Location::Edges);
+
+    RunConcurrently([edgeLengthId, locationId](int threadIndex)
+                    {
+        for (int iteration = 0; iteration < numberOfIterations; ++iteration)
+        {
+            // Each thread allocates, edits and expunges its own states
+            int meshKernelId = -1;
+            ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_allocate_state(0, meshKernelId));
+
+            mk::MakeGridParameters makeGridParameters;
+            makeGridParameters.num_columns = 5 + threadIndex;
+            makeGridParameters.num_rows = 4;
+            makeGridParameters.block_size_x = 1.0;
+            makeGridParameters.block_size_y = 1.0;
+            ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_curvilinear_compute_rectangular_grid(meshKernelId, makeGridParameters));
+            ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_curvilinear_convert_to_mesh2d(meshKernelId));
+
+            // Move the first node by a quarter of a block, close enough not to drag its neighbours along
+            std::vector<double> nodeX;
+            std::vector<double> nodeY;
+            GetNodeCoordinates(meshKernelId, nodeX, nodeY);
+            ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_mesh2d_move_node(meshKernelId, nodeX[0] + 0.25, nodeY[0], 0));
+
+            int dimension = -1;
+            ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_mesh2d_get_property_dimension(meshKernelId, edgeLengthId, locationId, dimension));
+
+            const int expectedNumberOfEdges = (makeGridParameters.num_columns + 1) * makeGridParameters.num_rows +
+                                              makeGridParameters.num_columns * (makeGridParameters.num_rows + 1);
+            ASSERT_EQ(expectedNumberOfEdges, dimension);
+
+            std::vector<double> values(dimension, -1.0);
+            mkapi::GeometryList propertyData{};
+            propertyData.num_coordinates = dimension;
+            propertyData.values = values.data();
+            ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_mesh2d_get_property(meshKernelId, edgeLengthId, locationId, propertyData));
+
+            // Only the two edges connected to the moved corner node are not of unit length
+            int numberOfUnitEdges = 0;
+            for (const double length : values)
+            {
+                numberOfUnitEdges += std::abs(length - 1.0) < 1.0e-12 ? 1 : 0;
+            }
+            EXPECT_EQ(dimension - 2, numberOfUnitEdges);
+
+            ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_expunge_state(meshKernelId));
+
+            bool isValid = true;
+            ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_is_valid_state(meshKernelId, isValid));
+            EXPECT_FALSE(isValid);
+        } });
+}
+
+TEST(ConcurrencyTests, SameState_ShouldSerialiseCalls)
+{
+    int meshKernelId = -1;
+    ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_allocate_state(0, meshKernelId));
+
+    mk::MakeGridParameters makeGridParameters;
+    makeGridParameters.num_columns = numberOfThreads - 1;
+    makeGridParameters.num_rows = 3;
+    makeGridParameters.block_size_x = 1.0;
+    makeGridParameters.block_size_y = 1.0;
+    ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_curvilinear_compute_rectangular_grid(meshKernelId, makeGridParameters));
+    ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_curvilinear_convert_to_mesh2d(meshKernelId));
+
+    std::vector<double> initialX;
+    std::vector<double> initialY;
+    GetNodeCoordinates(meshKernelId, initialX, initialY);
+    const auto numberOfNodes = static_cast<int>(initialX.size());
+
+    // All threads move their own nodes of the same state, shifting them by a quarter of a block so that
+    // no neighbouring node is dragged along
+    RunConcurrently([&](int threadIndex)
+                    {
+        for (int node = threadIndex; node < numberOfNodes; node += numberOfThreads)
+        {
+            EXPECT_EQ(mk::ExitCode::Success, mkapi::mkernel_mesh2d_move_node(meshKernelId, initialX[node] + 0.25, initialY[node], node));
+        } });
+
+    std::vector<double> nodeX;
+    std::vector<double> nodeY;
+    GetNodeCoordinates(meshKernelId, nodeX, nodeY);
+
+    ASSERT_EQ(numberOfNodes, static_cast<int>(nodeX.size()));
+    for (int node = 0; node < numberOfNodes; ++node)
+    {
+        EXPECT_NEAR(initialX[node] + 0.25, nodeX[node], 1.0e-12);
+        EXPECT_NEAR(initialY[node], nodeY[node], 1.0e-12);
+    }
+
+    // Every move has been recorded, after the computation and the conversion of the curvilinear grid
+    int committedCount = 0;
+    int restoredCount = 0;
+    ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_undo_state_count_for_id(meshKernelId, committedCount, restoredCount));
+    EXPECT_EQ(numberOfNodes + 2, committedCount);
+
+    ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_expunge_state(meshKernelId));
+}
+
+TEST(ConcurrencyTests, ErrorState_ShouldBeLocalToTheCallingThread)
+{
+    constexpr int invalidMeshKernelId = -1000;
+    constexpr int invalidProjection = 100;
+
+    RunConcurrently([](int threadIndex)
+                    {
+        // Half of the threads use an id that does not exist, the other half an invalid projection
+        const bool useInvalidId = threadIndex % 2 == 0;
+
+        for (int iteration = 0; iteration < 50; ++iteration)
+        {
+            int exitCode = mk::ExitCode::Success;
+            if (useInvalidId)
+            {
+                exitCode = mkapi::mkernel_mesh2d_move_node(invalidMeshKernelId, 0.0, 0.0, 0);
+                EXPECT_EQ(mk::ExitCode::MeshKernelErrorCode, exitCode);
+            }
+            else
+            {
+                int meshKernelId = -1;
+                exitCode = mkapi::mkernel_allocate_state(invalidProjection, meshKernelId);
+                EXPECT_EQ(mk::ExitCode::RangeErrorCode, exitCode);
+            }
+
+            std::this_thread::yield();
+
+            auto exceptionMessage = std::make_unique<char[]>(512);
+            ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_get_error(exceptionMessage.get()));
+            const std::string message(exceptionMessage.get());
+
+            if (useInvalidId)
+            {
+                EXPECT_NE(std::string::npos, message.find("does not exist")) << message;
+            }
+            else
+            {
+                EXPECT_NE(std::string::npos, message.find("Projection")) << message;
+            }
+        } });
+}
+
+TEST(ConcurrencyTests, ClosestNodeOfUnknownState_ShouldFailWithoutAddingTheState)
+{
+    constexpr int unknownMeshKernelId = 1000000;
+
+    RunConcurrently([](int)
+                    {
+        for (int iteration = 0; iteration < 50; ++iteration)
+        {
+            double xCoordinate = 0.0;
+            double yCoordinate = 0.0;
+            const auto exitCode = mkapi::mkernel_mesh2d_get_closest_node(unknownMeshKernelId, 0.0, 0.0, 10.0, -10.0, -10.0, 10.0, 10.0, xCoordinate, yCoordinate);
+            EXPECT_EQ(mk::ExitCode::MeshKernelErrorCode, exitCode);
+
+            bool isValid = true;
+            ASSERT_EQ(mk::ExitCode::Success, mkapi::mkernel_is_valid_state(unknownMeshKernelId, isValid));
+            EXPECT_FALSE(isValid);
+        } });
+}
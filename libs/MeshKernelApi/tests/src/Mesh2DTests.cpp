@@ -26,6 +26,7 @@
 //------------------------------------------------------------------------------
 
 #include <algorithm>
+#include <filesystem>
 #include <gtest/gtest.h>
 #include <random>
 
@@ -1879,3 +1880,72 @@ TEST(Mesh2DTests, Mesh2D_ShouldComputeFaceBounds)
     errorCode = meshkernelapi::mkernel_mesh2d_get_property_dimension(meshkernelId, propertyId, nodesLocation, dimension);
     ASSERT_EQ(meshkernel::ExitCode::MeshKernelErrorCode, errorCode);
 }
+
+TEST(Mesh2DTests, Mesh2DSnapshot_WhenWrittenAndRead_ShouldRestoreTheMesh)
+{
+    // Prepare
+    auto [num_nodes, num_edges, node_x, node_y, edge_nodes] = MakeRectangularMeshForApiTesting(4, 5, 1.0, meshkernel::Point(0.0, 0.0));
+    meshkernelapi::Mesh2D mesh2d{};
+    mesh2d.num_nodes = static_cast<int>(num_nodes);
+    mesh2d.num_edges = static_cast<int>(num_edges);
+    mesh2d.node_x = node_x.data();
+    mesh2d.node_y = node_y.data();
+    mesh2d.edge_nodes = edge_nodes.data();
+
+    int meshKernelId = -1;
+    auto errorCode = meshkernelapi::mkernel_allocate_state(0, meshKernelId);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+    errorCode = meshkernelapi::mkernel_mesh2d_set(meshKernelId, mesh2d);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+
+    const auto fileName = (std::filesystem::temp_directory_path() / "Mesh2DSnapshot_WhenWrittenAndRead_ShouldRestoreTheMesh.bin").string();
+    errorCode = meshkernelapi::mkernel_mesh2d_write_snapshot(meshKernelId, fileName.c_str());
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+
+    int otherMeshKernelId = -1;
+    errorCode = meshkernelapi::mkernel_allocate_state(0, otherMeshKernelId);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+
+    // Execute
+    errorCode = meshkernelapi::mkernel_mesh2d_read_snapshot(otherMeshKernelId, fileName.c_str());
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+
+    // Assert
+    meshkernelapi::Mesh2D expected{};
+    errorCode = meshkernelapi::mkernel_mesh2d_get_dimensions(meshKernelId, expected);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+    meshkernelapi::Mesh2D actual{};
+    errorCode = meshkernelapi::mkernel_mesh2d_get_dimensions(otherMeshKernelId, actual);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+    EXPECT_EQ(actual.num_nodes, expected.num_nodes);
+    EXPECT_EQ(actual.num_edges, expected.num_edges);
+    EXPECT_EQ(actual.num_faces, expected.num_faces);
+    EXPECT_EQ(actual.num_faces, 20);
+    EXPECT_EQ(actual.num_face_nodes, expected.num_face_nodes);
+
+    // a snapshot with a different projection is rejected
+    int sphericalMeshKernelId = -1;
+    errorCode = meshkernelapi::mkernel_allocate_state(1, sphericalMeshKernelId);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+    errorCode = meshkernelapi::mkernel_mesh2d_read_snapshot(sphericalMeshKernelId, fileName.c_str());
+    EXPECT_EQ(meshkernel::ExitCode::MeshKernelErrorCode, errorCode);
+
+    // undo restores the empty mesh
+    bool undone = false;
+    int undoneMeshKernelId = -1;
+    errorCode = meshkernelapi::mkernel_undo_state(undone, undoneMeshKernelId);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+    EXPECT_TRUE(undone);
+    EXPECT_EQ(undoneMeshKernelId, otherMeshKernelId);
+    errorCode = meshkernelapi::mkernel_mesh2d_get_dimensions(otherMeshKernelId, actual);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+    EXPECT_EQ(actual.num_nodes, 0);
+
+    std::filesystem::remove(fileName);
+    errorCode = meshkernelapi::mkernel_deallocate_state(meshKernelId);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+    errorCode = meshkernelapi::mkernel_deallocate_state(otherMeshKernelId);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+    errorCode = meshkernelapi::mkernel_deallocate_state(sphericalMeshKernelId);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+}
@@ -26,8 +26,10 @@
 //------------------------------------------------------------------------------
 
 #include <algorithm>
+#include <cmath>
 #include <gtest/gtest.h>
 #include <random>
+#include <ranges>
 #include <vector>
 
 #include "CartesianApiTestFixture.hpp"
@@ -345,3 +347,208 @@ TEST(MeshPropertyTests, PropertyFailureTest)
     errorCode = mkapi::mkernel_expunge_state(meshKernelId);
     ASSERT_EQ(mk::ExitCode::Success, errorCode);
 }
+
+TEST(MeshPropertyTests, PropertiesWithSharedSamplePointsTest)
+{
+    const int numberOfBathyCoordinates = 36;
+    const int numberOfProperties = 3;
+
+    int meshKernelId = meshkernel::constants::missing::intValue;
+    int errorCode;
+
+    errorCode = mkapi::mkernel_clear_state();
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    errorCode = mkapi::mkernel_allocate_state(0, meshKernelId);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    meshkernel::MakeGridParameters makeGridParameters;
+    makeGridParameters.num_columns = 4;
+    makeGridParameters.num_rows = 4;
+    makeGridParameters.origin_x = 0.0;
+    makeGridParameters.origin_y = 0.0;
+    makeGridParameters.block_size_x = 1.0;
+    makeGridParameters.block_size_y = 1.0;
+
+    errorCode = mkapi::mkernel_curvilinear_compute_rectangular_grid(meshKernelId, makeGridParameters);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    errorCode = mkapi::mkernel_curvilinear_convert_to_mesh2d(meshKernelId);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    std::vector<double> bathymetryXNodes(numberOfBathyCoordinates);
+    std::vector<double> bathymetryYNodes(numberOfBathyCoordinates);
+    std::vector<std::vector<double>> bathymetryData(numberOfProperties, std::vector<double>(numberOfBathyCoordinates));
+
+    for (int i = 0; i < numberOfBathyCoordinates; ++i)
+    {
+        bathymetryXNodes[i] = -0.5 + static_cast<double>(i % 6);
+        bathymetryYNodes[i] = -0.5 + static_cast<double>(i / 6);
+
+        for (int p = 0; p < numberOfProperties; ++p)
+        {
+            bathymetryData[p][i] = static_cast<double>(p + 1) * bathymetryXNodes[i] - static_cast<double>(p) * bathymetryYNodes[i];
+        }
+    }
+
+    meshkernel::InterpolationParameters interpolationParameters{.interpolation_type = 0};
+    std::vector<int> propertyIds(numberOfProperties, -1);
+
+    for (int p = 0; p < numberOfProperties; ++p)
+    {
+        mkapi::GeometryList sampleData{};
+        sampleData.num_coordinates = numberOfBathyCoordinates;
+        sampleData.values = bathymetryData[p].data();
+        sampleData.coordinates_x = bathymetryXNodes.data();
+        sampleData.coordinates_y = bathymetryYNodes.data();
+
+        errorCode = mkapi::mkernel_mesh2d_set_property(meshKernelId, interpolationParameters, sampleData, propertyIds[p]);
+        ASSERT_EQ(mk::ExitCode::Success, errorCode);
+    }
+
+    const int locationId = static_cast<int>(meshkernel::Location::Nodes);
+
+    int dimension = -1;
+    errorCode = mkapi::mkernel_mesh2d_get_property_dimension(meshKernelId, propertyIds[0], locationId, dimension);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    // Get all properties in a single call, in reverse order
+    const std::vector<int> requestedIds{propertyIds[2], propertyIds[1], propertyIds[0]};
+    std::vector<double> batchValues(numberOfProperties * dimension, -1.0);
+
+    mkapi::GeometryList batchData{};
+    batchData.num_coordinates = numberOfProperties * dimension;
+    batchData.values = batchValues.data();
+
+    errorCode = mkapi::mkernel_mesh2d_get_interpolated_properties(meshKernelId, requestedIds.data(), numberOfProperties, locationId, batchData);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    for (int p = 0; p < numberOfProperties; ++p)
+    {
+        std::vector<double> values(dimension, -1.0);
+        mkapi::GeometryList propertyData{};
+        propertyData.num_coordinates = dimension;
+        propertyData.values = values.data();
+
+        errorCode = mkapi::mkernel_mesh2d_get_property(meshKernelId, requestedIds[p], locationId, propertyData);
+        ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+        for (int i = 0; i < dimension; ++i)
+        {
+            EXPECT_NEAR(batchValues[p * dimension + i], values[i], 1.0e-12);
+        }
+    }
+
+    // Removing a property does not affect the properties sharing its sample points
+    errorCode = mkapi::mkernel_deallocate_property(meshKernelId, propertyIds[0]);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    std::vector<double> values(dimension, -1.0);
+    mkapi::GeometryList propertyData{};
+    propertyData.num_coordinates = dimension;
+    propertyData.values = values.data();
+
+    errorCode = mkapi::mkernel_mesh2d_get_property(meshKernelId, propertyIds[1], locationId, propertyData);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    for (int i = 0; i < dimension; ++i)
+    {
+        EXPECT_NEAR(batchValues[dimension + i], values[i], 1.0e-12);
+    }
+
+    // Only interpolated sample properties can be retrieved together
+    int orthogonalityId = -1;
+    errorCode = mkapi::mkernel_mesh2d_get_orthogonality_property_type(orthogonalityId);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    const std::vector<int> mixedIds{propertyIds[1], orthogonalityId};
+    errorCode = mkapi::mkernel_mesh2d_get_interpolated_properties(meshKernelId, mixedIds.data(), 2, locationId, batchData);
+    EXPECT_EQ(mk::ExitCode::MeshKernelErrorCode, errorCode);
+
+    errorCode = mkapi::mkernel_expunge_state(meshKernelId);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+}
+
+TEST(MeshPropertyTests, CachedPropertiesFollowMeshEditsTest)
+{
+    int meshKernelId = meshkernel::constants::missing::intValue;
+    int errorCode;
+
+    errorCode = mkapi::mkernel_clear_state();
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    errorCode = mkapi::mkernel_allocate_state(0, meshKernelId);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    meshkernel::MakeGridParameters makeGridParameters;
+    makeGridParameters.num_columns = 3;
+    makeGridParameters.num_rows = 3;
+    makeGridParameters.origin_x = 0.0;
+    makeGridParameters.origin_y = 0.0;
+    makeGridParameters.block_size_x = 1.0;
+    makeGridParameters.block_size_y = 1.0;
+
+    errorCode = mkapi::mkernel_curvilinear_compute_rectangular_grid(meshKernelId, makeGridParameters);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    errorCode = mkapi::mkernel_curvilinear_convert_to_mesh2d(meshKernelId);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    int edgeLengthId = -1;
+    errorCode = mkapi::mkernel_mesh2d_get_edge_length_property_type(edgeLengthId);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    const int locationId = static_cast<int>(meshkernel::Location::Edges);
+
+    int dimension = -1;
+    errorCode = mkapi::mkernel_mesh2d_get_property_dimension(meshKernelId, edgeLengthId, locationId, dimension);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    const auto getEdgeLengths = [&]()
+    {
+        std::vector<double> values(dimension, -1.0);
+        mkapi::GeometryList propertyData{};
+        propertyData.num_coordinates = dimension;
+        propertyData.values = values.data();
+
+        EXPECT_EQ(mk::ExitCode::Success, mkapi::mkernel_mesh2d_get_property(meshKernelId, edgeLengthId, locationId, propertyData));
+        return values;
+    };
+
+    const std::vector<double> initialLengths = getEdgeLengths();
+
+    for (const double length : initialLengths)
+    {
+        EXPECT_NEAR(1.0, length, 1.0e-12);
+    }
+
+    // Requesting the property again on the same mesh gives the cached results
+    EXPECT_EQ(initialLengths, getEdgeLengths());
+
+    // Moving a node changes the lengths of its edges
+    errorCode = mkapi::mkernel_mesh2d_move_node(meshKernelId, 1.5, 1.5, 5);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+
+    const std::vector<double> movedLengths = getEdgeLengths();
+    const auto numberOfChangedLengths = std::ranges::count_if(std::views::iota(0, dimension),
+                                                              [&](int e)
+                                                              { return std::abs(movedLengths[e] - initialLengths[e]) > 1.0e-12; });
+    EXPECT_EQ(4, numberOfChangedLengths);
+
+    // Undoing the move gives the initial lengths again
+    bool undone = false;
+    int undoId = meshkernel::constants::missing::intValue;
+    errorCode = mkapi::mkernel_undo_state(undone, undoId);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+    ASSERT_TRUE(undone);
+
+    const std::vector<double> restoredLengths = getEdgeLengths();
+
+    for (int e = 0; e < dimension; ++e)
+    {
+        EXPECT_NEAR(initialLengths[e], restoredLengths[e], 1.0e-12);
+    }
+
+    errorCode = mkapi::mkernel_deallocate_state(meshKernelId);
+    ASSERT_EQ(mk::ExitCode::Success, errorCode);
+}
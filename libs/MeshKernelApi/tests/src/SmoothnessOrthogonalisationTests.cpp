@@ -178,6 +178,72 @@ TEST_F(CartesianApiTestFixture, ComputeOrthogonalizationMesh2D_WithOrthogonalMes
     ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
 }
 
+TEST_F(CartesianApiTestFixture, ComputeOrthogonalizationMesh2D_WithDisplacementTolerance_ShouldGetResiduals)
+{
+    // Prepare
+    MakeMesh();
+    auto const meshKernelId = GetMeshKernelId();
+
+    meshkernel::OrthogonalizationParameters orthogonalizationParameters;
+    orthogonalizationParameters.outer_iterations = 2;
+    orthogonalizationParameters.boundary_iterations = 25;
+    orthogonalizationParameters.inner_iterations = 25;
+    orthogonalizationParameters.displacement_tolerance = 1.0e-6;
+    meshkernelapi::GeometryList polygons{};
+    meshkernelapi::GeometryList landBoundaries{};
+
+    // Execute
+    auto errorCode = mkernel_mesh2d_compute_orthogonalization(meshKernelId, 1, orthogonalizationParameters, polygons, landBoundaries);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+
+    int numResiduals = 0;
+    errorCode = meshkernelapi::mkernel_mesh2d_get_orthogonalization_residuals_dimension(meshKernelId, numResiduals);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+
+    std::vector<double> residuals(numResiduals);
+    errorCode = meshkernelapi::mkernel_mesh2d_get_orthogonalization_residuals(meshKernelId, residuals.data());
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+
+    // Assert: the mesh is already orthogonal, the iterations stop well before the iteration budget
+    ASSERT_GT(numResiduals, 0);
+    EXPECT_LT(numResiduals, 2 * 25 * 25);
+    EXPECT_LE(residuals.back(), orthogonalizationParameters.displacement_tolerance);
+}
+
+TEST_F(CartesianApiTestFixture, OrthogonalizationThroughApi_ShouldRecordResidualOfEachInnerIteration)
+{
+    // Prepare
+    MakeMesh();
+    auto const meshKernelId = GetMeshKernelId();
+
+    meshkernel::OrthogonalizationParameters orthogonalizationParameters{};
+    meshkernelapi::GeometryList polygons{};
+    meshkernelapi::GeometryList landBoundaries{};
+
+    auto errorCode = mkernel_mesh2d_initialize_orthogonalization(meshKernelId, 1, orthogonalizationParameters, polygons, landBoundaries);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+
+    errorCode = meshkernelapi::mkernel_mesh2d_prepare_outer_iteration_orthogonalization(meshKernelId);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+
+    // Execute
+    constexpr int numInnerIterations = 3;
+    for (int i = 0; i < numInnerIterations; ++i)
+    {
+        errorCode = meshkernelapi::mkernel_mesh2d_compute_inner_ortogonalization_iteration(meshKernelId);
+        ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+    }
+
+    // Assert
+    int numResiduals = 0;
+    errorCode = meshkernelapi::mkernel_mesh2d_get_orthogonalization_residuals_dimension(meshKernelId, numResiduals);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+    ASSERT_EQ(numInnerIterations, numResiduals);
+
+    errorCode = meshkernelapi::mkernel_mesh2d_delete_orthogonalization(meshKernelId);
+    ASSERT_EQ(meshkernel::ExitCode::Success, errorCode);
+}
+
 TEST_F(CartesianApiTestFixture, GetOrthogonalityMesh2D_OnMesh2D_ShouldGetOrthogonality)
 {
     // Prepare